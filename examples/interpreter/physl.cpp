@@ -261,6 +261,9 @@ int handle_command_line(int argc, char* argv[], po::variables_map& vm)
                 "is to be executed to a file")
             ("dump-counters", po::value<std::string>(), "Write the performance "
                 "counter CSV data code to a file")
+            ("compilation-cache", po::value<std::string>(), "file to cache "
+                "the compilation results in, speeds up subsequent runs of the "
+                "same code")
             ("dry-run", "Perform all other options requested but do not "
                 "actually run the code")
             ("time", "Print overall execution time before exiting")
@@ -421,7 +424,8 @@ phylanx::execution_tree::compiler::result_type compile_and_run(
     std::vector<phylanx::ast::expression> const& ast,
     std::vector<std::string> const& positional_args,
     phylanx::execution_tree::compiler::function_list& snippets,
-    std::string const& code_source_name, bool dry_run, bool print_time)
+    std::string const& code_source_name, std::string const& cache_file,
+    bool dry_run, bool print_time)
 {
     phylanx::execution_tree::compiler::environment env =
         phylanx::execution_tree::compiler::default_environment();
@@ -438,8 +442,10 @@ phylanx::execution_tree::compiler::result_type compile_and_run(
     phylanx::execution_tree::eval_context ctx;
     def.run(ctx);
 
-    auto const& code =
-        phylanx::execution_tree::compile(code_source_name, ast, snippets, env);
+    auto const& code = cache_file.empty() ?
+        phylanx::execution_tree::compile(code_source_name, ast, snippets, env) :
+        phylanx::execution_tree::compile_cached(code_source_name,
+            code_source_name, ast, cache_file, snippets, env);
 
     // Re-init all performance counters to guarantee correct measurement
     // results if those are requested on the command line.
@@ -470,7 +476,8 @@ phylanx::execution_tree::compiler::result_type compile_and_run(
 void print_performance_counter_data_csv(std::ostream& os)
 {
     // CSV Header
-    os << "primitive_instance,display_name,count,time,eval_direct\n";
+    os << "primitive_instance,display_name,count,time,eval_direct,"
+          "transferred_bytes,copied_bytes,moved_bytes,reused_bytes\n";
 
     // Print performance data
     for (auto const& entry : phylanx::util::retrieve_counter_data())
@@ -674,9 +681,21 @@ void interpreter(po::variables_map const& vm)
         dump_physl_code(ast, physl_file);
     }
 
+    std::string cache_file;
+    if (vm.count("compilation-cache") != 0)
+    {
+        cache_file = vm["compilation-cache"].as<std::string>();
+    }
+
+    // Attribute the node_data copies, moves, and reuses to the primitives
+    // while the performance data is collected
+    phylanx::ir::reset_enable_counts_on_exit counts(
+        vm.count("performance") != 0);
+
     phylanx::execution_tree::compiler::function_list snippets;
     auto const result = compile_and_run(ast, positional_args, snippets,
-        code_source_name, vm.count("dry-run") != 0, vm.count("time") != 0);
+        code_source_name, cache_file, vm.count("dry-run") != 0,
+        vm.count("time") != 0);
 
     // Print the result of the last PhySL expression, and to the specified file,
     // if requested
@@ -21,6 +21,7 @@
 namespace phylanx { namespace execution_tree {
     ////////////////////////////////////////////////////////////////////////////
     struct annotation;
+    struct localities_information;
 
     PHYLANX_EXPORT primitive_argument_type as_primitive_argument_type(
         annotation&& ann);
@@ -38,6 +39,31 @@ namespace phylanx { namespace execution_tree {
     public:
         annotation() = default;
 
+        annotation(annotation const& rhs)
+          : data_(rhs.data_)
+          , localities_(std::atomic_load(&rhs.localities_))
+        {
+        }
+        annotation(annotation&& rhs) noexcept
+          : data_(std::move(rhs.data_))
+          , localities_(std::move(rhs.localities_))
+        {
+        }
+
+        annotation& operator=(annotation const& rhs)
+        {
+            data_ = rhs.data_;
+            std::atomic_store(
+                &localities_, std::atomic_load(&rhs.localities_));
+            return *this;
+        }
+        annotation& operator=(annotation&& rhs) noexcept
+        {
+            data_ = std::move(rhs.data_);
+            std::atomic_store(&localities_, std::move(rhs.localities_));
+            return *this;
+        }
+
         explicit annotation(ir::range const& rhs)
           : data_(rhs)
         {
@@ -61,11 +87,13 @@ namespace phylanx { namespace execution_tree {
         annotation& operator=(ir::range const& rhs)
         {
             data_ = rhs;
+            invalidate_localities_information();
             return *this;
         }
         annotation& operator=(ir::range&& rhs)
         {
             data_ = std::move(rhs);
+            invalidate_localities_information();
             return *this;
         }
 
@@ -76,6 +104,8 @@ namespace phylanx { namespace execution_tree {
 
         ir::range& get_range()
         {
+            // the data may be modified through the returned reference
+            invalidate_localities_information();
             return data_;
         }
         ir::range const& get_range() const
@@ -121,8 +151,30 @@ namespace phylanx { namespace execution_tree {
         PHYLANX_EXPORT void increment_generation(
             std::string const& name, std::string const& codename);
 
+        // The tiling information described by this annotation is parsed only
+        // once (see get_localities_information), the parsed (immutable)
+        // information is shared by all copies of this annotation. Any
+        // modification of the annotation discards the parsed information.
+        std::shared_ptr<localities_information const>
+        cached_localities_information() const
+        {
+            return std::atomic_load(&localities_);
+        }
+        void cache_localities_information(
+            std::shared_ptr<localities_information const> info) const
+        {
+            std::atomic_store(&localities_, std::move(info));
+        }
+
     private:
+        void invalidate_localities_information()
+        {
+            std::atomic_store(&localities_,
+                std::shared_ptr<localities_information const>());
+        }
+
         ir::range data_;
+        mutable std::shared_ptr<localities_information const> localities_;
 
         friend class hpx::serialization::access;
 
@@ -116,6 +116,28 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets,
         hpx::id_type const& default_locality = hpx::find_here());
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Compile a given expression into a function. Reuse the given compilation
+    /// environment. The compilation results are cached in the given file:
+    /// if the file holds a valid cache entry for the given expression, the
+    /// expression is neither parsed nor matched against the list of known
+    /// patterns. The cache entry is (re-)written otherwise.
+    PHYLANX_EXPORT compiler::entry_point const& compile_cached(
+        std::string const& name, std::string const& func_name,
+        std::string const& expr, std::string const& cache_file,
+        compiler::function_list& snippets, compiler::environment& env,
+        hpx::id_type const& default_locality = hpx::find_here());
+
+    /// Compile the given AST into a function using the cache stored in the
+    /// given file. A valid cache entry allows to skip matching the AST
+    /// against the list of known patterns.
+    PHYLANX_EXPORT compiler::entry_point const& compile_cached(
+        std::string const& name, std::string const& func_name,
+        std::vector<ast::expression> const& exprs,
+        std::string const& cache_file, compiler::function_list& snippets,
+        compiler::environment& env,
+        hpx::id_type const& default_locality = hpx::find_here());
+
     ///////////////////////////////////////////////////////////////////////////
     /// Add the given variable to the compilation environment
     PHYLANX_EXPORT compiler::function define_variable(
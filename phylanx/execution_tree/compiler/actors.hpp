@@ -634,10 +634,14 @@ namespace phylanx { namespace execution_tree { namespace compiler
         entry_point_set::iterator last_inserted_;
     };
 
+    class compilation_cache;
+    class pattern_index;
+
     struct function_list
     {
         function_list()
           : compile_id_(0)
+          , cache_(nullptr)
         {}
 
         function_list(function_list const&) = delete;
@@ -649,6 +653,10 @@ namespace phylanx { namespace execution_tree { namespace compiler
         std::size_t compile_id_;    // sequence number of this compiler invocation
         program program_;           // storage for top-level code
         std::map<std::string, std::size_t> sequence_numbers_;
+        compilation_cache* cache_;  // optional, used by the current compilation
+
+        // dispatch index for the patterns used by the current compilation
+        std::shared_ptr<pattern_index const> index_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
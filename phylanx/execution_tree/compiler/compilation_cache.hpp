@@ -0,0 +1,102 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_COMPILATION_CACHE_HPP)
+#define PHYLANX_EXECUTION_TREE_COMPILATION_CACHE_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/execution_tree/compiler/compiler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A persistent (on-disk) cache of the results of compiling a piece of
+    // PhySL code. It stores the AST of the code and, for each expression, the
+    // pattern the compiler has selected for it. A valid cache entry allows to
+    // compile the code without parsing it and without searching the list of
+    // known patterns.
+    //
+    // Cache entries are keyed by a hash of the source code and a hash of all
+    // known patterns (i.e. of the set of loaded plugins), entries written by
+    // a different version of the cache format are ignored.
+    class compilation_cache
+    {
+    public:
+        static constexpr std::uint32_t version = 1;
+
+        PHYLANX_EXPORT compilation_cache(std::string const& source,
+            expression_pattern_list const& patterns);
+
+        // Load the cache entry stored in the given file, returns false if the
+        // file does not exist or if it does not match the source code or the
+        // patterns this cache was created for.
+        PHYLANX_EXPORT bool load(std::string const& filename);
+
+        // Write the cache entry to the given file
+        PHYLANX_EXPORT void save(std::string const& filename) const;
+
+        // AST of the cached source code
+        std::vector<ast::expression> const& ast() const
+        {
+            return ast_;
+        }
+        void ast(std::vector<ast::expression> ast)
+        {
+            ast_ = std::move(ast);
+        }
+
+        // The cache can be used only with the list of patterns it was
+        // created for
+        bool uses_patterns(expression_pattern_list const& patterns) const
+        {
+            return &patterns == &patterns_;
+        }
+
+        // Look up the pattern that was selected for the given expression.
+        // Returns false if the expression is not known, otherwise 'it' refers
+        // to the selected pattern (or is the end iterator if no pattern
+        // matched the expression).
+        PHYLANX_EXPORT bool find_pattern(ast::expression const& expr,
+            std::string const& name,
+            expression_pattern_list::const_iterator& it) const;
+
+        // Record the pattern selected for the given expression
+        PHYLANX_EXPORT void add_pattern(ast::expression const& expr,
+            std::string const& name,
+            expression_pattern_list::const_iterator it);
+
+    private:
+        // Expressions are identified by their position in the source code,
+        // the name of the invoked function (if any), and the number of
+        // operations they consist of (subexpressions may start at the same
+        // position as the enclosing expression).
+        using key_type = std::tuple<std::int64_t, std::int64_t, std::string,
+            std::size_t>;
+
+        static bool make_key(ast::expression const& expr,
+            std::string const& name, key_type& key);
+
+        std::uint64_t source_hash_;
+        std::uint64_t patterns_hash_;
+        expression_pattern_list const& patterns_;
+        std::vector<expression_pattern_list::const_iterator> index_;
+        std::unordered_map<expression_pattern const*, std::size_t> positions_;
+
+        std::vector<ast::expression> ast_;
+        std::map<key_type, std::size_t> selected_patterns_;
+    };
+}}}
+
+#endif
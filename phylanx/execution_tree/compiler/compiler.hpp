@@ -10,6 +10,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/ast/detail/is_placeholder_ellipses.hpp>
+#include <phylanx/ast/node.hpp>
 #include <phylanx/execution_tree/compiler/actors.hpp>
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
@@ -25,6 +26,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -80,16 +82,76 @@ namespace phylanx { namespace execution_tree { namespace compiler
             return false;
         }
 
+        // returns whether this pattern could match a function call with the
+        // given number of arguments
+        bool accepts_arguments(std::size_t num_args) const
+        {
+            if (!is_function_call_)
+            {
+                return true;
+            }
+            return is_variadic_ ? num_args >= num_args_ : num_args == num_args_;
+        }
+
         std::string pattern_;               // pattern
         ast::expression pattern_ast_;       // simplified pattern AST (no arg())
         factory_function_type creator_;     // creator function for the primitive
         std::vector<std::string> args_;     // argument names
         std::vector<std::string> defaults_; // default values
+
+        // pre-parsed default values (empty if no default value is available)
+        std::vector<ast::expression> default_values_;
+
+        // dispatch information derived from pattern_ast_
+        bool is_function_call_;             // pattern is a function call
+        bool is_variadic_;                  // pattern has trailing ellipses
+        std::size_t num_args_;              // number of (leading) arguments
     };
 
     using expression_pattern_list =
         std::multimap<std::string, expression_pattern>;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Index of a list of patterns allowing to find the patterns that could
+    // match an expression without searching the whole list. Function calls
+    // are dispatched on the function name (and the number of arguments, see
+    // expression_pattern::accepts_arguments), all other expressions have to
+    // be matched against the patterns that are not function calls only.
+    class pattern_index
+    {
+    public:
+        using candidates_type =
+            std::vector<expression_pattern_list::const_iterator>;
+
+        PHYLANX_EXPORT explicit pattern_index(
+            expression_pattern_list const& patterns);
+
+        // Patterns registered for the given name, in the order they appear in
+        // the indexed list
+        PHYLANX_EXPORT candidates_type const& functions(
+            std::string const& name) const;
+
+        // Patterns that are not function calls (e.g. operators), in the order
+        // they appear in the indexed list
+        candidates_type const& operators() const
+        {
+            return operators_;
+        }
+
+        // The index is valid for the list it was created for as long as no
+        // patterns are added to the list
+        bool indexes(expression_pattern_list const& patterns) const
+        {
+            return &patterns == patterns_ && patterns.size() == size_;
+        }
+
+    private:
+        expression_pattern_list const* patterns_;
+        std::size_t size_;
+        std::unordered_map<std::string, candidates_type> functions_;
+        candidates_type operators_;
+    };
+
     PHYLANX_EXPORT expression_pattern_list const& generate_patterns();
 
     /// Create default compilation environment based on the given list of
@@ -238,7 +300,8 @@ namespace phylanx { namespace execution_tree { namespace compiler
 
         function operator()(argument_type && arg,
             primitive_name_parts&& name_parts,
-            std::string const& codename = "<unknown>") const
+            std::string const& codename = "<unknown>",
+            variable_slot const& slot = variable_slot{}) const
         {
             if (name_parts.primitive != type_)
             {
@@ -247,10 +310,17 @@ namespace phylanx { namespace execution_tree { namespace compiler
                 name_parts.primitive = type_;
             }
 
+            primitive_arguments_type fargs;
+            fargs.reserve(2);
+
+            fargs.emplace_back(std::move(arg));
+            fargs.emplace_back(variable_slot_operand(slot));
+
             std::string full_name = compose_primitive_name(name_parts);
             return function{primitive_argument_type{
                 create_primitive_component(this->locality_,
-                    name_parts.primitive, std::move(arg), full_name, codename)
+                    name_parts.primitive, std::move(fargs), full_name,
+                    codename)
                 }, full_name};
         }
 
@@ -366,6 +436,16 @@ namespace phylanx { namespace execution_tree { namespace compiler
         function compose(std::list<function>&& elements,
             primitive_name_parts&& name_parts,
             std::string const& codename) const
+        {
+            return compose(std::move(elements), std::move(name_parts),
+                codename, variable_slot{});
+        }
+
+        // slot is the location of the target in the frames as resolved by
+        // the compiler for the point of access
+        function compose(std::list<function>&& elements,
+            primitive_name_parts&& name_parts, std::string const& codename,
+            variable_slot const& slot) const
         {
             if (name_parts.instance.empty())
             {
@@ -374,22 +454,12 @@ namespace phylanx { namespace execution_tree { namespace compiler
             name_parts.primitive = target_name_;
 
             std::string full_name = compose_primitive_name(name_parts);
-            if (elements.empty())
-            {
-                auto p = create_primitive_component(this->locality_,
-                    name_parts.primitive, f_.get().arg_, full_name, codename);
-
-                auto f =
-                    function{primitive_argument_type{std::move(p)}, full_name};
-                f.set_named_args(f_.get().named_args_, f_.get().num_named_args_);
-
-                return f;
-            }
 
             primitive_arguments_type fargs;
-            fargs.reserve(elements.size() + 1);
+            fargs.reserve(elements.size() + 2);
 
             fargs.push_back(f_.get().arg_);
+            fargs.emplace_back(variable_slot_operand(slot));
             for (auto&& arg : elements)
             {
                 fargs.emplace_back(std::move(arg.arg_));
@@ -468,6 +538,13 @@ namespace phylanx { namespace execution_tree { namespace compiler
             std::string codename_;
         };
 
+        // the arguments and the body of a function defined in PhySL
+        struct function_ast
+        {
+            std::vector<ast::expression> args_;
+            ast::expression body_;
+        };
+
     private:
         using map_type = std::map<util::hashed_string, definition_data>;
         using iterator = map_type::iterator;
@@ -475,11 +552,14 @@ namespace phylanx { namespace execution_tree { namespace compiler
         using value_type = map_type::value_type;
 
     public:
+        // new_frame is true for environments representing the body of a
+        // function, which is evaluated using a new frame for its variables
         environment(environment* outer = nullptr, std::size_t arg_num = 0,
-            std::int64_t var_num = 0)
+            bool new_frame = false)
           : outer_(outer)
           , base_arg_num_(
                 outer != nullptr ? outer->base_arg_num_ + arg_num : arg_num)
+          , new_frame_(outer == nullptr || new_frame)
         {}
 
         template <typename F>
@@ -506,6 +586,7 @@ namespace phylanx { namespace execution_tree { namespace compiler
                 }
                 definitions_.erase(existing);
             }
+            function_asts_.erase(name);
 
             auto result = definitions_.emplace(value_type(std::move(name),
                 definition_data{compiled_function(std::forward<F>(f)), line,
@@ -569,6 +650,39 @@ namespace phylanx { namespace execution_tree { namespace compiler
             return nullptr;
         }
 
+        // Remember the arguments and the body of the function of the given
+        // name, this is used to derive new code from it (see grad())
+        void define_function_ast(std::string const& name,
+            std::vector<ast::expression> args, ast::expression body,
+            bool define_globally = false)
+        {
+            environment* env = define_globally ? outermost_environment() : this;
+            env->function_asts_[name] =
+                function_ast{std::move(args), std::move(body)};
+        }
+
+        // Return the arguments and the body of the function visible under the
+        // given name, if any
+        function_ast const* find_function_ast(std::string const& name) const
+        {
+            environment const* env = this;
+            while (env != nullptr && !env->was_defined_in_scope(name))
+            {
+                env = env->outer_;
+            }
+            if (env == nullptr)
+            {
+                return nullptr;
+            }
+
+            auto it = env->function_asts_.find(name);
+            if (it == env->function_asts_.end())
+            {
+                return nullptr;
+            }
+            return &it->second;
+        }
+
         environment* parent() const { return outer_; }
 
         std::size_t size() const
@@ -586,10 +700,106 @@ namespace phylanx { namespace execution_tree { namespace compiler
             return base_arg_num_;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // All variables defined in the environments belonging to the same
+        // frame (at runtime) are stored in the flat array of variables of
+        // that frame. Return the slot assigned to the given variable.
+        variable_slot define_slot(
+            std::string const& name, bool define_globally = false)
+        {
+            environment* env =
+                define_globally ? outermost_environment() : frame_environment();
+
+            auto it = env->slots_.find(name);
+            if (it == env->slots_.end())
+            {
+                std::int64_t index =
+                    static_cast<std::int64_t>(env->slots_.size());
+                it = env->slots_.emplace(name, index).first;
+            }
+
+            return variable_slot(define_globally ?
+                    variable_slot::outermost_frame :
+                    variable_slot::current_frame,
+                it->second);
+        }
+
+        // Return the location of the given variable as seen from this
+        // environment. Only variables stored in the current frame can be
+        // resolved, all others are looked up by name at runtime (frames are
+        // chained following the callers, a caller might shadow a variable
+        // of an enclosing frame).
+        variable_slot resolve_slot(std::string const& name) const
+        {
+            environment const* env = this;
+            while (env != nullptr && !env->was_defined_in_scope(name))
+            {
+                env = env->outer_;
+            }
+            if (env == nullptr)
+            {
+                return variable_slot{};
+            }
+
+            environment const* frame = env->frame_environment();
+            auto it = frame->slots_.find(name);
+            if (it == frame->slots_.end())
+            {
+                return variable_slot{};     // function argument or built-in
+            }
+
+            if (frame == frame_environment())
+            {
+                return variable_slot(variable_slot::current_frame, it->second);
+            }
+            return variable_slot{};
+        }
+
+        // number of slots needed by the frames created for this environment
+        std::size_t num_slots() const
+        {
+            return frame_environment()->slots_.size();
+        }
+
+    private:
+        environment* frame_environment()
+        {
+            environment* env = this;
+            while (!env->new_frame_)
+            {
+                env = env->outer_;
+            }
+            return env;
+        }
+        environment const* frame_environment() const
+        {
+            environment const* env = this;
+            while (!env->new_frame_)
+            {
+                env = env->outer_;
+            }
+            return env;
+        }
+
+        environment* outermost_environment()
+        {
+            environment* env = this;
+            while (env->outer_ != nullptr)
+            {
+                env = env->outer_;
+            }
+            return env;
+        }
+
     private:
         environment* outer_;
         map_type definitions_;
         std::size_t base_arg_num_;
+
+        bool new_frame_;
+        std::map<std::string, std::int64_t> slots_;
+
+        std::map<std::string, function_ast> function_asts_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
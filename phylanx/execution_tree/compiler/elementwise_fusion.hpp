@@ -0,0 +1,72 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_ELEMENTWISE_FUSION_HPP)
+#define PHYLANX_EXECUTION_TREE_ELEMENTWISE_FUSION_HPP
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Chains of elementwise primitives (for instance
+    // '__add(__mul(a, b), sigmoid(c))') are collapsed by the compiler into a
+    // single '__fused_elementwise' primitive. The fused primitive receives
+    // the non-fusable leaves of the expression as its operands and a program
+    // describing the expression tree in postfix order as its first operand.
+    //
+    // The program is a sequence of (opcode, argument) pairs, where argument
+    // is the leaf index for 'load' and the number of consumed stack entries
+    // for all other opcodes.
+    enum class fused_opcode : std::int64_t
+    {
+        load = 0,       // push leaf
+        add = 1,        // __add(_1, __2)
+        sub = 2,        // __sub(_1, __2)
+        mul = 3,        // __mul(_1, __2)
+        div = 4,        // __div(_1, __2)
+        minus = 5,      // __minus(_1)
+        square = 6,     // square(_1), retains the argument type
+        exp = 7,        // exp(_1), floating point result
+        log = 8,        // log(_1), floating point result
+        sqrt = 9,       // sqrt(_1), floating point result
+        tanh = 10,      // tanh(_1), floating point result
+        sigmoid = 11,   // sigmoid(_1), floating point result
+
+        last = sigmoid
+    };
+
+    struct fusable_operation
+    {
+        char const* name_;
+        fused_opcode opcode_;
+        std::size_t min_arity_;
+        std::size_t max_arity_;
+    };
+
+    // Return the description of the elementwise operation with the given
+    // name, returns nullptr if the named primitive can't be fused.
+    PHYLANX_EXPORT fusable_operation const* find_fusable_operation(
+        std::string const& name);
+
+    // Return the description of the elementwise operation represented by the
+    // given opcode, returns nullptr for 'load'.
+    PHYLANX_EXPORT fusable_operation const* find_fusable_operation(
+        fused_opcode op);
+
+    // Return whether the given opcode always produces floating point results,
+    // single precision arguments produce single precision results
+    PHYLANX_EXPORT bool is_float_fused_opcode(fused_opcode op);
+
+    // Return whether elementwise fusion is enabled (configuration setting
+    // 'phylanx.fuse_elementwise', defaults to '1')
+    PHYLANX_EXPORT bool fuse_elementwise_operations();
+}}}
+
+#endif
@@ -0,0 +1,42 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_REVERSE_MODE_HPP)
+#define PHYLANX_EXECUTION_TREE_REVERSE_MODE_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/execution_tree/compiler/compiler.hpp>
+
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // 'grad(f, wrt)' is handled by the compiler as a source transformation of
+    // the PhySL function 'f' into a new function accepting the same
+    // arguments. The generated body evaluates the body of 'f' while keeping
+    // every intermediate result depending on the arguments listed in 'wrt'
+    // in a variable (the tape), followed by the evaluation of the adjoint of
+    // each taped primitive in reverse order. Intermediate results and
+    // adjoints are released (set to nil) right after their last use.
+    //
+    // The generated function returns the gradient of the result of 'f' with
+    // respect to the single argument named by 'wrt' or a list of gradients
+    // if 'wrt' is a list of argument names (return_list is true).
+    //
+    // The supported subset of PhySL consists of (nested) blocks, define()
+    // and store() of variables, and invocations of primitives with a known
+    // adjoint rule. Code not depending on the arguments in 'wrt' is used
+    // unchanged.
+    PHYLANX_EXPORT ast::expression generate_gradient(
+        std::vector<ast::expression> const& args, ast::expression const& body,
+        std::vector<std::string> const& wrt, bool return_list,
+        pattern_index const& patterns, std::string const& codename,
+        ast::tagged const& id);
+}}}
+
+#endif
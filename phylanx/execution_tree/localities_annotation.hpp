@@ -19,6 +19,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -71,6 +72,11 @@ namespace phylanx { namespace execution_tree
         bool is_column_tiled(
             std::string const& name, std::string const& codename) const;
 
+        // make sure the tile information matches the dimensions of the given
+        // array
+        void check_dimensions(primitive_argument_type const& arg,
+            std::string const& name, std::string const& codename) const;
+
         locality_information locality_;
         annotation_information annotation_;
         std::vector<tiling_information> tiles_;
@@ -79,6 +85,13 @@ namespace phylanx { namespace execution_tree
     PHYLANX_EXPORT localities_information extract_localities_information(
         primitive_argument_type const& arg,
         std::string const& name, std::string const& codename);
+
+    // Return the tiling information of the given array. The 'localities'
+    // annotation of the array is parsed only once, the returned (immutable)
+    // descriptor is shared by all arrays that carry the same annotation.
+    PHYLANX_EXPORT std::shared_ptr<localities_information const>
+    get_localities_information(primitive_argument_type const& arg,
+        std::string const& name, std::string const& codename);
 }}
 
 #endif
@@ -285,6 +285,42 @@ namespace phylanx { namespace execution_tree
         std::string const& name = "",
         std::string const& codename = "<unknown>");
 
+    // Return whether the given argument holds sparse (compressed) data
+    PHYLANX_EXPORT bool is_sparse_operand(primitive_argument_type const& val);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract a ir::node_data<float> type from a given primitive_argument_type,
+    // throw if it doesn't hold one.
+    PHYLANX_EXPORT ir::node_data<float> extract_float_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float> extract_float_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT ir::node_data<float> extract_float_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float>&& extract_float_value_strict(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT float extract_scalar_float_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT float extract_scalar_float_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT bool is_float_operand_strict(
+        primitive_argument_type const& val);
+
     ///////////////////////////////////////////////////////////////////////////
     // Extract a ir::node_data<std::uint8_t> type from a given
     // primitive_argument_type, throw if it doesn't hold one.
@@ -311,6 +347,15 @@ namespace phylanx { namespace execution_tree
         std::string const& name = "",
         std::string const& codename = "<unknown>");
 
+    // Represent the location of a variable as resolved by the compiler as an
+    // operand of the primitives defining or accessing the variable
+    PHYLANX_EXPORT primitive_argument_type variable_slot_operand(
+        variable_slot const& slot);
+    PHYLANX_EXPORT variable_slot extract_variable_slot(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
     // Extract an integer value from a primitive_argument_type
     PHYLANX_EXPORT hpx::future<ir::node_data<std::int64_t>> integer_operand(
         primitive_argument_type const& val,
@@ -529,6 +574,13 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value(val, name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float_value(val, name, codename);
+    }
 
     template <typename T>
     ir::node_data<T> extract_node_data(primitive_argument_type&& val,
@@ -556,6 +608,13 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value(std::move(val), name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float_value(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -584,6 +643,13 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value_strict(val, name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float_value_strict(val, name, codename);
+    }
 
     template <typename T>
     ir::node_data<T> extract_node_data_strict(primitive_argument_type&& val,
@@ -611,6 +677,13 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value_strict(std::move(val), name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float_value_strict(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -636,6 +709,12 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value(val, name, codename);
     }
+    template <>
+    inline float extract_scalar_data(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        return extract_scalar_float_value(val, name, codename);
+    }
 
     template <typename T>
     T extract_scalar_data(primitive_argument_type&& val,
@@ -660,6 +739,12 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value(std::move(val), name, codename);
     }
+    template <>
+    inline float extract_scalar_data(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return extract_scalar_float_value(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -687,6 +772,13 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value_strict(val, name, codename);
     }
+    template <>
+    inline float extract_scalar_data_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_scalar_float_value_strict(val, name, codename);
+    }
 
     template <typename T>
     T extract_scalar_data_strict(primitive_argument_type&& val,
@@ -716,6 +808,14 @@ namespace phylanx { namespace execution_tree
         return extract_scalar_boolean_value_strict(
             std::move(val), name, codename);
     }
+    template <>
+    inline float extract_scalar_data_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_scalar_float_value_strict(
+            std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     // Extract a std::string type from a given primitive_argument_type,
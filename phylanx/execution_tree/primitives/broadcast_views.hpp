@@ -0,0 +1,199 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_BROADCAST_VIEWS_HPP)
+#define PHYLANX_EXECUTION_TREE_BROADCAST_VIEWS_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+
+// Broadcasting of vectors and matrices without materializing the broadcast
+// operand. Instead of copying the smaller operand into every element, row, or
+// column of a newly allocated array, the given function is invoked with a
+// lazy Blaze view of the operand that has the requested shape: scalars are
+// represented as uniform vectors or matrices, rows and columns are replicated
+// using blaze::expand (i.e. with a stride of zero).
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f with the given data broadcast to a vector of the given size
+    template <typename T, typename F>
+    auto broadcast_vector_view(ir::node_data<T> const& data, std::size_t size,
+        F&& f, std::string const& name, std::string const& codename)
+        -> decltype(f(data.vector()))
+    {
+        switch (data.num_dimensions())
+        {
+        case 0:
+            return f(blaze::UniformVector<T>(size, data.scalar()));
+
+        case 1:
+            if (data.size() == size)
+            {
+                return f(data.vector());
+            }
+
+            // vectors of size one can be broadcast into any vector
+            if (data.size() == 1)
+            {
+                return f(blaze::UniformVector<T>(size, data[0]));
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::broadcast_vector_view",
+                util::generate_error_message(
+                    "cannot broadcast a vector into a vector of a different "
+                    "size",
+                    name, codename));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::broadcast_vector_view",
+            util::generate_error_message(
+                "cannot broadcast an array with more than one dimension into "
+                "a vector",
+                name, codename));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f with the given data broadcast to a matrix of the given shape
+    template <typename T, typename F>
+    auto broadcast_matrix_view(ir::node_data<T> const& data, std::size_t rows,
+        std::size_t columns, F&& f, std::string const& name,
+        std::string const& codename) -> decltype(f(data.matrix()))
+    {
+        switch (data.num_dimensions())
+        {
+        case 0:
+            return f(blaze::UniformMatrix<T>(rows, columns, data.scalar()));
+
+        case 1:
+            {
+                // vectors of size one can be broadcast into any matrix
+                if (data.size() == 1)
+                {
+                    return f(blaze::UniformMatrix<T>(rows, columns, data[0]));
+                }
+
+                // vectors are broadcast into each of the rows
+                if (data.size() == columns)
+                {
+                    return f(blaze::expand(blaze::trans(data.vector()), rows));
+                }
+
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::broadcast_matrix_view",
+                    util::generate_error_message(
+                        "cannot broadcast a vector into a matrix with a "
+                        "different number of columns",
+                        name, codename));
+            }
+
+        case 2:
+            {
+                std::size_t data_rows = data.dimension(0);
+                std::size_t data_columns = data.dimension(1);
+
+                if (data_rows == rows && data_columns == columns)
+                {
+                    return f(data.matrix());
+                }
+
+                // matrices of size one can be broadcast into any other matrix
+                if (data.size() == 1)
+                {
+                    return f(
+                        blaze::UniformMatrix<T>(rows, columns, data.at(0, 0)));
+                }
+
+                // matrices with one row can be broadcast into any other
+                // matrix with the same number of columns
+                auto m = data.matrix();
+                if (data_rows == 1 && data_columns == columns)
+                {
+                    return f(blaze::expand(blaze::row(m, 0), rows));
+                }
+
+                // matrices with one column can be broadcast into any other
+                // matrix with the same number of rows
+                if (data_columns == 1 && data_rows == rows)
+                {
+                    return f(blaze::expand(blaze::column(m, 0), columns));
+                }
+
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::broadcast_matrix_view",
+                    util::generate_error_message(
+                        "cannot broadcast a matrix into a differently sized "
+                        "matrix",
+                        name, codename));
+            }
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::broadcast_matrix_view",
+            util::generate_error_message(
+                "cannot broadcast an array with more than two dimensions into "
+                "a matrix",
+                name, codename));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f with both operands broadcast to the same vector or matrix shape
+    template <typename T, typename F>
+    auto broadcast_vector_views(ir::node_data<T> const& lhs,
+        ir::node_data<T> const& rhs, std::size_t size, F&& f,
+        std::string const& name, std::string const& codename)
+        -> decltype(f(lhs.vector(), rhs.vector()))
+    {
+        return broadcast_vector_view(lhs, size,
+            [&](auto const& l)
+            {
+                return broadcast_vector_view(rhs, size,
+                    [&](auto const& r)
+                    {
+                        return f(l, r);
+                    },
+                    name, codename);
+            },
+            name, codename);
+    }
+
+    template <typename T, typename F>
+    auto broadcast_matrix_views(ir::node_data<T> const& lhs,
+        ir::node_data<T> const& rhs, std::size_t rows, std::size_t columns,
+        F&& f, std::string const& name, std::string const& codename)
+        -> decltype(f(lhs.matrix(), rhs.matrix()))
+    {
+        return broadcast_matrix_view(lhs, rows, columns,
+            [&](auto const& l)
+            {
+                return broadcast_matrix_view(rhs, rows, columns,
+                    [&](auto const& r)
+                    {
+                        return f(l, r);
+                    },
+                    name, codename);
+            },
+            name, codename);
+    }
+}}
+
+#endif
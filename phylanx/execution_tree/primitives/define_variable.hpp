@@ -54,6 +54,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         util::hashed_string target_name_;   // name of the represented variable
         std::shared_ptr<primitive_component> target_;
         bool define_globally_;
+        variable_slot slot_;        // location as resolved by the compiler
     };
 }}}
 
@@ -40,6 +40,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         void store(primitive_arguments_type&& data,
             primitive_arguments_type&& params, eval_context ctx) override;
+
+    private:
+        std::size_t num_slots_ = 0;     // size of the frames of this function
     };
 }}}
 
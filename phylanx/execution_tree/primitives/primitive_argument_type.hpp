@@ -13,6 +13,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 #include <phylanx/util/hashed_string.hpp>
+#include <phylanx/util/small_vector.hpp>
 #include <phylanx/util/variant.hpp>
 
 #include <hpx/allocator_support/internal_allocator.hpp>
@@ -95,6 +96,36 @@ namespace phylanx { namespace execution_tree
     ///////////////////////////////////////////////////////////////////////////
     enum class language { cxx = 0, python = 1 };
 
+    // The location of a variable as resolved by the compiler: the frame the
+    // variable is stored in (depth_ is either the current frame or the
+    // outermost frame of the chain of frames) and the index of the variable
+    // in the array of slots of that frame. Variables that could not be
+    // resolved at compile time (index_ < 0) are looked up by name.
+    struct variable_slot
+    {
+        enum : std::int64_t
+        {
+            current_frame = 0,
+            outermost_frame = -1
+        };
+
+        constexpr variable_slot() noexcept = default;
+
+        constexpr variable_slot(std::int64_t depth, std::int64_t index) noexcept
+          : depth_(depth)
+          , index_(index)
+        {
+        }
+
+        constexpr bool valid() const noexcept
+        {
+            return index_ >= 0;
+        }
+
+        std::int64_t depth_ = current_frame;
+        std::int64_t index_ = -1;
+    };
+
     class variable_frame
     {
         using allocator_type = hpx::util::internal_allocator<
@@ -102,18 +133,31 @@ namespace phylanx { namespace execution_tree
         using variables_map_type = std::map<util::hashed_string,
             primitive_argument_type, std::less<>, allocator_type>;
 
+        // the slots refer to the variables resolved by the compiler, all
+        // variables are stored in the map, a slot is nullptr as long as the
+        // corresponding variable was not defined yet
+        using slot_type = variables_map_type::value_type*;
+        using slots_type = util::small_vector<slot_type>;
+
     public:
         variable_frame() = default;
 
         variable_frame(std::shared_ptr<variable_frame> nextframe,
-            language lang, std::string const& name, std::string const& codename)
-          : nextframe_(std::move(nextframe))
+            language lang, std::string const& name, std::string const& codename,
+            std::size_t num_slots = 0)
+          : slots_(num_slots, nullptr)
+          , nextframe_(std::move(nextframe))
+          , outermost_(nextframe_ ? nextframe_->outermost() : nullptr)
           , lang_(lang)
           , name_(name)
           , codename_(codename)
         {
         }
 
+        // the slots refer to the elements of the map
+        variable_frame(variable_frame const&) = delete;
+        variable_frame& operator=(variable_frame const&) = delete;
+
         inline primitive_argument_type* get_var(
             util::hashed_string const& name) noexcept;
         inline primitive_argument_type const* get_var(
@@ -122,6 +166,20 @@ namespace phylanx { namespace execution_tree
             util::hashed_string const& name, primitive_argument_type&& var,
             bool define_globally = false);
 
+        // access variables using the location resolved by the compiler, fall
+        // back to looking up the variable by name (only slots of the current
+        // frame are used for lookups, variables in any other frame might be
+        // shadowed by a caller's variable of the same name)
+        inline primitive_argument_type* get_var(
+            util::hashed_string const& name,
+            variable_slot const& slot) noexcept;
+        inline primitive_argument_type const* get_var(
+            util::hashed_string const& name,
+            variable_slot const& slot) const noexcept;
+        inline primitive_argument_type& set_var(
+            util::hashed_string const& name, variable_slot const& slot,
+            primitive_argument_type&& var, bool define_globally = false);
+
         PHYLANX_EXPORT std::vector<std::string> back_trace() const;
 
     private:
@@ -131,9 +189,26 @@ namespace phylanx { namespace execution_tree
         PHYLANX_EXPORT void serialize(hpx::serialization::input_archive& ar,
             unsigned);
 
+        variable_frame* outermost() noexcept
+        {
+            return outermost_ != nullptr ? outermost_ : this;
+        }
+        variable_frame const* outermost() const noexcept
+        {
+            return outermost_ != nullptr ? outermost_ : this;
+        }
+
+        inline primitive_argument_type* find_var(
+            util::hashed_string const& name) noexcept;
+
+        inline variables_map_type::value_type& define_var(
+            util::hashed_string const& name, primitive_argument_type&& var);
+
     private:
+        slots_type slots_;
         variables_map_type variables_;
         std::shared_ptr<variable_frame> nextframe_;
+        variable_frame* outermost_ = nullptr;   // kept alive by nextframe_
         language lang_;
         std::string name_;
         std::string codename_;
@@ -205,11 +280,30 @@ namespace phylanx { namespace execution_tree
         inline primitive_argument_type& set_var(util::hashed_string const& name,
             primitive_argument_type&& var, bool define_globally = false);
 
-        eval_context& add_frame(
-            std::string const& name, std::string const& codename)
+        primitive_argument_type* get_var(util::hashed_string const& name,
+            variable_slot const& slot) noexcept
+        {
+            HPX_ASSERT(bool(variables_));
+            return variables_->get_var(name, slot);
+        }
+        primitive_argument_type const* get_var(
+            util::hashed_string const& name,
+            variable_slot const& slot) const noexcept
         {
-            variables_ = std::allocate_shared<variable_frame>(
-                alloc_, std::move(variables_), language::cxx, name, codename);
+            HPX_ASSERT(bool(variables_));
+            return variables_->get_var(name, slot);
+        }
+
+        inline primitive_argument_type& set_var(util::hashed_string const& name,
+            variable_slot const& slot, primitive_argument_type&& var,
+            bool define_globally = false);
+
+        eval_context& add_frame(std::string const& name,
+            std::string const& codename, std::size_t num_slots = 0)
+        {
+            variables_ = std::allocate_shared<variable_frame>(alloc_,
+                std::move(variables_), language::cxx, name, codename,
+                num_slots);
             return *this;
         }
 
@@ -273,10 +367,10 @@ namespace phylanx { namespace execution_tree
     }
 
     inline eval_context add_frame(eval_context&& ctx, std::string const& name,
-        std::string const& codename)
+        std::string const& codename, std::size_t num_slots = 0)
     {
         eval_context newctx = std::move(ctx);
-        return std::move(newctx.add_frame(name, codename));
+        return std::move(newctx.add_frame(name, codename, num_slots));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -363,6 +457,11 @@ namespace phylanx { namespace execution_tree
 
     public:
         static bool enable_tracing;
+
+    private:
+        // pinned pointer to the referenced component if it lives on this
+        // locality, used to bypass the action machinery when evaluating
+        std::shared_ptr<primitives::primitive_component> local_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -377,6 +476,7 @@ namespace phylanx { namespace execution_tree
           , util::recursive_wrapper<hpx::shared_future<primitive_argument_type>>
           , ir::range
           , phylanx::ir::dictionary
+          , ir::node_data<float>
         >;
 
     PHYLANX_EXPORT primitive_argument_type extract_copy_value(
@@ -397,7 +497,8 @@ namespace phylanx { namespace execution_tree
             primitive_index = 5,
             future_index = 6,
             list_index = 7,
-            dictionary_index = 8
+            dictionary_index = 8,
+            float32_index = 9
         };
 
         using annotation_ptr = std::shared_ptr<execution_tree::annotation>;
@@ -707,6 +808,88 @@ namespace phylanx { namespace execution_tree
           , annotation_(ann)
         {}
 
+        // float
+        explicit primitive_argument_type(float val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicVector<float> const& val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicVector<float>&& val)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicMatrix<float> const& val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicMatrix<float>&& val)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicTensor<float> const& val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicTensor<float>&& val)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(
+            blaze::DynamicArray<4UL, float> const& val)
+          : argument_value_type{phylanx::ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicArray<4UL, float>&& val)
+          : argument_value_type{phylanx::ir::node_data<float>{std::move(val)}}
+        {}
+
+        primitive_argument_type(float val, annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicVector<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicVector<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicMatrix<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicMatrix<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicTensor<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicTensor<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+          , annotation_(ann)
+        {}
+
+        primitive_argument_type(ir::node_data<float> const& val)
+          : argument_value_type{val}
+        {}
+        primitive_argument_type(ir::node_data<float>&& val)
+          : argument_value_type{std::move(val)}
+        {}
+        primitive_argument_type(ir::node_data<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{val}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(ir::node_data<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{std::move(val)}
+          , annotation_(ann)
+        {}
+
         // primitive
         primitive_argument_type(primitive const& val)
           : argument_value_type{val}
@@ -1011,35 +1194,84 @@ namespace phylanx { namespace execution_tree
         return variables_->set_var(name, std::move(var), define_globally);
     }
 
+    primitive_argument_type& eval_context::set_var(
+        util::hashed_string const& name, variable_slot const& slot,
+        primitive_argument_type&& var, bool define_globally)
+    {
+        return variables_->set_var(
+            name, slot, std::move(var), define_globally);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type* variable_frame::get_var(
+    // look up the variable in this frame only
+    primitive_argument_type* variable_frame::find_var(
         util::hashed_string const& name) noexcept
     {
         auto it = variables_.find(name);
         if (it == variables_.end())
         {
-            if (!nextframe_)
-            {
-                return nullptr;
-            }
-            return nextframe_->get_var(name);
+            return nullptr;
         }
         return &it->second;
     }
 
+    primitive_argument_type* variable_frame::get_var(
+        util::hashed_string const& name) noexcept
+    {
+        primitive_argument_type* var = find_var(name);
+        if (var == nullptr && nextframe_)
+        {
+            return nextframe_->get_var(name);
+        }
+        return var;
+    }
+
     primitive_argument_type const* variable_frame::get_var(
         util::hashed_string const& name) const noexcept
     {
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        return const_cast<variable_frame*>(this)->get_var(name);
+    }
+
+    primitive_argument_type* variable_frame::get_var(
+        util::hashed_string const& name, variable_slot const& slot) noexcept
+    {
+        // the current frame is the first one searched by name as well, this
+        // gives the same result as the name based lookup
+        std::size_t index = static_cast<std::size_t>(slot.index_);
+        if (slot.valid() && slot.depth_ == variable_slot::current_frame &&
+            index < slots_.size())
         {
-            if (!nextframe_)
+            slot_type s = slots_[index];
+            if (s != nullptr && s->first == name)
             {
-                return nullptr;
+                return &s->second;
             }
-            return nextframe_->get_var(name);
         }
-        return &it->second;
+
+        // the variable was not defined yet, was defined in a frame the
+        // compiler didn't know about, or lives in an enclosing frame
+        return get_var(name);
+    }
+
+    primitive_argument_type const* variable_frame::get_var(
+        util::hashed_string const& name,
+        variable_slot const& slot) const noexcept
+    {
+        return const_cast<variable_frame*>(this)->get_var(name, slot);
+    }
+
+    variable_frame::variables_map_type::value_type& variable_frame::define_var(
+        util::hashed_string const& name, primitive_argument_type&& var)
+    {
+        auto it = variables_.find(name);
+        if (it != variables_.end())
+        {
+            it->second = std::move(var);
+            return *it;
+        }
+
+        using value_type = variables_map_type::value_type;
+        return *variables_.insert(value_type(name, std::move(var))).first;
     }
 
     primitive_argument_type& variable_frame::set_var(
@@ -1049,22 +1281,45 @@ namespace phylanx { namespace execution_tree
         // global variables are defined in the outermost frame
         if (define_globally && nextframe_ != nullptr)
         {
-            return nextframe_->set_var(name, std::move(var), define_globally);
+            return outermost()->set_var(name, std::move(var), false);
         }
 
         // non-global variables are always created in the currently top-most
         // environment
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        return define_var(name, std::move(var)).second;
+    }
+
+    primitive_argument_type& variable_frame::set_var(
+        util::hashed_string const& name, variable_slot const& slot,
+        primitive_argument_type&& var, bool define_globally)
+    {
+        variable_frame* frame = this;
+        if (define_globally || slot.depth_ == variable_slot::outermost_frame)
         {
-            using value_type = variables_map_type::value_type;
-            it = variables_.insert(value_type(name, std::move(var))).first;
+            frame = outermost();
         }
-        else
+
+        // the slot is used unless it is taken by a different variable (code
+        // compiled for a different frame might be executed in this frame)
+        std::size_t index = static_cast<std::size_t>(slot.index_);
+        if (slot.valid() && index < frame->slots_.size())
         {
-            it->second = std::move(var);
+            slot_type& s = frame->slots_[index];
+            if (s != nullptr && s->first == name)
+            {
+                s->second = std::move(var);
+                return s->second;
+            }
+
+            auto& v = frame->define_var(name, std::move(var));
+            if (s == nullptr)
+            {
+                s = &v;
+            }
+            return v.second;
         }
-        return it->second;
+
+        return frame->define_var(name, std::move(var)).second;
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -67,6 +67,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
         PHYLANX_EXPORT hpx::future<primitive_argument_type> eval_single(
             primitive_argument_type && param, eval_context ctx) const;
 
+        // evaluate without going through an action, this is used by clients
+        // that have resolved the (local) pointer to this component
+        PHYLANX_EXPORT hpx::future<primitive_argument_type> eval_local(
+            primitive_arguments_type const& params, eval_context ctx) const;
+        PHYLANX_EXPORT hpx::future<primitive_argument_type> eval_local(
+            primitive_arguments_type&& params, eval_context ctx) const;
+
+        PHYLANX_EXPORT hpx::future<primitive_argument_type> eval_local(
+            primitive_argument_type && param, eval_context ctx) const;
+
         // store_action
         PHYLANX_EXPORT void store(primitive_arguments_type&&,
             primitive_arguments_type&&, eval_context ctx);
@@ -104,6 +114,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         PHYLANX_EXPORT std::int64_t get_transferred_bytes(bool reset) const;
 
+        PHYLANX_EXPORT std::int64_t get_copied_bytes(bool reset) const;
+        PHYLANX_EXPORT std::int64_t get_moved_bytes(bool reset) const;
+        PHYLANX_EXPORT std::int64_t get_reused_bytes(bool reset) const;
+
         PHYLANX_EXPORT void enable_measurements();
 
         // decide whether to execute eval directly
@@ -113,7 +127,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             eval_single_action, hpx::launch policy,
             hpx::naming::address_type lva);
 
+        // decide whether evaluating local primitives may bypass actions
+        // (configuration setting 'phylanx.direct_local_eval')
+        PHYLANX_EXPORT static bool enable_local_eval();
+
     private:
+        hpx::launch select_local_execution() const;
+
         std::shared_ptr<primitive_component_base> primitive_;
     };
 }}}
@@ -101,6 +101,11 @@ namespace phylanx { namespace execution_tree
 
             virtual std::int64_t get_transferred_bytes(bool reset) const;
 
+            // bytes of node_data copied, moved, and reused by eval
+            std::int64_t get_copied_bytes(bool reset) const;
+            std::int64_t get_moved_bytes(bool reset) const;
+            std::int64_t get_reused_bytes(bool reset) const;
+
             void enable_measurements();
 
             // decide whether to execute eval directly
@@ -145,6 +150,7 @@ namespace phylanx { namespace execution_tree
             mutable std::int64_t eval_duration_;
             mutable std::int64_t execute_directly_;
             bool measurements_enabled_;
+            mutable ir::node_data_bytes node_data_bytes_;
 
 #if defined(HPX_HAVE_APEX)
             std::string eval_name_;
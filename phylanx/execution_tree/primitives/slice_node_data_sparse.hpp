@@ -0,0 +1,208 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_IR_NODE_SLICE_NODE_DATA_SPARSE_HPP)
+#define PHYLANX_IR_NODE_SLICE_NODE_DATA_SPARSE_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/detail/advanced_indexes.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/ir/ranges.hpp>
+#include <phylanx/util/slicing_helpers.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze/math/Elements.h>
+
+// Slicing functionality for sparse (compressed) 1d and 2d data. Only basic
+// slicing (nil, a single integer, or start/stop/step lists) is performed on
+// the compressed representation, advanced indexing falls back to slicing a
+// dense copy of the data.
+namespace phylanx { namespace execution_tree
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        inline bool is_basic_sparse_index(
+            primitive_argument_type const& indices, std::string const& name,
+            std::string const& codename)
+        {
+            if (!valid(indices))
+            {
+                return true;
+            }
+            if (is_list_operand_strict(indices))
+            {
+                return extract_slicing_index_type(indices, name, codename) ==
+                    slicing_index_basic;
+            }
+            return is_integer_operand_strict(indices) &&
+                extract_numeric_value_dimension(indices, name, codename) == 0;
+        }
+
+        inline ir::slicing_indices extract_sparse_slicing(
+            primitive_argument_type const& indices, std::size_t size,
+            std::string const& name, std::string const& codename,
+            eval_context const& ctx)
+        {
+            if (valid(indices) && !is_list_operand_strict(indices))
+            {
+                return ir::slicing_indices(
+                    check_index(extract_scalar_integer_value_strict(
+                                    indices, name, codename),
+                        size, name, codename, ctx),
+                    true);
+            }
+            return util::slicing_helpers::extract_slicing(
+                indices, size, name, codename, ctx);
+        }
+
+        // positions of the elements selected by the given slice
+        inline std::vector<std::size_t> sparse_slice_positions(
+            ir::slicing_indices const& indices, std::size_t size,
+            std::string const& name, std::string const& codename,
+            eval_context const& ctx)
+        {
+            if (indices.start() >= std::int64_t(size) ||
+                indices.span() > std::int64_t(size))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::sparse_slice_positions",
+                    util::generate_error_message(
+                        "cannot extract anything but the existing elements "
+                        "from sparse data",
+                        name, codename, ctx.back_trace()));
+            }
+
+            if (indices.single_value())
+            {
+                return std::vector<std::size_t>{std::size_t(
+                    check_index(indices.start(), size, name, codename, ctx))};
+            }
+
+            if (indices.step() == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::sparse_slice_positions",
+                    util::generate_error_message(
+                        "step can not be zero", name, codename,
+                        ctx.back_trace()));
+            }
+
+            return util::slicing_helpers::create_list_slice(
+                indices.start(), indices.stop(), indices.step());
+        }
+
+        template <typename T>
+        ir::node_data<T> sparse_to_dense(ir::node_data<T> const& data)
+        {
+            if (data.num_dimensions() == 1)
+            {
+                return ir::node_data<T>{data.vector_copy()};
+            }
+            return ir::node_data<T>{data.matrix_copy()};
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    ir::node_data<T> slice1d_extract_sparse(ir::node_data<T> const& data,
+        primitive_argument_type const& indices, std::string const& name,
+        std::string const& codename, eval_context const& ctx)
+    {
+        auto const& v = data.sparse_vector();
+
+        auto slice = detail::extract_sparse_slicing(
+            indices, v.size(), name, codename, ctx);
+        auto positions = detail::sparse_slice_positions(
+            slice, v.size(), name, codename, ctx);
+
+        if (slice.single_value())
+        {
+            return ir::node_data<T>{T(v[positions[0]])};
+        }
+        return ir::node_data<T>{
+            blaze::CompressedVector<T>(blaze::elements(v, positions))};
+    }
+
+    template <typename T>
+    ir::node_data<T> slice2d_extract_sparse(ir::node_data<T> const& data,
+        primitive_argument_type const& rows,
+        primitive_argument_type const& columns, std::string const& name,
+        std::string const& codename, eval_context const& ctx)
+    {
+        auto const& m = data.sparse_matrix();
+
+        auto row_slice = detail::extract_sparse_slicing(
+            rows, m.rows(), name, codename, ctx);
+        auto row_positions = detail::sparse_slice_positions(
+            row_slice, m.rows(), name, codename, ctx);
+
+        auto column_slice = detail::extract_sparse_slicing(
+            columns, m.columns(), name, codename, ctx);
+        auto column_positions = detail::sparse_slice_positions(
+            column_slice, m.columns(), name, codename, ctx);
+
+        if (row_slice.single_value())
+        {
+            auto r = blaze::row(m, row_positions[0]);
+            if (column_slice.single_value())
+            {
+                return ir::node_data<T>{T(r[column_positions[0]])};
+            }
+            return ir::node_data<T>{blaze::CompressedVector<T>(
+                blaze::trans(blaze::elements(r, column_positions)))};
+        }
+
+        if (column_slice.single_value())
+        {
+            return ir::node_data<T>{blaze::CompressedVector<T>(
+                blaze::elements(blaze::column(m, column_positions[0]),
+                    row_positions))};
+        }
+
+        // consecutive rows and columns map onto a submatrix
+        if (row_slice.step() == 1 && column_slice.step() == 1)
+        {
+            return ir::node_data<T>{blaze::CompressedMatrix<T>(
+                blaze::submatrix(m, row_positions[0], column_positions[0],
+                    row_positions.size(), column_positions.size()))};
+        }
+
+        return ir::node_data<T>{blaze::CompressedMatrix<T>(blaze::columns(
+            blaze::rows(m, row_positions), column_positions))};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    ir::node_data<T> slice_extract_sparse(ir::node_data<T> const& data,
+        primitive_argument_type const& rows,
+        primitive_argument_type const& columns, std::string const& name,
+        std::string const& codename, eval_context const& ctx)
+    {
+        if (data.num_dimensions() == 1)
+        {
+            auto row_data =
+                slice1d_extract_sparse(data, rows, name, codename, ctx);
+            if (valid(columns) && row_data.is_sparse())
+            {
+                // chaining two indexing schemes
+                return slice1d_extract_sparse(
+                    row_data, columns, name, codename, ctx);
+            }
+            return row_data;
+        }
+        return slice2d_extract_sparse(data, rows, columns, name, codename, ctx);
+    }
+}}
+
+#endif
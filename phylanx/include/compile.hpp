@@ -9,6 +9,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/compile.hpp>
 #include <phylanx/execution_tree/compiler/actors.hpp>
+#include <phylanx/execution_tree/compiler/compilation_cache.hpp>
 #include <phylanx/execution_tree/compiler/compiler.hpp>
 #include <phylanx/execution_tree/compiler_component.hpp>
 
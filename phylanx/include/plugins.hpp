@@ -9,10 +9,12 @@
 #include <phylanx/config.hpp>
 #include <phylanx/plugins/algorithms/algorithms.hpp>
 #include <phylanx/plugins/arithmetics/arithmetics.hpp>
+#include <phylanx/plugins/autodiff/autodiff.hpp>
 #include <phylanx/plugins/booleans/booleans.hpp>
 #include <phylanx/plugins/controls/controls.hpp>
 #include <phylanx/plugins/dist_keras_support/dist_keras_support.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_matrixops.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics.hpp>
 #include <phylanx/plugins/fileio/fileio.hpp>
 #include <phylanx/plugins/keras_support/keras_support.hpp>
 #include <phylanx/plugins/listops/listops.hpp>
@@ -15,6 +15,7 @@
 #include <hpx/errors/throw_exception.hpp>
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -141,10 +142,25 @@ namespace phylanx { namespace ir
         using custom_storage4d_type =
             blaze::CustomArray<4UL, T, blaze::aligned, blaze::padded>;
 
+        // Sparse (compressed) storage is used for 1d and 2d data only. The
+        // custom sparse types refer to the sparse data held by a different
+        // instance (see ref()). vector() and matrix() are not available for
+        // sparse data (use vector_copy() or matrix_copy() to densify the data
+        // instead).
+        using sparse_storage1d_type = blaze::CompressedVector<T>;
+        using sparse_storage2d_type = blaze::CompressedMatrix<T>;
+
+        using custom_sparse_storage1d_type =
+            std::reference_wrapper<sparse_storage1d_type>;
+        using custom_sparse_storage2d_type =
+            std::reference_wrapper<sparse_storage2d_type>;
+
         using storage_type = util::variant<storage0d_type, storage1d_type,
             storage2d_type, storage3d_type, storage4d_type,
             custom_storage0d_type, custom_storage1d_type, custom_storage2d_type,
-            custom_storage3d_type, custom_storage4d_type>;
+            custom_storage3d_type, custom_storage4d_type,
+            sparse_storage1d_type, sparse_storage2d_type,
+            custom_sparse_storage1d_type, custom_sparse_storage2d_type>;
 
         enum variant_index
         {
@@ -157,7 +173,11 @@ namespace phylanx { namespace ir
             custom_storage1d = 6,
             custom_storage2d = 7,
             custom_storage3d = 8,
-            custom_storage4d = 9
+            custom_storage4d = 9,
+            sparse_storage1d = 10,
+            sparse_storage2d = 11,
+            custom_sparse_storage1d = 12,
+            custom_sparse_storage2d = 13
         };
 
         using dimensions_type = std::array<std::size_t, max_dimensions>;
@@ -202,6 +222,16 @@ namespace phylanx { namespace ir
         explicit node_data(custom_storage4d_type const& values);
         explicit node_data(custom_storage4d_type && values);
 
+        /// Create node data for sparse 1- and 2-dimensional values
+        explicit node_data(sparse_storage1d_type const& values);
+        explicit node_data(sparse_storage1d_type && values);
+
+        explicit node_data(sparse_storage2d_type const& values);
+        explicit node_data(sparse_storage2d_type && values);
+
+        explicit node_data(custom_sparse_storage1d_type const& values);
+        explicit node_data(custom_sparse_storage2d_type const& values);
+
         // conversion helpers for Python bindings and AST parsing
         explicit node_data(std::vector<T> const& values);
         explicit node_data(std::vector<std::vector<T>> const& values);
@@ -236,6 +266,18 @@ namespace phylanx { namespace ir
         template <typename U>
         static storage_type init_data_from_type(node_data<U> const& d)
         {
+            if (d.is_sparse())
+            {
+                increment_copy_construction_count();
+                if (d.num_dimensions() == 1)
+                {
+                    return storage_type(
+                        sparse_storage1d_type(d.sparse_vector()));
+                }
+                return storage_type(
+                    sparse_storage2d_type(d.sparse_matrix()));
+            }
+
             std::size_t dims = d.num_dimensions();
 
             switch (dims)
@@ -310,6 +352,13 @@ namespace phylanx { namespace ir
 
         node_data& operator=(custom_storage4d_type const& val);
         node_data& operator=(custom_storage4d_type && val);
+
+        node_data& operator=(sparse_storage1d_type const& val);
+        node_data& operator=(sparse_storage1d_type && val);
+
+        node_data& operator=(sparse_storage2d_type const& val);
+        node_data& operator=(sparse_storage2d_type && val);
+
         // conversion helpers for Python bindings and AST parsing
         node_data& operator=(std::vector<T> const& val);
         node_data& operator=(std::vector<std::vector<T>> const& values);
@@ -415,6 +464,27 @@ namespace phylanx { namespace ir
         storage0d_type& scalar_non_ref();
         storage0d_type const& scalar_non_ref() const;
 
+        /// Return whether this instance holds sparse (compressed) data
+        bool is_sparse() const;
+
+        /// Access the sparse data (throws if the data is not sparse)
+        sparse_storage1d_type const& sparse_vector() const&;
+        sparse_storage1d_type sparse_vector() &&;
+
+        sparse_storage2d_type const& sparse_matrix() const&;
+        sparse_storage2d_type sparse_matrix() &&;
+
+    private:
+        // the sparse data held or referred to by this instance, nullptr if
+        // the data is not sparse
+        sparse_storage1d_type* sparse_vector_ptr();
+        sparse_storage1d_type const* sparse_vector_ptr() const;
+
+        sparse_storage2d_type* sparse_matrix_ptr();
+        sparse_storage2d_type const* sparse_matrix_ptr() const;
+
+    public:
+
         /// Extract the dimensionality of the underlying data array.
         std::size_t num_dimensions() const;
 
@@ -485,9 +555,45 @@ namespace phylanx { namespace ir
         bool enabled_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of bytes of node_data that were deep-copied, moved, or reused in
+    // place. While the node_data counts are enabled, the bytes are attributed
+    // to the instance installed for the current HPX thread by
+    // node_data_bytes_scope.
+    struct node_data_bytes
+    {
+        std::atomic<std::int64_t> copied_{0};
+        std::atomic<std::int64_t> moved_{0};
+        std::atomic<std::int64_t> reused_{0};
+    };
+
+    class PHYLANX_EXPORT node_data_bytes_scope
+    {
+    public:
+        // passing nullptr leaves the currently installed instance in place
+        explicit node_data_bytes_scope(node_data_bytes* bytes);
+        ~node_data_bytes_scope();
+
+        node_data_bytes_scope(node_data_bytes_scope const&) = delete;
+        node_data_bytes_scope& operator=(
+            node_data_bytes_scope const&) = delete;
+
+    private:
+        node_data_bytes* previous_;
+        bool installed_;
+    };
+
+    // Attribute the given number of bytes to the node_data_bytes instance
+    // installed for the current HPX thread, if any
+    PHYLANX_EXPORT void count_copied_bytes(std::size_t bytes);
+    PHYLANX_EXPORT void count_moved_bytes(std::size_t bytes);
+    PHYLANX_EXPORT void count_reused_bytes(std::size_t bytes);
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT bool operator==(
         node_data<double> const& lhs, node_data<double> const& rhs);
+    PHYLANX_EXPORT bool operator==(
+        node_data<float> const& lhs, node_data<float> const& rhs);
     PHYLANX_EXPORT bool operator==(
         node_data<std::uint8_t> const& lhs, node_data<std::uint8_t> const& rhs);
     PHYLANX_EXPORT bool operator==(
@@ -504,6 +610,10 @@ namespace phylanx { namespace ir
         node_data<double> const& rhs, double rtol = 1e-5, double atol = 1e-8,
         bool equal_nan = false);
 
+    PHYLANX_EXPORT bool allclose(node_data<float> const& lhs,
+        node_data<float> const& rhs, double rtol = 1e-5, double atol = 1e-8,
+        bool equal_nan = false);
+
     inline bool allclose(node_data<std::uint8_t> const& lhs,
         node_data<std::uint8_t> const& rhs, double rtol = 0, double atol = 0,
         bool equal_nan = false)
@@ -521,6 +631,8 @@ namespace phylanx { namespace ir
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<double> const& nd);
+    PHYLANX_EXPORT std::ostream& operator<<(
+        std::ostream& out, node_data<float> const& nd);
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<std::uint8_t> const& nd);
     PHYLANX_EXPORT std::ostream& operator<<(
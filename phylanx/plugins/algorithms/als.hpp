@@ -12,11 +12,14 @@
 
 #include <hpx/futures/future.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 namespace phylanx { namespace execution_tree { namespace primitives
 {
     class als
@@ -47,6 +50,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     protected:
         primitive_argument_type calculate_als(
             primitive_arguments_type&& args) const;
+
+        template <typename Matrix>
+        void calculate_als_iterations(Matrix const& conf,
+            Matrix const& conf_t, blaze::DynamicMatrix<double>& X,
+            blaze::DynamicMatrix<double>& Y, double regularization,
+            std::int64_t iterations, bool enable_output) const;
     };
 
     inline primitive create_als(hpx::id_type const& locality,
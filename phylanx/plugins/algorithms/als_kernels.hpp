@@ -0,0 +1,55 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_ALS_KERNELS_HPP)
+#define PHYLANX_ALS_KERNELS_HPP
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Building blocks shared by the als and als_d primitives. The confidences
+// are given as a (num_rows, num_other) matrix, where num_rows is the number
+// of rows of the factor matrix to update and num_other is the number of rows
+// of the fixed factor matrix.
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Calculate F^T F + reg * I for the given factors.
+    blaze::DynamicMatrix<double> als_gram_matrix(
+        blaze::DynamicMatrix<double> const& factors, double regularization);
+
+    // Solve the normal equations for all rows r of result, given the
+    // confidences of that row and the fixed factors:
+    //
+    //      A = F^T C_r F + FtF,  b = F^T (C_r + I) p_r,  result_r = A^-1 b
+    //
+    // Only the non-zero confidences contribute to A and b. The rows of F that
+    // belong to the non-zero confidences are gathered into a workspace to
+    // form F^T C_r F using a single matrix product, the system is solved using
+    // a Cholesky decomposition. The rows are processed in parallel, each task
+    // reuses its workspaces for all of its rows.
+    void als_update_rows(blaze::CompressedMatrix<double> const& conf,
+        blaze::DynamicMatrix<double> const& factors,
+        blaze::DynamicMatrix<double> const& FtF,
+        blaze::DynamicMatrix<double>& result);
+
+    void als_update_rows(blaze::DynamicMatrix<double> const& conf,
+        blaze::DynamicMatrix<double> const& factors,
+        blaze::DynamicMatrix<double> const& FtF,
+        blaze::DynamicMatrix<double>& result);
+
+    // Initialize the given factors, row_offset is the global index of the
+    // first row. The values are the same as generated by 'random' for the
+    // given key (independently of how the rows are distributed).
+    void als_initialize_factors(blaze::DynamicMatrix<double>& factors,
+        std::uint64_t key, std::size_t row_offset = 0);
+}}}
+
+#endif
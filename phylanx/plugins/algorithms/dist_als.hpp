@@ -0,0 +1,62 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_DIST_ALS_AS_PRIMITIVE)
+#define PHYLANX_DIST_ALS_AS_PRIMITIVE
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///
+    /// Creates a primitive executing the ALS algorithm on row-tiled ratings
+    /// distributed over several localities
+    ///
+    class dist_als
+      : public primitive_component_base
+      , public std::enable_shared_from_this<dist_als>
+    {
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static match_pattern_type const match_data;
+
+        dist_als() = default;
+
+        dist_als(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    protected:
+        primitive_argument_type calculate_als(
+            primitive_arguments_type&& args) const;
+    };
+
+    inline primitive create_dist_als(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "als_d", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
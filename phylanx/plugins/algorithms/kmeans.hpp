@@ -49,16 +49,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
     protected:
         blaze::DynamicMatrix<double> initialize_centroids(
-            blaze::DynamicMatrix<double> const& points, std::size_t num_points,
-            std::size_t num_centroids) const;
-        blaze::DynamicVector<std::size_t> closest_centroids(
-            blaze::DynamicMatrix<double> const& points,
-            blaze::DynamicMatrix<double> const& centroids,
-            std::size_t num_points, std::size_t num_centroids) const;
-        blaze::DynamicMatrix<double> move_centroids(
             blaze::DynamicMatrix<double> const& points,
-            blaze::DynamicVector<std::size_t>&& closest,
-            blaze::DynamicMatrix<double>&& centroids, std::size_t num_points,
             std::size_t num_centroids) const;
 
         primitive_argument_type calculate_kmeans(
@@ -0,0 +1,51 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_KMEANS_KERNELS_HPP)
+#define PHYLANX_KMEANS_KERNELS_HPP
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Building blocks shared by the kmeans and kmeans_d primitives. The points
+// are given as a (num_points, num_features) matrix, the centroids as a
+// (num_centroids, num_features) matrix.
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Assign each point to its closest centroid. The squared distances are
+    // calculated as ||x||^2 - 2 x c + ||c||^2, where the products of all
+    // points with all centroids are calculated as one matrix product per
+    // block of points. The points are processed in parallel.
+    blaze::DynamicVector<std::size_t> kmeans_closest_centroids(
+        blaze::DynamicMatrix<double> const& points,
+        blaze::DynamicMatrix<double> const& centroids);
+
+    // Calculate the sums of all points assigned to each of the centroids
+    // (stored in the first num_features columns of the result) and the number
+    // of points assigned to each centroid (stored in the last column).
+    blaze::DynamicMatrix<double> kmeans_partial_sums(
+        blaze::DynamicMatrix<double> const& points,
+        blaze::DynamicVector<std::size_t> const& closest,
+        std::size_t num_centroids);
+
+    // Generate the new centroids from the (reduced) partial sums, centroids
+    // without any points assigned are set to zero.
+    blaze::DynamicMatrix<double> kmeans_move_centroids(
+        blaze::DynamicMatrix<double> const& sums);
+
+    // Choose num_centroids unique random indices in [0, num_points), uses
+    // the global random number generator.
+    std::vector<std::size_t> kmeans_random_indices(
+        std::size_t num_points, std::size_t num_centroids);
+}}}
+
+#endif
@@ -31,12 +31,45 @@
 #include <numeric>
 #include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include <blaze/Blaze.h>
 
 /////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives {
 
+// Walker's alias table, draws samples from a (fixed) discrete distribution
+// over [0, n) in constant time
+//
+class lda_alias_table {
+
+    private:
+
+    std::vector<double> prob;
+    std::vector<std::int64_t> alias;
+    double total_weight = 0.0;
+
+    public:
+
+    template< typename F >
+    void build(const std::int64_t n, F && weight);
+
+    // sum of the (unnormalized) weights the table was built from
+    double total() const { return total_weight; }
+
+    template< typename Engine >
+    std::int64_t sample(Engine & eng) const;
+};
+
+// Parallel collapsed Gibbs sampler in the style of AD-LDA: the documents
+// are partitioned between HPX tasks, each task samples the topics of its
+// tokens using the word-topic counts of the previous sweep (plus its own
+// updates), all updates are merged after each sweep. The topic of a token
+// is sampled in O(k_d) (k_d being the number of topics of its document)
+// using a Metropolis-Hastings step that combines the sparse document-topic
+// counts with per-word alias tables (see Li et al., "Reducing the Sampling
+// Complexity of Topic Models", KDD 2014).
+//
 class lda_trainer_impl {
 
     private:
@@ -49,23 +82,29 @@ class lda_trainer_impl {
         alpha(alpha_), beta(beta_) {
     }
 
-    static void gibbs(
-        const blaze::DynamicMatrix<double> & word_doc_mat,
-        const double alpha,
-        const double beta,
-        blaze::DynamicVector<std::int64_t> & z,
-        blaze::DynamicMatrix<double> & wp0,
-        blaze::DynamicMatrix<double> & dp,
-        blaze::DynamicVector<double, blaze::rowVector> & ztot);
-
     using dmatrix_t = blaze::DynamicMatrix<double>;
     using dvector_t = blaze::DynamicVector<double>;
     using i64vector_t = blaze::DynamicVector<std::int64_t>;
+    using smatrix_t = blaze::CompressedMatrix<double>;
 
     std::tuple<dmatrix_t, dmatrix_t> operator()(
         const dmatrix_t & word_doc_mat,
         const std::int64_t T,
         const std::int64_t iter=500);
+
+    // sparse word-document matrices visit non-zero entries only
+    std::tuple<dmatrix_t, dmatrix_t> operator()(
+        const smatrix_t & word_doc_mat,
+        const std::int64_t T,
+        const std::int64_t iter=500);
+
+    private:
+
+    template< typename Matrix >
+    std::tuple<dmatrix_t, dmatrix_t> train(
+        const Matrix & word_doc_mat,
+        const std::int64_t T,
+        const std::int64_t iter);
 };
 
 } } } // end namespaces
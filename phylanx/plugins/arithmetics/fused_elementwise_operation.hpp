@@ -0,0 +1,107 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE_OPERATION_MAR_02_2020_1134AM)
+#define PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE_OPERATION_MAR_02_2020_1134AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/elementwise_fusion.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Evaluates a chain of elementwise operations in a single pass
+    ///
+    /// This primitive is not meant to be used directly. The compiler replaces
+    /// nested calls to elementwise primitives (__add, __sub, __mul, __div,
+    /// __minus, square, exp, log, sqrt, tanh, sigmoid) with this primitive.
+    /// All sub-expressions sharing the same result type are evaluated block
+    /// by block without materializing any temporaries.
+    ///
+    /// \param program  The postfix encoded expression tree (generated by the
+    ///                 compiler)
+    /// \param args     The values referenced by the expression tree
+    class fused_elementwise_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<fused_elementwise_operation>
+    {
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static match_pattern_type const match_data;
+
+        fused_elementwise_operation() = default;
+
+        fused_elementwise_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+        struct fused_node
+        {
+            compiler::fused_opcode opcode_;
+            std::size_t leaf_;
+            std::vector<std::size_t> children_;
+        };
+
+        struct fused_instruction
+        {
+            compiler::fused_opcode opcode_;
+            std::size_t arg_;
+        };
+
+    private:
+        primitive_argument_type evaluate(
+            primitive_arguments_type&& leaves, eval_context const& ctx) const;
+
+        primitive_argument_type evaluate_unfused(std::size_t node,
+            primitive_arguments_type& leaves, std::vector<std::size_t>& uses,
+            eval_context const& ctx) const;
+
+        primitive_argument_type evaluate_region(std::size_t node,
+            primitive_arguments_type& leaves,
+            std::vector<node_data_type> const& types,
+            std::vector<std::size_t>& uses) const;
+
+        void compile_region(std::size_t node, node_data_type t,
+            std::vector<fused_instruction>& code,
+            primitive_arguments_type& leaves,
+            std::vector<node_data_type> const& types,
+            std::vector<std::size_t>& uses) const;
+
+        template <typename T>
+        primitive_argument_type evaluate_region(
+            std::vector<fused_instruction>&& code,
+            primitive_arguments_type& leaves,
+            std::vector<std::size_t>& uses) const;
+
+    private:
+        std::vector<fused_node> nodes_;
+    };
+
+    inline primitive create_fused_elementwise_operation(
+        hpx::id_type const& locality, primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__fused_elementwise",
+            std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -16,6 +16,7 @@
 
 #include <hpx/futures/future.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -67,14 +68,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
         template <typename T>
         primitive_argument_type numeric1d1d(
             arg_type<T>&& lhs, arg_type<T>&& rhs) const;
-        template <typename T>
-        primitive_argument_type numeric1d1d(args_type<T> && args) const;
 
         template <typename T>
         primitive_argument_type numeric2d2d(
             arg_type<T>&& lhs, arg_type<T>&& rhs) const;
+
+        // operands of different shapes are broadcast using lazy views
+        template <typename T>
+        arg_type<T> numeric1d_broadcast(
+            arg_type<T>&& lhs, arg_type<T>&& rhs, std::size_t size) const;
         template <typename T>
-        primitive_argument_type numeric2d2d(args_type<T> && args) const;
+        arg_type<T> numeric2d_broadcast(arg_type<T>&& lhs,
+            arg_type<T>&& rhs, std::size_t rows, std::size_t columns) const;
 
         template <typename T>
         primitive_argument_type numeric3d3d(
@@ -10,6 +10,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/primitives/broadcast_views.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
@@ -111,40 +112,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
             else
             {
                 // Reuse the memory from rhs operand
+                ir::count_reused_bytes(rhs.size() * sizeof(T));
                 rhs.vector() = Op{}(lhs.vector(), rhs.vector());
             }
             return primitive_argument_type(std::move(rhs));
         }
 
         // Reuse the memory from lhs operand
+        ir::count_reused_bytes(lhs.size() * sizeof(T));
         auto v = lhs.vector();
         Op{}.op_assign(v, rhs.vector());
 
         return primitive_argument_type(std::move(lhs));
     }
 
-    template <typename Op, typename Derived>
-    template <typename T>
-    primitive_argument_type numeric<Op, Derived>::numeric1d1d(args_type<T>&& args) const
-    {
-        return primitive_argument_type(std::accumulate(
-            args.begin() + 1, args.end(), std::move(args[0]),
-            [](arg_type<T>& result, arg_type<T> const& curr) -> arg_type<T>
-            {
-                if (result.is_ref())
-                {
-                    result = Op{}(result.vector(), curr.vector());
-                    return std::move(result);
-                }
-                else
-                {
-                    auto v = result.vector();
-                    Op{}.op_assign(v, curr.vector());
-                }
-                return std::move(result);
-            }));
-    }
-
     ///////////////////////////////////////////////////////////////////////////
     template <typename Op, typename Derived>
     template <typename T>
@@ -162,37 +143,80 @@ namespace phylanx { namespace execution_tree { namespace primitives
             else
             {
                 // Reuse the memory from rhs operand
+                ir::count_reused_bytes(rhs.size() * sizeof(T));
                 rhs.matrix() = Op{}(lhs.matrix(), rhs.matrix());
             }
             return primitive_argument_type(std::move(rhs));
         }
 
         // Reuse the memory from lhs operand
+        ir::count_reused_bytes(lhs.size() * sizeof(T));
         auto m = lhs.matrix();
         Op{}.op_assign(m, rhs.matrix());
 
         return primitive_argument_type(std::move(lhs));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
     template <typename Op, typename Derived>
     template <typename T>
-    primitive_argument_type numeric<Op, Derived>::numeric2d2d(args_type<T> && args) const
+    typename numeric<Op, Derived>::template arg_type<T>
+    numeric<Op, Derived>::numeric1d_broadcast(
+        arg_type<T>&& lhs, arg_type<T>&& rhs, std::size_t size) const
     {
-        return primitive_argument_type{std::accumulate(
-            args.begin() + 1, args.end(), std::move(args[0]),
-            [](arg_type<T>& result, arg_type<T> const& curr) -> arg_type<T>
-            {
-                if (result.is_ref())
+        // Reuse the memory from lhs operand if it already has the shape of
+        // the result
+        if (!lhs.is_ref() && lhs.num_dimensions() == 1 && lhs.size() == size)
+        {
+            ir::count_reused_bytes(lhs.size() * sizeof(T));
+            auto v = lhs.vector();
+            broadcast_vector_view(rhs, size,
+                [&](auto const& r)
                 {
-                    result = Op{}(result.matrix(), curr.matrix());
-                }
-                else
+                    Op{}.op_assign(v, r);
+                },
+                name_, codename_);
+            return std::move(lhs);
+        }
+
+        return broadcast_vector_views(lhs, rhs, size,
+            [](auto const& l, auto const& r) -> arg_type<T>
+            {
+                return arg_type<T>{
+                    typename arg_type<T>::storage1d_type(Op{}(l, r))};
+            },
+            name_, codename_);
+    }
+
+    template <typename Op, typename Derived>
+    template <typename T>
+    typename numeric<Op, Derived>::template arg_type<T>
+    numeric<Op, Derived>::numeric2d_broadcast(arg_type<T>&& lhs,
+        arg_type<T>&& rhs, std::size_t rows, std::size_t columns) const
+    {
+        // Reuse the memory from lhs operand if it already has the shape of
+        // the result
+        if (!lhs.is_ref() && lhs.num_dimensions() == 2 &&
+            lhs.dimension(0) == rows && lhs.dimension(1) == columns)
+        {
+            ir::count_reused_bytes(lhs.size() * sizeof(T));
+            auto m = lhs.matrix();
+            broadcast_matrix_view(rhs, rows, columns,
+                [&](auto const& r)
                 {
-                    auto m = result.matrix();
-                    Op{}.op_assign(m, curr.matrix());
-                }
-                return std::move(result);
-            })};
+                    Op{}.op_assign(m, r);
+                },
+                name_, codename_);
+            return std::move(lhs);
+        }
+
+        return broadcast_matrix_views(lhs, rhs, rows, columns,
+            [](auto const& l, auto const& r) -> arg_type<T>
+            {
+                return arg_type<T>{
+                    typename arg_type<T>::storage2d_type(Op{}(l, r))};
+            },
+            name_, codename_);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -212,12 +236,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             else
             {
                 // Reuse the memory from rhs operand
+                ir::count_reused_bytes(rhs.size() * sizeof(T));
                 rhs.tensor() = Op{}(lhs.tensor(), rhs.tensor());
             }
             return primitive_argument_type(std::move(rhs));
         }
 
         // Reuse the memory from lhs operand
+        ir::count_reused_bytes(lhs.size() * sizeof(T));
         auto m = lhs.tensor();
         Op{}.op_assign(m, rhs.tensor());
 
@@ -269,12 +295,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     auto sizes =
                         extract_largest_dimensions(name_, codename_, op1, op2);
 
-                    auto lhs = extract_value_vector<T>(
-                        std::move(op1), sizes[0], name_, codename_);
-                    auto rhs = extract_value_vector<T>(
-                        std::move(op2), sizes[0], name_, codename_);
-
-                    return numeric1d1d<T>(std::move(lhs), std::move(rhs));
+                    return primitive_argument_type{numeric1d_broadcast<T>(
+                        extract_node_data<T>(std::move(op1), name_, codename_),
+                        extract_node_data<T>(std::move(op2), name_, codename_),
+                        sizes[0])};
                 }
 
                 return numeric1d1d<T>(
@@ -290,12 +314,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     auto sizes =
                         extract_largest_dimensions(name_, codename_, op1, op2);
 
-                    auto lhs = extract_value_matrix<T>(
-                        std::move(op1), sizes[0], sizes[1], name_, codename_);
-                    auto rhs = extract_value_matrix<T>(
-                        std::move(op2), sizes[0], sizes[1], name_, codename_);
-
-                    return numeric2d2d<T>(std::move(lhs), std::move(rhs));
+                    return primitive_argument_type{numeric2d_broadcast<T>(
+                        extract_node_data<T>(std::move(op1), name_, codename_),
+                        extract_node_data<T>(std::move(op2), name_, codename_),
+                        sizes[0], sizes[1])};
                 }
 
                 return numeric2d2d<T>(
@@ -357,6 +379,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(op1), std::move(op2));
 
+        case node_data_type_float:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(op1), std::move(op2));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
@@ -397,30 +423,34 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case 1:
             {
-                args_type<T> args;
-                args.reserve(ops.size());
-
-                for (auto && op : std::move(ops))
+                // broadcast operands pair-wise, only the (first) result is
+                // allocated
+                auto result =
+                    extract_node_data<T>(std::move(ops[0]), name_, codename_);
+                for (std::size_t i = 1; i != ops.size(); ++i)
                 {
-                    args.emplace_back(extract_value_vector<T>(
-                        std::move(op), sizes[0], name_, codename_));
+                    result = numeric1d_broadcast<T>(std::move(result),
+                        extract_node_data<T>(
+                            std::move(ops[i]), name_, codename_),
+                        sizes[0]);
                 }
-
-                return numeric1d1d<T>(std::move(args));
+                return primitive_argument_type{std::move(result)};
             }
 
         case 2:
             {
-                args_type<T> args;
-                args.reserve(ops.size());
-
-                for (auto && op : std::move(ops))
+                // broadcast operands pair-wise, only the (first) result is
+                // allocated
+                auto result =
+                    extract_node_data<T>(std::move(ops[0]), name_, codename_);
+                for (std::size_t i = 1; i != ops.size(); ++i)
                 {
-                    args.emplace_back(extract_value_matrix<T>(
-                        std::move(op), sizes[0], sizes[1], name_, codename_));
+                    result = numeric2d_broadcast<T>(std::move(result),
+                        extract_node_data<T>(
+                            std::move(ops[i]), name_, codename_),
+                        sizes[0], sizes[1]);
                 }
-
-                return numeric2d2d<T>(std::move(args));
+                return primitive_argument_type{std::move(result)};
             }
 
         case 3:
@@ -469,6 +499,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(ops));
 
+        case node_data_type_float:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(ops));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
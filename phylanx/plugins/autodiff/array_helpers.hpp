@@ -0,0 +1,201 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_ARRAY_HELPERS)
+#define PHYLANX_PLUGINS_AUTODIFF_ARRAY_HELPERS
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// The gradient primitives operate on arrays of any number of dimensions. The
+// arrays are handled as sequences of their elements in row major order, the
+// shape of an array is padded with leading ones to PHYLANX_MAX_DIMENSIONS
+// dimensions (the dimensions are right aligned as for broadcasting).
+namespace phylanx { namespace execution_tree { namespace primitives {
+namespace detail
+{
+    using padded_shape = std::array<std::size_t, PHYLANX_MAX_DIMENSIONS>;
+
+    inline padded_shape gradient_shape(
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
+        std::size_t ndim)
+    {
+        padded_shape shape;
+        shape.fill(1);
+        for (std::size_t i = 0; i != ndim; ++i)
+        {
+            shape[PHYLANX_MAX_DIMENSIONS - ndim + i] = dims[i];
+        }
+        return shape;
+    }
+
+    inline padded_shape gradient_shape(ir::node_data<double> const& arg)
+    {
+        return gradient_shape(arg.dimensions(), arg.num_dimensions());
+    }
+
+    inline std::size_t gradient_size(padded_shape const& shape)
+    {
+        std::size_t size = 1;
+        for (std::size_t dim : shape)
+        {
+            size *= dim;
+        }
+        return size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline std::vector<double> gradient_values(
+        ir::node_data<double> const& arg)
+    {
+        std::vector<double> values;
+        values.reserve(arg.size());
+
+        switch (arg.num_dimensions())
+        {
+        case 0:
+            values.push_back(arg.scalar());
+            break;
+
+        case 1:
+            {
+                auto v = arg.vector();
+                values.assign(v.begin(), v.end());
+            }
+            break;
+
+        case 2:
+            {
+                auto m = arg.matrix();
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    auto r = blaze::row(m, i);
+                    values.insert(values.end(), r.begin(), r.end());
+                }
+            }
+            break;
+
+        case 3:
+            {
+                auto t = arg.tensor();
+                for (std::size_t k = 0; k != t.pages(); ++k)
+                {
+                    auto page = blaze::pageslice(t, k);
+                    for (std::size_t i = 0; i != t.rows(); ++i)
+                    {
+                        auto r = blaze::row(page, i);
+                        values.insert(values.end(), r.begin(), r.end());
+                    }
+                }
+            }
+            break;
+
+        default:
+            {
+                auto q = arg.quatern();
+                for (std::size_t l = 0; l != q.quats(); ++l)
+                {
+                    for (std::size_t k = 0; k != q.pages(); ++k)
+                    {
+                        for (std::size_t i = 0; i != q.rows(); ++i)
+                        {
+                            for (std::size_t j = 0; j != q.columns(); ++j)
+                            {
+                                values.push_back(q(l, k, i, j));
+                            }
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        return values;
+    }
+
+    // create an array with the given number of dimensions from its elements
+    inline ir::node_data<double> gradient_array(
+        std::vector<double> const& values, padded_shape const& shape,
+        std::size_t ndim)
+    {
+        std::size_t const columns = shape[PHYLANX_MAX_DIMENSIONS - 1];
+        std::size_t const rows = shape[PHYLANX_MAX_DIMENSIONS - 2];
+        std::size_t const pages = shape[PHYLANX_MAX_DIMENSIONS - 3];
+
+        switch (ndim)
+        {
+        case 0:
+            return ir::node_data<double>{values[0]};
+
+        case 1:
+            {
+                blaze::DynamicVector<double> result(columns);
+                std::copy(values.begin(), values.end(), result.begin());
+                return ir::node_data<double>{std::move(result)};
+            }
+
+        case 2:
+            {
+                blaze::DynamicMatrix<double> result(rows, columns);
+                for (std::size_t i = 0; i != rows; ++i)
+                {
+                    auto r = blaze::row(result, i);
+                    auto const* p = &values[i * columns];
+                    std::copy(p, p + columns, r.begin());
+                }
+                return ir::node_data<double>{std::move(result)};
+            }
+
+        case 3:
+            {
+                blaze::DynamicTensor<double> result(pages, rows, columns);
+                for (std::size_t k = 0; k != pages; ++k)
+                {
+                    auto page = blaze::pageslice(result, k);
+                    for (std::size_t i = 0; i != rows; ++i)
+                    {
+                        auto r = blaze::row(page, i);
+                        auto const* p = &values[(k * rows + i) * columns];
+                        std::copy(p, p + columns, r.begin());
+                    }
+                }
+                return ir::node_data<double>{std::move(result)};
+            }
+
+        default:
+            break;
+        }
+
+        std::size_t const quats = shape[PHYLANX_MAX_DIMENSIONS - 4];
+        blaze::DynamicArray<4UL, double> result(quats, pages, rows, columns);
+
+        auto it = values.begin();
+        for (std::size_t l = 0; l != quats; ++l)
+        {
+            for (std::size_t k = 0; k != pages; ++k)
+            {
+                for (std::size_t i = 0; i != rows; ++i)
+                {
+                    for (std::size_t j = 0; j != columns; ++j)
+                    {
+                        result(l, k, i, j) = *it++;
+                    }
+                }
+            }
+        }
+        return ir::node_data<double>{std::move(result)};
+    }
+}}}}
+
+#endif
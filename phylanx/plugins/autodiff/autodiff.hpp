@@ -0,0 +1,15 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_PRIMITIVES)
+#define PHYLANX_PLUGINS_AUTODIFF_PRIMITIVES
+
+#include <phylanx/plugins/autodiff/conv_gradient_operation.hpp>
+#include <phylanx/plugins/autodiff/dot_gradient_operation.hpp>
+#include <phylanx/plugins/autodiff/pool2d_gradient_operation.hpp>
+#include <phylanx/plugins/autodiff/unbroadcast_operation.hpp>
+#include <phylanx/plugins/autodiff/unreduce_operation.hpp>
+
+#endif
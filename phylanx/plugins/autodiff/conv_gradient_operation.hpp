@@ -0,0 +1,89 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_CONV_GRADIENT_OPERATION)
+#define PHYLANX_PLUGINS_AUTODIFF_CONV_GRADIENT_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Gradient of conv1d or conv2d with respect to the input or the
+    ///        kernel
+    /// \param g              The adjoint of the result of the convolution
+    /// \param x              The input of the convolution
+    /// \param kernel         The kernel of the convolution
+    /// \param padding        The padding mode of the convolution
+    /// \param strides        The strides of the convolution
+    /// \param dilation_rate  The dilation rate of the convolution
+    class conv_gradient_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<conv_gradient_operation>
+    {
+    public:
+        enum class operation
+        {
+            conv1d_input,
+            conv1d_kernel,
+            conv2d_input,
+            conv2d_kernel
+        };
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static std::vector<match_pattern_type> const match_data;
+
+        conv_gradient_operation() = default;
+
+        conv_gradient_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        std::array<std::int64_t, 2> extract_sizes(
+            primitive_argument_type const& arg, std::size_t count,
+            char const* what) const;
+
+        primitive_argument_type conv1d_gradient(ir::node_data<double>&& g,
+            ir::node_data<double>&& x, ir::node_data<double>&& kernel,
+            std::string const& padding, std::int64_t stride,
+            std::int64_t dilation) const;
+        primitive_argument_type conv2d_gradient(ir::node_data<double>&& g,
+            ir::node_data<double>&& x, ir::node_data<double>&& kernel,
+            std::string const& padding,
+            std::array<std::int64_t, 2> const& strides,
+            std::array<std::int64_t, 2> const& dilation) const;
+
+    private:
+        operation operation_;
+    };
+
+    inline primitive create_conv_gradient_operation(
+        hpx::id_type const& locality, primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__conv1d_grad_input",
+            std::move(operands), name, codename);
+    }
+}}}
+
+#endif
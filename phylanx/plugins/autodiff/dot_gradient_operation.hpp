@@ -0,0 +1,71 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_DOT_GRADIENT_OPERATION)
+#define PHYLANX_PLUGINS_AUTODIFF_DOT_GRADIENT_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Gradient of dot(a, b) with respect to one of its arguments
+    /// \param g  The adjoint of the result of dot(a, b)
+    /// \param a  The first argument of dot
+    /// \param b  The second argument of dot
+    class dot_gradient_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<dot_gradient_operation>
+    {
+    public:
+        enum class operation
+        {
+            lhs,            // the gradient with respect to a
+            rhs             // the gradient with respect to b
+        };
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static std::vector<match_pattern_type> const match_data;
+
+        dot_gradient_operation() = default;
+
+        dot_gradient_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        primitive_argument_type dot_gradient_lhs(ir::node_data<double>&& g,
+            ir::node_data<double>&& a, ir::node_data<double>&& b) const;
+        primitive_argument_type dot_gradient_rhs(ir::node_data<double>&& g,
+            ir::node_data<double>&& a, ir::node_data<double>&& b) const;
+
+    private:
+        operation operation_;
+    };
+
+    inline primitive create_dot_gradient_operation(
+        hpx::id_type const& locality, primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "__dot_grad_lhs", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_POOL2D_GRADIENT_OPERATION)
+#define PHYLANX_PLUGINS_AUTODIFF_POOL2D_GRADIENT_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Gradient of max_pool2d or avg_pool2d with respect to the input
+    /// \param g          The adjoint of the result of the pooling
+    /// \param x          The input of the pooling
+    /// \param pool_size  The pool size of the pooling
+    /// \param padding    The padding mode of the pooling
+    /// \param strides    The strides of the pooling
+    class pool2d_gradient_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<pool2d_gradient_operation>
+    {
+    public:
+        enum class operation
+        {
+            max_pool2d,
+            avg_pool2d
+        };
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static std::vector<match_pattern_type> const match_data;
+
+        pool2d_gradient_operation() = default;
+
+        pool2d_gradient_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        std::array<std::int64_t, 2> extract_sizes(
+            primitive_argument_type const& arg, char const* what) const;
+
+        primitive_argument_type pool2d_gradient(ir::node_data<double>&& g,
+            ir::node_data<double>&& x,
+            std::array<std::int64_t, 2> const& pool_size,
+            std::string const& padding,
+            std::array<std::int64_t, 2> const& strides) const;
+
+    private:
+        operation operation_;
+    };
+
+    inline primitive create_pool2d_gradient_operation(
+        hpx::id_type const& locality, primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__max_pool2d_grad",
+            std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_UNBROADCAST_OPERATION)
+#define PHYLANX_PLUGINS_AUTODIFF_UNBROADCAST_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Reduce the adjoint of the result of a broadcasting operation to
+    ///        the shape of one of its arguments
+    /// \param g     The adjoint of the result of the operation
+    /// \param like  The argument of the operation, g is summed over all
+    ///              dimensions this argument was broadcast along
+    class unbroadcast_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<unbroadcast_operation>
+    {
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static match_pattern_type const match_data;
+
+        unbroadcast_operation() = default;
+
+        unbroadcast_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        primitive_argument_type unbroadcast(ir::node_data<double>&& g,
+            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
+            std::size_t ndim) const;
+    };
+
+    inline primitive create_unbroadcast_operation(
+        hpx::id_type const& locality, primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__unbroadcast",
+            std::move(operands), name, codename);
+    }
+}}}
+
+#endif
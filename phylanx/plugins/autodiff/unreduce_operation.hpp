@@ -0,0 +1,75 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_AUTODIFF_UNREDUCE_OPERATION)
+#define PHYLANX_PLUGINS_AUTODIFF_UNREDUCE_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Expand the result of a reduction (or its adjoint) to the shape
+    ///        of the reduced argument
+    /// \param value  The (reduced) value to expand
+    /// \param like   The argument of the reduction
+    /// \param axis   The axis (or list of axes) the reduction was performed
+    ///               along, nil if all elements were reduced
+    class unreduce_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<unreduce_operation>
+    {
+    public:
+        enum class operation
+        {
+            unreduce,           // repeat the value
+            unreduce_mean       // repeat the value divided by the count
+        };
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static std::vector<match_pattern_type> const match_data;
+
+        unreduce_operation() = default;
+
+        unreduce_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        primitive_argument_type unreduce(ir::node_data<double>&& value,
+            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
+            std::size_t ndim, std::vector<std::int64_t> const& axes) const;
+
+    private:
+        operation operation_;
+    };
+
+    inline primitive create_unreduce_operation(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "__unreduce", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
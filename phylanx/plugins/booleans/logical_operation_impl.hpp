@@ -10,6 +10,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/primitives/broadcast_views.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
@@ -259,15 +260,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicVector<T> lhs_data, rhs_data;
-
-            extract_value_vector(
-                lhs_data, std::move(lhs), sizes[0], name_, codename_);
-            extract_value_vector(
-                rhs_data, std::move(rhs), sizes[0], name_, codename_);
-
-            return ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                [&](bool x, bool y) -> std::uint8_t { return Op{}(x, y); })};
+            // broadcast the operands without materializing them
+            return broadcast_vector_views(lhs, rhs, sizes[0],
+                [&](auto const& lhs_data, auto const& rhs_data)
+                    -> primitive_argument_type
+                {
+                    return primitive_argument_type{
+                        ir::node_data<std::uint8_t>{blaze::map(lhs_data,
+                            rhs_data, [&](bool x, bool y) -> std::uint8_t {
+                                return Op{}(x, y);
+                            })}};
+                },
+                name_, codename_);
         }
 
         return logical1d1d(std::move(lhs), std::move(rhs));
@@ -315,15 +319,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicMatrix<T> lhs_data, rhs_data;
-
-            extract_value_matrix(
-                lhs_data, std::move(lhs), sizes[0], sizes[1], name_, codename_);
-            extract_value_matrix(
-                rhs_data, std::move(rhs), sizes[0], sizes[1], name_, codename_);
-
-            return ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                [&](bool x, bool y) -> std::uint8_t { return Op{}(x, y); })};
+            // broadcast the operands without materializing them
+            return broadcast_matrix_views(lhs, rhs, sizes[0], sizes[1],
+                [&](auto const& lhs_data, auto const& rhs_data)
+                    -> primitive_argument_type
+                {
+                    return primitive_argument_type{
+                        ir::node_data<std::uint8_t>{blaze::map(lhs_data,
+                            rhs_data, [&](bool x, bool y) -> std::uint8_t {
+                                return Op{}(x, y);
+                            })}};
+                },
+                name_, codename_);
         }
 
         return logical2d2d(std::move(lhs), std::move(rhs));
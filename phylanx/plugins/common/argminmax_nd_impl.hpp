@@ -90,6 +90,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_float: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_unknown:
             return detail::argminmax0d<Operation>(numargs,
                 execution_tree::extract_numeric_value(
@@ -192,6 +193,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_float: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_unknown:
             return detail::argminmax1d<Operation>(numargs,
                 execution_tree::extract_numeric_value(
@@ -431,6 +433,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_float: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_unknown:
             return detail::argminmax2d<Operation>(numargs,
                 execution_tree::extract_numeric_value(
@@ -663,6 +666,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_float: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_unknown:
             return detail::argminmax3d<Operation>(numargs,
                 execution_tree::extract_numeric_value(
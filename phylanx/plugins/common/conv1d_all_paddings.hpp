@@ -17,45 +17,58 @@
 
 namespace phylanx { namespace common {
 
+    // all convolutions are available for double and float data
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type conv1d_valid(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel);
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type conv1d_valid(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t strides);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
-    conv1d_valid_dilation(ir::node_data<double>&& arg,
-        ir::node_data<double>&& kernel, std::int64_t dilation_rate);
+    conv1d_valid_dilation(ir::node_data<T>&& arg,
+        ir::node_data<T>&& kernel, std::int64_t dilation_rate);
 
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type conv1d_same(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel);
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type conv1d_same(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t strides);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
-    conv1d_same_dilation(ir::node_data<double>&& arg,
-        ir::node_data<double>&& kernel, std::int64_t dilation_rate);
+    conv1d_same_dilation(ir::node_data<T>&& arg,
+        ir::node_data<T>&& kernel, std::int64_t dilation_rate);
 
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type conv1d_causal(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel);
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type conv1d_causal(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t strides);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
-    conv1d_causal_dilation(ir::node_data<double>&& arg,
-        ir::node_data<double>&& kernel, std::int64_t dilation_rate);
+    conv1d_causal_dilation(ir::node_data<T>&& arg,
+        ir::node_data<T>&& kernel, std::int64_t dilation_rate);
 
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
-    conv1d_all_paddings(ir::node_data<double>&& arg,
-        ir::node_data<double>&& kernel, std::string&& padding,
+    conv1d_all_paddings(ir::node_data<T>&& arg,
+        ir::node_data<T>&& kernel, std::string&& padding,
         std::string const& name, std::string const& codename);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
-    conv1d_all_paddings(ir::node_data<double>&& arg,
-        ir::node_data<double>&& kernel, std::string&& padding,
+    conv1d_all_paddings(ir::node_data<T>&& arg,
+        ir::node_data<T>&& kernel, std::string&& padding,
         std::int64_t strides, std::string const& name,
         std::string const& codename);
+    template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
-    conv1d_all_paddings_dilation(ir::node_data<double>&& arg,
-        ir::node_data<double>&& kernel, std::string&& padding,
+    conv1d_all_paddings_dilation(ir::node_data<T>&& arg,
+        ir::node_data<T>&& kernel, std::string&& padding,
         std::int64_t dilation_rate, std::string const& name,
         std::string const& codename);
 
@@ -0,0 +1,125 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_COMMON_CONV_ENGINE)
+#define PHYLANX_COMMON_CONV_ENGINE
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// All convolutions (conv1d, separable_conv1d, conv2d, and conv2d_transpose)
+// are lowered to a matrix product of the input patches (im2col) with the
+// kernel reshaped into a (taps * in_channels) x out_channels matrix.
+namespace phylanx { namespace common {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Geometry of one spatial dimension of a convolution. The output element
+    // i reads the input elements at i * stride - pad + t * dilation for all
+    // kernel taps t. Positions outside of the input are zero (padding). The
+    // input is upsampled by inserting upsampling - 1 zeros in between the
+    // elements, which is used for transposed convolutions.
+    struct conv_dimension
+    {
+        conv_dimension(std::int64_t input_size, std::int64_t kernel_size,
+            std::int64_t output_size, std::int64_t pad,
+            std::int64_t stride = 1, std::int64_t dilation = 1,
+            std::int64_t upsampling = 1)
+          : input_size_(input_size)
+          , kernel_size_(kernel_size)
+          , output_size_(output_size)
+          , pad_(pad)
+          , stride_(stride)
+          , dilation_(dilation)
+          , upsampling_(upsampling)
+        {
+        }
+
+        std::int64_t input_size_;
+        std::int64_t kernel_size_;
+        std::int64_t output_size_;
+        std::int64_t pad_;
+        std::int64_t stride_;
+        std::int64_t dilation_;
+        std::int64_t upsampling_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of zeros added in front of the input for the given padding mode
+    // ('valid', 'same', or 'causal'), this is shared with the pooling
+    // operations
+    PHYLANX_COMMON_EXPORT std::int64_t conv_padding(std::string const& padding,
+        std::int64_t input_size, std::int64_t kernel_size,
+        std::int64_t stride = 1, std::int64_t dilation = 1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reshape the kernels into the matrix used by the engine, the forward
+    // convolutions are available for double and float
+    template <typename T>
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<T> conv1d_kernel_matrix(
+        ir::node_data<T> const& kernel);
+    template <typename T>
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<T>
+    separable_conv1d_kernel_matrix(ir::node_data<T> const& depth_kernel,
+        ir::node_data<T> const& point_kernel);
+    template <typename T>
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<T> conv2d_kernel_matrix(
+        ir::node_data<T> const& kernel);
+    template <typename T>
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<T>
+    conv2d_transpose_kernel_matrix(ir::node_data<T> const& kernel);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // arg is a (batch, length, in_channels) tensor
+    template <typename T>
+    PHYLANX_COMMON_EXPORT blaze::DynamicTensor<T> conv1d_gemm(
+        ir::node_data<T> const& arg, blaze::DynamicMatrix<T> const& kernel,
+        conv_dimension const& length);
+
+    // arg is a (batch, height, width, in_channels) array
+    template <typename T>
+    PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, T> conv2d_gemm(
+        ir::node_data<T> const& arg, blaze::DynamicMatrix<T> const& kernel,
+        conv_dimension const& height, conv_dimension const& width);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Gradients of conv1d_gemm and conv2d_gemm, grad is the gradient with
+    // respect to their result. The gradient with respect to the kernel is
+    // returned in the shape of the matrix used by the engine.
+    PHYLANX_COMMON_EXPORT blaze::DynamicTensor<double>
+    conv1d_gemm_input_gradient(ir::node_data<double> const& grad,
+        blaze::DynamicMatrix<double> const& kernel,
+        conv_dimension const& length);
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double>
+    conv1d_gemm_kernel_gradient(ir::node_data<double> const& arg,
+        ir::node_data<double> const& grad, conv_dimension const& length);
+
+    PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, double>
+    conv2d_gemm_input_gradient(ir::node_data<double> const& grad,
+        blaze::DynamicMatrix<double> const& kernel,
+        conv_dimension const& height, conv_dimension const& width);
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double>
+    conv2d_gemm_kernel_gradient(ir::node_data<double> const& arg,
+        ir::node_data<double> const& grad, conv_dimension const& height,
+        conv_dimension const& width);
+
+    // Reshape a matrix used by the engine back into a kernel
+    PHYLANX_COMMON_EXPORT blaze::DynamicTensor<double>
+    conv1d_kernel_from_matrix(
+        blaze::DynamicMatrix<double> const& kernel, std::size_t filter_length);
+    PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, double>
+    conv2d_kernel_from_matrix(blaze::DynamicMatrix<double> const& kernel,
+        std::size_t filter_height, std::size_t filter_width);
+}}
+
+#endif
@@ -0,0 +1,305 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_COMMON_SORT_KERNELS)
+#define PHYLANX_COMMON_SORT_KERNELS
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/parallel_sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Sorting kernels shared by sort, argsort, unique, and sort_d. Long sequences
+// are sorted using HPX's parallel sort, independent rows, columns, or pages
+// of an array are sorted concurrently.
+namespace phylanx { namespace common {
+
+    // sequences (or amounts of work) smaller than this are handled on the
+    // calling thread
+    constexpr std::size_t parallel_sort_threshold = 65536;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f(i) for all i in [0, count), work is the overall number of
+    // elements touched by all invocations
+    template <typename F>
+    void sort_for_loop(std::size_t count, std::size_t work, F&& f)
+    {
+        if (count < 2 || work < parallel_sort_threshold)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(i);
+            }
+            return;
+        }
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), count,
+            std::forward<F>(f));
+    }
+
+    namespace detail
+    {
+        // booleans are sorted by counting the number of false values
+        template <typename T>
+        void sort_values(T* begin, T* end, std::true_type)
+        {
+            std::ptrdiff_t falses = std::count(begin, end, T(0));
+            std::fill(begin, begin + falses, T(0));
+            std::fill(begin + falses, end, T(1));
+        }
+
+        template <typename T>
+        void sort_values(T* begin, T* end, std::false_type)
+        {
+            if (std::size_t(end - begin) < parallel_sort_threshold)
+            {
+                std::sort(begin, end);
+                return;
+            }
+            hpx::parallel::sort(hpx::execution::par, begin, end);
+        }
+
+        // Ties are broken using the original position of the elements,
+        // which makes the sort stable (independently of the algorithm)
+        struct stable_less
+        {
+            template <typename T>
+            bool operator()(std::pair<T, std::int64_t> const& lhs,
+                std::pair<T, std::int64_t> const& rhs) const
+            {
+                return lhs.first < rhs.first ||
+                    (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+            }
+        };
+
+        template <typename Iter, typename Less>
+        void sort_range(Iter begin, Iter end, Less&& less)
+        {
+            if (std::size_t(std::distance(begin, end)) <
+                parallel_sort_threshold)
+            {
+                std::sort(begin, end, std::forward<Less>(less));
+                return;
+            }
+            hpx::parallel::sort(
+                hpx::execution::par, begin, end, std::forward<Less>(less));
+        }
+
+        // Sort the elements of the given sequence together with their
+        // positions
+        template <typename T, typename Values>
+        std::vector<std::pair<T, std::int64_t>> stable_sort_keys(
+            Values const& values)
+        {
+            std::size_t const size = values.size();
+
+            std::vector<std::pair<T, std::int64_t>> keys(size);
+            sort_for_loop(size, size, [&](std::size_t i) {
+                keys[i] = std::make_pair(
+                    T(values[i]), static_cast<std::int64_t>(i));
+            });
+
+            sort_range(keys.begin(), keys.end(), stable_less{});
+            return keys;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the given contiguous sequence in ascending order
+    template <typename T>
+    void sort_values(T* begin, T* end)
+    {
+        detail::sort_values(begin, end, std::is_same<T, std::uint8_t>{});
+    }
+
+    // Sort num_lanes independent sequences (rows, columns, etc.) of the
+    // given length, lane(i) returns a view of the i-th sequence. Strided
+    // sequences are sorted in a contiguous buffer.
+    template <typename T, typename Lane>
+    void sort_lanes(std::size_t num_lanes, std::size_t length, Lane&& lane)
+    {
+        sort_for_loop(num_lanes, num_lanes * length, [&](std::size_t i) {
+            auto l = lane(i);
+
+            std::vector<T> buffer(l.begin(), l.end());
+            sort_values(buffer.data(), buffer.data() + buffer.size());
+            std::copy(buffer.begin(), buffer.end(), l.begin());
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Store the indices that sort the given values into indices, equal
+    // values keep their relative order
+    template <typename T, typename Values, typename Indices>
+    void argsort_values(Values const& values, Indices&& indices)
+    {
+        auto keys = detail::stable_sort_keys<T>(values);
+        sort_for_loop(keys.size(), keys.size(),
+            [&](std::size_t i) { indices[i] = keys[i].second; });
+    }
+
+    // Apply argsort_values to num_lanes independent sequences of the given
+    // length, lane(i) and index_lane(i) return views of the i-th sequence
+    // of values and of indices
+    template <typename T, typename Lane, typename IndexLane>
+    void argsort_lanes(std::size_t num_lanes, std::size_t length, Lane&& lane,
+        IndexLane&& index_lane)
+    {
+        sort_for_loop(num_lanes, num_lanes * length, [&](std::size_t i) {
+            argsort_values<T>(lane(i), index_lane(i));
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sorted unique elements (values or rows/columns) of a sequence. For
+    // each unique element, indices_ holds the position of its first
+    // occurrence and counts_ the number of its occurrences. For each element
+    // of the sequence, inverse_ holds the position of its unique element.
+    struct unique_groups
+    {
+        blaze::DynamicVector<std::int64_t> indices_;
+        blaze::DynamicVector<std::int64_t> inverse_;
+        blaze::DynamicVector<std::int64_t> counts_;
+    };
+
+    namespace detail
+    {
+        // order is the (stable) sorted sequence of the positions of the
+        // elements, starts the positions in order at which a new unique
+        // element begins (followed by the overall number of elements)
+        inline unique_groups make_unique_groups(
+            std::vector<std::int64_t> const& order,
+            std::vector<std::size_t> const& starts)
+        {
+            std::size_t const num_unique = starts.size() - 1;
+
+            unique_groups result;
+            result.indices_.resize(num_unique);
+            result.inverse_.resize(order.size());
+            result.counts_.resize(num_unique);
+
+            sort_for_loop(num_unique, order.size(), [&](std::size_t k) {
+                // the sort is stable, thus the first element of each group
+                // is the first occurrence of the unique element
+                result.indices_[k] = order[starts[k]];
+                result.counts_[k] =
+                    static_cast<std::int64_t>(starts[k + 1] - starts[k]);
+                for (std::size_t j = starts[k]; j != starts[k + 1]; ++j)
+                {
+                    result.inverse_[order[j]] = static_cast<std::int64_t>(k);
+                }
+            });
+            return result;
+        }
+    }
+
+    // Sorted unique values of the given sequence, fills groups if given
+    template <typename T, typename Values>
+    blaze::DynamicVector<T> unique_values(
+        Values const& values, unique_groups* groups = nullptr)
+    {
+        if (groups == nullptr)
+        {
+            blaze::DynamicVector<T> result(values.size());
+            std::copy(values.begin(), values.end(), result.begin());
+
+            sort_values(result.data(), result.data() + result.size());
+            auto last = std::unique(result.data(),
+                result.data() + result.size());
+
+            result.resize(last - result.data());
+            return result;
+        }
+
+        auto keys = detail::stable_sort_keys<T>(values);
+
+        std::vector<std::int64_t> order(keys.size());
+        std::vector<std::size_t> starts;
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            if (i == 0 || keys[i - 1].first < keys[i].first)
+            {
+                starts.push_back(i);
+            }
+            order[i] = keys[i].second;
+        }
+        starts.push_back(keys.size());
+
+        blaze::DynamicVector<T> result(starts.size() - 1);
+        for (std::size_t k = 0; k != result.size(); ++k)
+        {
+            result[k] = keys[starts[k]].first;
+        }
+
+        *groups = detail::make_unique_groups(order, starts);
+        return result;
+    }
+
+    // Sorted unique lanes (rows or columns) of an array, lane(i) returns a
+    // view of the i-th lane. Returns the positions of the unique lanes and
+    // fills groups if given.
+    template <typename Lane>
+    std::vector<std::int64_t> unique_lanes(std::size_t num_lanes,
+        std::size_t length, Lane&& lane, unique_groups* groups = nullptr)
+    {
+        auto less = [&](std::int64_t lhs, std::int64_t rhs) {
+            auto l = lane(lhs);
+            auto r = lane(rhs);
+            return std::lexicographical_compare(
+                l.begin(), l.end(), r.begin(), r.end());
+        };
+
+        std::vector<std::int64_t> order(num_lanes);
+        for (std::size_t i = 0; i != num_lanes; ++i)
+        {
+            order[i] = static_cast<std::int64_t>(i);
+        }
+
+        // sorting the positions is stable if ties are broken by position
+        auto stable = [&](std::int64_t lhs, std::int64_t rhs) {
+            return less(lhs, rhs) || (!less(rhs, lhs) && lhs < rhs);
+        };
+        if (num_lanes * length < parallel_sort_threshold)
+        {
+            std::sort(order.begin(), order.end(), stable);
+        }
+        else
+        {
+            hpx::parallel::sort(
+                hpx::execution::par, order.begin(), order.end(), stable);
+        }
+
+        std::vector<std::int64_t> result;
+        std::vector<std::size_t> starts;
+        for (std::size_t i = 0; i != num_lanes; ++i)
+        {
+            if (i == 0 || less(order[i - 1], order[i]))
+            {
+                starts.push_back(i);
+                result.push_back(order[i]);
+            }
+        }
+        starts.push_back(num_lanes);
+
+        if (groups != nullptr)
+        {
+            *groups = detail::make_unique_groups(order, starts);
+        }
+        return result;
+    }
+}}
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_COMMON_SPARSE_OPERATIONS_HPP)
+#define PHYLANX_COMMON_SPARSE_OPERATIONS_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+
+#include <hpx/datastructures/optional.hpp>
+
+#include <cstdint>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Operations on sparse (compressed) vectors and matrices. Sparse data is
+// always stored as ir::node_data<double>, the operations below expect at least
+// one of their operands to hold sparse data.
+namespace phylanx { namespace common
+{
+    ////////////////////////////////////////////////////////////////////////////
+    // Convert a dense vector or matrix into its sparse representation and vice
+    // versa, other arguments are returned unchanged.
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type to_sparse(
+        execution_tree::primitive_argument_type&& arg,
+        std::string const& name, std::string const& codename);
+
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type to_dense(
+        execution_tree::primitive_argument_type&& arg,
+        std::string const& name, std::string const& codename);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Dot product of two vectors or matrices. The result is sparse only if
+    // both operands are sparse (or if one of the operands is a scalar), the
+    // product of a sparse matrix with a dense vector is a dense vector (SpMV).
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type sparse_dot(
+        execution_tree::primitive_argument_type&& lhs,
+        execution_tree::primitive_argument_type&& rhs,
+        std::string const& name, std::string const& codename);
+
+    // Element-wise product with a scalar or with an array of the same shape,
+    // the result is always sparse.
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type sparse_mul(
+        execution_tree::primitive_argument_type&& lhs,
+        execution_tree::primitive_argument_type&& rhs,
+        std::string const& name, std::string const& codename);
+
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    sparse_transpose(execution_tree::primitive_argument_type&& arg,
+        std::string const& name, std::string const& codename);
+
+    // Sum of all elements or sums along the given axis, the result is dense.
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type sparse_sum(
+        execution_tree::primitive_argument_type&& arg,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        std::string const& name, std::string const& codename);
+}}
+
+#endif
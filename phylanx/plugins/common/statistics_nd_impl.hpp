@@ -914,6 +914,8 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float:
+                HPX_FALLTHROUGH;
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -1342,6 +1344,8 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float:
+                HPX_FALLTHROUGH;
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -1612,6 +1616,8 @@ namespace phylanx { namespace common {
                     axis0, axis1, axis2, keepdims, std::move(initial), name,
                     codename, std::move(ctx));
 
+            case execution_tree::node_data_type_float:
+                HPX_FALLTHROUGH;
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -2125,6 +2131,8 @@ namespace phylanx { namespace common {
                 axis, keepdims, std::move(initial), name, codename,
                 std::move(ctx));
 
+        case execution_tree::node_data_type_float:
+            HPX_FALLTHROUGH;
         case execution_tree::node_data_type_unknown:
             HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
@@ -2221,6 +2229,8 @@ namespace phylanx { namespace common {
                         std::move(arg), name, codename),
                     std::move(initial), name, codename, std::move(ctx));
 
+            case execution_tree::node_data_type_float:
+                HPX_FALLTHROUGH;
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -2319,6 +2329,8 @@ namespace phylanx { namespace common {
                     keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float:
+                HPX_FALLTHROUGH;
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -0,0 +1,157 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_CONTROLS_CHUNKING_POLICY_HPP)
+#define PHYLANX_CONTROLS_CHUNKING_POLICY_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Describes how the iterations of a (parallel) loop over the elements of
+    // an iteration space are grouped into HPX tasks. The textual form is:
+    //
+    //      "sequential"        all elements are evaluated on the calling
+    //                          thread
+    //      "auto"              the chunk size is derived from the measured
+    //                          time it takes to evaluate a single element
+    //      "static[:N]"        each task evaluates N contiguous elements (by
+    //                          default the elements are evenly distributed
+    //                          over the available cores)
+    //      "dynamic[:N]"       idle cores pick up the next N contiguous
+    //                          elements (work stealing, N is 1 by default)
+    struct chunking_policy
+    {
+        enum policy_kind
+        {
+            sequential,
+            automatic,
+            static_size,
+            dynamic_size
+        };
+
+        chunking_policy(policy_kind kind = sequential,
+                std::size_t chunk_size = 0)
+          : kind_(kind)
+          , chunk_size_(chunk_size)
+        {
+        }
+
+        policy_kind kind_;
+        std::size_t chunk_size_;
+    };
+
+    inline chunking_policy parse_chunking_policy(std::string const& spec,
+        std::string const& name, std::string const& codename)
+    {
+        std::string kind = spec;
+        std::size_t chunk_size = 0;
+
+        std::string::size_type p = spec.find(':');
+        if (p != std::string::npos)
+        {
+            kind = spec.substr(0, p);
+            try
+            {
+                chunk_size = std::stoul(spec.substr(p + 1));
+            }
+            catch (std::exception const&)
+            {
+                chunk_size = 0;
+                kind.clear();       // report error below
+            }
+        }
+
+        if (kind == "sequential" && p == std::string::npos)
+        {
+            return chunking_policy(chunking_policy::sequential);
+        }
+        if (kind == "auto" && p == std::string::npos)
+        {
+            return chunking_policy(chunking_policy::automatic);
+        }
+        if (kind == "static")
+        {
+            return chunking_policy(chunking_policy::static_size, chunk_size);
+        }
+        if (kind == "dynamic")
+        {
+            return chunking_policy(chunking_policy::dynamic_size,
+                chunk_size == 0 ? 1 : chunk_size);
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::primitives::parse_chunking_policy",
+            util::generate_error_message(
+                "invalid chunking policy '" + spec +
+                    "', expected 'sequential', 'auto', 'static[:N]', or "
+                    "'dynamic[:N]'",
+                name, codename));
+    }
+
+    // The policy used if none was specified explicitly, can be changed using
+    // the configuration setting phylanx.chunking_policy (read once)
+    inline chunking_policy default_chunking_policy(
+        std::string const& name, std::string const& codename)
+    {
+        static std::string const spec =
+            hpx::get_config_entry("phylanx.chunking_policy", "auto");
+        return parse_chunking_policy(spec, name, codename);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f(i) for all i in [0, size) as described by the given policy
+    template <typename F>
+    void chunked_for_loop(
+        chunking_policy const& policy, std::size_t size, F&& f)
+    {
+        switch (policy.kind_)
+        {
+        case chunking_policy::automatic:
+            hpx::for_loop(
+                hpx::execution::par.with(hpx::execution::auto_chunk_size()),
+                std::size_t(0), size, std::forward<F>(f));
+            return;
+
+        case chunking_policy::static_size:
+            hpx::for_loop(hpx::execution::par.with(
+                              hpx::execution::static_chunk_size(
+                                  policy.chunk_size_)),
+                std::size_t(0), size, std::forward<F>(f));
+            return;
+
+        case chunking_policy::dynamic_size:
+            hpx::for_loop(hpx::execution::par.with(
+                              hpx::execution::dynamic_chunk_size(
+                                  policy.chunk_size_)),
+                std::size_t(0), size, std::forward<F>(f));
+            return;
+
+        case chunking_policy::sequential:
+            HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            f(i);
+        }
+    }
+}}}
+
+#endif
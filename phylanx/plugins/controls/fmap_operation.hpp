@@ -9,6 +9,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/plugins/controls/chunking_policy.hpp>
 
 #include <hpx/futures/future.hpp>
 
@@ -38,28 +39,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
             eval_context ctx) const override;
 
         hpx::future<primitive_argument_type> fmap_1(
-            primitive_arguments_type const& operands,
-            primitive_arguments_type const& args, eval_context ctx) const;
+            primitive_argument_type const& list_operand,
+            primitive_arguments_type const& args,
+            chunking_policy const& policy, eval_context ctx) const;
         hpx::future<primitive_argument_type> fmap_n(
-            primitive_arguments_type const& operands,
-            primitive_arguments_type const& args, eval_context ctx) const;
+            primitive_arguments_type&& lists,
+            primitive_arguments_type const& args,
+            chunking_policy const& policy, eval_context ctx) const;
 
         primitive_argument_type fmap_1_scalar(primitive const* p,
             primitive_argument_type&& arg, eval_context ctx) const;
         primitive_argument_type fmap_1_vector(primitive const* p,
-            primitive_argument_type&& arg, eval_context ctx) const;
+            primitive_argument_type&& arg, chunking_policy const& policy,
+            eval_context ctx) const;
         primitive_argument_type fmap_1_matrix(primitive const* p,
-            primitive_argument_type&& arg, eval_context ctx) const;
+            primitive_argument_type&& arg, chunking_policy const& policy,
+            eval_context ctx) const;
 
         primitive_argument_type fmap_n_lists(primitive const* p,
-            primitive_arguments_type&& args, eval_context ctx) const;
+            primitive_arguments_type&& args, chunking_policy const& policy,
+            eval_context ctx) const;
 
         primitive_argument_type fmap_n_scalar(primitive const* p,
             primitive_arguments_type&& args, eval_context ctx) const;
         primitive_argument_type fmap_n_vector(primitive const* p,
-            primitive_arguments_type&& args, eval_context ctx) const;
+            primitive_arguments_type&& args, chunking_policy const& policy,
+            eval_context ctx) const;
         primitive_argument_type fmap_n_matrix(primitive const* p,
-            primitive_arguments_type&& args, eval_context ctx) const;
+            primitive_arguments_type&& args, chunking_policy const& policy,
+            eval_context ctx) const;
     };
 
     inline primitive create_fmap_operation(hpx::id_type const& locality,
@@ -9,6 +9,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/plugins/controls/chunking_policy.hpp>
 
 #include <hpx/futures/future.hpp>
 
@@ -38,14 +39,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             eval_context ctx) const override;
 
         void iterate_over_array(primitive const* p,
-            primitive_argument_type&& value, eval_context ctx) const;
+            primitive_argument_type&& value, chunking_policy const& policy,
+            eval_context ctx) const;
 
         void iterate_over_array_scalar(primitive const* p,
             primitive_argument_type&& value, eval_context ctx) const;
         void iterate_over_array_vector(primitive const* p,
-            primitive_argument_type&& value, eval_context ctx) const;
+            primitive_argument_type&& value, chunking_policy const& policy,
+            eval_context ctx) const;
         void iterate_over_array_matrix(primitive const* p,
-            primitive_argument_type&& value, eval_context ctx) const;
+            primitive_argument_type&& value, chunking_policy const& policy,
+            eval_context ctx) const;
 
     private:
         struct iteration_for;
@@ -98,6 +98,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                     Op::template initial<std::int64_t>());
 
             case node_data_type_double: HPX_FALLTHROUGH;
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return primitive_argument_type(Op::template initial<double>());
 
@@ -132,6 +133,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         size, Op::template initial<std::int64_t>()));
 
             case node_data_type_double: HPX_FALLTHROUGH;
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return primitive_argument_type(blaze::DynamicVector<double>(
                     size, Op::template initial<double>()));
@@ -209,6 +211,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         std::move(local_value), name, codename),
                     index, locs);
 
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return detail::argminmax0d_reduce<Op>(
                     extract_scalar_numeric_value(
@@ -312,6 +315,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         std::move(local_value), name, codename),
                     indices, locs);
 
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return detail::argminmax1d_reduce<Op>(
                     extract_numeric_value(
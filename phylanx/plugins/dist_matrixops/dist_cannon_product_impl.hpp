@@ -41,6 +41,7 @@ using std_uint8_t = std::uint8_t;
 
 ////////////////////////////////////////////////////////////////////////////////
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(float);
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_int64_t);
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_uint8_t);
 
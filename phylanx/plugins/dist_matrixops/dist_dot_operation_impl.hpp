@@ -46,16 +46,35 @@ using std_uint8_t = std::uint8_t;
 
 ////////////////////////////////////////////////////////////////////////////////
 REGISTER_DISTRIBUTED_VECTOR_DECLARATION(double);
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(float);
 REGISTER_DISTRIBUTED_VECTOR_DECLARATION(std_int64_t);
 REGISTER_DISTRIBUTED_VECTOR_DECLARATION(std_uint8_t);
 
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(float);
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_int64_t);
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_uint8_t);
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace dist_matrixops { namespace primitives {
 
+    ////////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // The tiles of the rhs are multiplied with the intersecting part of
+        // the local lhs tile. All remote tiles are requested up front, the
+        // local tile is processed while those are in flight, and the partial
+        // products of the remote tiles are accumulated in the order in which
+        // they arrive.
+        struct tile_product
+        {
+            execution_tree::tiling_span lhs_intersection_;
+            execution_tree::tiling_span rhs_intersection_;
+            std::size_t rhs_column_start_;
+            std::size_t rhs_column_size_;
+        };
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename T>
     execution_tree::primitive_argument_type dist_dot_operation::dot0d(
@@ -132,6 +151,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         // go over all tiles of rhs vector
         T dot_result = T{0};
 
+        std::vector<hpx::future<blaze::DynamicVector<T>>> remote_tiles;
+        std::vector<detail::tile_product> remote_products;
+
+        bool has_local_tile = false;
+        detail::tile_product local_product;
+
         std::uint32_t loc = 0;
         for (auto const& rhs_tile : rhs_localities.tiles_)
         {
@@ -163,27 +188,45 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                dot_result += T{blaze::dot(
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size()),
-                    blaze::subvector(*rhs_data, rhs_intersection.start_,
-                        rhs_intersection.size()))};
+                has_local_tile = true;
+                local_product = detail::tile_product{
+                    lhs_intersection, rhs_intersection, 0, 0};
             }
             else
             {
-                // calculate the dot product with remote tile
-                dot_result += T{blaze::dot(
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size()),
-                    rhs_data
-                        .fetch(loc, rhs_intersection.start_,
-                            rhs_intersection.stop_)
-                        .get())};
+                remote_tiles.push_back(rhs_data.fetch(
+                    loc, rhs_intersection.start_, rhs_intersection.stop_));
+                remote_products.push_back(detail::tile_product{
+                    lhs_intersection, rhs_intersection, 0, 0});
             }
             ++loc;
         }
 
+        if (has_local_tile)
+        {
+            // calculate the dot product with local tile
+            dot_result += T{blaze::dot(
+                blaze::subvector(lhs.vector(),
+                    local_product.lhs_intersection_.start_,
+                    local_product.lhs_intersection_.size()),
+                blaze::subvector(*rhs_data,
+                    local_product.rhs_intersection_.start_,
+                    local_product.rhs_intersection_.size()))};
+        }
+
+        // calculate the dot product with the remote tiles as they arrive
+        hpx::wait_each(
+            [&](std::size_t i, hpx::future<blaze::DynamicVector<T>>&& f)
+            {
+                auto const& lhs_intersection =
+                    remote_products[i].lhs_intersection_;
+                dot_result += T{blaze::dot(
+                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
+                        lhs_intersection.size()),
+                    f.get())};
+            },
+            remote_tiles);
+
         // collect overall result if left hand side vector is distributed
         if (lhs_localities.locality_.num_localities_ > 1)
         {
@@ -248,6 +291,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         blaze::DynamicVector<T> dot_result(
             rhs_localities.columns(name_, codename_), T{0});
 
+        std::vector<hpx::future<blaze::DynamicMatrix<T>>> remote_tiles;
+        std::vector<detail::tile_product> remote_products;
+
+        bool has_local_tile = false;
+        detail::tile_product local_product;
+
         std::uint32_t loc = 0;
         std::size_t rhs_span_index = 0;
         for (auto const& rhs_tile : rhs_localities.tiles_)
@@ -279,31 +328,51 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                blaze::subvector(
-                    dot_result, rhs_column_start, rhs_column_size) +=
-                    blaze::trans(
-                        blaze::submatrix(rhs.matrix(), rhs_intersection.start_,
-                            0, rhs_intersection.size(), rhs.dimension(1))) *
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size());
+                has_local_tile = true;
+                local_product = detail::tile_product{lhs_intersection,
+                    rhs_intersection, rhs_column_start, rhs_column_size};
             }
             else
             {
-                // calculate the dot product with remote tile
-                blaze::subvector(
-                    dot_result, rhs_column_start, rhs_column_size) +=
-                    blaze::trans(
-                        rhs_data
-                            .fetch(loc, rhs_intersection.start_, 0,
-                                rhs_intersection.stop_, rhs_column_size)
-                            .get()) *
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size());
+                remote_tiles.push_back(rhs_data.fetch(loc,
+                    rhs_intersection.start_, 0, rhs_intersection.stop_,
+                    rhs_column_size));
+                remote_products.push_back(detail::tile_product{
+                    lhs_intersection, rhs_intersection, rhs_column_start,
+                    rhs_column_size});
             }
             ++loc;
         }
 
+        if (has_local_tile)
+        {
+            // calculate the dot product with local tile
+            auto const& lhs_intersection = local_product.lhs_intersection_;
+            auto const& rhs_intersection = local_product.rhs_intersection_;
+
+            blaze::subvector(dot_result, local_product.rhs_column_start_,
+                local_product.rhs_column_size_) +=
+                blaze::trans(
+                    blaze::submatrix(rhs.matrix(), rhs_intersection.start_,
+                        0, rhs_intersection.size(), rhs.dimension(1))) *
+                blaze::subvector(lhs.vector(), lhs_intersection.start_,
+                    lhs_intersection.size());
+        }
+
+        // calculate the dot product with the remote tiles as they arrive
+        hpx::wait_each(
+            [&](std::size_t i, hpx::future<blaze::DynamicMatrix<T>>&& f)
+            {
+                auto const& product = remote_products[i];
+                blaze::subvector(dot_result, product.rhs_column_start_,
+                    product.rhs_column_size_) +=
+                    blaze::trans(f.get()) *
+                    blaze::subvector(lhs.vector(),
+                        product.lhs_intersection_.start_,
+                        product.lhs_intersection_.size());
+            },
+            remote_tiles);
+
         // collect overall result if left hand side vector is distributed
         execution_tree::primitive_argument_type result;
         if (lhs_localities.locality_.num_localities_ > 1)
@@ -441,6 +510,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         // number of rows of the lhs tile
         blaze::DynamicVector<T> dot_result(lhs.dimension(0), T{0});
 
+        std::vector<hpx::future<blaze::DynamicVector<T>>> remote_tiles;
+        std::vector<detail::tile_product> remote_products;
+
+        bool has_local_tile = false;
+        detail::tile_product local_product;
+
         std::uint32_t loc = 0;
         // rhs can be a row or column vector. all the tile should have the same
         // type (column or row)
@@ -474,27 +549,46 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                dot_result +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    blaze::subvector(*rhs_data, rhs_intersection.start_,
-                        rhs_intersection.size());
+                has_local_tile = true;
+                local_product = detail::tile_product{
+                    lhs_intersection, rhs_intersection, 0, 0};
             }
             else
             {
-                // calculate the dot product with remote tile
-                dot_result +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    rhs_data
-                        .fetch(loc, rhs_intersection.start_,
-                            rhs_intersection.stop_)
-                        .get();
+                remote_tiles.push_back(rhs_data.fetch(
+                    loc, rhs_intersection.start_, rhs_intersection.stop_));
+                remote_products.push_back(detail::tile_product{
+                    lhs_intersection, rhs_intersection, 0, 0});
             }
             ++loc;
         }
 
+        if (has_local_tile)
+        {
+            // calculate the dot product with local tile
+            auto const& lhs_intersection = local_product.lhs_intersection_;
+            auto const& rhs_intersection = local_product.rhs_intersection_;
+
+            dot_result +=
+                blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
+                    lhs.dimension(0), lhs_intersection.size()) *
+                blaze::subvector(*rhs_data, rhs_intersection.start_,
+                    rhs_intersection.size());
+        }
+
+        // calculate the dot product with the remote tiles as they arrive
+        hpx::wait_each(
+            [&](std::size_t i, hpx::future<blaze::DynamicVector<T>>&& f)
+            {
+                auto const& lhs_intersection =
+                    remote_products[i].lhs_intersection_;
+                dot_result +=
+                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
+                        lhs.dimension(0), lhs_intersection.size()) *
+                    f.get();
+            },
+            remote_tiles);
+
         // collect overall result if left hand side vector is distributed
         execution_tree::primitive_argument_type result;
         if (lhs_localities.locality_.num_localities_ > 1)
@@ -614,6 +708,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         blaze::DynamicMatrix<T> result_matrix(
             lhs.dimension(0), rhs_localities.columns(name_, codename_), T{0});
 
+        std::vector<hpx::future<blaze::DynamicMatrix<T>>> remote_tiles;
+        std::vector<detail::tile_product> remote_products;
+
+        bool has_local_tile = false;
+        detail::tile_product local_product;
+
         std::uint32_t loc = 0;
         std::size_t lhs_span_index = 1;
         std::size_t rhs_span_index = 0;
@@ -652,30 +752,51 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                // TODO ensure that this is generating a sub-matrix
-                blaze::submatrix(result_matrix, 0, rhs_column_start,
-                    lhs.dimension(0), rhs_column_size) +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    blaze::submatrix(rhs.matrix(), rhs_intersection.start_, 0,
-                        rhs_intersection.size(), rhs.dimension(1));
+                has_local_tile = true;
+                local_product = detail::tile_product{lhs_intersection,
+                    rhs_intersection, rhs_column_start, rhs_column_size};
             }
             else
             {
-                // calculate the dot product with remote tile
-                blaze::submatrix(result_matrix, 0, rhs_column_start,
-                    lhs.dimension(0), rhs_column_size) +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    rhs_data
-                        .fetch(loc, rhs_intersection.start_, 0,
-                            rhs_intersection.stop_, rhs_column_size)
-                        .get();
+                remote_tiles.push_back(rhs_data.fetch(loc,
+                    rhs_intersection.start_, 0, rhs_intersection.stop_,
+                    rhs_column_size));
+                remote_products.push_back(detail::tile_product{
+                    lhs_intersection, rhs_intersection, rhs_column_start,
+                    rhs_column_size});
             }
             ++loc;
         }
 
+        if (has_local_tile)
+        {
+            // calculate the dot product with local tile
+            // TODO ensure that this is generating a sub-matrix
+            auto const& lhs_intersection = local_product.lhs_intersection_;
+            auto const& rhs_intersection = local_product.rhs_intersection_;
+
+            blaze::submatrix(result_matrix, 0, local_product.rhs_column_start_,
+                lhs.dimension(0), local_product.rhs_column_size_) +=
+                blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
+                    lhs.dimension(0), lhs_intersection.size()) *
+                blaze::submatrix(rhs.matrix(), rhs_intersection.start_, 0,
+                    rhs_intersection.size(), rhs.dimension(1));
+        }
+
+        // calculate the dot product with the remote tiles as they arrive
+        hpx::wait_each(
+            [&](std::size_t i, hpx::future<blaze::DynamicMatrix<T>>&& f)
+            {
+                auto const& product = remote_products[i];
+                blaze::submatrix(result_matrix, 0, product.rhs_column_start_,
+                    lhs.dimension(0), product.rhs_column_size_) +=
+                    blaze::submatrix(lhs.matrix(), 0,
+                        product.lhs_intersection_.start_, lhs.dimension(0),
+                        product.lhs_intersection_.size()) *
+                    f.get();
+            },
+            remote_tiles);
+
         // collect overall result if left hand side vector is distributed
         execution_tree::primitive_argument_type result;
         if (lhs_localities.locality_.num_localities_ > 1)
@@ -0,0 +1,65 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_DIST_SORT)
+#define PHYLANX_PRIMITIVES_DIST_SORT
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///
+    /// Sorts a vector that is tiled over several localities (sample sort).
+    /// The result is tiled over the same localities, however the sizes of
+    /// the tiles depend on the distribution of the values.
+    ///
+    class dist_sort
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_sort>
+    {
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    public:
+        static execution_tree::match_pattern_type const match_data;
+
+        dist_sort() = default;
+
+        dist_sort(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        execution_tree::primitive_argument_type sort1d(
+            execution_tree::primitive_argument_type&& arg) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type sort1d(ir::node_data<T>&& arg,
+            execution_tree::localities_information* locs) const;
+    };
+
+    inline execution_tree::primitive create_dist_sort(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return execution_tree::create_primitive_component(
+            locality, "sort_d", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_STATISTICS_ANY_D_OPERATION)
+#define PHYLANX_STATISTICS_ANY_D_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/plugins/common/statistics_operations.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics_base.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tests whether any element of an array that is tiled over several
+    ///        localities (or along an axis of such an array) is nonzero.
+    /// \param a         The scalar, vector, matrix, or tensor to reduce
+    /// \param axis      Optional. If provided, the reduction is performed
+    ///                  along the provided axis.
+    /// \param keep_dims Optional. If true the result has to have the same
+    ///                  number of dimensions as a. Otherwise, the axes with
+    ///                  size one will be reduced.
+    class any_d_operation
+      : public dist_statistics_base<common::statistics_any_op, any_d_operation>
+    {
+        using base_type =
+            dist_statistics_base<common::statistics_any_op, any_d_operation>;
+
+    public:
+        static match_pattern_type const match_data;
+
+        any_d_operation() = default;
+
+        any_d_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+    };
+
+    inline primitive create_any_d_operation(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "any_d", std::move(operands), name, codename);
+    }
+}}}    // namespace phylanx::execution_tree::primitives
+
+#endif
@@ -9,17 +9,27 @@
 #define PHYLANX_PRIMITIVE_DIST_STATISTICS_IMPL_2020_JUN_19_1229PM
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/statistics_nd.hpp>
 #include <phylanx/plugins/dist_statistics/dist_statistics_base.hpp>
+#include <phylanx/plugins/dist_statistics/statistics_partials.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/collectives/all_reduce.hpp>
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/errors/throw_exception.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/util.hpp>
+#include <hpx/serialization/vector.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -44,50 +54,597 @@ namespace phylanx { namespace execution_tree { namespace primitives {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <template <class T> class Op, typename Derived>
-    primitive_argument_type dist_statistics_base<Op, Derived>::statistics0d(
-        primitive_argument_type&& arg, ir::range&& axes, bool keepdims,
-        primitive_argument_type&& initial, node_data_type dtype,
-        eval_context ctx) const
+    namespace detail
     {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
-    }
+        // sequences of partial results smaller than this are reduced on the
+        // calling thread
+        constexpr std::size_t dist_statistics_parallel_threshold = 65536;
 
-    template <template <class T> class Op, typename Derived>
-    primitive_argument_type dist_statistics_base<Op, Derived>::statistics1d(
-        primitive_argument_type&& arg, ir::range&& axes, bool keepdims,
-        primitive_argument_type&& initial, node_data_type dtype,
-        eval_context ctx) const
-    {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
-    }
+        constexpr std::size_t dist_no_dimension = std::size_t(-1);
 
-    template <template <class T> class Op, typename Derived>
-    primitive_argument_type dist_statistics_base<Op, Derived>::statistics2d(
-        primitive_argument_type&& arg, ir::range&& axes, bool keepdims,
-        primitive_argument_type&& initial, node_data_type dtype,
-        eval_context ctx) const
-    {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
-    }
+        ///////////////////////////////////////////////////////////////////////
+        // The (global) number of dimensions of a tiled array, the tiles of
+        // localities not holding any part of the array have no valid spans
+        inline std::size_t dist_dimension(localities_information const& locs)
+        {
+            std::size_t dim = 0;
+            for (auto const& tile : locs.tiles_)
+            {
+                dim = (std::max)(dim, tile.dimension());
+            }
+            return dim;
+        }
 
-    template <template <class T> class Op, typename Derived>
-    primitive_argument_type dist_statistics_base<Op, Derived>::statistics3d(
-        primitive_argument_type&& arg, ir::range&& axes, bool keepdims,
-        primitive_argument_type&& initial, node_data_type dtype,
-        eval_context ctx) const
-    {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
-    }
+        // The global extent of a matrix or tensor along the given dimension
+        inline std::size_t dist_extent(localities_information const& locs,
+            std::size_t ndim, std::size_t dim, std::string const& name,
+            std::string const& codename)
+        {
+            if (ndim == 2)
+            {
+                return dim == 0 ? locs.rows(name, codename) :
+                                  locs.columns(name, codename);
+            }
+
+            switch (dim)
+            {
+            case 0:
+                return locs.pages(name, codename);
+            case 1:
+                return locs.rows(name, codename);
+            default:
+                break;
+            }
+            return locs.columns(name, codename);
+        }
+
+        // Every (non-empty) tile holds the whole extent of the array along
+        // the given dimension
+        inline bool dist_is_complete(localities_information const& locs,
+            std::size_t dim, std::size_t extent)
+        {
+            return std::all_of(locs.tiles_.begin(), locs.tiles_.end(),
+                [&](tiling_information const& tile) {
+                    return tile.dimension() == 0 ||
+                        (tile.spans_[dim].start_ == 0 &&
+                            std::size_t(tile.spans_[dim].stop_) == extent);
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A reduction along an axis of a matrix or tensor computes a partial
+        // result for each element (a, b) of a (conceptual) matrix from the
+        // values along the reduced dimension j. The members hold the
+        // dimensions of the array corresponding to a, j, and b, the
+        // dimensions are in the same order as in the array. Dimensions not
+        // present in the array have an extent of one.
+        struct dist_reduction_layout
+        {
+            std::size_t a_;
+            std::size_t j_;
+            std::size_t b_;
+        };
+
+        inline dist_reduction_layout dist_make_layout(
+            std::size_t ndim, std::size_t axis)
+        {
+            if (ndim == 2)
+            {
+                if (axis == 0)
+                {
+                    return dist_reduction_layout{dist_no_dimension, 0, 1};
+                }
+                return dist_reduction_layout{0, 1, dist_no_dimension};
+            }
+
+            switch (axis)
+            {
+            case 0:
+                return dist_reduction_layout{1, 0, 2};
+            case 1:
+                return dist_reduction_layout{0, 1, 2};
+            default:
+                break;
+            }
+            return dist_reduction_layout{0, 2, 1};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Reduce a tile along j, at(a, j, b) returns the elements of the tile
+        template <typename Partial, typename Access>
+        std::vector<typename Partial::partial_type> dist_reduce_tile(
+            std::size_t rows, std::size_t length, std::size_t columns,
+            Access&& at)
+        {
+            std::vector<typename Partial::partial_type> result(
+                rows * columns, Partial::identity());
+
+            auto reduce_row = [&](std::size_t a) {
+                auto* p = result.data() + a * columns;
+                for (std::size_t j = 0; j != length; ++j)
+                {
+                    for (std::size_t b = 0; b != columns; ++b)
+                    {
+                        Partial::accumulate(p[b], at(a, j, b));
+                    }
+                }
+            };
+
+            if (rows < 2 ||
+                rows * length * columns < dist_statistics_parallel_threshold)
+            {
+                for (std::size_t a = 0; a != rows; ++a)
+                {
+                    reduce_row(a);
+                }
+            }
+            else
+            {
+                hpx::for_loop(
+                    hpx::execution::par, std::size_t(0), rows, reduce_row);
+            }
+            return result;
+        }
+
+        template <typename Partial, typename T>
+        std::vector<typename Partial::partial_type> dist_local_partials(
+            ir::node_data<T> const& arg, std::size_t ndim, std::size_t axis,
+            std::size_t rows, std::size_t length, std::size_t columns)
+        {
+            if (ndim == 2)
+            {
+                auto m = arg.matrix();
+                if (axis == 0)
+                {
+                    return dist_reduce_tile<Partial>(rows, length, columns,
+                        [&](std::size_t, std::size_t j, std::size_t b) -> T {
+                            return m(j, b);
+                        });
+                }
+                return dist_reduce_tile<Partial>(rows, length, columns,
+                    [&](std::size_t a, std::size_t j, std::size_t) -> T {
+                        return m(a, j);
+                    });
+            }
+
+            auto t = arg.tensor();
+            switch (axis)
+            {
+            case 0:
+                return dist_reduce_tile<Partial>(rows, length, columns,
+                    [&](std::size_t a, std::size_t j, std::size_t b) -> T {
+                        return t(j, a, b);
+                    });
+            case 1:
+                return dist_reduce_tile<Partial>(rows, length, columns,
+                    [&](std::size_t a, std::size_t j, std::size_t b) -> T {
+                        return t(a, j, b);
+                    });
+            default:
+                break;
+            }
+            return dist_reduce_tile<Partial>(rows, length, columns,
+                [&](std::size_t a, std::size_t j, std::size_t b) -> T {
+                    return t(a, b, j);
+                });
+        }
+
+        // Reduce all elements of a tile
+        template <typename Partial, typename T>
+        typename Partial::partial_type dist_local_partial(
+            ir::node_data<T> const& arg)
+        {
+            auto p = Partial::identity();
+            switch (arg.num_dimensions())
+            {
+            case 0:
+                Partial::accumulate(p, arg.scalar());
+                break;
 
+            case 1:
+                for (T value : arg.vector())
+                {
+                    Partial::accumulate(p, value);
+                }
+                break;
+
+            case 2:
+                {
+                    auto m = arg.matrix();
+                    for (std::size_t i = 0; i != m.rows(); ++i)
+                    {
+                        for (T value : blaze::row(m, i))
+                        {
+                            Partial::accumulate(p, value);
+                        }
+                    }
+                }
+                break;
+
+            default:
+                {
+                    auto t = arg.tensor();
+                    for (std::size_t k = 0; k != t.pages(); ++k)
+                    {
+                        auto page = blaze::pageslice(t, k);
+                        for (std::size_t i = 0; i != t.rows(); ++i)
+                        {
+                            for (T value : blaze::row(page, i))
+                            {
+                                Partial::accumulate(p, value);
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            return p;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Partial>
+        struct dist_combine_partials
+        {
+            template <typename P>
+            std::vector<P> operator()(
+                std::vector<P> const& lhs, std::vector<P> const& rhs) const
+            {
+                HPX_ASSERT(lhs.size() == rhs.size());
+
+                std::vector<P> result;
+                result.reserve(lhs.size());
+                for (std::size_t i = 0; i != lhs.size(); ++i)
+                {
+                    result.push_back(Partial::combine(lhs[i], rhs[i]));
+                }
+                return result;
+            }
+        };
+
+        // Combine the partial results of all localities, the partial results
+        // of each locality hold the identity for all elements it does not
+        // contribute to
+        template <typename Partial>
+        std::vector<typename Partial::partial_type> dist_all_reduce(
+            std::vector<typename Partial::partial_type>&& partials,
+            localities_information const& locs)
+        {
+            if (locs.locality_.num_localities_ == 1)
+            {
+                return std::move(partials);
+            }
+
+            return hpx::all_reduce(
+                ("statistics_" + locs.annotation_.name_).c_str(),
+                std::move(partials), dist_combine_partials<Partial>{},
+                locs.locality_.num_localities_, std::size_t(-1),
+                locs.locality_.locality_id_)
+                .get();
+        }
+
+        template <typename Partial>
+        std::vector<typename Partial::result_type> dist_finalize(
+            std::vector<typename Partial::partial_type>&& partials,
+            hpx::util::optional<typename Partial::result_type> const& initial,
+            std::string const& name, std::string const& codename)
+        {
+            std::vector<typename Partial::result_type> result;
+            result.reserve(partials.size());
+            for (auto& p : partials)
+            {
+                if (initial)
+                {
+                    Partial::apply_initial(p, *initial);
+                }
+                result.push_back(Partial::finalize(p, name, codename));
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Create an array of the given shape from the (row-major) values
+        template <typename R>
+        primitive_argument_type dist_make_result(std::vector<R> const& values,
+            std::size_t ndim, std::array<std::size_t, 3> const& dims,
+            primitive_argument_type::annotation_ptr const& ann = nullptr)
+        {
+            switch (ndim)
+            {
+            case 1:
+                {
+                    blaze::DynamicVector<R> result(dims[0]);
+                    std::copy(values.begin(), values.end(), result.begin());
+                    return primitive_argument_type(std::move(result), ann);
+                }
+
+            case 2:
+                {
+                    blaze::DynamicMatrix<R> result(dims[0], dims[1]);
+                    for (std::size_t i = 0; i != dims[0]; ++i)
+                    {
+                        std::copy(values.begin() + i * dims[1],
+                            values.begin() + (i + 1) * dims[1],
+                            blaze::row(result, i).begin());
+                    }
+                    return primitive_argument_type(std::move(result), ann);
+                }
+
+            default:
+                break;
+            }
+
+            blaze::DynamicTensor<R> result(dims[0], dims[1], dims[2]);
+            auto it = values.begin();
+            for (std::size_t k = 0; k != dims[0]; ++k)
+            {
+                for (std::size_t i = 0; i != dims[1]; ++i)
+                {
+                    auto row = blaze::row(blaze::pageslice(result, k), i);
+                    std::copy(it, it + dims[2], row.begin());
+                    it += dims[2];
+                }
+            }
+            return primitive_argument_type(std::move(result), ann);
+        }
+
+        inline annotation dist_tile_annotation(std::size_t ndim,
+            std::array<tiling_span, 3> const& spans, std::string const& name,
+            std::string const& codename)
+        {
+            switch (ndim)
+            {
+            case 1:
+                return tiling_information_1d(
+                    tiling_information_1d::tile1d_type::columns, spans[0])
+                    .as_annotation(name, codename);
+
+            case 2:
+                return tiling_information_2d(spans[0], spans[1])
+                    .as_annotation(name, codename);
+
+            default:
+                break;
+            }
+            return tiling_information_3d(spans[0], spans[1], spans[2])
+                .as_annotation(name, codename);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <template <class T> class Op, typename T>
+        primitive_argument_type dist_statisticsnd(ir::node_data<T>&& arg,
+            localities_information&& locs, std::size_t ndim,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type&& initial, std::string const& name,
+            std::string const& codename, eval_context const& ctx)
+        {
+            using partial = dist_statistics_partial<Op, T>;
+            using partial_type = typename partial::partial_type;
+            using result_type = typename partial::result_type;
+
+            hpx::util::optional<result_type> initial_value;
+            if (valid(initial))
+            {
+                initial_value = extract_scalar_data<result_type>(
+                    std::move(initial), name, codename);
+            }
+
+            std::int64_t reduced_axis = 0;
+            if (axis)
+            {
+                reduced_axis = *axis < 0 ? *axis + ndim : *axis;
+                if (reduced_axis < 0 || std::size_t(reduced_axis) >= ndim)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "dist_statistics_base::dist_statisticsnd",
+                        util::generate_error_message(
+                            hpx::util::format(
+                                "the statistics primitive requires operand "
+                                "axis to be between {} and {} for the given "
+                                "array",
+                                -std::int64_t(ndim), ndim - 1),
+                            name, codename, ctx.back_trace()));
+                }
+            }
+
+            // localities not holding any part of the array contribute the
+            // identity only
+            bool const has_data = locs.num_dimensions() != 0;
+
+            // reduce all elements (vectors have a single axis only), the
+            // overall result is available on all localities
+            if (!axis || ndim == 1)
+            {
+                std::vector<partial_type> partials(1, partial::identity());
+                if (has_data)
+                {
+                    partials[0] = dist_local_partial<partial>(arg);
+                }
+
+                auto result = dist_finalize<partial>(
+                    dist_all_reduce<partial>(std::move(partials), locs),
+                    initial_value, name, codename);
+
+                if (!keepdims)
+                {
+                    return primitive_argument_type(result[0]);
+                }
+                return dist_make_result(result, ndim, {1, 1, 1});
+            }
+
+            dist_reduction_layout const layout =
+                dist_make_layout(ndim, reduced_axis);
+            tiling_information const& tile =
+                locs.tiles_[locs.locality_.locality_id_];
+
+            auto local_span = [&](std::size_t dim) {
+                if (!has_data)
+                {
+                    return tiling_span(0, 0);
+                }
+                return dim == dist_no_dimension ? tiling_span(0, 1) :
+                                                  tile.spans_[dim];
+            };
+
+            tiling_span const rows_span = local_span(layout.a_);
+            tiling_span const columns_span = local_span(layout.b_);
+            std::size_t const rows = rows_span.size();
+            std::size_t const columns = columns_span.size();
+
+            std::vector<partial_type> partials;
+            if (has_data)
+            {
+                partials = dist_local_partials<partial>(arg, ndim,
+                    reduced_axis, rows, local_span(layout.j_).size(), columns);
+            }
+
+            // the shape of the result, the reduced dimension is removed or
+            // kept with an extent of one
+            auto result_dims = [&](std::size_t result_rows,
+                                   std::size_t result_columns,
+                                   std::array<std::size_t, 3>& dims) {
+                std::size_t result_ndim = 0;
+                for (std::size_t d = 0; d != ndim; ++d)
+                {
+                    if (d != layout.j_)
+                    {
+                        dims[result_ndim++] =
+                            d == layout.a_ ? result_rows : result_columns;
+                    }
+                    else if (keepdims)
+                    {
+                        dims[result_ndim++] = 1;
+                    }
+                }
+                return result_ndim;
+            };
+
+            std::size_t const length =
+                dist_extent(locs, ndim, layout.j_, name, codename);
+            if (dist_is_complete(locs, layout.j_, length))
+            {
+                // all tiles hold complete lanes along the reduced axis, the
+                // local results are final and the result is tiled like the
+                // remaining dimensions of the array
+                auto result = dist_finalize<partial>(
+                    std::move(partials), initial_value, name, codename);
+
+                std::array<std::size_t, 3> dims{};
+                std::size_t result_ndim = result_dims(rows, columns, dims);
+
+                std::array<tiling_span, 3> spans;
+                std::size_t i = 0;
+                for (std::size_t d = 0; d != ndim; ++d)
+                {
+                    if (d != layout.j_)
+                    {
+                        spans[i++] = d == layout.a_ ? rows_span : columns_span;
+                    }
+                    else if (keepdims)
+                    {
+                        spans[i++] = local_span(dist_no_dimension);
+                    }
+                }
+
+                ++locs.annotation_.generation_;
+                auto locality_ann = locs.locality_.as_annotation();
+                auto attached_annotation =
+                    std::make_shared<annotation>(localities_annotation(
+                        locality_ann,
+                        dist_tile_annotation(
+                            result_ndim, spans, name, codename),
+                        locs.annotation_, name, codename));
+
+                return dist_make_result(
+                    result, result_ndim, dims, attached_annotation);
+            }
+
+            // otherwise the partial results are combined into the overall
+            // result, which is available on all localities
+            std::size_t const global_rows = layout.a_ == dist_no_dimension ?
+                1 :
+                dist_extent(locs, ndim, layout.a_, name, codename);
+            std::size_t const global_columns = layout.b_ == dist_no_dimension ?
+                1 :
+                dist_extent(locs, ndim, layout.b_, name, codename);
+
+            std::vector<partial_type> global_partials(
+                global_rows * global_columns, partial::identity());
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                std::move(partials.begin() + i * columns,
+                    partials.begin() + (i + 1) * columns,
+                    global_partials.begin() +
+                        (rows_span.start_ + i) * global_columns +
+                        columns_span.start_);
+            }
+
+            auto result = dist_finalize<partial>(
+                dist_all_reduce<partial>(std::move(global_partials), locs),
+                initial_value, name, codename);
+
+            std::array<std::size_t, 3> dims{};
+            std::size_t result_ndim =
+                result_dims(global_rows, global_columns, dims);
+
+            return dist_make_result(result, result_ndim, dims);
+        }
+
+        template <template <class T> class Op>
+        primitive_argument_type dist_statisticsnd(
+            primitive_argument_type&& arg, std::size_t ndim,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type&& initial, node_data_type dtype,
+            std::string const& name, std::string const& codename,
+            eval_context const& ctx)
+        {
+            localities_information locs =
+                extract_localities_information(arg, name, codename);
+
+            if (dtype == node_data_type_unknown)
+            {
+                dtype = extract_common_type(arg);
+            }
+
+            switch (dtype)
+            {
+            case node_data_type_bool:
+                return dist_statisticsnd<Op>(
+                    extract_boolean_value_strict(
+                        std::move(arg), name, codename),
+                    std::move(locs), ndim, axis, keepdims, std::move(initial),
+                    name, codename, ctx);
+
+            case node_data_type_int64:
+                return dist_statisticsnd<Op>(
+                    extract_integer_value_strict(
+                        std::move(arg), name, codename),
+                    std::move(locs), ndim, axis, keepdims, std::move(initial),
+                    name, codename, ctx);
+
+            case node_data_type_float:
+                HPX_FALLTHROUGH;
+            case node_data_type_unknown:
+                HPX_FALLTHROUGH;
+            case node_data_type_double:
+                return dist_statisticsnd<Op>(
+                    extract_numeric_value(std::move(arg), name, codename),
+                    std::move(locs), ndim, axis, keepdims, std::move(initial),
+                    name, codename, ctx);
+
+            default:
+                break;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_statistics_base::dist_statisticsnd",
+                util::generate_error_message(
+                    "the statistics primitive requires for all arguments "
+                    "to be numeric data types",
+                    name, codename, ctx.back_trace()));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
     template <template <class T> class Op, typename Derived>
     primitive_argument_type dist_statistics_base<Op, Derived>::statisticsnd(
         primitive_argument_type&& arg, ir::range&& axes, bool keepdims,
@@ -101,33 +658,72 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 std::move(ctx));
         }
 
-        std::size_t a_dims =
-            extract_numeric_value_dimension(arg, name_, codename_);
-        switch (a_dims)
+        localities_information locs =
+            extract_localities_information(arg, name_, codename_);
+        std::size_t ndim = detail::dist_dimension(locs);
+
+        // a single axis
+        if (axes.size() == 1)
         {
-        case 0:
-            return statistics0d(std::move(arg), std::move(axes), keepdims,
-                std::move(initial), dtype, std::move(ctx));
+            return statisticsnd(std::move(arg),
+                hpx::util::optional<std::int64_t>(
+                    extract_scalar_integer_value_strict(
+                        *axes.begin(), name_, codename_)),
+                keepdims, std::move(initial), dtype, std::move(ctx));
+        }
 
-        case 1:
-            return statistics1d(std::move(arg), std::move(axes), keepdims,
-                std::move(initial), dtype, std::move(ctx));
+        // element-wise operation, the result is tiled like the argument
+        if (axes.size() == 0)
+        {
+            primitive_argument_type result = common::statisticsnd<Op>(
+                std::move(arg), std::move(axes), keepdims, std::move(initial),
+                dtype, name_, codename_, std::move(ctx));
+
+            ++locs.annotation_.generation_;
+            auto locality_ann = locs.locality_.as_annotation();
+            result.set_annotation(
+                std::make_shared<annotation>(localities_annotation(
+                    locality_ann,
+                    locs.tiles_[locs.locality_.locality_id_].as_annotation(
+                        name_, codename_),
+                    locs.annotation_, name_, codename_)));
+            return result;
+        }
 
-        case 2:
-            return statistics2d(std::move(arg), std::move(axes), keepdims,
-                std::move(initial), dtype, std::move(ctx));
+        // all axes, reduce all elements
+        if (axes.size() == ndim)
+        {
+            std::set<std::int64_t> unique_axes;
+            for (auto const& a : axes)
+            {
+                std::int64_t axis =
+                    extract_scalar_integer_value_strict(a, name_, codename_);
+                unique_axes.insert(axis < 0 ? axis + ndim : axis);
+            }
 
-        case 3:
-            return statistics3d(std::move(arg), std::move(axes), keepdims,
+            if (unique_axes.size() != ndim || *unique_axes.begin() < 0 ||
+                std::size_t(*unique_axes.rbegin()) >= ndim)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_statistics_base<Op, Derived>::statisticsnd",
+                    generate_error_message(
+                        "the statistics primitive requires for all axis "
+                        "arguments to be unique and valid for the given "
+                        "array",
+                        std::move(ctx)));
+            }
+
+            return statisticsnd(std::move(arg),
+                hpx::util::optional<std::int64_t>(), keepdims,
                 std::move(initial), dtype, std::move(ctx));
-
-        default:
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "dist_argminmax<Op, Derived>::eval",
-                generate_error_message(
-                    "operand a has an invalid number of dimensions",
-                    std::move(ctx)));
         }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_statistics_base<Op, Derived>::statisticsnd",
+            generate_error_message(
+                "the statistics primitive supports reducing a tiled array "
+                "along a single axis or along all of its axes only",
+                std::move(ctx)));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -149,8 +745,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), axis, keepdims,
-            std::move(initial), dtype, name_, codename_, std::move(ctx));
+        return detail::dist_statisticsnd<Op>(std::move(arg), 1, axis,
+            keepdims, std::move(initial), dtype, name_, codename_, ctx);
     }
 
     template <template <class T> class Op, typename Derived>
@@ -160,8 +756,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), axis, keepdims,
-            std::move(initial), dtype, name_, codename_, std::move(ctx));
+        return detail::dist_statisticsnd<Op>(std::move(arg), 2, axis,
+            keepdims, std::move(initial), dtype, name_, codename_, ctx);
     }
 
     template <template <class T> class Op, typename Derived>
@@ -171,8 +767,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), axis, keepdims,
-            std::move(initial), dtype, name_, codename_, std::move(ctx));
+        return detail::dist_statisticsnd<Op>(std::move(arg), 3, axis,
+            keepdims, std::move(initial), dtype, name_, codename_, ctx);
     }
 
     template <template <class T> class Op, typename Derived>
@@ -188,8 +784,10 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 std::move(initial), dtype, name_, codename_, std::move(ctx));
         }
 
-        std::size_t a_dims =
-            extract_numeric_value_dimension(arg, name_, codename_);
+        // the dimensionality is taken from the tiling information as the
+        // local part of the array may be empty
+        std::size_t a_dims = detail::dist_dimension(
+            extract_localities_information(arg, name_, codename_));
         switch (a_dims)
         {
         case 0:
@@ -210,7 +808,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         default:
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "dist_argminmax<Op, Derived>::eval",
+                "dist_statistics_base<Op, Derived>::statisticsnd",
                 generate_error_message(
                     "operand a has an invalid number of dimensions",
                     std::move(ctx)));
@@ -0,0 +1,388 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PLUGINS_DIST_STATISTICS_PARTIALS)
+#define PHYLANX_PLUGINS_DIST_STATISTICS_PARTIALS
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/common/statistics_operations.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// The distributed statistics primitives reduce each tile into partial results
+// which are combined across localities. For each of the statistics operations
+// the specialization of dist_statistics_partial<Op, T> describes the partial
+// result and how it is accumulated, combined, and finalized:
+//
+//      partial_type    the (serializable) partial result
+//      result_type     the type of the final result
+//      identity()      the partial result of an empty sequence
+//      accumulate(p, value)
+//                      fold a value of the sequence into the partial result
+//      apply_initial(p, initial)
+//                      fold the 'initial' argument into the partial result
+//                      (ignored by the operations not supporting it)
+//      combine(lhs, rhs)
+//                      combine the partial results of two subsequences
+//      finalize(p, name, codename)
+//                      compute the result from the partial result
+//
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    template <template <class T> class Op, typename T>
+    struct dist_statistics_partial;
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // sum, prod, min, and max: the partial result is a value of the result
+        // type, its identity is the initial value of the operation
+        template <template <class T> class Op, typename T, typename Combine>
+        struct value_partial
+        {
+            using result_type = typename Op<T>::result_type;
+            using partial_type = result_type;
+
+            static partial_type identity()
+            {
+                return Op<T>::initial();
+            }
+
+            static void accumulate(partial_type& p, T value)
+            {
+                p = Combine{}(p, partial_type(value));
+            }
+
+            static void apply_initial(partial_type& p, result_type initial)
+            {
+                p = Combine{}(p, initial);
+            }
+
+            static partial_type combine(partial_type lhs, partial_type rhs)
+            {
+                return Combine{}(lhs, rhs);
+            }
+
+            static result_type finalize(partial_type p,
+                std::string const& name, std::string const& codename)
+            {
+                return p;
+            }
+        };
+
+        struct plus_partial
+        {
+            template <typename T>
+            T operator()(T lhs, T rhs) const
+            {
+                return lhs + rhs;
+            }
+        };
+
+        struct multiplies_partial
+        {
+            template <typename T>
+            T operator()(T lhs, T rhs) const
+            {
+                return lhs * rhs;
+            }
+        };
+
+        struct min_partial
+        {
+            template <typename T>
+            T operator()(T lhs, T rhs) const
+            {
+                return (std::min)(lhs, rhs);
+            }
+        };
+
+        struct max_partial
+        {
+            template <typename T>
+            T operator()(T lhs, T rhs) const
+            {
+                return (std::max)(lhs, rhs);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // any and all
+        template <bool All>
+        struct boolean_partial
+        {
+            using result_type = std::uint8_t;
+            using partial_type = std::uint8_t;
+
+            static partial_type identity()
+            {
+                return All ? 1 : 0;
+            }
+
+            template <typename T>
+            static void accumulate(partial_type& p, T value)
+            {
+                p = combine(p, value != 0 ? 1 : 0);
+            }
+
+            static void apply_initial(partial_type& p, result_type initial)
+            {
+            }
+
+            static partial_type combine(partial_type lhs, partial_type rhs)
+            {
+                return (All ? (lhs && rhs) : (lhs || rhs)) ? 1 : 0;
+            }
+
+            static result_type finalize(partial_type p,
+                std::string const& name, std::string const& codename)
+            {
+                return p;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // mean, var, and std: number of values, their mean, and the sum of
+        // the squared differences from the mean
+        struct moments
+        {
+            double count_ = 0;
+            double mean_ = 0;
+            double m2_ = 0;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & count_ & mean_ & m2_;
+                // clang-format on
+            }
+        };
+
+        template <typename Derived>
+        struct moments_partial
+        {
+            using result_type = double;
+            using partial_type = moments;
+
+            static partial_type identity()
+            {
+                return partial_type{};
+            }
+
+            // Welford's online algorithm, see
+            // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+            template <typename T>
+            static void accumulate(partial_type& p, T value)
+            {
+                p.count_ += 1;
+                double delta = value - p.mean_;
+                p.mean_ += delta / p.count_;
+                p.m2_ += delta * (value - p.mean_);
+            }
+
+            static void apply_initial(partial_type& p, result_type initial)
+            {
+            }
+
+            // Chan's algorithm for combining the moments of two subsequences
+            static partial_type combine(
+                partial_type const& lhs, partial_type const& rhs)
+            {
+                if (lhs.count_ == 0)
+                {
+                    return rhs;
+                }
+                if (rhs.count_ == 0)
+                {
+                    return lhs;
+                }
+
+                partial_type result;
+                result.count_ = lhs.count_ + rhs.count_;
+
+                double delta = rhs.mean_ - lhs.mean_;
+                result.mean_ = lhs.mean_ + delta * rhs.count_ / result.count_;
+                result.m2_ = lhs.m2_ + rhs.m2_ +
+                    delta * delta * lhs.count_ * rhs.count_ / result.count_;
+                return result;
+            }
+
+            static result_type finalize(partial_type const& p,
+                std::string const& name, std::string const& codename)
+            {
+                if (p.count_ == 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "dist_statistics_partial::finalize",
+                        util::generate_error_message(
+                            "empty sequences are not supported", name,
+                            codename));
+                }
+                return Derived::finalize_moments(p);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // logsumexp: the largest value and the sum of the exponentials of
+        // the differences of all values from the largest value, which avoids
+        // overflows while combining the partial results
+        struct scaled_sum
+        {
+            double max_ = -std::numeric_limits<double>::infinity();
+            double sum_ = 0;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & max_ & sum_;
+                // clang-format on
+            }
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_sum_op, T>
+      : detail::value_partial<common::statistics_sum_op, T,
+            detail::plus_partial>
+    {
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_prod_op, T>
+      : detail::value_partial<common::statistics_prod_op, T,
+            detail::multiplies_partial>
+    {
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_min_op, T>
+      : detail::value_partial<common::statistics_min_op, T,
+            detail::min_partial>
+    {
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_max_op, T>
+      : detail::value_partial<common::statistics_max_op, T,
+            detail::max_partial>
+    {
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_all_op, T>
+      : detail::boolean_partial<true>
+    {
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_any_op, T>
+      : detail::boolean_partial<false>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_mean_op, T>
+      : detail::moments_partial<
+            dist_statistics_partial<common::statistics_mean_op, T>>
+    {
+        static double finalize_moments(detail::moments const& p)
+        {
+            return p.mean_;
+        }
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_var_op, T>
+      : detail::moments_partial<
+            dist_statistics_partial<common::statistics_var_op, T>>
+    {
+        static double finalize_moments(detail::moments const& p)
+        {
+            return p.m2_ / p.count_;
+        }
+    };
+
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_stddev_op, T>
+      : detail::moments_partial<
+            dist_statistics_partial<common::statistics_stddev_op, T>>
+    {
+        static double finalize_moments(detail::moments const& p)
+        {
+            return std::sqrt(p.m2_ / p.count_);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct dist_statistics_partial<common::statistics_logsumexp_op, T>
+    {
+        using result_type = double;
+        using partial_type = detail::scaled_sum;
+
+        static partial_type identity()
+        {
+            return partial_type{};
+        }
+
+        static void accumulate(partial_type& p, T value)
+        {
+            double v = value;
+            if (v > p.max_)
+            {
+                p.sum_ = p.sum_ * std::exp(p.max_ - v) + 1.0;
+                p.max_ = v;
+            }
+            else
+            {
+                p.sum_ += std::exp(v - p.max_);
+            }
+        }
+
+        static void apply_initial(partial_type& p, result_type initial)
+        {
+        }
+
+        static partial_type combine(
+            partial_type const& lhs, partial_type const& rhs)
+        {
+            if (lhs.sum_ == 0)
+            {
+                return rhs;
+            }
+            if (rhs.sum_ == 0)
+            {
+                return lhs;
+            }
+
+            partial_type result;
+            result.max_ = (std::max)(lhs.max_, rhs.max_);
+            result.sum_ = lhs.sum_ * std::exp(lhs.max_ - result.max_) +
+                rhs.sum_ * std::exp(rhs.max_ - result.max_);
+            return result;
+        }
+
+        static result_type finalize(partial_type const& p,
+            std::string const& name, std::string const& codename)
+        {
+            return p.max_ + std::log(p.sum_);
+        }
+    };
+}}}    // namespace phylanx::execution_tree::primitives
+
+#endif
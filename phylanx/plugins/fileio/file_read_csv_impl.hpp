@@ -15,18 +15,19 @@
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/include/util.hpp>
 
-#include <boost/spirit/include/qi_char.hpp>
-#include <boost/spirit/include/qi_list.hpp>
-#include <boost/spirit/include/qi_lit.hpp>
 #include <boost/spirit/include/qi_parse.hpp>
 #include <boost/spirit/include/qi_real.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -36,58 +37,326 @@
 
 namespace phylanx { namespace execution_tree { namespace primitives
 {
-
-    // read data from given file and return content
-    inline std::tuple<std::vector<double>, std::size_t, std::size_t>
-    read_helper(std::ifstream&& infile, std::string const& filename)
+    ///////////////////////////////////////////////////////////////////////////
+    // The contents of a csv file, loaded into memory using a single bulk
+    // read. The line boundaries are determined in parallel, the data lines
+    // are parsed on demand (in parallel) straight into the target array. This
+    // allows for the distributed readers to parse the rows of their tile only.
+    // The distributed readers load the byte range holding those rows only.
+    class csv_file
     {
-        std::string line;
-        bool header_parsed = false;
-        std::vector<double> matrix_array, current_line;
-        std::size_t n_rows = 0, n_cols = 0;
-        std::size_t before_readln, after_readln;
+    public:
+        csv_file(std::ifstream&& infile, std::string const& filename)
+          : filename_(filename)
+          , first_row_(0)
+          , n_cols_(0)
+        {
+            infile.seekg(0, std::ios::end);
+            buffer_.resize(static_cast<std::size_t>(infile.tellg()));
+            infile.seekg(0, std::ios::beg);
+            infile.read(&buffer_[0], buffer_.size());
+
+            find_lines();
+            find_first_row();
+        }
 
-        while (std::getline(infile, line))
+        // Load the lines starting in the byte range [begin, end) of the file
+        // only, begin has to be the start of a line. The data rows are
+        // counted starting with the line first_row of the loaded range, all
+        // of them are expected to have n_cols columns.
+        csv_file(std::ifstream& infile, std::string const& filename,
+            std::size_t begin, std::size_t end, std::size_t first_row,
+            std::size_t n_cols)
+          : filename_(filename)
+          , buffer_(end - begin, '\0')
+          , first_row_(first_row)
+          , n_cols_(n_cols)
         {
-            before_readln = matrix_array.size();
+            if (!buffer_.empty())
+            {
+                infile.seekg(begin, std::ios::beg);
+                infile.read(&buffer_[0], buffer_.size());
+            }
 
-            auto begin_local = line.begin();
-            if (boost::spirit::qi::parse(begin_local, line.end(),
-                    boost::spirit::qi::double_ % ',', current_line))
+            find_lines();
+        }
+
+        // Determine the number of header lines (lines that can't be parsed
+        // completely) and the number of columns of the first data row,
+        // reading the beginning of the file only
+        static std::pair<std::size_t, std::size_t> read_header(
+            std::ifstream& infile, std::string const& filename)
+        {
+            infile.seekg(0, std::ios::beg);
+
+            std::size_t header = 0;
+            std::string line;
+            while (std::getline(infile, line))
             {
-                if (begin_local == line.end() || header_parsed)
+                if (!line.empty() && line.back() == '\r')
                 {
-                    header_parsed = true;
+                    line.pop_back();
+                }
+
+                char const* begin = line.data();
+                char const* end = begin + line.size();
+
+                std::size_t n_cols = 0;
+                if (!parse_values(
+                        begin, end, n_cols, [](std::size_t, double) {}))
+                {
+                    throw std::runtime_error(
+                        util::generate_error_message("wrong data format " +
+                            filename + ':' + std::to_string(0)));
+                }
+
+                if (begin == end)
+                {
+                    return std::make_pair(header, n_cols);
+                }
+                ++header;
+            }
+
+            infile.clear();
+            return std::make_pair(header, std::size_t(0));
+        }
+
+        // Count the lines starting in the byte range [begin, end) of the
+        // file. A line starts at offset zero and after every newline
+        // character that is not the last character of the file.
+        static std::size_t count_lines(
+            std::ifstream& infile, std::size_t begin, std::size_t end)
+        {
+            if (begin == end)
+            {
+                return 0;
+            }
 
-                    matrix_array.insert(matrix_array.end(),
-                        current_line.begin(), current_line.end());
+            std::size_t count = begin == 0 ? 1 : 0;
+            std::size_t pos = begin == 0 ? 0 : begin - 1;
+            std::size_t const last = end - 1;
 
-                    after_readln = matrix_array.size();
-                    if (n_rows == 0)
+            infile.seekg(pos, std::ios::beg);
+
+            // read the range in blocks of at most 1MB
+            std::vector<char> block(
+                (std::min)(last - pos, std::size_t(1024 * 1024)));
+            while (pos != last)
+            {
+                std::size_t n = (std::min)(block.size(), last - pos);
+                infile.read(block.data(), n);
+                count += std::count(block.data(), block.data() + n, '\n');
+                pos += n;
+            }
+            return count;
+        }
+
+        // Return the offset of the first line starting at or after the
+        // given offset, or the size of the file if there is none
+        static std::size_t next_line(
+            std::ifstream& infile, std::size_t offset, std::size_t size)
+        {
+            if (offset == 0 || offset >= size)
+            {
+                return offset == 0 ? 0 : size;
+            }
+
+            infile.seekg(offset - 1, std::ios::beg);
+            infile.ignore((std::numeric_limits<std::streamsize>::max)(), '\n');
+            if (infile.eof())
+            {
+                infile.clear();
+                return size;
+            }
+            return static_cast<std::size_t>(infile.tellg());
+        }
+
+        std::size_t rows() const
+        {
+            return lines_.size() - first_row_;
+        }
+
+        std::size_t columns() const
+        {
+            return n_cols_;
+        }
+
+        // Parse the data rows [row_start, row_start + row_size), storing
+        // the columns [column_start, column_start + column_size) only. The
+        // function dest(row) returns the pointer to the first element of the
+        // given row in the target array.
+        template <typename F>
+        void parse_rows(std::size_t row_start, std::size_t row_size,
+            std::size_t column_start, std::size_t column_size,
+            F&& dest) const
+        {
+            hpx::for_loop(hpx::execution::par, std::size_t(0), row_size,
+                [&](std::size_t row)
+                {
+                    parse_row(first_row_ + row_start + row, column_start,
+                        column_size, dest(row));
+                });
+        }
+
+    private:
+        // the lines span [lines_[i], lines_[i + 1] - 1)
+        std::pair<char const*, char const*> line(std::size_t i) const
+        {
+            char const* begin = buffer_.data() + lines_[i];
+            char const* end = buffer_.data() +
+                (i + 1 == lines_.size() ? buffer_.size() : lines_[i + 1] - 1);
+
+            if (end != begin && *(end - 1) == '\r')
+            {
+                --end;
+            }
+            return std::make_pair(begin, end);
+        }
+
+        // Split the buffer into byte ranges, find the starting offsets of all
+        // lines in each range in parallel
+        void find_lines()
+        {
+            std::size_t const size = buffer_.size();
+            if (size == 0)
+            {
+                return;
+            }
+
+            std::size_t num_chunks = (std::max)(
+                std::size_t(1), std::size_t(hpx::get_os_thread_count()));
+            std::size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+            num_chunks = (size + chunk_size - 1) / chunk_size;
+
+            std::vector<std::vector<std::size_t>> chunk_lines(num_chunks);
+            hpx::for_loop(hpx::execution::par, std::size_t(0), num_chunks,
+                [&](std::size_t chunk)
+                {
+                    std::size_t begin = chunk * chunk_size;
+                    std::size_t end = (std::min)(begin + chunk_size, size);
+
+                    auto& offsets = chunk_lines[chunk];
+                    if (begin == 0)
                     {
-                        n_cols = matrix_array.size();
+                        offsets.push_back(0);
                     }
-                    else if (n_cols != (after_readln - before_readln))
+                    for (std::size_t i = begin; i != end; ++i)
                     {
-                        throw std::runtime_error(util::generate_error_message(
-                            "wrong data format, different number of element in "
-                            "this row " +
-                            filename + ':' + std::to_string(n_rows)));
+                        if (buffer_[i] == '\n' && i + 1 != size)
+                        {
+                            offsets.push_back(i + 1);
+                        }
                     }
-                    n_rows++;
+                });
+
+            std::size_t num_lines = 0;
+            for (auto const& offsets : chunk_lines)
+            {
+                num_lines += offsets.size();
+            }
+
+            lines_.reserve(num_lines);
+            for (auto const& offsets : chunk_lines)
+            {
+                lines_.insert(lines_.end(), offsets.begin(), offsets.end());
+            }
+        }
+
+        // Skip the header lines (lines that can't be parsed completely) and
+        // determine the number of columns from the first data row
+        void find_first_row()
+        {
+            for (/**/; first_row_ != lines_.size(); ++first_row_)
+            {
+                char const* begin;
+                char const* end;
+                std::tie(begin, end) = line(first_row_);
+
+                std::size_t n_cols = 0;
+                if (!parse_values(
+                        begin, end, n_cols, [](std::size_t, double) {}))
+                {
+                    throw std::runtime_error(
+                        util::generate_error_message("wrong data format " +
+                            filename_ + ':' + std::to_string(0)));
+                }
+
+                if (begin == end)
+                {
+                    n_cols_ = n_cols;
+                    return;
                 }
-                current_line.clear();
             }
-            else
+        }
+
+        void parse_row(std::size_t i, std::size_t column_start,
+            std::size_t column_size, double* dest) const
+        {
+            char const* begin;
+            char const* end;
+            std::tie(begin, end) = line(i);
+
+            std::size_t n_cols = 0;
+            bool result = parse_values(begin, end, n_cols,
+                [&](std::size_t col, double value)
+                {
+                    if (col >= column_start && col - column_start < column_size)
+                    {
+                        dest[col - column_start] = value;
+                    }
+                });
+
+            if (!result)
             {
                 throw std::runtime_error(
                     util::generate_error_message("wrong data format " +
-                        filename + ':' + std::to_string(n_rows)));
+                        filename_ + ':' + std::to_string(i - first_row_)));
+            }
+
+            if (n_cols != n_cols_)
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "wrong data format, different number of element in "
+                    "this row " +
+                    filename_ + ':' + std::to_string(i - first_row_)));
+            }
+        }
+
+        // parse a comma separated list of doubles, stops at the first
+        // element that can't be parsed
+        template <typename F>
+        static bool parse_values(char const*& begin, char const* end,
+            std::size_t& n_cols, F&& f)
+        {
+            double value;
+            if (!boost::spirit::qi::parse(
+                    begin, end, boost::spirit::qi::double_, value))
+            {
+                return false;
+            }
+            f(n_cols++, value);
+
+            while (begin != end && *begin == ',')
+            {
+                char const* next = begin + 1;
+                if (!boost::spirit::qi::parse(
+                        next, end, boost::spirit::qi::double_, value))
+                {
+                    break;
+                }
+                f(n_cols++, value);
+                begin = next;
             }
+            return true;
         }
 
-        return std::move(std::make_tuple(matrix_array, n_rows, n_cols));
-    }
+    private:
+        std::string filename_;
+        std::string buffer_;
+        std::vector<std::size_t> lines_;
+        std::size_t first_row_;
+        std::size_t n_cols_;
+    };
 }}}
 
 #endif
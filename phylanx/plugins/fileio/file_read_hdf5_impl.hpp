@@ -0,0 +1,233 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FILE_READ_HDF5_IMPL_HPP)
+#define PHYLANX_PRIMITIVES_FILE_READ_HDF5_IMPL_HPP
+
+#include <phylanx/config.hpp>
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+
+#include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSpace.hpp>
+#include <highfive/H5File.hpp>
+
+#include <H5Dpublic.h>
+#include <H5Ppublic.h>
+#include <H5Spublic.h>
+#include <H5Tpublic.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A dataset in a HDF5 file. Data is read using hyperslab selections
+    // (start, count, and stride for each of the dimensions of the dataset)
+    // straight into the storage of the resulting array, which allows for
+    // reading parts of datasets that would not fit into memory as a whole.
+    class hdf5_dataset
+    {
+    public:
+        using dimensions_type = std::array<std::size_t, PHYLANX_MAX_DIMENSIONS>;
+
+        hdf5_dataset(std::string const& filename, std::string const& dataset,
+                std::string const& name, std::string const& codename)
+          : file_(filename, HighFive::File::ReadOnly)
+          , dataset_(file_.getDataSet(dataset))
+          , dims_(dataset_.getSpace().getDimensions())
+          , name_(name)
+          , codename_(codename)
+        {
+            if (dims_.size() > PHYLANX_MAX_DIMENSIONS)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hdf5_dataset::hdf5_dataset",
+                    util::generate_error_message(
+                        "the dataset '" + dataset + "' in file '" + filename +
+                            "' has an incompatible number of dimensions",
+                        name_, codename_));
+            }
+        }
+
+        std::size_t num_dimensions() const
+        {
+            return dims_.size();
+        }
+
+        std::size_t dimension(std::size_t dim) const
+        {
+            return dims_[dim];
+        }
+
+        // Select the elements start[i] + k * stride[i] (k < count[i]) of each
+        // dimension i. A count of zero selects all elements starting at
+        // start[i] up to the end of that dimension.
+        ir::node_data<double> read(dimensions_type const& start,
+            dimensions_type count, dimensions_type stride) const
+        {
+            std::size_t const ndims = dims_.size();
+            if (ndims == 0)
+            {
+                double scalar;
+                dataset_.read(scalar);
+                return ir::node_data<double>{scalar};
+            }
+
+            for (std::size_t i = 0; i != ndims; ++i)
+            {
+                if (stride[i] == 0)
+                {
+                    stride[i] = 1;
+                }
+                if (start[i] >= dims_[i])
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "hdf5_dataset::read",
+                        util::generate_error_message(
+                            "the start of the selection is out of the bounds "
+                            "of the dataset",
+                            name_, codename_));
+                }
+                if (count[i] == 0)
+                {
+                    count[i] =
+                        (dims_[i] - start[i] + stride[i] - 1) / stride[i];
+                }
+                else if (start[i] + (count[i] - 1) * stride[i] >= dims_[i])
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "hdf5_dataset::read",
+                        util::generate_error_message(
+                            "the selection is out of the bounds of the "
+                            "dataset",
+                            name_, codename_));
+                }
+            }
+
+            switch (ndims)
+            {
+            case 1:
+                {
+                    blaze::DynamicVector<double> result(count[0]);
+                    read_hyperslab(result.data(), {count[0]}, start, count,
+                        stride);
+                    return ir::node_data<double>{std::move(result)};
+                }
+
+            case 2:
+                {
+                    blaze::DynamicMatrix<double> result(count[0], count[1]);
+                    read_hyperslab(result.data(),
+                        {count[0], result.spacing()}, start, count, stride);
+                    return ir::node_data<double>{std::move(result)};
+                }
+
+            case 3:
+                {
+                    blaze::DynamicTensor<double> result(
+                        count[0], count[1], count[2]);
+                    read_hyperslab(result.data(),
+                        {count[0], count[1], result.spacing()}, start, count,
+                        stride);
+                    return ir::node_data<double>{std::move(result)};
+                }
+
+            case 4:
+                {
+                    blaze::DynamicArray<4, double> result(
+                        count[0], count[1], count[2], count[3]);
+                    read_hyperslab(result.data(),
+                        {count[0], count[1], count[2], result.spacing()},
+                        start, count, stride);
+                    return ir::node_data<double>{std::move(result)};
+                }
+
+            default:
+                break;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "hdf5_dataset::read",
+                util::generate_error_message(
+                    "the dataset has an incompatible number of dimensions",
+                    name_, codename_));
+        }
+
+        // read the whole dataset
+        ir::node_data<double> read() const
+        {
+            return read(dimensions_type{0}, dimensions_type{0},
+                dimensions_type{0});
+        }
+
+    private:
+        // The memory space describes the (padded) layout of the target
+        // array: its innermost dimension is the spacing of the array, out of
+        // which only the leading count elements are selected.
+        void read_hyperslab(double* buffer, std::vector<hsize_t> mem_dims,
+            dimensions_type const& start, dimensions_type const& count,
+            dimensions_type const& stride) const
+        {
+            std::size_t const ndims = mem_dims.size();
+            std::vector<hsize_t> file_start(
+                start.begin(), start.begin() + ndims);
+            std::vector<hsize_t> file_count(
+                count.begin(), count.begin() + ndims);
+            std::vector<hsize_t> file_stride(
+                stride.begin(), stride.begin() + ndims);
+            std::vector<hsize_t> mem_start(ndims, 0);
+
+            hid_t file_space = H5Dget_space(dataset_.getId());
+            hid_t mem_space = H5Screate_simple(
+                static_cast<int>(ndims), mem_dims.data(), nullptr);
+
+            herr_t status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET,
+                file_start.data(), file_stride.data(), file_count.data(),
+                nullptr);
+            if (status >= 0)
+            {
+                status = H5Sselect_hyperslab(mem_space, H5S_SELECT_SET,
+                    mem_start.data(), nullptr, file_count.data(), nullptr);
+            }
+            if (status >= 0)
+            {
+                status = H5Dread(dataset_.getId(), H5T_NATIVE_DOUBLE,
+                    mem_space, file_space, H5P_DEFAULT, buffer);
+            }
+
+            H5Sclose(mem_space);
+            H5Sclose(file_space);
+
+            if (status < 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hdf5_dataset::read_hyperslab",
+                    util::generate_error_message(
+                        "reading the selected part of the dataset failed",
+                        name_, codename_));
+            }
+        }
+
+        HighFive::File file_;
+        HighFive::DataSet dataset_;
+        std::vector<std::size_t> dims_;
+        std::string name_;
+        std::string codename_;
+    };
+}}}
+
+#endif
+#endif
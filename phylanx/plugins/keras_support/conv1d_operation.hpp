@@ -10,6 +10,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/conv1d_all_paddings.hpp>
 
 #include <hpx/futures/future.hpp>
@@ -45,6 +46,12 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         conv1d_operation(primitive_arguments_type&& operands,
             std::string const& name, std::string const& codename);
+
+    private:
+        template <typename T>
+        primitive_argument_type conv1d_any(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel, std::string&& padding,
+            std::int64_t strides, std::int64_t dilation_rate) const;
     };
 
     inline primitive create_conv1d_operation(hpx::id_type const& locality,
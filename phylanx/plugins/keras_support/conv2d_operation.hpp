@@ -49,33 +49,48 @@ namespace phylanx { namespace execution_tree { namespace primitives {
             std::string const& name, std::string const& codename);
 
     private:
-        primitive_argument_type conv2d_valid(ir::node_data<double>&& arg,
-            ir::node_data<double>&& kernel) const;
-        primitive_argument_type conv2d_valid(ir::node_data<double>&& arg,
-            ir::node_data<double>&& kernel, std::int64_t stride_height,
+        template <typename T>
+        primitive_argument_type conv2d_valid(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel) const;
+        template <typename T>
+        primitive_argument_type conv2d_valid(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel, std::int64_t stride_height,
             std::int64_t stride_width) const;
+        template <typename T>
         primitive_argument_type conv2d_valid_dilation(
-            ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+            ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
             std::int64_t dilation_height, std::int64_t dilation_width) const;
 
-        primitive_argument_type conv2d_same(ir::node_data<double>&& arg,
-            ir::node_data<double>&& kernel) const;
-        primitive_argument_type conv2d_same(ir::node_data<double>&& arg,
-            ir::node_data<double>&& kernel, std::int64_t stride_height,
+        template <typename T>
+        primitive_argument_type conv2d_same(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel) const;
+        template <typename T>
+        primitive_argument_type conv2d_same(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel, std::int64_t stride_height,
             std::int64_t stride_width) const;
+        template <typename T>
         primitive_argument_type conv2d_same_dilation(
-            ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+            ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
             std::int64_t dilation_height, std::int64_t dilation_width) const;
 
-        primitive_argument_type conv2d_any_pad(ir::node_data<double>&& arg,
-            ir::node_data<double>&& kernel, std::string&& padding) const;
-        primitive_argument_type conv2d_any_pad(ir::node_data<double>&& arg,
-            ir::node_data<double>&& kernel, std::string&& padding,
+        template <typename T>
+        primitive_argument_type conv2d_any_pad(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel, std::string&& padding) const;
+        template <typename T>
+        primitive_argument_type conv2d_any_pad(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel, std::string&& padding,
             std::int64_t stride_height, std::int64_t stride_width) const;
+        template <typename T>
         primitive_argument_type conv2d_any_pad_dilation(
-            ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+            ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
             std::string&& padding, std::int64_t dilation_height,
             std::int64_t dilation_width) const;
+
+        template <typename T>
+        primitive_argument_type conv2d_any(ir::node_data<T>&& arg,
+            ir::node_data<T>&& kernel, std::string&& padding,
+            std::int64_t stride_height, std::int64_t stride_width,
+            std::int64_t dilation_height, std::int64_t dilation_width) const;
     };
 
     inline primitive create_conv2d_operation(hpx::id_type const& locality,
@@ -65,9 +65,6 @@ namespace phylanx { namespace execution_tree { namespace primitives {
             std::string&& padding, std::int64_t dilation_height,
             std::int64_t dilation_width) const;
 
-        template <typename Tensor>
-        void flip_kernel(Tensor& m) const;
-
         primitive_argument_type conv2d_transpose_valid(
             ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
             std::size_t res_height, std::size_t res_width) const;
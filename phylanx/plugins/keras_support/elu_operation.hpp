@@ -40,10 +40,6 @@ namespace phylanx {  namespace execution_tree {  namespace primitives
             primitive_arguments_type const& args,
             eval_context ctx) const override;
 
-        using val_type   = double;
-        using mat_type   = ir::node_data<val_type>;
-        using alpha_type = ir::node_data<val_type>;
-
     public:
         static match_pattern_type const match_data;
 
@@ -53,10 +49,17 @@ namespace phylanx {  namespace execution_tree {  namespace primitives
             std::string const& name, std::string const& codename);
 
     private:
-        primitive_argument_type elu0d(mat_type&& arg, double alpha) const;
-        primitive_argument_type elu1d(mat_type&& arg, double alpha) const;
-        primitive_argument_type elu2d(mat_type&& arg, double alpha) const;
-        primitive_argument_type elu3d(mat_type&& arg, double alpha) const;
+        template <typename T>
+        primitive_argument_type elu0d(ir::node_data<T>&& arg, T alpha) const;
+        template <typename T>
+        primitive_argument_type elu1d(ir::node_data<T>&& arg, T alpha) const;
+        template <typename T>
+        primitive_argument_type elu2d(ir::node_data<T>&& arg, T alpha) const;
+        template <typename T>
+        primitive_argument_type elu3d(ir::node_data<T>&& arg, T alpha) const;
+
+        template <typename T>
+        primitive_argument_type elu_nd(ir::node_data<T>&& arg, T alpha) const;
     };
 
     inline primitive create_elu_operation(hpx::id_type const& locality,
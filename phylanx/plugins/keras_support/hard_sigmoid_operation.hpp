@@ -36,9 +36,6 @@ namespace phylanx {  namespace execution_tree {  namespace primitives
             primitive_arguments_type const& args,
             eval_context ctx) const override;
 
-        using val_type = double;
-        using arg_type = ir::node_data<val_type>;
-
     public:
         static match_pattern_type const match_data;
 
@@ -48,10 +45,17 @@ namespace phylanx {  namespace execution_tree {  namespace primitives
             std::string const& name, std::string const& codename);
 
     private:
-        primitive_argument_type hard_sigmoid0d(arg_type&& arg) const;
-        primitive_argument_type hard_sigmoid1d(arg_type&& arg) const;
-        primitive_argument_type hard_sigmoid2d(arg_type&& arg) const;
-        primitive_argument_type hard_sigmoid3d(arg_type&& arg) const;
+        template <typename T>
+        primitive_argument_type hard_sigmoid0d(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type hard_sigmoid1d(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type hard_sigmoid2d(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type hard_sigmoid3d(ir::node_data<T>&& arg) const;
+
+        template <typename T>
+        primitive_argument_type hard_sigmoid_nd(ir::node_data<T>&& arg) const;
     };
 
     inline primitive create_hard_sigmoid_operation(hpx::id_type const& locality,
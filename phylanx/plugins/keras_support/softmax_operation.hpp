@@ -39,8 +39,6 @@ namespace phylanx {  namespace execution_tree {  namespace primitives  {
             primitive_arguments_type const& operands,
             primitive_arguments_type const& args,
             eval_context ctx) const override;
-        using val_type = double;
-        using arg_type = ir::node_data<val_type>;
 
     public:
         static match_pattern_type const match_data;
@@ -51,26 +49,44 @@ namespace phylanx {  namespace execution_tree {  namespace primitives  {
             std::string const& name, std::string const& codename);
 
     private:
+        template <typename T>
         primitive_argument_type softmax0d() const;
-        primitive_argument_type softmax1d(arg_type&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax1d(ir::node_data<T>&& arg) const;
 
+        template <typename T>
         primitive_argument_type softmax2d(
-            arg_type&& arg, std::int64_t axis) const;
-        primitive_argument_type softmax2d_axis0(arg_type&& arg) const;
-        primitive_argument_type softmax2d_axis1(arg_type&& arg) const;
+            ir::node_data<T>&& arg, std::int64_t axis) const;
+        template <typename T>
+        primitive_argument_type softmax2d_axis0(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax2d_axis1(ir::node_data<T>&& arg) const;
 
-        primitive_argument_type softmax3d_axis0(arg_type&& arg) const;
-        primitive_argument_type softmax3d_axis1(arg_type&& arg) const;
-        primitive_argument_type softmax3d_axis2(arg_type&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax3d_axis0(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax3d_axis1(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax3d_axis2(ir::node_data<T>&& arg) const;
+        template <typename T>
         primitive_argument_type softmax3d(
-            arg_type&& arg, std::int64_t axis) const;
+            ir::node_data<T>&& arg, std::int64_t axis) const;
 
-        primitive_argument_type softmax4d_axis0(arg_type&& arg) const;
-        primitive_argument_type softmax4d_axis1(arg_type&& arg) const;
-        primitive_argument_type softmax4d_axis2(arg_type&& arg) const;
-        primitive_argument_type softmax4d_axis3(arg_type&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax4d_axis0(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax4d_axis1(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax4d_axis2(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softmax4d_axis3(ir::node_data<T>&& arg) const;
+        template <typename T>
         primitive_argument_type softmax4d(
-            arg_type&& arg, std::int64_t axis) const;
+            ir::node_data<T>&& arg, std::int64_t axis) const;
+
+        template <typename T>
+        primitive_argument_type softmax_nd(
+            ir::node_data<T>&& arg, std::int64_t axis) const;
     };
 
     inline primitive create_softmax_operation(hpx::id_type const& locality,
@@ -38,9 +38,6 @@ namespace phylanx {  namespace execution_tree {  namespace primitives
             primitive_arguments_type const& args,
             eval_context ctx) const override;
 
-        using val_type = double;
-        using arg_type = ir::node_data<val_type>;
-
     public:
         static match_pattern_type const match_data;
 
@@ -50,10 +47,17 @@ namespace phylanx {  namespace execution_tree {  namespace primitives
             std::string const& name, std::string const& codename);
 
     private:
-        primitive_argument_type softplus0d(arg_type&& arg) const;
-        primitive_argument_type softplus1d(arg_type&& arg) const;
-        primitive_argument_type softplus2d(arg_type&& arg) const;
-        primitive_argument_type softplus3d(arg_type&& arg) const;
+        template <typename T>
+        primitive_argument_type softplus0d(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softplus1d(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softplus2d(ir::node_data<T>&& arg) const;
+        template <typename T>
+        primitive_argument_type softplus3d(ir::node_data<T>&& arg) const;
+
+        template <typename T>
+        primitive_argument_type softplus_nd(ir::node_data<T>&& arg) const;
     };
 
     inline primitive create_softplus_operation(hpx::id_type const& locality,
@@ -23,7 +23,9 @@
 namespace phylanx { namespace execution_tree { namespace primitives
 {
     /// \brief Implementation of unique as a Phylanx primitive.
-    /// Returns the sorted unique elements of array a.
+    /// Returns the sorted unique elements of array a, optionally together
+    /// with the indices of their first occurrences, the indices
+    /// reconstructing a from the unique elements, and their counts.
     /// This implementation is intended to behave like [NumPy implementation of unique]
     /// (https://docs.scipy.org/doc/numpy-1.15.0/reference/generated/numpy.unique.html).
     /// \param a an array
@@ -46,30 +48,39 @@ namespace phylanx { namespace execution_tree { namespace primitives
                std::string const &codename);
 
     private:
-        primitive_argument_type unique0d(primitive_arguments_type &&args) const;
+        // the optional results requested in addition to the unique values
+        struct unique_options
+        {
+            bool return_index_ = false;
+            bool return_inverse_ = false;
+            bool return_counts_ = false;
+
+            bool any() const
+            {
+                return return_index_ || return_inverse_ || return_counts_;
+            }
+        };
+
+        primitive_argument_type unique_helper(primitive_argument_type&& arg,
+            std::int64_t axis, bool has_axis,
+            unique_options const& options) const;
 
-        primitive_argument_type unique1d(primitive_arguments_type &&args) const;
-
-        primitive_argument_type unique2d(primitive_arguments_type &&args) const;
-
-        template<typename T>
-        primitive_argument_type unique0d(ir::node_data <T> &&args) const;
-
-        template<typename T>
-        primitive_argument_type unique1d(ir::node_data <T> &&args) const;
-
-        template<typename T>
-        primitive_argument_type unique2d_flatten(ir::node_data <T> &&arg) const;
+        template <typename T>
+        primitive_argument_type unique_helper(ir::node_data<T>&& arg,
+            std::int64_t axis, bool has_axis,
+            unique_options const& options) const;
 
-        template<typename T>
-        primitive_argument_type unique2d_x_axis(ir::node_data <T> &&arg) const;
+        template <typename T>
+        primitive_argument_type unique_flatten(
+            ir::node_data<T>&& arg, unique_options const& options) const;
 
-        template<typename T>
-        primitive_argument_type unique2d_y_axis(ir::node_data <T> &&arg) const;
+        template <typename T>
+        primitive_argument_type unique2d_x_axis(
+            ir::node_data<T>&& arg, unique_options const& options) const;
 
         template <typename T>
-        primitive_argument_type unique2d(std::size_t numargs,
-            ir::node_data<T>&& arg, std::int64_t axis) const;
+        primitive_argument_type unique2d_y_axis(
+            ir::node_data<T>&& arg, unique_options const& options) const;
     };
 
     inline primitive create_unique(hpx::id_type const& locality,
@@ -10,7 +10,9 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/sparse_operations.hpp>
 #include <phylanx/plugins/common/statistics_nd.hpp>
+#include <phylanx/plugins/common/statistics_operations.hpp>
 #include <phylanx/plugins/statistics/statistics_base.hpp>
 
 #include <hpx/assert.hpp>
@@ -25,6 +27,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -99,6 +102,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                         // the second argument is either a list of integers...
                         if (is_list_operand_strict(args[1]))
                         {
+                            args[0] = common::to_dense(std::move(args[0]),
+                                this_->name_, this_->codename_);
                             return common::statisticsnd<Op>(std::move(args[0]),
                                 extract_list_value_strict(std::move(args[1]),
                                     this_->name_, this_->codename_),
@@ -112,6 +117,21 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                     }
                 }
 
+                // sums are calculated directly on sparse data, everything
+                // else operates on a dense copy
+                if (is_sparse_operand(args[0]))
+                {
+                    if (std::is_same<Op<double>,
+                            common::statistics_sum_op<double>>::value &&
+                        !valid(initial) && dtype == node_data_type_unknown)
+                    {
+                        return common::sparse_sum(std::move(args[0]), axis,
+                            keepdims, this_->name_, this_->codename_);
+                    }
+                    args[0] = common::to_dense(std::move(args[0]),
+                        this_->name_, this_->codename_);
+                }
+
                 return common::statisticsnd<Op>(std::move(args[0]), axis,
                     keepdims, std::move(initial), dtype, this_->name_,
                     this_->codename_, std::move(ctx));
@@ -8,6 +8,7 @@
 
 #include <phylanx/config.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
@@ -85,6 +86,12 @@ namespace phylanx { namespace traits
     {
     };
 
+    // uniform vectors are used to broadcast scalars
+    template <typename T, bool TF>
+    struct is_vector<blaze::UniformVector<T, TF>> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool SO>
     struct is_matrix<blaze::DynamicMatrix<T, SO>> : std::true_type
@@ -97,6 +104,18 @@ namespace phylanx { namespace traits
     {
     };
 
+    // uniform matrices and expanded vectors are used to broadcast scalars,
+    // vectors, rows, and columns into matrices
+    template <typename T, bool SO>
+    struct is_matrix<blaze::UniformMatrix<T, SO>> : std::true_type
+    {
+    };
+
+    template <typename VT, bool TF, std::size_t... CEAs>
+    struct is_matrix<blaze::DVecExpandExpr<VT, TF, CEAs...>> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct is_tensor<blaze::DynamicTensor<T>> : std::true_type
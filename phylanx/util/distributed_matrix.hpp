@@ -9,11 +9,13 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/util/serialization/blaze.hpp>
+#include <phylanx/util/serialization/submatrix.hpp>
 
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/errors/throw_exception.hpp>
+#include <hpx/futures/future.hpp>
 #include <hpx/modules/components.hpp>
 #include <hpx/modules/components_base.hpp>
 #include <hpx/modules/runtime_components.hpp>
@@ -46,6 +48,9 @@ namespace phylanx { namespace util { namespace server {
         using reference_type =
             blaze::CustomMatrix<T, blaze::aligned, blaze::padded>;
 
+        // the parts are sent without their padding
+        using transfer_type = submatrix_transfer<T>;
+
         distributed_matrix_part() = default;
 
         explicit distributed_matrix_part(reference_type const& data)
@@ -78,18 +83,22 @@ namespace phylanx { namespace util { namespace server {
             return &data_;
         }
 
-        data_type fetch() const
+        // the elements are copied before the action returns, the part may
+        // be modified or destroyed before the result has been sent
+        transfer_type fetch() const
         {
-            return data_;
+            return transfer_type{data_type{data_}};
         }
 
         HPX_DEFINE_COMPONENT_ACTION(distributed_matrix_part, fetch);
 
-        data_type fetch_part(std::size_t start_row, std::size_t start_column,
-            std::size_t stop_row, std::size_t stop_column) const
+        transfer_type fetch_part(std::size_t start_row,
+            std::size_t start_column, std::size_t stop_row,
+            std::size_t stop_column) const
         {
-            return data_type{blaze::submatrix(data_, start_row, start_column,
-                stop_row - start_row, stop_column - start_column)};
+            return transfer_type{data_type{blaze::submatrix(data_, start_row,
+                start_column, stop_row - start_row,
+                stop_column - start_column)}};
         }
 
         HPX_DEFINE_COMPONENT_ACTION(distributed_matrix_part, fetch_part);
@@ -133,6 +142,8 @@ namespace phylanx { namespace util {
             typename server::distributed_matrix_part<T>::data_type;
         using reference_type =
             typename server::distributed_matrix_part<T>::reference_type;
+        using transfer_type =
+            typename server::distributed_matrix_part<T>::transfer_type;
 
     public:
         /// Creates a distributed_matrix in every locality
@@ -268,30 +279,21 @@ namespace phylanx { namespace util {
         hpx::future<data_type> fetch(std::size_t idx) const
         {
             /// \cond NOINTERNAL
+            if (idx == this_site_)
+            {
+                // the local part is copied directly, nothing is transferred
+                HPX_ASSERT(!!ptr_);
+                return hpx::make_ready_future(data_type{**ptr_});
+            }
+
             using action_type =
                 typename server::distributed_matrix_part<T>::fetch_action;
 
-            auto f = hpx::async<action_type>(get_part_id(idx));
-
-            // keep track of number of transferred bytes, if needed
-            if (transferred_bytes_ != nullptr)
-            {
-                auto shared_state = hpx::traits::detail::get_shared_state(f);
-                shared_state->set_on_completed([this, shared_state]() -> void {
-                    data_type* r = shared_state->get_result();
-                    if (r != nullptr)
-                    {
-                        using spinlock_pool =
-                            hpx::util::spinlock_pool<std::uint64_t>;
-
-                        std::lock_guard<hpx::util::detail::spinlock> l(
-                            spinlock_pool::spinlock_for(transferred_bytes_));
-
-                        *transferred_bytes_ += r->capacity() * sizeof(T);
-                    }
-                });
-            }
-            return f;
+            return hpx::async<action_type>(get_part_id(idx))
+                .then(hpx::launch::sync,
+                    [this](hpx::future<transfer_type>&& f) -> data_type {
+                        return received(f.get());
+                    });
             /// \endcond
         }
 
@@ -308,36 +310,45 @@ namespace phylanx { namespace util {
             std::size_t stop_column) const
         {
             /// \cond NOINTERNAL
+            if (idx == this_site_)
+            {
+                // the local part is copied directly, nothing is transferred
+                HPX_ASSERT(!!ptr_);
+                return hpx::make_ready_future(data_type{blaze::submatrix(
+                    **ptr_, start_row, start_column, stop_row - start_row,
+                    stop_column - start_column)});
+            }
+
             using action_type =
                 typename server::distributed_matrix_part<T>::fetch_part_action;
 
-            auto f = hpx::async<action_type>(get_part_id(idx), start_row,
-                start_column, stop_row, stop_column);
+            return hpx::async<action_type>(get_part_id(idx), start_row,
+                start_column, stop_row, stop_column)
+                .then(hpx::launch::sync,
+                    [this](hpx::future<transfer_type>&& f) -> data_type {
+                        return received(f.get());
+                    });
+            /// \endcond
+        }
 
+    private:
+        /// \cond NOINTERNAL
+        data_type received(transfer_type&& part) const
+        {
             // keep track of number of transferred bytes, if needed
             if (transferred_bytes_ != nullptr)
             {
-                auto shared_state = hpx::traits::detail::get_shared_state(f);
-                shared_state->set_on_completed([this, shared_state]() -> void {
-                    data_type* r = shared_state->get_result();
-                    if (r != nullptr)
-                    {
-                        using spinlock_pool =
-                            hpx::util::spinlock_pool<std::uint64_t>;
-
-                        std::lock_guard<hpx::util::detail::spinlock> l(
-                            spinlock_pool::spinlock_for(transferred_bytes_));
-
-                        *transferred_bytes_ += r->capacity() * sizeof(T);
-                    }
-                });
+                using spinlock_pool = hpx::util::spinlock_pool<std::uint64_t>;
+
+                std::lock_guard<hpx::util::detail::spinlock> l(
+                    spinlock_pool::spinlock_for(transferred_bytes_));
+
+                *transferred_bytes_ += part.size_in_bytes();
             }
-            return f;
-            /// \endcond
+
+            return std::move(part).get();
         }
 
-    private:
-        /// \cond NOINTERNAL
         template <typename Arg>
         hpx::id_type create_and_register_server(Arg&& value)
         {
@@ -49,6 +49,17 @@ namespace phylanx { namespace util
                 (lhs.hash_ == rhs.hash_ && lhs.key_ < rhs.key_);
         }
 
+        friend bool operator==(hashed_string const& lhs,
+            hashed_string const& rhs)
+        {
+            return lhs.hash_ == rhs.hash_ && lhs.key_ == rhs.key_;
+        }
+        friend bool operator!=(hashed_string const& lhs,
+            hashed_string const& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
         PHYLANX_EXPORT friend std::ostream& operator<<(std::ostream& os,
             hashed_string const& s);
 
@@ -70,7 +81,7 @@ namespace phylanx { namespace util
             unsigned);
 
         std::string key_;
-        size_type hash_;
+        size_type hash_ = 0;
     };
 }}
 
@@ -6,8 +6,15 @@
 
 #include <phylanx/config.hpp>
 
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <random>
+#include <vector>
 
 #if !defined(PHYLANX_PRIMITIVES_RANDOM_UTILS)
 #define PHYLANX_PRIMITIVES_RANDOM_UTILS
@@ -23,6 +30,246 @@ namespace phylanx { namespace util
     PHYLANX_EXPORT void set_seed(std::uint32_t seed);
 
     PHYLANX_EXPORT std::uint32_t get_seed();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Counter based random number generator (Philox-4x32-10, see Salmon et.al.
+    // "Parallel Random Numbers: As Easy as 1, 2, 3"). The generated sequence
+    // is a pure function of the key and the initial counter, which allows to
+    // generate the random values of array elements independently of each
+    // other (and in any order).
+    class philox_engine
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        philox_engine(std::uint64_t key, std::uint64_t counter)
+          : key_{{static_cast<std::uint32_t>(key),
+                static_cast<std::uint32_t>(key >> 32)}}
+          , counter_{{static_cast<std::uint32_t>(counter),
+                static_cast<std::uint32_t>(counter >> 32), 0, 0}}
+          , index_(4)
+        {
+        }
+
+        static constexpr result_type (min)()
+        {
+            return 0;
+        }
+        static constexpr result_type (max)()
+        {
+            return 0xffffffff;
+        }
+
+        result_type operator()()
+        {
+            if (index_ == 4)
+            {
+                generate_block();
+                index_ = 0;
+            }
+            return block_[index_++];
+        }
+
+        void discard(unsigned long long n)
+        {
+            for (/**/; n != 0; --n)
+            {
+                (*this)();
+            }
+        }
+
+        // Return the given block of the sequence generated for the given key
+        // and initial counter.
+        static std::array<std::uint32_t, 4> block(
+            std::uint64_t key, std::uint64_t counter, std::uint64_t n)
+        {
+            return philox(
+                {{static_cast<std::uint32_t>(key),
+                    static_cast<std::uint32_t>(key >> 32)}},
+                {{static_cast<std::uint32_t>(counter),
+                    static_cast<std::uint32_t>(counter >> 32),
+                    static_cast<std::uint32_t>(n),
+                    static_cast<std::uint32_t>(n >> 32)}});
+        }
+
+    private:
+        static std::uint32_t mulhilo(
+            std::uint32_t a, std::uint32_t b, std::uint32_t& hi)
+        {
+            std::uint64_t product = std::uint64_t(a) * std::uint64_t(b);
+            hi = static_cast<std::uint32_t>(product >> 32);
+            return static_cast<std::uint32_t>(product);
+        }
+
+        static std::array<std::uint32_t, 4> philox(
+            std::array<std::uint32_t, 2> key, std::array<std::uint32_t, 4> ctr)
+        {
+            for (int round = 0; round != 10; ++round)
+            {
+                std::uint32_t hi0, hi1;
+                std::uint32_t lo0 = mulhilo(0xD2511F53, ctr[0], hi0);
+                std::uint32_t lo1 = mulhilo(0xCD9E8D57, ctr[2], hi1);
+
+                ctr = {{hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0}};
+
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            return ctr;
+        }
+
+        void generate_block()
+        {
+            block_ = philox(key_, counter_);
+
+            // the upper half of the counter enumerates the blocks generated
+            // for the same initial counter
+            if (++counter_[2] == 0)
+            {
+                ++counter_[3];
+            }
+        }
+
+        std::array<std::uint32_t, 2> key_;
+        std::array<std::uint32_t, 4> counter_;
+        std::array<std::uint32_t, 4> block_;
+        std::size_t index_;
+    };
+
+    // Return the key to use for the next array of random numbers. Keys are
+    // derived from the current seed and the number of keys handed out since
+    // the seed was set, thus subsequent arrays are different while the
+    // overall sequence is reproducible after calling set_seed.
+    PHYLANX_EXPORT std::uint64_t next_random_key();
+
+    // Random numbers for the elements of the array associated with the
+    // given key. The first number drawn for an element is the word
+    // (index % 4) of the Philox block for the counter (index / 4), further
+    // numbers are taken from the same word of the subsequent blocks of
+    // that counter. The numbers of an element are a pure function of the
+    // key and its index, while four consecutive elements share the
+    // computation of their blocks.
+    class philox_element_engine
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        explicit philox_element_engine(std::uint64_t key)
+          : key_(key)
+          , counter_(0)
+          , word_(0)
+          , next_(0)
+        {
+        }
+
+        static constexpr result_type (min)()
+        {
+            return 0;
+        }
+        static constexpr result_type (max)()
+        {
+            return 0xffffffff;
+        }
+
+        // draw the following numbers for the element with the given index
+        void seek(std::uint64_t index)
+        {
+            if (blocks_.empty() || index / 4 != counter_)
+            {
+                counter_ = index / 4;
+                blocks_.clear();
+            }
+            word_ = static_cast<std::size_t>(index % 4);
+            next_ = 0;
+        }
+
+        result_type operator()()
+        {
+            if (next_ == blocks_.size())
+            {
+                blocks_.push_back(
+                    philox_engine::block(key_, counter_, blocks_.size()));
+            }
+            return blocks_[next_++][word_];
+        }
+
+    private:
+        std::uint64_t key_;
+        std::uint64_t counter_;
+        std::size_t word_;
+        std::size_t next_;
+        std::vector<std::array<std::uint32_t, 4>> blocks_;
+    };
+
+    // Generates the random values of the elements of the array associated
+    // with the given key using (a copy of) the given distribution.
+    template <typename Dist>
+    class random_element_generator
+    {
+    public:
+        random_element_generator(Dist const& dist, std::uint64_t key)
+          : dist_(dist)
+          , engine_(key)
+        {
+        }
+
+        typename Dist::result_type operator()(std::uint64_t index)
+        {
+            engine_.seek(index);
+            dist_.reset();
+            return dist_(engine_);
+        }
+
+    private:
+        Dist dist_;
+        philox_element_engine engine_;
+    };
+
+    // Generate the random value for the element with the given (global)
+    // index of the array associated with the given key.
+    template <typename Dist>
+    typename Dist::result_type random_element(
+        Dist const& dist, std::uint64_t key, std::uint64_t index)
+    {
+        random_element_generator<Dist> gen(dist, key);
+        return gen(index);
+    }
+
+    // Invoke f(gen, i) for all i in [0, count) in parallel, each chunk of
+    // elements uses its own random_element_generator for the given
+    // distribution and key.
+    template <typename Dist, typename F>
+    void random_for_loop(
+        Dist const& dist, std::uint64_t key, std::size_t count, F&& f)
+    {
+        constexpr std::size_t min_chunk_size = 1024;
+
+        std::size_t num_chunks = (std::min)(
+            (count + min_chunk_size - 1) / min_chunk_size,
+            std::size_t(4 * hpx::get_os_thread_count()));
+
+        if (num_chunks <= 1)
+        {
+            random_element_generator<Dist> gen(dist, key);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(gen, i);
+            }
+            return;
+        }
+
+        std::size_t chunk_size = (count + num_chunks - 1) / num_chunks;
+        hpx::for_loop(hpx::execution::par, std::size_t(0), num_chunks,
+            [&](std::size_t chunk)
+            {
+                random_element_generator<Dist> gen(dist, key);
+                std::size_t end = (std::min)(count, (chunk + 1) * chunk_size);
+                for (std::size_t i = chunk * chunk_size; i < end; ++i)
+                {
+                    f(gen, i);
+                }
+            });
+    }
 }}
 
 #endif
@@ -17,6 +17,7 @@ namespace phylanx { namespace util
 {
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<double> const&);
+    PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<float> const&);
     PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<std::int64_t> const&);
     PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<std::uint8_t> const&);
 
@@ -24,6 +25,8 @@ namespace phylanx { namespace util
     {
         PHYLANX_EXPORT void unserialize(
             std::vector<char> const&, ir::node_data<double>&);
+        PHYLANX_EXPORT void unserialize(
+            std::vector<char> const&, ir::node_data<float>&);
         PHYLANX_EXPORT void unserialize(
             std::vector<char> const&, ir::node_data<std::int64_t>&);
         PHYLANX_EXPORT void unserialize(
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <cstddef>
+#include <vector>
 
 namespace hpx { namespace serialization
 {
@@ -132,6 +133,73 @@ namespace hpx { namespace serialization
         HPX_ASSERT(false);      // shouldn't ever be called
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool TF>
+    void load(input_archive& archive, blaze::CompressedVector<T, TF>& target,
+        unsigned)
+    {
+        // De-serialize sparse vector, the non-zero elements are stored as
+        // (index, value) pairs
+        std::size_t size = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> size >> nonzeros;
+
+        std::vector<std::size_t> indices(nonzeros);
+        std::vector<T> values(nonzeros);
+        archive >> hpx::serialization::make_array(indices.data(), nonzeros) >>
+            hpx::serialization::make_array(values.data(), nonzeros);
+
+        target.resize(size, false);
+        target.reset();
+        target.reserve(nonzeros);
+        for (std::size_t i = 0; i != nonzeros; ++i)
+        {
+            target.append(indices[i], values[i]);
+        }
+    }
+
+    template <typename T, bool SO>
+    void load(input_archive& archive, blaze::CompressedMatrix<T, SO>& target,
+        unsigned)
+    {
+        // De-serialize sparse matrix, the non-zero elements are stored row by
+        // row (or column by column for column-major matrices)
+        std::size_t rows = 0UL;
+        std::size_t columns = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> rows >> columns >> nonzeros;
+
+        std::size_t outer = SO == blaze::columnMajor ? columns : rows;
+
+        std::vector<std::size_t> counts(outer);
+        std::vector<std::size_t> indices(nonzeros);
+        std::vector<T> values(nonzeros);
+        archive >> hpx::serialization::make_array(counts.data(), outer) >>
+            hpx::serialization::make_array(indices.data(), nonzeros) >>
+            hpx::serialization::make_array(values.data(), nonzeros);
+
+        target.resize(rows, columns, false);
+        target.reset();
+        target.reserve(nonzeros);
+
+        std::size_t k = 0;
+        for (std::size_t i = 0; i != outer; ++i)
+        {
+            for (std::size_t n = 0; n != counts[i]; ++n, ++k)
+            {
+                if (SO == blaze::columnMajor)
+                {
+                    target.append(indices[k], i, values[k]);
+                }
+                else
+                {
+                    target.append(i, indices[k], values[k]);
+                }
+            }
+            target.finalize(i);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool TF>
     void save(output_archive& archive,
@@ -281,6 +349,62 @@ namespace hpx { namespace serialization
             target.data(), quats * pages * rows * spacing);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool TF>
+    void save(output_archive& archive,
+        blaze::CompressedVector<T, TF> const& target, unsigned)
+    {
+        // Serialize sparse vector
+        std::size_t size = target.size();
+        std::size_t nonzeros = target.nonZeros();
+        archive << size << nonzeros;
+
+        std::vector<std::size_t> indices;
+        std::vector<T> values;
+        indices.reserve(nonzeros);
+        values.reserve(nonzeros);
+        for (auto it = target.begin(); it != target.end(); ++it)
+        {
+            indices.push_back(it->index());
+            values.push_back(it->value());
+        }
+
+        archive << hpx::serialization::make_array(indices.data(), nonzeros)
+                << hpx::serialization::make_array(values.data(), nonzeros);
+    }
+
+    template <typename T, bool SO>
+    void save(output_archive& archive,
+        blaze::CompressedMatrix<T, SO> const& target, unsigned)
+    {
+        // Serialize sparse matrix
+        std::size_t rows = target.rows();
+        std::size_t columns = target.columns();
+        std::size_t nonzeros = target.nonZeros();
+        archive << rows << columns << nonzeros;
+
+        std::size_t outer = SO == blaze::columnMajor ? columns : rows;
+
+        std::vector<std::size_t> counts(outer);
+        std::vector<std::size_t> indices;
+        std::vector<T> values;
+        indices.reserve(nonzeros);
+        values.reserve(nonzeros);
+        for (std::size_t i = 0; i != outer; ++i)
+        {
+            counts[i] = target.nonZeros(i);
+            for (auto it = target.begin(i); it != target.end(i); ++it)
+            {
+                indices.push_back(it->index());
+                values.push_back(it->value());
+            }
+        }
+
+        archive << hpx::serialization::make_array(counts.data(), outer)
+                << hpx::serialization::make_array(indices.data(), nonzeros)
+                << hpx::serialization::make_array(values.data(), nonzeros);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
         (template <typename T, bool TF>), (blaze::DynamicVector<T, TF>));
@@ -313,6 +437,12 @@ namespace hpx { namespace serialization
         (template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF,
             typename RT>),
         (blaze::CustomArray<4UL, T, AF, PF, RT>) );
+
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool TF>), (blaze::CompressedVector<T, TF>));
+
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool SO>), (blaze::CompressedMatrix<T, SO>));
 }}
 
 #endif
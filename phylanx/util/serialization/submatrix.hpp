@@ -0,0 +1,222 @@
+//  Copyright (c) 2021 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_SERIALIZATION_SUBMATRIX_HPP)
+#define PHYLANX_UTIL_SERIALIZATION_SUBMATRIX_HPP
+
+#include <phylanx/config.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Transfers (a submatrix of) a dense row-major matrix without copying the
+    // elements before they are serialized and without sending the padding at
+    // the end of the rows. Each (sufficiently large) contiguous block of
+    // elements is handed to the archive as a separate array, which allows
+    // HPX to send it as a zero-copy chunk.
+    //
+    // On the sending side the object either owns a matrix or refers to the
+    // elements of an existing matrix, those have to stay valid and unchanged
+    // until the object has been serialized. Results of actions have to own
+    // their elements as they are serialized after the action has returned.
+    // On the receiving side the elements are stored in a newly allocated
+    // matrix or, for objects created using destination(), directly in the
+    // given (preallocated) matrix.
+    template <typename T>
+    class submatrix_transfer
+    {
+    public:
+        using data_type = blaze::DynamicMatrix<T>;
+
+        submatrix_transfer() = default;
+
+        // take ownership of the given matrix
+        explicit submatrix_transfer(data_type&& m)
+          : rows_(m.rows())
+          , columns_(m.columns())
+          , owns_data_(true)
+          , received_(std::move(m))
+        {
+        }
+
+        // refer to all elements of the given matrix
+        template <typename Matrix>
+        explicit submatrix_transfer(Matrix const& m)
+          : submatrix_transfer(m, 0, 0, m.rows(), m.columns())
+        {
+        }
+
+        // refer to the given part of the matrix
+        template <typename Matrix>
+        submatrix_transfer(Matrix const& m, std::size_t row,
+                std::size_t column, std::size_t rows, std::size_t columns)
+          : data_(const_cast<T*>(m.data()) + row * m.spacing() + column)
+          , rows_(rows)
+          , columns_(columns)
+          , spacing_(m.spacing())
+        {
+            HPX_ASSERT(
+                row + rows <= m.rows() && column + columns <= m.columns());
+        }
+
+        // receive the transferred elements directly into the given matrix,
+        // it is not resized and has to have the dimensions of the
+        // transferred matrix
+        template <typename Matrix>
+        static submatrix_transfer destination(Matrix& m)
+        {
+            submatrix_transfer result(m);
+            result.is_destination_ = true;
+            return result;
+        }
+
+        std::size_t rows() const
+        {
+            return rows_;
+        }
+        std::size_t columns() const
+        {
+            return columns_;
+        }
+
+        // number of bytes occupied by the transferred elements
+        std::size_t size_in_bytes() const
+        {
+            return rows_ * columns_ * sizeof(T);
+        }
+
+        // extract the received (or owned) elements, copies the elements if
+        // this object refers to an existing matrix
+        data_type get() &&
+        {
+            if (owns_data_)
+            {
+                return std::move(received_);
+            }
+
+            using view_type =
+                blaze::CustomMatrix<T const, blaze::unaligned, blaze::unpadded>;
+            return data_type{view_type(data(), rows_, columns_, spacing())};
+        }
+
+    private:
+        T* data()
+        {
+            return owns_data_ ? received_.data() : data_;
+        }
+        T const* data() const
+        {
+            return owns_data_ ? received_.data() : data_;
+        }
+        std::size_t spacing() const
+        {
+            return owns_data_ ? received_.spacing() : spacing_;
+        }
+
+        friend class hpx::serialization::access;
+
+        void serialize(hpx::serialization::output_archive& ar, unsigned)
+        {
+            // the elements can be sent as a single block only if there is
+            // no padding in between the rows
+            bool contiguous = rows_ <= 1 || spacing() == columns_;
+            ar << rows_ << columns_ << contiguous;
+
+            T const* p = data();
+            if (contiguous)
+            {
+                ar << hpx::serialization::make_array(p, rows_ * columns_);
+                return;
+            }
+
+            std::size_t const spacing = this->spacing();
+            for (std::size_t i = 0; i != rows_; ++i, p += spacing)
+            {
+                ar << hpx::serialization::make_array(p, columns_);
+            }
+        }
+
+        void serialize(hpx::serialization::input_archive& ar, unsigned)
+        {
+            std::size_t rows = 0;
+            std::size_t columns = 0;
+            bool contiguous = false;
+            ar >> rows >> columns >> contiguous;
+
+            if (is_destination_)
+            {
+                if (rows != rows_ || columns != columns_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::util::submatrix_transfer::serialize",
+                        "the dimensions of the destination matrix do not "
+                        "match the dimensions of the received matrix");
+                }
+            }
+            else
+            {
+                received_.resize(rows, columns, false);
+                owns_data_ = true;
+                data_ = nullptr;
+                rows_ = rows;
+                columns_ = columns;
+                spacing_ = 0;
+            }
+
+            T* p = data();
+            std::size_t const spacing = this->spacing();
+
+            if (!contiguous)
+            {
+                for (std::size_t i = 0; i != rows; ++i, p += spacing)
+                {
+                    ar >> hpx::serialization::make_array(p, columns);
+                }
+            }
+            else if (rows <= 1 || spacing == columns)
+            {
+                ar >> hpx::serialization::make_array(p, rows * columns);
+            }
+            else
+            {
+                // the block of elements has to be received as a whole, the
+                // rows of the destination are padded
+                std::vector<T> buffer(rows * columns);
+                ar >> hpx::serialization::make_array(
+                    buffer.data(), buffer.size());
+
+                auto it = buffer.begin();
+                for (std::size_t i = 0; i != rows; ++i, p += spacing)
+                {
+                    std::copy(it, it + columns, p);
+                    it += columns;
+                }
+            }
+        }
+
+        T* data_ = nullptr;         // referenced elements (if not owned)
+        std::size_t rows_ = 0;
+        std::size_t columns_ = 0;
+        std::size_t spacing_ = 0;
+        bool is_destination_ = false;
+
+        bool owns_data_ = false;
+        data_type received_;        // owned or received elements
+    };
+}}
+
+#endif
@@ -403,6 +403,9 @@ class PhySL:
                 physl_db.insert(
                     self.wrapped_function.__name__, self.__src__, self.__ast__)
 
+            self.compilation_cache = physl_db.compilation_cache(
+                self.wrapped_function.__name__)
+
             physl_db.close()
 
         except Exception as e:
@@ -459,10 +462,17 @@ class PhySL:
         # transduce the python code, generate AST
         self._compile_or_load()
 
-        # compile this function
-        phylanx.execution_tree.compile(
-            PhySL.compiler_state, self.file_name,
-            self.wrapped_function.__name__, self.__ast__)
+        # compile this function, reuse the results of earlier compilations
+        # if possible
+        if self.compilation_cache is not None:
+            phylanx.execution_tree.compile_cached(
+                PhySL.compiler_state, self.file_name,
+                self.wrapped_function.__name__, self.__src__,
+                self.compilation_cache)
+        else:
+            phylanx.execution_tree.compile(
+                PhySL.compiler_state, self.file_name,
+                self.wrapped_function.__name__, self.__ast__)
 
         self.is_compiled = True
 
@@ -476,6 +486,7 @@ class PhySL:
         self.file_name = None
         self.__src__ = None
         self.__ast__ = None
+        self.compilation_cache = None
         self.ir = None
         self.python_tree = tree
         if 'doc_src' in kwargs and kwargs['doc_src']:
@@ -608,6 +619,17 @@ class PhySL:
 
         return result
 
+    def call_async(self, *args, **kwargs):
+        """Start invoking this Phylanx function, return a future representing
+           the result"""
+
+        self._ensure_global_state()
+        self._ensure_is_compiled()
+
+        return phylanx.execution_tree.eval_async(
+            PhySL.compiler_state, self.file_name,
+            self.wrapped_function.__name__, *args, **kwargs)
+
     def tree(self):
         """Return the tree data for this object"""
 
@@ -152,3 +152,11 @@ class db:
             return (None, None)
 
         return rows[0][0], pickle.loads(rows[0][1])
+
+    def compilation_cache(self, funcname):
+        """return the name of the file holding the compilation cache for the
+           given physl function"""
+
+        head, tail = os.path.split(self.dbname)
+        filename, _ = os.path.splitext(tail)
+        return '%s/%s.%s.cache' % (head, filename, funcname)
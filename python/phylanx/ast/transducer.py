@@ -6,6 +6,7 @@
 # file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 import re
+import concurrent.futures
 import ast
 import inspect
 import types
@@ -194,6 +195,25 @@ def Phylanx(__phylanx_arg=None, **kwargs):
 
             return result
 
+        def submit(self, *args, **kwargs):
+            """Start invoking this decorator using the given arguments, return
+               a future representing the result"""
+
+            # just invoke original function if decorator should be disabled
+            if self.disable_decorator:
+                result = concurrent.futures.Future()
+                result.set_result(self.decorated_function(*args, **kwargs))
+                return result
+
+            if self.backend == 'OpenSCoP':
+                raise NotImplementedError(
+                    "OpenSCoP kernels are not yet callable.")
+
+            mapped_args = tuple(map(self.map_decorated, args))
+            kwitems = kwargs.items()
+            mapped_kwargs = {k: self.map_decorated(v) for k, v in kwitems}
+            return self.backend.call_async(*mapped_args, **mapped_kwargs)
+
         def generate_ast(self):
             return generate_phylanx_ast(self.__src__)
 
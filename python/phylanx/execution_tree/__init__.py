@@ -3,6 +3,8 @@
 # Distributed under the Boost Software License, Version 1.0. (See accompanying
 # file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+import asyncio
+import concurrent.futures
 import inspect
 try:
     from phylanx._phylanx.execution_tree import *
@@ -63,3 +65,35 @@ class variable(variable_impl):
                 return
 
         super(variable, self).__init__(global_compiler_state(), *args, **kwargs)
+
+    def submit(self, *args):
+        """start evaluating the variable, return a primitive_argument_future
+           representing the result"""
+
+        return self.eval_async(*args)
+
+
+# expose futures to Python's concurrent.futures and asyncio
+def _as_concurrent_future(self):
+    """return a concurrent.futures.Future that becomes ready together with
+       this future"""
+
+    result = concurrent.futures.Future()
+    result.set_running_or_notify_cancel()
+
+    def transfer(f):
+        try:
+            result.set_result(f.result())
+        except Exception as e:
+            result.set_exception(e)
+
+    self.add_done_callback(transfer)
+    return result
+
+
+def _await(self):
+    return asyncio.wrap_future(self.as_concurrent_future()).__await__()
+
+
+primitive_argument_future.as_concurrent_future = _as_concurrent_future
+primitive_argument_future.__await__ = _await
@@ -7,6 +7,7 @@
 
 #include <phylanx/phylanx.hpp>
 
+#include <hpx/include/lcos.hpp>
 #include <hpx/iostream.hpp>
 
 #include <bindings/binding_helpers.hpp>
@@ -21,6 +22,7 @@
 #include <iterator>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -95,6 +97,39 @@ namespace phylanx { namespace bindings
             });
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::string expression_compiler_cached(compiler_state& state,
+        std::string const& file_name, std::string const& func_name,
+        std::string const& xexpr_str, std::string const& cache_file)
+    {
+        pybind11::gil_scoped_release release;       // release GIL
+
+        return hpx::threads::run_as_hpx_thread(
+            [&]() -> std::string
+            {
+                auto const& code = phylanx::execution_tree::compile_cached(
+                    file_name, func_name, xexpr_str, cache_file,
+                    state.eval_snippets, state.eval_env);
+
+                auto const& funcs = code.functions();
+
+                if (state.enable_measurements)
+                {
+                    if (!funcs.empty())
+                    {
+                        state.primitive_instances.push_back(
+                            phylanx::util::enable_measurements(
+                                funcs.front().name_));
+                    }
+                }
+
+                // add all definitions to the global execution environment
+                code.run(state.eval_ctx);
+
+                return !funcs.empty() ? funcs.front().name_ : "";
+            });
+    }
+
     pybind11::object expression_evaluator(
         compiler_state& state, std::string const& file_name,
         std::string const& xexpr_str, pybind11::args args,
@@ -173,6 +208,87 @@ namespace phylanx { namespace bindings
             });
     }
 
+    hpx::shared_future<phylanx::execution_tree::primitive_argument_type>
+    expression_evaluator_async(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args, pybind11::kwargs kwargs)
+    {
+        pybind11::gil_scoped_release release;       // release GIL
+
+        using phylanx::execution_tree::primitive_argument_type;
+        using result_type = hpx::shared_future<primitive_argument_type>;
+
+        return hpx::threads::run_as_hpx_thread(
+            [&]() -> result_type
+            {
+                auto const& code_x =
+                    phylanx::execution_tree::compile(file_name, xexpr_str,
+                        xexpr_str, state.eval_snippets, state.eval_env);
+
+                if (state.enable_measurements)
+                {
+                    auto const& funcs = code_x.functions();
+                    if (!funcs.empty())
+                    {
+                        state.primitive_instances.push_back(
+                            phylanx::util::enable_measurements(
+                                funcs.front().name_));
+                    }
+                }
+
+                auto x = code_x.run(state.eval_ctx);
+
+                phylanx::execution_tree::primitive_arguments_type fargs;
+                fargs.reserve(args.size());
+
+                std::map<std::string, primitive_argument_type> fkwargs;
+
+                {
+                    pybind11::gil_scoped_acquire acquire;
+                    for (auto const& item : args)
+                    {
+                        fargs.emplace_back(
+                            item.cast<primitive_argument_type>());
+                    }
+
+                    if (kwargs)
+                    {
+                        fkwargs = kwargs.cast<
+                            std::map<std::string, primitive_argument_type>>();
+                    }
+                }
+
+                // Arguments converted from numpy arrays refer to the memory
+                // of the Python objects, which the caller is free to modify
+                // (or release) while the evaluation is still running.
+                for (auto& arg : fargs)
+                {
+                    arg = phylanx::execution_tree::extract_copy_value(
+                        arg, x.name_, file_name);
+                }
+                for (auto& kwarg : fkwargs)
+                {
+                    kwarg.second = phylanx::execution_tree::extract_copy_value(
+                        kwarg.second, x.name_, file_name);
+                }
+
+                return hpx::async(
+                    [x = std::move(x), fargs = std::move(fargs),
+                        fkwargs = std::move(fkwargs),
+                        ctx = state.eval_ctx]() mutable
+                    -> primitive_argument_type
+                    {
+                        // potentially handle keyword arguments
+                        if (fkwargs.empty())
+                        {
+                            return x(std::move(fargs), std::move(ctx));
+                        }
+                        return x(std::move(fargs), std::move(fkwargs),
+                            std::move(ctx));
+                    }).share();
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state, std::string const& file_name,
@@ -372,6 +488,14 @@ namespace phylanx { namespace bindings
             // measurements have been enabled
             c.enable_measurements = true;
 
+            // attribute the node_data copies, moves, and reuses to the
+            // primitives (copied_bytes, moved_bytes, reused_bytes)
+            if (!c.enable_counts)
+            {
+                c.enable_counts = std::make_unique<
+                    phylanx::ir::reset_enable_counts_on_exit>(true);
+            }
+
             c.primitive_instances =
                 phylanx::util::enable_measurements(c.primitive_instances);
 
@@ -403,7 +527,9 @@ namespace phylanx { namespace bindings
                 std::ostringstream os;
 
                 // CSV Header
-                os << "primitive_instance,display_name,count,time,eval_direct\n";
+                os << "primitive_instance,display_name,count,time,"
+                      "eval_direct,transferred_bytes,copied_bytes,"
+                      "moved_bytes,reused_bytes\n";
 
                 // Print performance data
                 for (auto const& entry :
@@ -648,6 +774,9 @@ namespace phylanx { namespace bindings
                 case primitive_argument_type::float64_index:
                     return pybind11::dtype("float64");
 
+                case primitive_argument_type::float32_index:
+                    return pybind11::dtype("float32");
+
                 case primitive_argument_type::primitive_index:
                     return pybind11::dtype("O");
 
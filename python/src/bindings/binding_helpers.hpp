@@ -13,11 +13,13 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <hpx/futures/future.hpp>
 #include <hpx/include/run_as.hpp>
 
 #include <cstdint>
 #include <exception>
 #include <list>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -52,6 +54,11 @@ namespace phylanx { namespace bindings
         bool enable_measurements;
         std::vector<std::string> primitive_instances;
 
+        // node_data copies, moves, and reuses are counted while measurements
+        // are enabled, the previous setting is restored on destruction
+        std::unique_ptr<phylanx::ir::reset_enable_counts_on_exit>
+            enable_counts;
+
         static pybind11::object import_phylanx()
         {
 #if defined(PHYLANX_DEBUG)
@@ -85,10 +92,24 @@ namespace phylanx { namespace bindings
           , name_(std::move(name))
           , codename_(std::move(codename))
           , enable_measurements(false)
+          , enable_counts()
         {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // run the given function on an HPX thread, this may be invoked from HPX
+    // threads as well (e.g. from inside a continuation)
+    template <typename F>
+    auto run_on_hpx_thread(F&& f) -> decltype(f())
+    {
+        if (hpx::threads::get_self_ptr() == nullptr)
+        {
+            return hpx::threads::run_as_hpx_thread(std::forward<F>(f));
+        }
+        return f();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // support for the traverse API
     struct traverse_helper
@@ -212,12 +233,24 @@ namespace phylanx { namespace bindings
         std::string const& file_name, std::string const& func_name,
         std::vector<phylanx::ast::expression> const& xexpr);
 
+    // compile expression, cache the compilation results in the given file
+    std::string expression_compiler_cached(compiler_state& state,
+        std::string const& file_name, std::string const& func_name,
+        std::string const& xexpr_str, std::string const& cache_file);
+
     // evaluate compiled expression
     pybind11::object expression_evaluator(
         compiler_state& state, std::string const& file_name,
         std::string const& xexpr_str, pybind11::args args,
         pybind11::kwargs kwargs);
 
+    // evaluate compiled expression asynchronously, the returned future
+    // becomes ready once the evaluation has finished
+    hpx::shared_future<phylanx::execution_tree::primitive_argument_type>
+    expression_evaluator_async(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args, pybind11::kwargs kwargs);
+
     // extract pre-compiled code for given function name
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state,
@@ -15,9 +15,12 @@
 #include <pybind11/stl.h>
 
 #include <hpx/errors/exception.hpp>
+#include <hpx/include/lcos.hpp>
 #include <hpx/include/run_as.hpp>
 
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <utility>
@@ -40,6 +43,11 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
     execution_tree.def("compile", phylanx::bindings::expression_compiler_ast,
         "compile a PhySL expression from a compiled AST");
 
+    execution_tree.def("compile_cached",
+        phylanx::bindings::expression_compiler_cached,
+        "compile a PhySL expression, reuse the compilation results stored in "
+        "the given cache file if possible");
+
     execution_tree.def("eval", phylanx::bindings::expression_evaluator,
         "compile and evaluate a numerical expression in PhySL");
 
@@ -54,6 +62,20 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
         },
         "compile and evaluate a numerical expression in PhySL");
 
+    execution_tree.def("eval_async",
+        phylanx::bindings::expression_evaluator_async,
+        "compile and asynchronously evaluate a numerical expression in PhySL");
+
+    execution_tree.def(
+        "eval_async",
+        [](phylanx::bindings::compiler_state& state, std::string const& xexpr,
+            pybind11::args args, pybind11::kwargs kwargs)
+        {
+            return phylanx::bindings::expression_evaluator_async(
+                state, state.codename_, xexpr, args, kwargs);
+        },
+        "compile and asynchronously evaluate a numerical expression in PhySL");
+
     // expose functionalities needed for accessing performance data
     execution_tree.def("enable_measurements",
         phylanx::bindings::enable_measurements,
@@ -142,6 +164,16 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
                             [&]() { return var.eval(std::move(args)); });
                 },
                 "evaluate execution tree")
+            .def(
+                "eval_async",
+                [](phylanx::execution_tree::variable const& var,
+                    pybind11::args args)
+                {
+                    pybind11::gil_scoped_release release;       // release GIL
+                    return hpx::threads::run_as_hpx_thread(
+                        [&]() { return var.eval_async(std::move(args)); });
+                },
+                "asynchronously evaluate execution tree")
             .def(
                 "__call__",
                 [](phylanx::execution_tree::variable const& var,
@@ -268,21 +300,109 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
             &phylanx::bindings::repr<phylanx::execution_tree::primitive>);
 
     // phylanx.execution_tree.primitive_argument_future
-    pybind11::class_<
-        hpx::shared_future<phylanx::execution_tree::primitive_argument_type>>(
-        execution_tree, "primitive_argument_future",
+    //
+    // The interface mirrors concurrent.futures.Future: the result is
+    // converted into a Python object only once it is requested.
+    using future_type =
+        hpx::shared_future<phylanx::execution_tree::primitive_argument_type>;
+
+    pybind11::class_<future_type>(execution_tree, "primitive_argument_future",
         "future type representing a value")
         .def(
             "get",
-            [](hpx::shared_future<
-                phylanx::execution_tree::primitive_argument_type> const& f)
+            [](future_type const& f)
             {
                 pybind11::gil_scoped_release release;    // release GIL
-                return hpx::threads::run_as_hpx_thread(
+                return phylanx::bindings::run_on_hpx_thread(
+                    [&]() -> phylanx::execution_tree::primitive_argument_type
+                    {
+                        return f.get();
+                    });
+            },
+            "wait for future to become ready")
+        .def(
+            "result",
+            [](future_type const& f, pybind11::object timeout)
+            {
+                if (!timeout.is_none())
+                {
+                    std::chrono::duration<double> const rel_time(
+                        timeout.cast<double>());
+
+                    bool is_ready = false;
+                    {
+                        pybind11::gil_scoped_release release;    // release GIL
+                        is_ready = phylanx::bindings::run_on_hpx_thread(
+                            [&]() -> bool
+                            {
+                                return f.wait_for(rel_time) !=
+                                    hpx::lcos::future_status::timeout;
+                            });
+                    }
+
+                    if (!is_ready)
+                    {
+                        auto timeout_error =
+                            pybind11::module::import("concurrent.futures")
+                                .attr("TimeoutError");
+                        PyErr_SetString(timeout_error.ptr(),
+                            "the evaluation did not finish in time");
+                        throw pybind11::error_already_set();
+                    }
+                }
+
+                pybind11::gil_scoped_release release;    // release GIL
+                return phylanx::bindings::run_on_hpx_thread(
                     [&]() -> phylanx::execution_tree::primitive_argument_type
                     {
                         return f.get();
                     });
             },
-            "wait for future to become ready");
+            pybind11::arg("timeout") = pybind11::none(),
+            "wait at most timeout seconds for the future to become ready "
+            "and return its value")
+        .def(
+            "done",
+            [](future_type const& f)
+            {
+                return f.is_ready();
+            },
+            "return whether the future has become ready")
+        .def(
+            "add_done_callback",
+            [](future_type const& f, pybind11::object fn)
+            {
+                // the callable has to be released while holding the GIL
+                std::shared_ptr<pybind11::object> callback(
+                    new pybind11::object(std::move(fn)),
+                    [](pybind11::object* p)
+                    {
+                        pybind11::gil_scoped_acquire acquire;
+                        delete p;
+                    });
+
+                pybind11::gil_scoped_release release;    // release GIL
+                phylanx::bindings::run_on_hpx_thread(
+                    [&]()
+                    {
+                        f.then(
+                            [callback](future_type f)
+                            {
+                                pybind11::gil_scoped_acquire acquire;
+                                try
+                                {
+                                    (*callback)(std::move(f));
+                                }
+                                catch (pybind11::error_already_set& e)
+                                {
+                                    // similar to concurrent.futures, report
+                                    // and otherwise ignore exceptions
+                                    e.restore();
+                                    PyErr_WriteUnraisable(callback->ptr());
+                                }
+                            });
+                    });
+            },
+            "attach a callable that is invoked with the future as its only "
+            "argument once the future has become ready");
 }
@@ -439,16 +439,6 @@ namespace pybind11 { namespace detail
         }
     };
 
-    template <>
-    struct is_array_instance<double>
-    {
-        static bool call(handle src)
-        {
-            return isinstance<array_t<double>>(src) ||
-                   isinstance<array_t<float>>(src);
-        }
-    };
-
     template <>
     struct is_array_instance<std::int64_t>
     {
@@ -731,6 +721,19 @@ namespace pybind11 { namespace detail
                 return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
                     src->quatern_copy()));
 
+            // sparse types are converted to dense arrays
+            // blaze::CompressedVector<T>
+            case phylanx::ir::node_data<T>::sparse_storage1d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage1d:
+                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                    src->vector_copy()));
+
+            // blaze::CompressedMatrix<T>
+            case phylanx::ir::node_data<T>::sparse_storage2d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage2d:
+                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                    src->matrix_copy()));
+
             default:
                 throw cast_error("cast_impl_automatic: "
                     "unexpected node_data type: should not happen!");
@@ -786,6 +789,19 @@ namespace pybind11 { namespace detail
                 return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
                     src->quatern_copy()));
 
+            // sparse types are converted to dense arrays
+            // blaze::CompressedVector<T>
+            case phylanx::ir::node_data<T>::sparse_storage1d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage1d:
+                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                    src->vector_copy()));
+
+            // blaze::CompressedMatrix<T>
+            case phylanx::ir::node_data<T>::sparse_storage2d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage2d:
+                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                    src->matrix_copy()));
+
             default:
                 throw cast_error("cast_impl_move: "
                     "unexpected node_data type: should not happen!");
@@ -836,6 +852,19 @@ namespace pybind11 { namespace detail
                 return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
                     src->quatern_copy()));
 
+            // sparse types are converted to dense arrays
+            // blaze::CompressedVector<T>
+            case phylanx::ir::node_data<T>::sparse_storage1d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage1d:
+                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                    src->vector_copy()));
+
+            // blaze::CompressedMatrix<T>
+            case phylanx::ir::node_data<T>::sparse_storage2d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage2d:
+                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                    src->matrix_copy()));
+
             default:
                 throw cast_error("cast_impl_copy: "
                     "unexpected node_data type: should not happen!");
@@ -887,6 +916,19 @@ namespace pybind11 { namespace detail
                 return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
                     src->quatern_copy()));
 
+            // sparse types are converted to dense arrays
+            // blaze::CompressedVector<T>
+            case phylanx::ir::node_data<T>::sparse_storage1d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage1d:
+                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                    src->vector_copy()));
+
+            // blaze::CompressedMatrix<T>
+            case phylanx::ir::node_data<T>::sparse_storage2d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage2d:
+                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                    src->matrix_copy()));
+
             default:
                 throw cast_error("cast_impl_automatic_reference: "
                     "unexpected node_data type: should not happen!");
@@ -897,6 +939,8 @@ namespace pybind11 { namespace detail
         template <typename Type>
         static handle cast_impl_reference_internal(Type* src, handle parent)
         {
+            using T_ = typename casted_type<T>::type;
+
             switch (src->index())
             {
             // blaze::DynamicVector<T>
@@ -915,6 +959,20 @@ namespace pybind11 { namespace detail
             case phylanx::ir::node_data<T>::storage4d:
                 return blaze_ref_array(src->quatern_non_ref(), parent);
 
+            // sparse types are converted to dense arrays, those can't
+            // reference the internal data
+            // blaze::CompressedVector<T>
+            case phylanx::ir::node_data<T>::sparse_storage1d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage1d:
+                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                    src->vector_copy()));
+
+            // blaze::CompressedMatrix<T>
+            case phylanx::ir::node_data<T>::sparse_storage2d:
+            case phylanx::ir::node_data<T>::custom_sparse_storage2d:
+                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                    src->matrix_copy()));
+
             // blaze::CustomVector<T>, blaze::CustomMatrix<T>,
             // blaze::CustomTensor<T>, blaze::CustomArray<4, T>
             case phylanx::ir::node_data<T>::custom_storage1d: HPX_FALLTHROUGH;
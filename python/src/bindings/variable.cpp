@@ -368,6 +368,35 @@ namespace phylanx { namespace execution_tree
                 pybind11::handle()));
     }
 
+    // Note: the dtype of the variable is not applied to the result of an
+    //       asynchronous evaluation.
+    hpx::shared_future<primitive_argument_type> variable::eval_async(
+        pybind11::args args) const
+    {
+        static std::string varname("variable::eval_async");
+
+        phylanx::execution_tree::primitive_arguments_type fargs;
+        fargs.reserve(args.size());
+
+        {
+            pybind11::gil_scoped_acquire acquire;
+            for (auto const& item : args)
+            {
+                fargs.emplace_back(item.cast<primitive_argument_type>());
+            }
+        }
+
+        // the evaluation may outlive the Python objects the arguments refer
+        // to, thus it has to operate on copies of those
+        for (auto& arg : fargs)
+        {
+            arg = extract_copy_value(arg, varname, state().codename_);
+        }
+
+        return value_operand(primitive_argument_type{value_}, std::move(fargs),
+            varname, state().codename_).share();
+    }
+
     ////////////////////////////////////////////////////////////////////////////
 #define PHYLANX_VARIABLE_OPERATION(op, name)                                   \
     /* forward operation */                                                    \
@@ -79,6 +79,8 @@ namespace phylanx { namespace execution_tree
         }
 
         pybind11::object eval(pybind11::args args) const;
+        hpx::shared_future<primitive_argument_type> eval_async(
+            pybind11::args args) const;
 
         pybind11::dtype dtype() const;
         void dtype(pybind11::object dt);
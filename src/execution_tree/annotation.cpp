@@ -160,6 +160,8 @@ namespace phylanx { namespace execution_tree {
                 data_.args().emplace_back(ir::range(key, std::move(data)));
             }
         }
+
+        invalidate_localities_information();
     }
 
     void annotation::add_annotation(
@@ -191,6 +193,8 @@ namespace phylanx { namespace execution_tree {
         {
             data_.args().emplace_back(std::move(data.get_range()));
         }
+
+        invalidate_localities_information();
     }
 
     bool operator==(annotation const& lhs, annotation const& rhs)
@@ -351,6 +355,7 @@ namespace phylanx { namespace execution_tree {
         }
 
         data_ = std::move(newdata);
+        invalidate_localities_information();
     }
 
     void annotation::replace_annotation(
@@ -390,6 +395,7 @@ namespace phylanx { namespace execution_tree {
     void annotation::serialize(hpx::serialization::input_archive& ar, unsigned)
     {
         ar >> data_;
+        invalidate_localities_information();
     }
 
     ////////////////////////////////////////////////////////////////////////////
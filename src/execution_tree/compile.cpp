@@ -7,9 +7,11 @@
 #include <phylanx/ast/generate_ast.hpp>
 #include <phylanx/ast/node.hpp>
 #include <phylanx/execution_tree/compile.hpp>
+#include <phylanx/execution_tree/compiler/compilation_cache.hpp>
 #include <phylanx/execution_tree/compiler/compiler.hpp>
 #include <phylanx/execution_tree/compiler_component.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/util/serialization/ast.hpp>
 
 #include <hpx/modules/format.hpp>
 #include <hpx/include/naming.hpp>
@@ -210,6 +212,85 @@ namespace phylanx { namespace execution_tree
             ast::generate_ast(expr), snippets, default_locality);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        compiler::entry_point const& compile_cached(std::string const& name,
+            std::string const& func_name, compiler::compilation_cache& cache,
+            bool is_cached, std::string const& cache_file,
+            compiler::function_list& snippets, compiler::environment& env,
+            compiler::expression_pattern_list const& patterns,
+            hpx::id_type const& default_locality)
+        {
+            // make the cache available to all (nested) compilations
+            compiler::compilation_cache* old_cache = snippets.cache_;
+            snippets.cache_ = &cache;
+
+            try
+            {
+                auto const& result = execution_tree::compile(name,
+                    func_name, cache.ast(), snippets, env, patterns,
+                    default_locality);
+                snippets.cache_ = old_cache;
+
+                if (!is_cached)
+                {
+                    cache.save(cache_file);
+                }
+                return result;
+            }
+            catch (...)
+            {
+                snippets.cache_ = old_cache;
+                throw;
+            }
+        }
+    }
+
+    compiler::entry_point const& compile_cached(std::string const& name,
+        std::string const& func_name, std::string const& expr,
+        std::string const& cache_file, compiler::function_list& snippets,
+        compiler::environment& env, hpx::id_type const& default_locality)
+    {
+        compiler::expression_pattern_list const& patterns =
+            compiler::generate_patterns();
+
+        compiler::compilation_cache cache(expr, patterns);
+
+        bool const is_cached = cache.load(cache_file);
+        if (!is_cached)
+        {
+            cache.ast(ast::generate_ast(expr));
+        }
+
+        return detail::compile_cached(name, func_name, cache, is_cached,
+            cache_file, snippets, env, patterns, default_locality);
+    }
+
+    compiler::entry_point const& compile_cached(std::string const& name,
+        std::string const& func_name,
+        std::vector<ast::expression> const& exprs,
+        std::string const& cache_file, compiler::function_list& snippets,
+        compiler::environment& env, hpx::id_type const& default_locality)
+    {
+        compiler::expression_pattern_list const& patterns =
+            compiler::generate_patterns();
+
+        // the serialized AST identifies the code
+        std::vector<char> const data = util::serialize(exprs);
+        compiler::compilation_cache cache(
+            std::string(data.begin(), data.end()), patterns);
+
+        bool const is_cached = cache.load(cache_file);
+        if (!is_cached)
+        {
+            cache.ast(exprs);
+        }
+
+        return detail::compile_cached(name, func_name, cache, is_cached,
+            cache_file, snippets, env, patterns, default_locality);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// Add the given variable to the compilation environment
     compiler::function define_variable(std::string const& codename,
@@ -0,0 +1,264 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/detail/tagged_id.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/execution_tree/compiler/compilation_cache.hpp>
+#include <phylanx/execution_tree/compiler/compiler.hpp>
+#include <phylanx/util/serialization/ast.hpp>
+
+#include <hpx/include/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // The hash values are stored on disk, thus they have to be stable
+        // across different runs (which is not guaranteed for std::hash),
+        // use 64bit FNV-1a.
+        constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ull;
+        constexpr std::uint64_t fnv_prime = 1099511628211ull;
+
+        static std::uint64_t hash_string(
+            std::string const& str, std::uint64_t hash = fnv_offset_basis)
+        {
+            for (char c : str)
+            {
+                hash ^= static_cast<std::uint8_t>(c);
+                hash *= fnv_prime;
+            }
+
+            // separate consecutive strings
+            hash ^= 0xff;
+            hash *= fnv_prime;
+
+            return hash;
+        }
+
+        static std::uint64_t hash_patterns(
+            expression_pattern_list const& patterns)
+        {
+            std::uint64_t hash = fnv_offset_basis;
+            for (auto const& p : patterns)
+            {
+                hash = hash_string(p.first, hash);
+                hash = hash_string(p.second.pattern_, hash);
+            }
+            return hash;
+        }
+
+        char const* const cache_magic = "phylanx-compilation-cache";
+
+        // marks expressions that did not match any of the patterns
+        constexpr std::size_t no_pattern = std::size_t(-1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    compilation_cache::compilation_cache(
+            std::string const& source, expression_pattern_list const& patterns)
+      : source_hash_(detail::hash_string(source))
+      , patterns_hash_(detail::hash_patterns(patterns))
+      , patterns_(patterns)
+    {
+        index_.reserve(patterns.size());
+        for (auto it = patterns.begin(); it != patterns.end(); ++it)
+        {
+            positions_.emplace(&it->second, index_.size());
+            index_.push_back(it);
+        }
+    }
+
+    constexpr std::uint32_t compilation_cache::version;
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool compilation_cache::load(std::string const& filename)
+    {
+        std::ifstream in(filename, std::ios::binary);
+        if (!in.is_open())
+        {
+            return false;
+        }
+
+        std::vector<char> data{std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>()};
+        if (data.empty())
+        {
+            return false;
+        }
+
+        try
+        {
+            hpx::serialization::input_archive archive(data, data.size());
+
+            std::string magic;
+            std::uint32_t file_version = 0;
+            std::uint64_t source_hash = 0;
+            std::uint64_t patterns_hash = 0;
+
+            archive >> magic >> file_version >> source_hash >> patterns_hash;
+            if (magic != detail::cache_magic || file_version != version ||
+                source_hash != source_hash_ || patterns_hash != patterns_hash_)
+            {
+                return false;    // stale cache entry
+            }
+
+            std::vector<char> ast_data;
+            archive >> ast_data;
+
+            std::vector<ast::expression> ast;
+            util::detail::unserialize(ast_data, ast);
+
+            std::size_t count = 0;
+            archive >> count;
+
+            std::map<key_type, std::size_t> selected_patterns;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                std::int64_t line = 0, column = 0;
+                std::string name;
+                std::size_t size = 0;
+                std::size_t pattern = 0;
+
+                archive >> line >> column >> name >> size >> pattern;
+                if (pattern != detail::no_pattern && pattern >= index_.size())
+                {
+                    return false;
+                }
+
+                selected_patterns.emplace(
+                    key_type{line, column, std::move(name), size}, pattern);
+            }
+
+            ast_ = std::move(ast);
+            selected_patterns_ = std::move(selected_patterns);
+        }
+        catch (std::exception const&)
+        {
+            return false;    // corrupted cache entry
+        }
+
+        return true;
+    }
+
+    void compilation_cache::save(std::string const& filename) const
+    {
+        std::vector<char> data;
+        std::size_t archive_size = 0;
+
+        {
+            hpx::serialization::output_archive archive(data);
+
+            archive << std::string(detail::cache_magic) << version
+                    << source_hash_ << patterns_hash_;
+            archive << util::serialize(ast_);
+
+            archive << selected_patterns_.size();
+            for (auto const& entry : selected_patterns_)
+            {
+                archive << std::get<0>(entry.first) << std::get<1>(entry.first)
+                        << std::get<2>(entry.first) << std::get<3>(entry.first)
+                        << entry.second;
+            }
+
+            archive_size = archive.bytes_written();
+        }
+
+        // write to a temporary file first to prevent concurrently running
+        // processes from seeing partially written cache entries, the random
+        // suffix keeps concurrent writers from sharing the temporary file
+        std::random_device rd;
+        std::uint64_t suffix = (std::uint64_t(rd()) << 32) | rd();
+
+        std::ostringstream tmpname_stream;
+        tmpname_stream << filename << '.' << std::hex << suffix << ".tmp";
+        std::string const tmpname = tmpname_stream.str();
+        {
+            std::ofstream out(tmpname, std::ios::binary | std::ios::trunc);
+            if (!out.is_open())
+            {
+                return;    // caching is optional, silently ignore errors
+            }
+            out.write(data.data(), archive_size);
+        }
+
+        if (std::rename(tmpname.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(tmpname.c_str());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool compilation_cache::make_key(ast::expression const& expr,
+        std::string const& name, key_type& key)
+    {
+        ast::tagged id = ast::detail::tagged_id(expr);
+        if (id.col == -1)
+        {
+            return false;    // not a position in the source code
+        }
+
+        key = key_type{id.id, id.col, name, expr.rest.size()};
+        return true;
+    }
+
+    bool compilation_cache::find_pattern(ast::expression const& expr,
+        std::string const& name,
+        expression_pattern_list::const_iterator& it) const
+    {
+        key_type key;
+        if (!make_key(expr, name, key))
+        {
+            return false;
+        }
+
+        auto entry = selected_patterns_.find(key);
+        if (entry == selected_patterns_.end())
+        {
+            return false;
+        }
+
+        it = entry->second == detail::no_pattern ? patterns_.end() :
+                                           index_[entry->second];
+        return true;
+    }
+
+    void compilation_cache::add_pattern(ast::expression const& expr,
+        std::string const& name, expression_pattern_list::const_iterator it)
+    {
+        key_type key;
+        if (!make_key(expr, name, key))
+        {
+            return;
+        }
+
+        if (it == patterns_.end())
+        {
+            selected_patterns_[std::move(key)] = detail::no_pattern;
+            return;
+        }
+
+        auto pos = positions_.find(&it->second);
+        if (pos != positions_.end())
+        {
+            selected_patterns_[std::move(key)] = pos->second;
+        }
+    }
+}}}
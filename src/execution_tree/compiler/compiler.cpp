@@ -18,9 +18,12 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/compile.hpp>
 #include <phylanx/execution_tree/compiler/actors.hpp>
+#include <phylanx/execution_tree/compiler/compilation_cache.hpp>
 #include <phylanx/execution_tree/compiler/compiler.hpp>
+#include <phylanx/execution_tree/compiler/elementwise_fusion.hpp>
 #include <phylanx/execution_tree/compiler/locality_attribute.hpp>
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/compiler/reverse_mode.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/ir/node_data.hpp>
 
@@ -46,6 +49,8 @@
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 namespace phylanx { namespace execution_tree { namespace compiler {
     ///////////////////////////////////////////////////////////////////////
     environment default_environment(
@@ -141,7 +146,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         // parse an __arg(_1, _2) construct
         bool parse_argument_value(expression_pattern_list const& patterns,
             ast::expression const& expr, std::string& argname,
-            std::string& value)
+            ast::expression& value)
         {
             using placeholder_map_type =
                 std::multimap<std::string, ast::expression>;
@@ -177,7 +182,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             }
 
             argname = std::move(names.second);
-            value = to_string(p->second, true);
+            value = std::move(p->second);
 
             return true;
         }
@@ -186,7 +191,8 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         bool extract_arguments(std::string const& name,
             expression_pattern_list const& patterns,
             ast::expression const& expr, std::vector<std::string>& args,
-            std::vector<std::string>& defaults)
+            std::vector<std::string>& defaults,
+            std::vector<ast::expression>& default_values)
         {
             // extract arguments, match primitive invocation
             using placeholder_map_type =
@@ -230,6 +236,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         if (has_default_value)
                         {
                             defaults.emplace_back();
+                            default_values.emplace_back();
                         }
                     }
                 }
@@ -240,7 +247,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         ast::detail::function_name(it->second) == "__arg");
 
                     std::string argname;
-                    std::string default_value;
+                    ast::expression default_value;
 
                     if (!parse_argument_value(
                             patterns, it->second, argname, default_value))
@@ -252,7 +259,8 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     HPX_ASSERT(!has_ellipses);
 
                     args.push_back(std::move(argname));
-                    defaults.push_back(std::move(default_value));
+                    defaults.push_back(to_string(default_value, true));
+                    default_values.push_back(std::move(default_value));
 
                     has_default_value = true;
                 }
@@ -301,6 +309,96 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             return pattern;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Extract the list of arguments of the given expression if it is a
+        // function call, without copying the arguments.
+        struct function_call_arguments
+        {
+            using result_type = std::vector<ast::expression> const*;
+
+            template <typename Ast>
+            result_type operator()(Ast const&) const
+            {
+                return nullptr;
+            }
+
+            template <typename Ast>
+            result_type operator()(
+                phylanx::util::recursive_wrapper<Ast> const& ast) const
+            {
+                return (*this)(ast.get());
+            }
+
+            result_type operator()(ast::primary_expr const& pe) const
+            {
+                return phylanx::util::visit(*this, pe);
+            }
+
+            result_type operator()(ast::operand const& op) const
+            {
+                return phylanx::util::visit(*this, op);
+            }
+
+            result_type operator()(ast::expression const& expr) const
+            {
+                if (!expr.rest.empty())
+                {
+                    return nullptr;
+                }
+                return (*this)(expr.first);
+            }
+
+            result_type operator()(ast::function_call const& fc) const
+            {
+                if (fc.function_name.name.empty())
+                {
+                    return nullptr;
+                }
+                return &fc.args;
+            }
+        };
+
+        // A pattern with n leading arguments matches function calls with n
+        // arguments only. If the pattern has ellipses at position n instead,
+        // it matches function calls with at least n arguments (the ellipses
+        // consume all remaining arguments).
+        void initialize_dispatch_information(expression_pattern& p)
+        {
+            p.is_function_call_ = ast::detail::is_function_call(p.pattern_ast_);
+            p.is_variadic_ = false;
+            p.num_args_ = 0;
+
+            auto const* args = function_call_arguments{}(p.pattern_ast_);
+            if (args == nullptr)
+            {
+                return;
+            }
+
+            for (auto const& arg : *args)
+            {
+                if (ast::detail::is_placeholder_ellipses(arg))
+                {
+                    p.is_variadic_ = true;
+                    break;
+                }
+                ++p.num_args_;
+            }
+        }
+
+        // returns whether any of the given function call arguments would be
+        // treated as ellipses by match_ast
+        bool has_placeholder_ellipses(std::vector<ast::expression> const& args)
+        {
+            for (auto const& arg : args)
+            {
+                if (ast::detail::is_placeholder_ellipses(arg))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void insert_pattern(expression_pattern_list& result,
             std::string pattern, match_pattern_type const& p,
@@ -317,12 +415,13 @@ namespace phylanx { namespace execution_tree { namespace compiler {
 
             std::vector<std::string> args;
             std::vector<std::string> defaults;
+            std::vector<ast::expression> default_values;
 
             if (ast::detail::is_function_call(exprs[0]))
             {
                 // handle named arguments
                 if (!extract_arguments(p.primitive_type_ + suffix, result,
-                        exprs[0], args, defaults))
+                        exprs[0], args, defaults, default_values))
                 {
                     // something went wrong
                     HPX_ASSERT(false);
@@ -332,11 +431,15 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             // reconstruct the pattern, if needed (leaving out default values)
             if (defaults.empty())
             {
-                result.insert(expression_pattern_list::value_type(
-                    p.primitive_type_ + suffix,
-                    expression_pattern{std::move(pattern), std::move(exprs[0]),
-                        p.create_primitive_, std::move(args),
-                        std::move(defaults)}));
+                expression_pattern_list::iterator it =
+                    result.insert(expression_pattern_list::value_type(
+                        p.primitive_type_ + suffix,
+                        expression_pattern{std::move(pattern),
+                            std::move(exprs[0]), p.create_primitive_,
+                            std::move(args), std::move(defaults),
+                            std::move(default_values), false, false, 0}));
+
+                initialize_dispatch_information(it->second);
             }
             else
             {
@@ -349,11 +452,15 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                             args.size() - (i - 1));
                     exprs = ast::generate_ast(resulting_pattern);
 
-                    result.insert(expression_pattern_list::value_type(
-                        p.primitive_type_ + suffix,
-                        expression_pattern{std::move(resulting_pattern),
-                            std::move(exprs[0]), p.create_primitive_, args,
-                            defaults}));
+                    expression_pattern_list::iterator it =
+                        result.insert(expression_pattern_list::value_type(
+                            p.primitive_type_ + suffix,
+                            expression_pattern{std::move(resulting_pattern),
+                                std::move(exprs[0]), p.create_primitive_,
+                                args, defaults, default_values, false, false,
+                                0}));
+
+                    initialize_dispatch_information(it->second);
                 }
             }
         }
@@ -397,6 +504,34 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         return patterns;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    pattern_index::pattern_index(expression_pattern_list const& patterns)
+      : patterns_(&patterns)
+      , size_(patterns.size())
+    {
+        for (auto it = patterns.begin(); it != patterns.end(); ++it)
+        {
+            functions_[it->first].push_back(it);
+            if (!it->second.is_function_call_)
+            {
+                operators_.push_back(it);
+            }
+        }
+    }
+
+    pattern_index::candidates_type const& pattern_index::functions(
+        std::string const& name) const
+    {
+        static candidates_type const no_candidates;
+
+        auto it = functions_.find(name);
+        if (it == functions_.end())
+        {
+            return no_candidates;
+        }
+        return it->second;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct compiler_helper
     {
@@ -657,8 +792,11 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             return compile(name_, body, snippets_, env, patterns_, locality);
         }
 
+        // num_slots is set to the number of variables stored in the frames
+        // created for the compiled function
         function compile_body(std::vector<ast::expression> const& args,
-            ast::expression const& body, hpx::id_type const& locality) const
+            ast::expression const& body, hpx::id_type const& locality,
+            std::size_t& num_slots) const
         {
 #if !defined(PHYLANX_HAVE_CXX17_SHARED_PTR_ARRAY)
             boost::shared_array<std::string> named_args;
@@ -668,7 +806,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             std::size_t base_arg_num = env_.base_arg_num();
 
             bool has_default_value = false;
-            environment env(&env_, args.size());
+            environment env(&env_, args.size(), true);
             for (std::size_t i = 0; i != args.size(); ++i)
             {
                 ast::tagged id = ast::detail::tagged_id(args[i]);
@@ -745,6 +883,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 f.set_named_args(std::move(named_args), args.size());
             }
 
+            num_slots = env.num_slots();
             return f;
         }
 
@@ -766,12 +905,19 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                              primitive_argument_type{}, lambda_name, name_)},
                 lambda_name};
 
-            function body_f = compile_body(args, body, locality);
+            std::size_t num_slots = 0;
+            function body_f = compile_body(args, body, locality, num_slots);
             f.set_named_args(
                 std::move(body_f.named_args_), body_f.num_named_args_);
 
+            // the lambda's frames need to be able to hold all of its variables
+            primitive_arguments_type data;
+            data.reserve(2);
+            data.emplace_back(std::move(body_f.arg_));
+            data.emplace_back(static_cast<std::int64_t>(num_slots));
+
             auto p = primitive_operand(f.arg_, lambda_name, name_);
-            p.store(hpx::launch::sync, std::move(body_f.arg_), {});
+            p.store(hpx::launch::sync, std::move(data), {});
 
             return f;
         }
@@ -862,6 +1008,10 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             // object of type 'access-variable' that extracts the current value
             // of the variable it refers to.
 
+            // the variable is stored in the flat array of variables of the
+            // current frame (or of the outermost frame)
+            variable_slot slot = env_.define_slot(name, define_globally);
+
             // a define() either sets up a named variable or a named lambda
             primitive_name_parts name_parts;
             if (args.empty())
@@ -931,6 +1081,8 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 env_.define_variable(name_parts.instance,
                     access_target(f, "access-function", default_locality_),
                     name_, id.id, id.col, define_globally);
+                env_.define_function_ast(
+                    name_parts.instance, args, body, define_globally);
 
                 std::string variable_name = compose_primitive_name(name_parts);
                 f = function{
@@ -960,7 +1112,8 @@ namespace phylanx { namespace execution_tree { namespace compiler {
 
             function define_f =
                 define_operation{default_locality_, std::move(define_variable)}(
-                    std::move(variable_ref.arg_), std::move(name_parts), name_);
+                    std::move(variable_ref.arg_), std::move(name_parts), name_,
+                    slot);
             define_f.set_named_args(f.named_args_, f.num_named_args_);
 
             return define_f;
@@ -993,6 +1146,10 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 {
                     name_parts.sequence_number =
                         snippets_.sequence_numbers_[at->target_name_]++;
+
+                    result = at->compose(std::move(elements),
+                        std::move(name_parts), name_, env_.resolve_slot(name));
+                    return true;
                 }
 
                 result =
@@ -1194,6 +1351,12 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     snippets_.compile_id_ - 1,
                     get_locality_id(default_locality_));
 
+                if (at != nullptr)
+                {
+                    return at->compose(std::list<function>{},
+                        std::move(name_parts), name_, env_.resolve_slot(name));
+                }
+
                 return (*cf)(
                     std::list<function>{}, std::move(name_parts), name_);
             }
@@ -1309,7 +1472,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         ast::detail::function_name(argexpr) == "__arg")
                     {
                         std::string argname;
-                        std::string value;
+                        ast::expression value;
                         detail::parse_argument_value(
                             patterns_, argexpr, argname, value);
 
@@ -1353,10 +1516,9 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         continue;    // skip arguments that have no default value
                     }
 
-                    ast::expression default_expr =
-                        ast::generate_ast(it->second.defaults_[default_arg])[0];
-
-                    fargs[base + pos] = compile(name_, default_expr, snippets_,
+                    // default values were parsed when the pattern was created
+                    fargs[base + pos] = compile(name_,
+                        it->second.default_values_[default_arg], snippets_,
                         env, patterns_, locality)
                                             .arg_;
                     args_valid[pos] = true;
@@ -1375,7 +1537,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 {
                     // named argument
                     std::string argname;
-                    std::string value;
+                    ast::expression value;
 
                     if (detail::parse_argument_value(
                             patterns_, argexpr, argname, value))
@@ -1399,10 +1561,9 @@ namespace phylanx { namespace execution_tree { namespace compiler {
 
                         // place the keyword argument into the argument slot
                         // it belongs
-                        fargs[base + pos] =
-                            compile(name_, ast::generate_ast(value)[0],
-                                snippets_, env, patterns_, locality)
-                                .arg_;
+                        fargs[base + pos] = compile(name_, value, snippets_,
+                            env, patterns_, locality)
+                                                .arg_;
                         args_valid[pos] = true;
 
                         count = base + pos + 1;
@@ -1487,8 +1648,17 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 primitive_arguments_type fargs;
                 fargs.reserve(argexprs.size() + 1);
 
-                fargs.push_back(
-                    (*cf)(std::list<function>{}, name_parts, name_).arg_);
+                if (auto at = cf->target<access_target>())
+                {
+                    fargs.push_back(at->compose(std::list<function>{},
+                        primitive_name_parts(name_parts), name_,
+                        env_.resolve_slot(name_parts.instance)).arg_);
+                }
+                else
+                {
+                    fargs.push_back(
+                        (*cf)(std::list<function>{}, name_parts, name_).arg_);
+                }
 
                 // we represent function calls with empty argument lists as
                 // a function call with a single nil argument to be able to
@@ -1519,6 +1689,217 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     name_, id));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // elementwise fusion support
+        static fusable_operation const* is_fusable_call(
+            ast::expression const& expr)
+        {
+            if (!ast::detail::is_function_call(expr) ||
+                !ast::detail::function_attribute(expr).empty())
+            {
+                return nullptr;
+            }
+
+            fusable_operation const* op =
+                find_fusable_operation(ast::detail::function_name(expr));
+            if (op == nullptr)
+            {
+                return nullptr;
+            }
+
+            std::vector<ast::expression> args =
+                ast::detail::function_arguments(expr);
+            if (args.size() < op->min_arity_ || args.size() > op->max_arity_)
+            {
+                return nullptr;
+            }
+
+            // keyword arguments (dtype etc.) are not supported by the fused
+            // primitive
+            for (auto const& arg : args)
+            {
+                if (ast::detail::is_function_call(arg) &&
+                    ast::detail::function_name(arg) == "__arg")
+                {
+                    return nullptr;
+                }
+            }
+            return op;
+        }
+
+        // an expression is worth fusing only if it combines at least two
+        // elementwise operations
+        static bool is_fusable_expression(ast::expression const& expr)
+        {
+            if (is_fusable_call(expr) == nullptr)
+            {
+                return false;
+            }
+
+            for (auto const& arg : ast::detail::function_arguments(expr))
+            {
+                if (is_fusable_call(arg) != nullptr)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // generate the postfix program for the given (sub-)expression,
+        // compiling all non-fusable leaves
+        void generate_fused_program(ast::expression const& expr,
+            std::vector<std::int64_t>& program, std::list<function>& leaves,
+            std::map<std::string, std::size_t>& variables, environment& env)
+        {
+            fusable_operation const* op = is_fusable_call(expr);
+            if (op != nullptr)
+            {
+                std::vector<ast::expression> args =
+                    ast::detail::function_arguments(expr);
+                for (auto const& arg : args)
+                {
+                    generate_fused_program(
+                        arg, program, leaves, variables, env);
+                }
+
+                program.push_back(static_cast<std::int64_t>(op->opcode_));
+                program.push_back(static_cast<std::int64_t>(args.size()));
+                return;
+            }
+
+            // variable references are free of side effects, load those
+            // only once
+            std::size_t leaf = leaves.size();
+            if (ast::detail::is_identifier(expr))
+            {
+                auto p = variables.emplace(
+                    ast::detail::identifier_name(expr), leaf);
+                if (!p.second)
+                {
+                    leaf = p.first->second;
+                }
+                else
+                {
+                    leaves.push_back(compile(name_, expr, snippets_, env,
+                        patterns_, default_locality_));
+                }
+            }
+            else
+            {
+                leaves.push_back(compile(name_, expr, snippets_, env,
+                    patterns_, default_locality_));
+            }
+
+            program.push_back(static_cast<std::int64_t>(fused_opcode::load));
+            program.push_back(static_cast<std::int64_t>(leaf));
+        }
+
+        bool handle_fused_elementwise(
+            ast::expression const& expr, ast::tagged id, function& result)
+        {
+            static std::string const fused_elementwise("__fused_elementwise");
+
+            compiled_function* cf = env_.find(fused_elementwise);
+            if (cf == nullptr)
+            {
+                return false;    // the arithmetics plugin was not loaded
+            }
+
+            std::vector<std::int64_t> program;
+            std::list<function> args;
+            std::map<std::string, std::size_t> variables;
+
+            environment env(&env_);
+            generate_fused_program(expr, program, args, variables, env);
+
+            blaze::DynamicVector<std::int64_t> p(program.size());
+            std::copy(program.begin(), program.end(), p.begin());
+            args.emplace_front(
+                primitive_argument_type{ir::node_data<std::int64_t>{
+                    std::move(p)}});
+
+            // add sequence number for this primitive component
+            std::size_t sequence_number =
+                snippets_.sequence_numbers_[fused_elementwise]++;
+
+            primitive_name_parts name_parts(fused_elementwise,
+                sequence_number, id.id, id.col, snippets_.compile_id_ - 1,
+                get_locality_id(default_locality_));
+
+            result = (*cf)(std::move(args), std::move(name_parts), name_);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // grad(f, wrt) is compiled into a new function computing the
+        // gradient of the PhySL function 'f' with respect to the argument(s)
+        // given by 'wrt' (either a single argument name or a list of those)
+        function handle_grad(ast::expression const& expr, ast::tagged id)
+        {
+            std::vector<ast::expression> args =
+                ast::detail::function_arguments(expr);
+            if (args.size() != 2 || !ast::detail::is_identifier(args[0]))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::handle_grad",
+                    generate_error_message(
+                        "the grad() operation requires exactly two "
+                        "arguments, the name of the function to "
+                        "differentiate and the name(s) of its argument(s) to "
+                        "differentiate with respect to",
+                        name_, id));
+            }
+
+            std::string fname = ast::detail::identifier_name(args[0]);
+            environment::function_ast const* def =
+                env_.find_function_ast(fname);
+            if (def == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::handle_grad",
+                    generate_error_message("the first argument of grad(), '" +
+                            fname +
+                            "', does not refer to a function defined in PhySL",
+                        name_, id));
+            }
+
+            std::vector<std::string> wrt;
+            bool return_list = !ast::detail::is_identifier(args[1]);
+            if (!return_list)
+            {
+                wrt.push_back(ast::detail::identifier_name(args[1]));
+            }
+            else if (ast::detail::is_function_call(args[1]) &&
+                ast::detail::function_name(args[1]) == "list")
+            {
+                for (auto const& arg : ast::detail::function_arguments(args[1]))
+                {
+                    if (!ast::detail::is_identifier(arg))
+                    {
+                        wrt.clear();
+                        break;
+                    }
+                    wrt.push_back(ast::detail::identifier_name(arg));
+                }
+            }
+
+            if (wrt.empty())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::handle_grad",
+                    generate_error_message(
+                        "the second argument of grad() has to be an argument "
+                        "name or a list of argument names",
+                        name_, id));
+            }
+
+            ast::expression body = generate_gradient(def->args_, def->body_,
+                wrt, return_list, get_pattern_index(), name_, id);
+
+            return compile_lambda(def->args_, body, id, default_locality_);
+        }
+
         function handle_placeholders(placeholder_map_type& placeholders,
             std::string const& name, ast::tagged id)
         {
@@ -1573,6 +1954,82 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     name_, id));
         }
 
+        // the dispatch index for the global list of patterns is created only
+        // once, indices for other lists are kept alive by the function_list
+        pattern_index const& get_pattern_index() const
+        {
+            if (&patterns_ == &generate_patterns())
+            {
+                static pattern_index const index(generate_patterns());
+                return index;
+            }
+
+            auto& index = snippets_.index_;
+            if (!index || !index->indexes(patterns_))
+            {
+                index = std::make_shared<pattern_index const>(patterns_);
+            }
+            return *index;
+        }
+
+        // use the pattern that was selected for the given expression by an
+        // earlier compilation of the same code, if available
+        compilation_cache* get_cache() const
+        {
+            compilation_cache* cache = snippets_.cache_;
+            if (cache != nullptr && cache->uses_patterns(patterns_))
+            {
+                return cache;
+            }
+            return nullptr;
+        }
+
+        // returns false if the given expression still has to be matched
+        // against the patterns, search_patterns is set to false if no pattern
+        // is known to match
+        bool handle_cached_pattern(ast::expression const& expr,
+            std::string const& name, ast::tagged id, function& result,
+            bool& search_patterns)
+        {
+            compilation_cache* cache = get_cache();
+            if (cache == nullptr)
+            {
+                return false;
+            }
+
+            expression_pattern_list::const_iterator cit;
+            if (!cache->find_pattern(expr, name, cit))
+            {
+                return false;
+            }
+
+            if (cit == patterns_.end())
+            {
+                search_patterns = false;
+                return false;
+            }
+
+            placeholder_map_type placeholders;
+            if (!ast::match_ast(expr, cit->second.pattern_ast_,
+                    ast::detail::on_placeholder_match{placeholders}))
+            {
+                return false;    // stale entry, fall back to a full search
+            }
+
+            result = handle_placeholders(placeholders, (*cit).first, id);
+            return true;
+        }
+
+        void add_cached_pattern(ast::expression const& expr,
+            std::string const& name,
+            expression_pattern_list::const_iterator cit)
+        {
+            if (compilation_cache* cache = get_cache())
+            {
+                cache->add_pattern(expr, name, cit);
+            }
+        }
+
         // separate name from possible dtype
         static std::string extract_name_and_dtype(std::string const& fullname)
         {
@@ -1594,6 +2051,26 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 std::string const& function_name =
                     ast::detail::function_name(expr);
 
+                // collapse chains of elementwise operations into a single
+                // fused primitive
+                if (fuse_elementwise_operations() &&
+                    is_fusable_expression(expr))
+                {
+                    function fused;
+                    if (handle_fused_elementwise(expr, id, fused))
+                    {
+                        return fused;
+                    }
+                }
+
+                // grad() is a source transformation of a PhySL function,
+                // unless the name was redefined
+                if (function_name == "grad" &&
+                    env_.find(function_name) == nullptr)
+                {
+                    return handle_grad(expr, id);
+                }
+
                 expression_pattern_list::const_iterator cit =
                     patterns_.lower_bound(function_name);
                 if (cit != patterns_.end())
@@ -1672,20 +2149,52 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     // }
 
                     // handle all non-special functions
-                    while (
-                        cit != patterns_.end() && (*cit).first == function_name)
+                    function cached;
+                    bool search_patterns = true;
+                    if (handle_cached_pattern(expr, function_name, id, cached,
+                            search_patterns))
                     {
-                        placeholder_map_type placeholders;
-                        if (!ast::match_ast(expr, cit->second.pattern_ast_,
-                                ast::detail::on_placeholder_match{
-                                    placeholders}))
+                        return cached;
+                    }
+
+                    if (search_patterns)
+                    {
+                        // only patterns expecting a compatible number of
+                        // arguments have to be matched
+                        auto const* args =
+                            detail::function_call_arguments{}(expr);
+                        bool check_arguments = args != nullptr &&
+                            !detail::has_placeholder_ellipses(*args);
+
+                        for (auto candidate :
+                            get_pattern_index().functions(function_name))
                         {
-                            ++cit;
-                            continue;    // no match found for the current pattern
+                            if (check_arguments &&
+                                !candidate->second.accepts_arguments(
+                                    args->size()))
+                            {
+                                continue;
+                            }
+
+                            placeholder_map_type placeholders;
+                            if (!ast::match_ast(expr,
+                                    candidate->second.pattern_ast_,
+                                    ast::detail::on_placeholder_match{
+                                        placeholders}))
+                            {
+                                continue;    // no match for this pattern
+                            }
+
+                            add_cached_pattern(expr, function_name, candidate);
+                            return handle_placeholders(
+                                placeholders, candidate->first, id);
                         }
+                    }
 
-                        return handle_placeholders(
-                            placeholders, (*cit).first, id);
+                    if (search_patterns)
+                    {
+                        add_cached_pattern(
+                            expr, function_name, patterns_.end());
                     }
                 }
                 else
@@ -1695,17 +2204,34 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             }
             else
             {
-                // this should handle all remaining constructs (non-function calls)
-                for (auto const& pattern : patterns_)
+                function cached;
+                bool search_patterns = true;
+                if (handle_cached_pattern(expr, std::string(), id, cached,
+                        search_patterns))
                 {
-                    placeholder_map_type placeholders;
-                    if (!ast::match_ast(expr, pattern.second.pattern_ast_,
-                            ast::detail::on_placeholder_match{placeholders}))
+                    return cached;
+                }
+
+                // this should handle all remaining constructs (non-function
+                // calls), those can't match any of the function call patterns
+                if (search_patterns)
+                {
+                    for (auto cit : get_pattern_index().operators())
                     {
-                        continue;    // no match found for the current pattern
+                        placeholder_map_type placeholders;
+                        if (!ast::match_ast(expr, cit->second.pattern_ast_,
+                                ast::detail::on_placeholder_match{
+                                    placeholders}))
+                        {
+                            continue;    // no match for the current pattern
+                        }
+
+                        add_cached_pattern(expr, std::string(), cit);
+                        return handle_placeholders(
+                            placeholders, cit->first, id);
                     }
 
-                    return handle_placeholders(placeholders, pattern.first, id);
+                    add_cached_pattern(expr, std::string(), patterns_.end());
                 }
             }
 
@@ -1861,6 +2387,9 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             access_target(f, "access-variable", default_locality), codename,
             name_parts.tag1, name_parts.tag2, define_globally);
 
+        variable_slot slot =
+            env.define_slot(name_parts.instance, define_globally);
+
         // now create the variable object
         std::string variable_name = compose_primitive_name(name_parts);
         f = function{primitive_argument_type{create_primitive_component(
@@ -1882,6 +2411,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
 
         function variable_ref = f;    // copy f as we need to move it
         return define_operation{default_locality, std::move(define_variable)}(
-            std::move(variable_ref.arg_), std::move(name_parts), codename);
+            std::move(variable_ref.arg_), std::move(name_parts), codename,
+            slot);
     }
 }}}    // namespace phylanx::execution_tree::compiler
@@ -0,0 +1,85 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/elementwise_fusion.hpp>
+
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        constexpr std::size_t variadic = (std::numeric_limits<std::size_t>::max)();
+
+        static fusable_operation const fusable_operations[] =
+        {
+            {"__add", fused_opcode::add, 2, variadic},
+            {"__sub", fused_opcode::sub, 2, variadic},
+            {"__mul", fused_opcode::mul, 2, variadic},
+            {"__div", fused_opcode::div, 2, variadic},
+            {"__minus", fused_opcode::minus, 1, 1},
+            {"square", fused_opcode::square, 1, 1},
+            {"exp", fused_opcode::exp, 1, 1},
+            {"log", fused_opcode::log, 1, 1},
+            {"sqrt", fused_opcode::sqrt, 1, 1},
+            {"tanh", fused_opcode::tanh, 1, 1},
+            {"sigmoid", fused_opcode::sigmoid, 1, 1},
+        };
+    }
+
+    fusable_operation const* find_fusable_operation(std::string const& name)
+    {
+        for (auto const& op : detail::fusable_operations)
+        {
+            if (name == op.name_)
+            {
+                return &op;
+            }
+        }
+        return nullptr;
+    }
+
+    fusable_operation const* find_fusable_operation(fused_opcode opcode)
+    {
+        for (auto const& op : detail::fusable_operations)
+        {
+            if (opcode == op.opcode_)
+            {
+                return &op;
+            }
+        }
+        return nullptr;
+    }
+
+    bool is_float_fused_opcode(fused_opcode op)
+    {
+        switch (op)
+        {
+        case fused_opcode::exp: HPX_FALLTHROUGH;
+        case fused_opcode::log: HPX_FALLTHROUGH;
+        case fused_opcode::sqrt: HPX_FALLTHROUGH;
+        case fused_opcode::tanh: HPX_FALLTHROUGH;
+        case fused_opcode::sigmoid:
+            return true;
+
+        default:
+            break;
+        }
+        return false;
+    }
+
+    bool fuse_elementwise_operations()
+    {
+        static bool fuse_elementwise =
+            hpx::get_config_entry("phylanx.fuse_elementwise", "1") == "1";
+        return fuse_elementwise;
+    }
+}}}
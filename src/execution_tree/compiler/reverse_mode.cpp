@@ -0,0 +1,1214 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/detail/is_function_call.hpp>
+#include <phylanx/ast/detail/is_identifier.hpp>
+#include <phylanx/ast/detail/is_literal_value.hpp>
+#include <phylanx/ast/generate_ast.hpp>
+#include <phylanx/ast/match_ast.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/ast/traverse.hpp>
+#include <phylanx/execution_tree/compiler/compiler.hpp>
+#include <phylanx/execution_tree/compiler/reverse_mode.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // all code generated for a gradient is tagged with the position of
+        // the grad() invocation
+        class code_builder
+        {
+        public:
+            explicit code_builder(ast::tagged const& id)
+              : id_(id)
+            {
+            }
+
+            ast::expression identifier(std::string const& name) const
+            {
+                return ast::expression(
+                    ast::identifier(name, id_.id, id_.col));
+            }
+
+            ast::expression call(std::string const& name,
+                std::vector<ast::expression> args) const
+            {
+                return ast::expression(ast::operand(ast::primary_expr(
+                    ast::function_call(ast::identifier(name, id_.id, id_.col),
+                        std::move(args)))));
+            }
+
+            ast::expression literal(double value) const
+            {
+                return ast::expression(value);
+            }
+
+            ast::expression nil() const
+            {
+                return identifier("nil");
+            }
+
+        private:
+            ast::tagged id_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // An adjoint rule generates the contribution of a primitive invocation
+        // 'y = f(args...)' to the adjoint of its i-th argument from the
+        // adjoint 'g' of its result. All expressions referred to by an
+        // adjoint rule are variables or literals, those can be used more than
+        // once.
+        struct adjoint_arguments
+        {
+            ast::expression call(std::string const& name,
+                std::vector<ast::expression> args) const
+            {
+                return code_.call(name, std::move(args));
+            }
+
+            ast::expression literal(double value) const
+            {
+                return code_.literal(value);
+            }
+
+            code_builder const& code_;
+            ast::expression const& g_;      // adjoint of the result
+            ast::expression const& y_;      // result of the primitive
+            std::vector<ast::expression> const& args_;
+        };
+
+        using adjoint_function =
+            ast::expression (*)(adjoint_arguments const&, std::size_t);
+
+        constexpr std::size_t variadic =
+            (std::numeric_limits<std::size_t>::max)();
+
+        struct adjoint_rule
+        {
+            char const* name_;
+            std::vector<char const*> params_;   // empty if variadic
+            std::vector<char const*> defaults_; // PhySL, nullptr if required
+            std::size_t num_differentiable_;    // leading parameters
+            adjoint_function adjoint_;
+        };
+
+        bool is_nil(ast::expression const& expr)
+        {
+            return ast::detail::is_identifier(expr) &&
+                ast::detail::identifier_name(expr) == "nil";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // arithmetic operations broadcast their arguments, the adjoints are
+        // reduced to the shape of the corresponding argument
+        ast::expression unbroadcast(adjoint_arguments const& a,
+            ast::expression const& adjoint, std::size_t i)
+        {
+            return a.call("__unbroadcast", {adjoint, a.args_[i]});
+        }
+
+        ast::expression add_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            return unbroadcast(a, a.g_, i);
+        }
+
+        ast::expression sub_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            if (i == 0)
+            {
+                return unbroadcast(a, a.g_, i);
+            }
+            return unbroadcast(a, a.call("__minus", {a.g_}), i);
+        }
+
+        ast::expression mul_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            std::vector<ast::expression> factors;
+            factors.reserve(a.args_.size());
+            factors.push_back(a.g_);
+            for (std::size_t j = 0; j != a.args_.size(); ++j)
+            {
+                if (j != i)
+                {
+                    factors.push_back(a.args_[j]);
+                }
+            }
+            return unbroadcast(a, a.call("__mul", std::move(factors)), i);
+        }
+
+        ast::expression div_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            // y = x0 / x1 / ...: dy/dx0 = 1 / (x1 * ...), dy/dxi = -y / xi
+            if (i == 0)
+            {
+                std::vector<ast::expression> operands;
+                operands.reserve(a.args_.size());
+                operands.push_back(a.g_);
+                operands.insert(
+                    operands.end(), a.args_.begin() + 1, a.args_.end());
+                return unbroadcast(a, a.call("__div", std::move(operands)), i);
+            }
+            return unbroadcast(a,
+                a.call("__minus",
+                    {a.call("__div",
+                        {a.call("__mul", {a.g_, a.y_}), a.args_[i]})}),
+                i);
+        }
+
+        ast::expression minus_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__minus", {a.g_});
+        }
+
+        ast::expression power_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            ast::expression const& x = a.args_[0];
+            ast::expression const& p = a.args_[1];
+            if (i == 0)
+            {
+                return unbroadcast(a,
+                    a.call("__mul",
+                        {a.g_, p,
+                            a.call("power",
+                                {x, a.call("__sub", {p, a.literal(1.0)})})}),
+                    i);
+            }
+            return unbroadcast(
+                a, a.call("__mul", {a.g_, a.y_, a.call("log", {x})}), i);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // elementwise functions
+        ast::expression exp_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul", {a.g_, a.y_});
+        }
+
+        ast::expression log_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__div", {a.g_, a.args_[0]});
+        }
+
+        ast::expression sqrt_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call(
+                "__div", {a.g_, a.call("__mul", {a.literal(2.0), a.y_})});
+        }
+
+        ast::expression square_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul", {a.literal(2.0), a.g_, a.args_[0]});
+        }
+
+        ast::expression tanh_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul",
+                {a.g_,
+                    a.call("__sub",
+                        {a.literal(1.0), a.call("square", {a.y_})})});
+        }
+
+        ast::expression sin_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul", {a.g_, a.call("cos", {a.args_[0]})});
+        }
+
+        ast::expression cos_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__minus",
+                {a.call("__mul", {a.g_, a.call("sin", {a.args_[0]})})});
+        }
+
+        ast::expression absolute_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul", {a.g_, a.call("sign", {a.args_[0]})});
+        }
+
+        ast::expression transpose_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            // the inverse of a permutation of the axes is given by argsort
+            ast::expression const& axes = a.args_[1];
+            if (is_nil(axes))
+            {
+                return a.call("transpose", {a.g_});
+            }
+            return a.call("transpose", {a.g_, a.call("argsort", {axes})});
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // activations
+        ast::expression sigmoid_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul",
+                {a.g_, a.y_, a.call("__sub", {a.literal(1.0), a.y_})});
+        }
+
+        ast::expression softplus_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul", {a.g_, a.call("sigmoid", {a.args_[0]})});
+        }
+
+        ast::expression softsign_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__div",
+                {a.g_,
+                    a.call("square",
+                        {a.call("__add",
+                            {a.literal(1.0),
+                                a.call("absolute", {a.args_[0]})})})});
+        }
+
+        ast::expression hard_sigmoid_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            // the slope is 0.2 in (-2.5, 2.5) and zero elsewhere
+            ast::expression const& x = a.args_[0];
+            return a.call("__mul",
+                {a.g_,
+                    a.call("where",
+                        {a.call("__gt", {x, a.literal(-2.5)}),
+                            a.call("where",
+                                {a.call("__lt", {x, a.literal(2.5)}),
+                                    a.literal(0.2), a.literal(0.0)}),
+                            a.literal(0.0)})});
+        }
+
+        ast::expression relu_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            // relu(x) = alpha * (x - threshold) for x < threshold,
+            // max(0, min(x, max_value)) otherwise
+            ast::expression const& x = a.args_[0];
+            ast::expression const& alpha = a.args_[1];
+            ast::expression const& max_value = a.args_[2];
+            ast::expression const& threshold = a.args_[3];
+
+            ast::expression slope = a.call("where",
+                {a.call("__gt", {x, a.literal(0.0)}), a.literal(1.0),
+                    a.literal(0.0)});
+            if (!is_nil(max_value))
+            {
+                slope = a.call("__mul",
+                    {std::move(slope),
+                        a.call("where",
+                            {a.call("__lt", {x, max_value}), a.literal(1.0),
+                                a.literal(0.0)})});
+            }
+            return a.call("__mul",
+                {a.g_,
+                    a.call("where",
+                        {a.call("__lt", {x, threshold}), alpha,
+                            std::move(slope)})});
+        }
+
+        ast::expression elu_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            // the derivative of alpha * (exp(x) - 1) is y + alpha
+            return a.call("__mul",
+                {a.g_,
+                    a.call("where",
+                        {a.call("__gt", {a.args_[0], a.literal(0.0)}),
+                            a.literal(1.0),
+                            a.call("__add", {a.y_, a.args_[1]})})});
+        }
+
+        ast::expression softmax_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul",
+                {a.y_,
+                    a.call("__sub",
+                        {a.g_,
+                            a.call("sum",
+                                {a.call("__mul", {a.g_, a.y_}), a.args_[1],
+                                    ast::expression(true)})})});
+        }
+
+        ast::expression bias_add_adjoint(
+            adjoint_arguments const& a, std::size_t i)
+        {
+            if (i == 0)
+            {
+                return a.g_;
+            }
+            return unbroadcast(a, a.g_, i);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // reductions, the adjoint of the result is expanded to the shape of
+        // the reduced argument
+        ast::expression unreduce(adjoint_arguments const& a,
+            ast::expression const& value, char const* name = "__unreduce")
+        {
+            return a.call(name, {value, a.args_[0], a.args_[1]});
+        }
+
+        ast::expression sum_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return unreduce(a, a.g_);
+        }
+
+        ast::expression mean_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return unreduce(a, a.g_, "__unreduce_mean");
+        }
+
+        ast::expression extremum_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            // all elements equal to the extremum receive the adjoint
+            return a.call("where",
+                {a.call("__eq", {a.args_[0], unreduce(a, a.y_)}),
+                    unreduce(a, a.g_), a.literal(0.0)});
+        }
+
+        ast::expression prod_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__div",
+                {unreduce(a, a.call("__mul", {a.g_, a.y_})), a.args_[0]});
+        }
+
+        ast::expression centered(adjoint_arguments const& a)
+        {
+            return a.call("__sub",
+                {a.args_[0],
+                    unreduce(a, a.call("mean", {a.args_[0], a.args_[1]}))});
+        }
+
+        ast::expression var_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul",
+                {unreduce(a, a.call("__mul", {a.literal(2.0), a.g_}),
+                     "__unreduce_mean"),
+                    centered(a)});
+        }
+
+        ast::expression std_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul",
+                {unreduce(a, a.call("__div", {a.g_, a.y_}), "__unreduce_mean"),
+                    centered(a)});
+        }
+
+        ast::expression logsumexp_adjoint(
+            adjoint_arguments const& a, std::size_t)
+        {
+            return a.call("__mul",
+                {unreduce(a, a.g_),
+                    a.call("exp",
+                        {a.call("__sub", {a.args_[0], unreduce(a, a.y_)})})});
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // linear algebra, convolutions, and pooling
+        ast::expression dot_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            return a.call(i == 0 ? "__dot_grad_lhs" : "__dot_grad_rhs",
+                {a.g_, a.args_[0], a.args_[1]});
+        }
+
+        template <char const* Input, char const* Kernel>
+        ast::expression conv_adjoint(adjoint_arguments const& a, std::size_t i)
+        {
+            std::vector<ast::expression> operands;
+            operands.reserve(a.args_.size() + 1);
+            operands.push_back(a.g_);
+            operands.insert(operands.end(), a.args_.begin(), a.args_.end());
+            return a.call(i == 0 ? Input : Kernel, std::move(operands));
+        }
+
+        template <char const* Name>
+        ast::expression pool_adjoint(adjoint_arguments const& a, std::size_t)
+        {
+            std::vector<ast::expression> operands;
+            operands.reserve(a.args_.size() + 1);
+            operands.push_back(a.g_);
+            operands.insert(operands.end(), a.args_.begin(), a.args_.end());
+            return a.call(Name, std::move(operands));
+        }
+
+        constexpr char conv1d_grad_input[] = "__conv1d_grad_input";
+        constexpr char conv1d_grad_kernel[] = "__conv1d_grad_kernel";
+        constexpr char conv2d_grad_input[] = "__conv2d_grad_input";
+        constexpr char conv2d_grad_kernel[] = "__conv2d_grad_kernel";
+        constexpr char max_pool2d_grad[] = "__max_pool2d_grad";
+        constexpr char avg_pool2d_grad[] = "__avg_pool2d_grad";
+
+        ///////////////////////////////////////////////////////////////////////
+        std::vector<adjoint_rule> const& adjoint_rules()
+        {
+            static std::vector<char const*> const unary = {"x"};
+            static std::vector<char const*> const unary_defaults = {nullptr};
+
+            // sum, amax, amin, prod: x, axis, keepdims, initial, dtype
+            // mean, var, std, logsumexp: x, axis, keepdims, dummy_, dtype
+            static std::vector<char const*> const reduction = {
+                "x", "axis", "keepdims", "initial", "dtype"};
+            static std::vector<char const*> const moments = {
+                "x", "axis", "keepdims", "dummy_", "dtype"};
+            static std::vector<char const*> const reduction_defaults = {
+                nullptr, "nil", "nil", "nil", "nil"};
+
+            static std::vector<adjoint_rule> const rules = {
+                {"__add", {}, {}, variadic, &add_adjoint},
+                {"__sub", {}, {}, variadic, &sub_adjoint},
+                {"__mul", {}, {}, variadic, &mul_adjoint},
+                {"__div", {}, {}, variadic, &div_adjoint},
+                {"__minus", unary, unary_defaults, 1, &minus_adjoint},
+                {"power", {"x", "p"}, {nullptr, nullptr}, 2, &power_adjoint},
+
+                {"exp", unary, unary_defaults, 1, &exp_adjoint},
+                {"log", unary, unary_defaults, 1, &log_adjoint},
+                {"sqrt", unary, unary_defaults, 1, &sqrt_adjoint},
+                {"square", unary, unary_defaults, 1, &square_adjoint},
+                {"tanh", unary, unary_defaults, 1, &tanh_adjoint},
+                {"sin", unary, unary_defaults, 1, &sin_adjoint},
+                {"cos", unary, unary_defaults, 1, &cos_adjoint},
+                {"absolute", unary, unary_defaults, 1, &absolute_adjoint},
+                {"transpose", {"x", "axes"}, {nullptr, "nil"}, 1,
+                    &transpose_adjoint},
+
+                {"sigmoid", unary, unary_defaults, 1, &sigmoid_adjoint},
+                {"softplus", unary, unary_defaults, 1, &softplus_adjoint},
+                {"softsign", unary, unary_defaults, 1, &softsign_adjoint},
+                {"hard_sigmoid", unary, unary_defaults, 1,
+                    &hard_sigmoid_adjoint},
+                {"relu", {"x", "alpha", "max_value", "threshold"},
+                    {nullptr, "0.", "nil", "0."}, 1, &relu_adjoint},
+                {"elu", {"x", "alpha"}, {nullptr, "1."}, 1, &elu_adjoint},
+                {"softmax", {"x", "axis"}, {nullptr, "-1"}, 1,
+                    &softmax_adjoint},
+                {"bias_add", {"x", "bias"}, {nullptr, nullptr}, 2,
+                    &bias_add_adjoint},
+
+                {"sum", reduction, reduction_defaults, 1, &sum_adjoint},
+                {"mean", moments, reduction_defaults, 1, &mean_adjoint},
+                {"amax", reduction, reduction_defaults, 1, &extremum_adjoint},
+                {"amin", reduction, reduction_defaults, 1, &extremum_adjoint},
+                {"prod", reduction, reduction_defaults, 1, &prod_adjoint},
+                {"var", moments, reduction_defaults, 1, &var_adjoint},
+                {"std", moments, reduction_defaults, 1, &std_adjoint},
+                {"logsumexp", moments, reduction_defaults, 1,
+                    &logsumexp_adjoint},
+
+                {"dot", {"a", "b"}, {nullptr, nullptr}, 2, &dot_adjoint},
+                {"conv1d",
+                    {"x", "kernel", "padding", "strides", "dilation_rate"},
+                    {nullptr, nullptr, "\"valid\"", "1", "1"}, 2,
+                    &conv_adjoint<conv1d_grad_input, conv1d_grad_kernel>},
+                {"conv2d",
+                    {"x", "kernel", "padding", "strides", "dilation_rate"},
+                    {nullptr, nullptr, "\"valid\"", "list(1, 1)",
+                        "list(1, 1)"},
+                    2, &conv_adjoint<conv2d_grad_input, conv2d_grad_kernel>},
+                {"max_pool2d", {"x", "pool_size", "padding", "strides"},
+                    {nullptr, nullptr, "\"valid\"", "list(1, 1)"}, 1,
+                    &pool_adjoint<max_pool2d_grad>},
+                {"avg_pool2d", {"x", "pool_size", "padding", "strides"},
+                    {nullptr, nullptr, "\"valid\"", "list(1, 1)"}, 1,
+                    &pool_adjoint<avg_pool2d_grad>},
+            };
+            return rules;
+        }
+
+        adjoint_rule const* find_adjoint_rule(std::string const& name)
+        {
+            for (auto const& rule : adjoint_rules())
+            {
+                if (name == rule.name_)
+                {
+                    return &rule;
+                }
+            }
+            return nullptr;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct collect_identifiers
+        {
+            template <typename Ast, typename... Ts>
+            bool operator()(Ast const&, Ts const&...) const
+            {
+                return true;
+            }
+
+            template <typename... Ts>
+            bool operator()(ast::identifier const& id, Ts const&...) const
+            {
+                names_.insert(id.name);
+                return true;
+            }
+
+            std::set<std::string>& names_;
+        };
+
+        std::set<std::string> identifiers(ast::expression const& expr)
+        {
+            std::set<std::string> names;
+            ast::traverse(expr, collect_identifiers{names});
+            return names;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        class gradient_generator
+        {
+            // a primitive invocation recorded during the forward pass
+            struct tape_entry
+            {
+                std::string result_;
+                adjoint_rule const* rule_;
+                std::vector<ast::expression> args_;
+                std::vector<bool> active_;
+            };
+
+        public:
+            gradient_generator(pattern_index const& patterns,
+                    std::string const& codename, ast::tagged const& id)
+              : patterns_(patterns)
+              , codename_(codename)
+              , id_(id)
+              , code_(id)
+            {
+            }
+
+            ast::expression operator()(
+                std::vector<ast::expression> const& args,
+                ast::expression const& body,
+                std::vector<std::string> const& wrt, bool return_list);
+
+        private:
+            // forward pass
+            void statement(ast::expression const& expr);
+            ast::expression value(ast::expression const& expr);
+            ast::expression primitive_call(std::string const& name,
+                std::vector<ast::expression> const& args, bool is_operator);
+            ast::expression capture(ast::expression const& expr);
+
+            // backward pass
+            void backward(ast::expression const& result);
+            void accumulate(std::string const& name, ast::expression&& adjoint);
+
+            ast::expression release_temporaries(
+                ast::expression&& result) const;
+
+            bool is_active(ast::expression const& expr) const;
+            std::string new_temporary();
+            std::string new_adjoint();
+
+            ast::expression define(std::string const& name,
+                ast::expression value) const
+            {
+                return code_.call(
+                    "define", {code_.identifier(name), std::move(value)});
+            }
+
+            ast::expression store(std::string const& name,
+                ast::expression value) const
+            {
+                return code_.call(
+                    "store", {code_.identifier(name), std::move(value)});
+            }
+
+            std::string generate_error_message(std::string const& msg) const
+            {
+                if (id_.id != std::int64_t(-1))
+                {
+                    if (id_.col != std::int64_t(-1))
+                    {
+                        return hpx::util::format(
+                            "{}({}, {}): {}", codename_, id_.id, id_.col, msg);
+                    }
+                    return hpx::util::format(
+                        "{}({}): {}", codename_, id_.id, msg);
+                }
+                return hpx::util::format("{}: {}", codename_, msg);
+            }
+
+            pattern_index const& patterns_;
+            std::string const& codename_;
+            ast::tagged id_;
+            code_builder code_;
+
+            std::set<std::string> parameters_;  // arguments of the function
+            std::set<std::string> active_;      // names depending on 'wrt'
+            std::set<std::string> variables_;   // inactive local variables
+            std::set<std::string> taped_;       // names referenced by the tape
+            std::set<std::string> generated_;   // temporaries and adjoints
+
+            // active local variables refer to temporaries or arguments
+            std::map<std::string, ast::expression> bindings_;
+
+            std::vector<ast::expression> statements_;
+            std::vector<tape_entry> tape_;
+            std::map<std::string, std::string> adjoints_;
+            std::size_t num_temporaries_ = 0;
+            std::size_t num_adjoints_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        bool gradient_generator::is_active(ast::expression const& expr) const
+        {
+            for (auto const& name : identifiers(expr))
+            {
+                if (active_.find(name) != active_.end())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::string gradient_generator::new_temporary()
+        {
+            std::string name =
+                hpx::util::format("__grad_t{}", num_temporaries_++);
+            generated_.insert(name);
+            return name;
+        }
+
+        std::string gradient_generator::new_adjoint()
+        {
+            std::string name = hpx::util::format("__grad_g{}", num_adjoints_++);
+            generated_.insert(name);
+            return name;
+        }
+
+        // store the value of an expression not depending on 'wrt' in a new
+        // temporary
+        ast::expression gradient_generator::capture(ast::expression const& expr)
+        {
+            std::string name = new_temporary();
+            statements_.push_back(define(name, expr));
+            return code_.identifier(name);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void gradient_generator::statement(ast::expression const& expr)
+        {
+            if (!ast::detail::is_function_call(expr) ||
+                !ast::detail::function_attribute(expr).empty())
+            {
+                if (is_active(expr))
+                {
+                    value(expr);    // the result is discarded
+                }
+                else
+                {
+                    statements_.push_back(expr);
+                }
+                return;
+            }
+
+            std::string name = ast::detail::function_name(expr);
+            if (name != "define" && name != "store")
+            {
+                if (is_active(expr))
+                {
+                    value(expr);
+                }
+                else
+                {
+                    statements_.push_back(expr);
+                }
+                return;
+            }
+
+            std::vector<ast::expression> args =
+                ast::detail::function_arguments(expr);
+            if (args.size() != 2 || !ast::detail::is_identifier(args[0]))
+            {
+                // local function definitions are used unchanged
+                if (name == "define" && !is_active(expr))
+                {
+                    statements_.push_back(expr);
+                    return;
+                }
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::generate_gradient",
+                    generate_error_message(hpx::util::format(
+                        "unsupported use of {}() in a differentiated "
+                        "function: {}",
+                        name, ast::to_string(expr))));
+            }
+
+            std::string var = ast::detail::identifier_name(args[0]);
+            if (name == "store" && parameters_.find(var) != parameters_.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::generate_gradient",
+                    generate_error_message(hpx::util::format(
+                        "a differentiated function can't assign to its "
+                        "argument '{}'",
+                        var)));
+            }
+
+            // the values referenced by the tape have to stay unchanged until
+            // the adjoints have been computed
+            if (taped_.find(var) != taped_.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::generate_gradient",
+                    generate_error_message(hpx::util::format(
+                        "the variable '{}' is modified after its value was "
+                        "used in a differentiated computation",
+                        var)));
+            }
+
+            if (is_active(args[1]))
+            {
+                bindings_[var] = value(args[1]);
+                active_.insert(var);
+                return;
+            }
+
+            bool was_bound = bindings_.erase(var) != 0;
+            active_.erase(var);
+
+            if (name == "store" &&
+                (!was_bound || variables_.find(var) != variables_.end()))
+            {
+                statements_.push_back(expr);
+            }
+            else
+            {
+                statements_.push_back(define(var, args[1]));
+                variables_.insert(var);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // return a variable or literal representing the value of the given
+        // expression
+        ast::expression gradient_generator::value(ast::expression const& expr)
+        {
+            if (ast::detail::is_identifier(expr))
+            {
+                auto it = bindings_.find(ast::detail::identifier_name(expr));
+                if (it != bindings_.end())
+                {
+                    return it->second;
+                }
+                return expr;
+            }
+
+            if (ast::detail::is_literal_value(expr))
+            {
+                return expr;
+            }
+
+            if (ast::detail::is_function_call(expr) &&
+                ast::detail::function_attribute(expr).empty())
+            {
+                std::string name = ast::detail::function_name(expr);
+                if (name == "block")
+                {
+                    std::vector<ast::expression> args =
+                        ast::detail::function_arguments(expr);
+                    if (args.empty())
+                    {
+                        return code_.nil();
+                    }
+                    for (std::size_t i = 0; i != args.size() - 1; ++i)
+                    {
+                        statement(args[i]);
+                    }
+                    return value(args.back());
+                }
+
+                if (name == "define" || name == "store")
+                {
+                    statement(expr);
+                    return code_.nil();
+                }
+            }
+
+            if (!is_active(expr))
+            {
+                return capture(expr);
+            }
+
+            if (ast::detail::is_function_call(expr))
+            {
+                if (!ast::detail::function_attribute(expr).empty())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::compiler::generate_gradient",
+                        generate_error_message(hpx::util::format(
+                            "attributes are not supported in differentiated "
+                            "code: {}",
+                            ast::to_string(expr))));
+                }
+                return primitive_call(ast::detail::function_name(expr),
+                    ast::detail::function_arguments(expr), false);
+            }
+
+            // operators are matched against the same patterns as used by the
+            // compiler, the arguments are listed in the order of the
+            // placeholders
+            for (auto cit : patterns_.operators())
+            {
+                std::multimap<std::string, ast::expression> placeholders;
+                if (!ast::match_ast(expr, cit->second.pattern_ast_,
+                        ast::detail::on_placeholder_match{placeholders}))
+                {
+                    continue;
+                }
+
+                std::vector<ast::expression> args;
+                args.reserve(placeholders.size());
+                for (auto const& placeholder : placeholders)
+                {
+                    args.push_back(placeholder.second);
+                }
+                return primitive_call(cit->first, args, true);
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::compiler::generate_gradient",
+                generate_error_message(
+                    "unsupported expression in a differentiated function: " +
+                    ast::to_string(expr)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        ast::expression gradient_generator::primitive_call(
+            std::string const& name, std::vector<ast::expression> const& args,
+            bool is_operator)
+        {
+            adjoint_rule const* rule = find_adjoint_rule(name);
+            if (rule == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::compiler::generate_gradient",
+                    generate_error_message(hpx::util::format(
+                        "no adjoint rule is known for the primitive '{}', "
+                        "control flow and calls to PhySL functions are not "
+                        "supported in differentiated code",
+                        name)));
+            }
+
+            bool const is_variadic = rule->num_differentiable_ == variadic;
+
+            // the invocation is re-generated with all arguments replaced by
+            // variables or literals, keyword arguments are mapped to the
+            // parameters of the rule
+            std::vector<ast::expression> call_args;
+            call_args.reserve(args.size());
+
+            std::vector<ast::expression> params(rule->params_.size());
+            std::vector<bool> given(rule->params_.size(), false);
+
+            std::size_t positional = 0;
+            for (auto const& arg : args)
+            {
+                if (!is_operator && ast::detail::is_function_call(arg) &&
+                    ast::detail::function_name(arg) == "__arg")
+                {
+                    std::vector<ast::expression> kwargs =
+                        ast::detail::function_arguments(arg);
+
+                    std::size_t k = rule->params_.size();
+                    if (kwargs.size() == 2 &&
+                        ast::detail::is_identifier(kwargs[0]))
+                    {
+                        std::string kwname =
+                            ast::detail::identifier_name(kwargs[0]);
+                        for (k = 0; k != rule->params_.size(); ++k)
+                        {
+                            if (kwname == rule->params_[k])
+                            {
+                                break;
+                            }
+                        }
+                    }
+                    if (k == rule->params_.size())
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "phylanx::execution_tree::compiler::"
+                            "generate_gradient",
+                            generate_error_message(hpx::util::format(
+                                "unsupported keyword argument for the "
+                                "primitive '{}' in differentiated code: {}",
+                                name, ast::to_string(arg))));
+                    }
+
+                    params[k] = value(kwargs[1]);
+                    given[k] = true;
+                    call_args.push_back(
+                        code_.call("__arg", {kwargs[0], params[k]}));
+                    continue;
+                }
+
+                ast::expression atom = value(arg);
+                if (is_variadic)
+                {
+                    params.push_back(atom);
+                }
+                else
+                {
+                    if (positional == rule->params_.size())
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "phylanx::execution_tree::compiler::"
+                            "generate_gradient",
+                            generate_error_message(hpx::util::format(
+                                "too many arguments for the primitive '{}'",
+                                name)));
+                    }
+                    params[positional] = atom;
+                    given[positional] = true;
+                    ++positional;
+                }
+                call_args.push_back(std::move(atom));
+            }
+
+            for (std::size_t k = 0; k != given.size(); ++k)
+            {
+                if (given[k])
+                {
+                    continue;
+                }
+                if (rule->defaults_[k] == nullptr)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::compiler::generate_gradient",
+                        generate_error_message(hpx::util::format(
+                            "missing argument '{}' for the primitive '{}'",
+                            rule->params_[k], name)));
+                }
+                params[k] = ast::generate_ast(rule->defaults_[k])[0];
+            }
+
+            std::size_t num_differentiable =
+                is_variadic ? params.size() : rule->num_differentiable_;
+
+            std::vector<bool> active(num_differentiable, false);
+            bool any_active = false;
+            for (std::size_t k = 0; k != num_differentiable; ++k)
+            {
+                active[k] = ast::detail::is_identifier(params[k]) &&
+                    active_.find(ast::detail::identifier_name(params[k])) !=
+                        active_.end();
+                any_active = any_active || active[k];
+            }
+
+            std::string result = new_temporary();
+            statements_.push_back(
+                define(result, code_.call(name, std::move(call_args))));
+
+            // the result depends on 'wrt' through non-differentiable
+            // arguments only (e.g. the axis of a reduction)
+            if (!any_active)
+            {
+                return code_.identifier(result);
+            }
+
+            for (auto const& param : params)
+            {
+                for (auto&& id : identifiers(param))
+                {
+                    taped_.insert(std::move(id));
+                }
+            }
+
+            active_.insert(result);
+            tape_.push_back(
+                tape_entry{result, rule, std::move(params), std::move(active)});
+
+            return code_.identifier(result);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void gradient_generator::accumulate(
+            std::string const& name, ast::expression&& adjoint)
+        {
+            auto it = adjoints_.find(name);
+            if (it == adjoints_.end())
+            {
+                std::string adj = new_adjoint();
+                statements_.push_back(define(adj, std::move(adjoint)));
+                adjoints_.emplace(name, std::move(adj));
+                return;
+            }
+
+            statements_.push_back(store(it->second,
+                code_.call("__add",
+                    {code_.identifier(it->second), std::move(adjoint)})));
+        }
+
+        void gradient_generator::backward(ast::expression const& result)
+        {
+            if (!ast::detail::is_identifier(result))
+            {
+                return;     // a literal
+            }
+
+            std::string name = ast::detail::identifier_name(result);
+            if (active_.find(name) == active_.end())
+            {
+                return;
+            }
+
+            // seed the adjoint of the result
+            accumulate(name,
+                code_.call("constant_like", {code_.literal(1.0), result}));
+
+            for (auto it = tape_.rbegin(); it != tape_.rend(); ++it)
+            {
+                auto adj = adjoints_.find(it->result_);
+                if (adj == adjoints_.end())
+                {
+                    continue;   // the result does not contribute
+                }
+
+                ast::expression g = code_.identifier(adj->second);
+                ast::expression y = code_.identifier(it->result_);
+                adjoint_arguments args{code_, g, y, it->args_};
+
+                for (std::size_t k = 0; k != it->active_.size(); ++k)
+                {
+                    if (it->active_[k])
+                    {
+                        accumulate(
+                            ast::detail::identifier_name(it->args_[k]),
+                            it->rule_->adjoint_(args, k));
+                    }
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // release all temporaries and adjoints right after their last use,
+        // except for those referenced by the result
+        ast::expression gradient_generator::release_temporaries(
+            ast::expression&& result) const
+        {
+            std::map<std::string, std::size_t> last_use;
+            for (std::size_t i = 0; i != statements_.size(); ++i)
+            {
+                for (auto&& name : identifiers(statements_[i]))
+                {
+                    if (generated_.find(name) != generated_.end())
+                    {
+                        last_use[std::move(name)] = i;
+                    }
+                }
+            }
+
+            for (auto const& name : identifiers(result))
+            {
+                last_use.erase(name);
+            }
+
+            std::vector<std::vector<std::string>> released(statements_.size());
+            for (auto const& use : last_use)
+            {
+                released[use.second].push_back(use.first);
+            }
+
+            std::vector<ast::expression> body;
+            body.reserve(statements_.size() + last_use.size() + 1);
+            for (std::size_t i = 0; i != statements_.size(); ++i)
+            {
+                body.push_back(statements_[i]);
+                for (auto const& name : released[i])
+                {
+                    body.push_back(store(name, code_.nil()));
+                }
+            }
+
+            if (body.empty())
+            {
+                return std::move(result);
+            }
+
+            body.push_back(std::move(result));
+            return code_.call("block", std::move(body));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        ast::expression gradient_generator::operator()(
+            std::vector<ast::expression> const& args,
+            ast::expression const& body, std::vector<std::string> const& wrt,
+            bool return_list)
+        {
+            for (auto const& arg : args)
+            {
+                if (ast::detail::is_identifier(arg))
+                {
+                    parameters_.insert(ast::detail::identifier_name(arg));
+                }
+            }
+
+            for (auto const& name : wrt)
+            {
+                if (parameters_.find(name) == parameters_.end())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::compiler::generate_gradient",
+                        generate_error_message(hpx::util::format(
+                            "'{}' is not an argument of the differentiated "
+                            "function",
+                            name)));
+                }
+                active_.insert(name);
+            }
+
+            ast::expression result = value(body);
+            backward(result);
+
+            // arguments without any contribution have a zero gradient
+            std::vector<ast::expression> gradients;
+            gradients.reserve(wrt.size());
+            for (auto const& name : wrt)
+            {
+                auto it = adjoints_.find(name);
+                if (it != adjoints_.end())
+                {
+                    gradients.push_back(code_.identifier(it->second));
+                }
+                else
+                {
+                    gradients.push_back(code_.call("constant_like",
+                        {code_.literal(0.0), code_.identifier(name)}));
+                }
+            }
+
+            if (!return_list && gradients.size() == 1)
+            {
+                return release_temporaries(std::move(gradients[0]));
+            }
+            return release_temporaries(
+                code_.call("list", std::move(gradients)));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ast::expression generate_gradient(std::vector<ast::expression> const& args,
+        ast::expression const& body, std::vector<std::string> const& wrt,
+        bool return_list, pattern_index const& patterns,
+        std::string const& codename, ast::tagged const& id)
+    {
+        return detail::gradient_generator(patterns, codename, id)(
+            args, body, wrt, return_list);
+    }
+}}}
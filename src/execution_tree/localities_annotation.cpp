@@ -20,6 +20,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -126,12 +127,40 @@ namespace phylanx { namespace execution_tree
             }
         }
 
-        // make sure the tile information matches the dimensions of the given
-        // array
+        check_dimensions(arg, name, codename);
+    }
+
+    localities_information::localities_information(std::size_t dim,
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims)
+    {
+        static std::atomic<std::size_t> count(0);
+
+        locality_ = locality_information(0, 1);
+        annotation_ = annotation_information(
+            hpx::util::format(
+                "annotation_{}_{}", hpx::get_locality_id(), ++count),
+            0ll);
+        tiles_.emplace_back(dim, dims);
+    }
+
+    void localities_information::check_dimensions(
+        primitive_argument_type const& arg, std::string const& name,
+        std::string const& codename) const
+    {
+        std::size_t dim = 0;
+        for (auto const& tile : tiles_)
+        {
+            if (tile.spans_[0].is_valid() ||
+                (tile.spans_.size() > 1 && tile.spans_[1].is_valid()))
+            {
+                dim = tile.dimension();
+            }
+        }
+
         if (extract_numeric_value_dimension(arg, name, codename) != dim)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "localities_information::localities_information",
+                "localities_information::check_dimensions",
                 util::generate_error_message(
                     "inconsistent dimensionalities between data and "
                     "tile information", name, codename));
@@ -141,43 +170,55 @@ namespace phylanx { namespace execution_tree
             dimensions(name, codename))
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "localities_information::localities_information",
+                "localities_information::check_dimensions",
                 util::generate_error_message(
                     "inconsistent dimensionalities between data and "
                     "tile information", name, codename));
         }
     }
 
-    localities_information::localities_information(std::size_t dim,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims)
-    {
-        static std::atomic<std::size_t> count(0);
-
-        locality_ = locality_information(0, 1);
-        annotation_ = annotation_information(
-            hpx::util::format(
-                "annotation_{}_{}", hpx::get_locality_id(), ++count),
-            0ll);
-        tiles_.emplace_back(dim, dims);
-    }
-
     ////////////////////////////////////////////////////////////////////////////
-    localities_information extract_localities_information(
+    std::shared_ptr<localities_information const> get_localities_information(
         primitive_argument_type const& arg,
         std::string const& name, std::string const& codename)
     {
+        auto const& ann = arg.annotation();
+        if (ann)
+        {
+            // reuse the tiling information if it was parsed before
+            auto info = ann->cached_localities_information();
+            if (info)
+            {
+                info->check_dimensions(arg, name, codename);
+                return info;
+            }
+        }
+
         annotation localities;
         if (!arg.get_annotation_if("localities", localities, name, codename) &&
             !arg.find_annotation("localities", localities, name, codename))
         {
+            // arrays that are not tiled get a new (unique) name every time
+            // the information is requested, so it can't be cached
             std::size_t dim = extract_numeric_value_dimension(
                 arg, name, codename);
             auto dims = extract_numeric_value_dimensions(
                 arg, name, codename);
 
-            return localities_information(dim, dims);
+            return std::make_shared<localities_information const>(dim, dims);
         }
-        return localities_information(arg, localities, name, codename);
+
+        auto info = std::make_shared<localities_information const>(
+            arg, localities, name, codename);
+        ann->cache_localities_information(info);
+        return info;
+    }
+
+    localities_information extract_localities_information(
+        primitive_argument_type const& arg,
+        std::string const& name, std::string const& codename)
+    {
+        return *get_localities_information(arg, name, codename);
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             operands_[0] =
                 extract_copy_value(std::move(operands_[0]), name_, codename_);
         }
+
+        // operands_[1] is the location of the function as resolved by the
+        // compiler
+        if (operands_.size() > 1)
+        {
+            slot_ = extract_variable_slot(operands_[1], name_, codename_);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -67,7 +74,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto const* target = ctx.get_var(target_name_);
+        auto const* target = ctx.get_var(target_name_, slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -119,7 +126,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -152,7 +159,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
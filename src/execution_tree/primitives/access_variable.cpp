@@ -37,16 +37,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
       : primitive_component_base(std::move(operands), name, codename, true)
       , target_name_(compiler::extract_instance_name(name_))
     {
-        // operands_[0] is expected to be the actual variable, operands_[1],
-        // operands_[2] and operands_[3] are optional slicing arguments
+        // operands_[0] is expected to be the actual variable, operands_[1]
+        // is the location of the variable as resolved by the compiler,
+        // operands_[2], operands_[3] and operands_[4] are optional slicing
+        // arguments
 
-        if (operands_.empty() || operands_.size() > 4)
+        if (operands_.size() < 2 || operands_.size() > 5)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "access_variable::access_variable",
                 generate_error_message(
-                    "the access_variable primitive requires at least one "
-                    "and at most four operands"));
+                    "the access_variable primitive requires at least two "
+                    "and at most five operands"));
         }
 
         if (valid(operands_[0]))
@@ -54,6 +56,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             operands_[0] =
                 extract_copy_value(std::move(operands_[0]), name_, codename_);
         }
+
+        slot_ = extract_variable_slot(operands_[1], name_, codename_);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -71,7 +75,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto const* target = ctx.get_var(target_name_);
+        auto const* target = ctx.get_var(target_name_, slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -86,11 +90,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         // parameters as variable evaluation can't depend on those anyways
         switch (operands_.size())
         {
-        case 2:
+        case 3:
             {
                 // one slicing parameter
                 auto this_ = this->shared_from_this();
-                return value_operand(operands_[1], params, name_, codename_, ctx)
+                return value_operand(operands_[2], params, name_, codename_, ctx)
                     .then(hpx::launch::sync,
                         [this_ = std::move(this_), ctx, target = *target](
                                 hpx::future<primitive_argument_type>&& rows)
@@ -104,7 +108,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         });
             }
 
-        case 3:
+        case 4:
             {
                 // two slicing parameters
                 auto this_ = this->shared_from_this();
@@ -125,11 +129,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 eval_dont_wrap_functions|eval_slicing)),
                                 eval_dont_evaluate_partials));
                     },
-                    value_operand(operands_[1], params, name_, codename_, ctx),
-                    value_operand(operands_[2], params, name_, codename_, ctx));
+                    value_operand(operands_[2], params, name_, codename_, ctx),
+                    value_operand(operands_[3], params, name_, codename_, ctx));
             }
 
-        case 4:
+        case 5:
             {
                 // three slicing parameters
                 auto this_ = this->shared_from_this();
@@ -152,9 +156,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             eval_dont_wrap_functions|eval_slicing)),
                             eval_dont_evaluate_partials));
                     },
-                    value_operand(operands_[1], params, name_, codename_, ctx),
                     value_operand(operands_[2], params, name_, codename_, ctx),
-                    value_operand(operands_[3], params, name_, codename_, ctx));
+                    value_operand(operands_[3], params, name_, codename_, ctx),
+                    value_operand(operands_[4], params, name_, codename_, ctx));
             }
 
         default:
@@ -189,7 +193,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -202,12 +206,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         // handle slicing, simply append the slicing parameters to the end of
         // the argument list
-        if (operands_.size() > 1)
+        if (operands_.size() > 2)
         {
             ctx = add_mode(std::move(ctx), eval_slicing);
         }
 
-        for (auto it = operands_.begin() + 1; it != operands_.end(); ++it)
+        for (auto it = operands_.begin() + 2; it != operands_.end(); ++it)
         {
             vals.emplace_back(extract_ref_value(*it, name_, codename_));
         }
@@ -234,7 +238,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -245,15 +249,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         target_name_), std::move(ctx)));
         }
 
-        if (operands_.size() > 1)
+        if (operands_.size() > 2)
         {
             // handle slicing, simply append the slicing parameters to the end of
             // the argument list
             primitive_arguments_type vals;
-            vals.reserve(operands_.size());
+            vals.reserve(operands_.size() - 1);
             vals.emplace_back(std::move(val));
 
-            for (auto it = operands_.begin() + 1; it != operands_.end(); ++it)
+            for (auto it = operands_.begin() + 2; it != operands_.end(); ++it)
             {
                 vals.emplace_back(extract_ref_value(*it, name_, codename_));
             }
@@ -21,6 +21,7 @@
 #include <hpx/include/actions.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/components.hpp>
+#include <hpx/include/naming.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/include/sync.hpp>
 #include <hpx/modules/logging.hpp>
@@ -60,7 +61,8 @@ namespace phylanx { namespace execution_tree
             "phylanx::execution_tree::primitive",
             "hpx::shared_future<phylanx::execution_tree::primitive_argument_type>",
             "phylanx::ir::range",
-            "phylanx::ir::dictionary"
+            "phylanx::ir::dictionary",
+            "phylanx::ir::node_data<float>"
         };
 
         char const* get_primitive_argument_type_name(std::size_t index)
@@ -136,11 +138,30 @@ namespace phylanx { namespace execution_tree
         {
             this->base_type::register_as(name).get();
         }
+
+        // resolve components created on this locality once, this allows for
+        // local evaluations to bypass the action machinery
+        if (primitives::primitive_component::enable_local_eval())
+        {
+            hpx::id_type const& id = this->base_type::get_id();
+            if (hpx::naming::get_locality_id_from_id(id) ==
+                hpx::get_locality_id())
+            {
+                local_ = hpx::get_ptr<primitives::primitive_component>(
+                    hpx::launch::sync, id);
+            }
+        }
     }
 
     hpx::future<primitive_argument_type> primitive::eval(
         primitive_arguments_type const& params, eval_context ctx) const
     {
+        if (local_)
+        {
+            return detail::lazy_trace(
+                "eval", *this, local_->eval_local(params, std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::unwrap_result(this->base_type::get_id()), params,
@@ -150,6 +171,12 @@ namespace phylanx { namespace execution_tree
     hpx::future<primitive_argument_type> primitive::eval(
         primitive_arguments_type&& params, eval_context ctx) const
     {
+        if (local_)
+        {
+            return detail::lazy_trace("eval", *this,
+                local_->eval_local(std::move(params), std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::unwrap_result(this->base_type::get_id()), std::move(params),
@@ -160,6 +187,12 @@ namespace phylanx { namespace execution_tree
     hpx::future<primitive_argument_type> primitive::eval(
         primitive_argument_type && param, eval_context ctx) const
     {
+        if (local_)
+        {
+            return detail::lazy_trace("eval", *this,
+                local_->eval_local(std::move(param), std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::eval_single_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::unwrap_result(this->base_type::get_id()), std::move(param),
@@ -176,6 +209,12 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         primitive_arguments_type const& params, eval_context ctx) const
     {
+        if (local_)
+        {
+            return detail::trace("eval", *this,
+                local_->eval(params, std::move(ctx)).get());
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::launch::sync, hpx::unwrap_result(this->base_type::get_id()),
@@ -185,6 +224,12 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         primitive_arguments_type&& params, eval_context ctx) const
     {
+        if (local_)
+        {
+            return detail::trace("eval", *this,
+                local_->eval(params, std::move(ctx)).get());
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::launch::sync, hpx::unwrap_result(this->base_type::get_id()),
@@ -195,6 +240,12 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         primitive_argument_type && param, eval_context ctx) const
     {
+        if (local_)
+        {
+            return detail::trace("eval", *this,
+                local_->eval_single(std::move(param), std::move(ctx)).get());
+        }
+
         using action_type = primitives::primitive_component::eval_single_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::launch::sync, hpx::unwrap_result(this->base_type::get_id()),
@@ -207,6 +258,12 @@ namespace phylanx { namespace execution_tree
     {
         using action_type = primitives::primitive_component::eval_action;
         static primitive_arguments_type params;
+        if (local_)
+        {
+            return detail::trace("eval", *this,
+                local_->eval(params, std::move(ctx)).get());
+        }
+
         hpx::future<primitive_argument_type> f = hpx::sync<action_type>(
             this->base_type::get_id(), std::move(params), std::move(ctx));
         return detail::trace("eval", *this, f.get());
@@ -441,6 +498,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -497,6 +555,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{v, val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto const& args = util::get<7>(val);
@@ -614,6 +683,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
         default:
             break;
         }
@@ -645,6 +725,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
             return std::move(val);
@@ -709,6 +790,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto&& v = util::get<9>(std::move(val));
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{std::move(v), val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto ann = val.annotation();
@@ -779,6 +871,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -813,6 +906,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).is_ref();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).is_ref();
+
         case primitive_argument_type::list_index:
             return util::get<7>(val).is_ref();
 
@@ -852,6 +948,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
             return val;
@@ -909,6 +1006,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto const& r = util::get<7>(val);
@@ -960,6 +1068,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
             return std::move(val);
@@ -992,7 +1101,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index:
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
             return true;
 
         case primitive_argument_type::future_index:
@@ -1023,6 +1133,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).ref();
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(val).ref()};
+
         case primitive_argument_type::future_index:
             return extract_numeric_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1092,6 +1205,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(std::move(val));
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(std::move(val))};
+
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
             val = f.get();
@@ -1137,6 +1253,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(val)[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(val)[0];
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_numeric_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1215,6 +1336,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(std::move(val))[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(std::move(val))[0];
+            break;
+
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
             val = f.get();
@@ -1318,7 +1444,8 @@ namespace phylanx { namespace execution_tree
         {
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index:
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
             return true;
 
         case primitive_argument_type::future_index:
@@ -1373,6 +1500,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).num_dimensions();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).num_dimensions();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_dimension(
                 util::get<6>(val).get().get(), name, codename);
@@ -1410,6 +1540,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).size();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).size();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_size(
                 util::get<6>(val).get().get(), name, codename);
@@ -1447,6 +1580,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).dimensions();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).dimensions();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_dimensions(
                 util::get<6>(val).get().get(), name, codename);
@@ -1469,6 +1605,295 @@ namespace phylanx { namespace execution_tree
                 name, codename));
     }
 
+    bool is_sparse_operand(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return util::get<1>(val).is_sparse();
+
+        case primitive_argument_type::int64_index:
+            return util::get<2>(val).is_sparse();
+
+        case primitive_argument_type::float64_index:
+            return util::get<4>(val).is_sparse();
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).is_sparse();
+
+        case primitive_argument_type::future_index:
+            return is_sparse_operand(util::get<6>(val).get().get());
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<float> extract_float_value(
+        primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return ir::node_data<float>{util::get<1>(val).ref()};
+
+        case primitive_argument_type::int64_index:
+            return ir::node_data<float>{util::get<2>(val).ref()};
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<float>{util::get<4>(val).ref()};
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).ref();
+
+        case primitive_argument_type::future_index:
+            return extract_float_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a numeric "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float> extract_float_value(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return ir::node_data<float>{util::get<1>(std::move(val))};
+
+        case primitive_argument_type::int64_index:
+            return ir::node_data<float>{util::get<2>(std::move(val))};
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<float>{util::get<4>(std::move(val))};
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(std::move(val));
+
+        case primitive_argument_type::future_index: {
+            auto f = util::get<6>(val).get();
+            val = f.get();
+            return extract_float_value(std::move(val), name, codename);
+        }
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a numeric "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float> extract_float_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).ref();
+
+        case primitive_argument_type::future_index:
+            return extract_float_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a single precision "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float>&& extract_float_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(std::move(val));
+
+        case primitive_argument_type::future_index: {
+            auto f = util::get<6>(val).get();
+            val = f.get();
+            return extract_float_value_strict(std::move(val), name, codename);
+        }
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a single precision "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    float extract_scalar_float_value(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            if (util::get<1>(val).num_dimensions() == 0)
+                return float(util::get<1>(val)[0]);
+            break;
+
+        case primitive_argument_type::int64_index:
+            if (util::get<2>(val).num_dimensions() == 0)
+                return float(util::get<2>(val)[0]);
+            break;
+
+        case primitive_argument_type::float64_index:
+            if (util::get<4>(val).num_dimensions() == 0)
+                return float(util::get<4>(val)[0]);
+            break;
+
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(val)[0];
+            break;
+
+        case primitive_argument_type::future_index:
+            return extract_scalar_float_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_scalar_float_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a floating point "
+                "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    float extract_scalar_float_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(val)[0];
+            break;
+
+        case primitive_argument_type::future_index:
+            return extract_scalar_float_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_scalar_float_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a single precision "
+                "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    bool is_float_operand_strict(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return true;
+
+        case primitive_argument_type::future_index:
+            return is_float_operand_strict(util::get<6>(val).get().get());
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return false;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool is_boolean_data_operand(primitive_argument_type const& val)
     {
@@ -1484,6 +1909,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1509,6 +1935,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::int64_t>(util::get<4>(val).ref());
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int64_t>(util::get<9>(val).ref());
+
         case primitive_argument_type::future_index:
             return extract_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1546,6 +1975,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::int64_t>(util::get<4>(std::move(val)));
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int64_t>(util::get<9>(std::move(val)));
+
         case primitive_argument_type::future_index:
             return extract_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1589,6 +2021,11 @@ namespace phylanx { namespace execution_tree
                 return std::int64_t(util::get<4>(val)[0]);
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(val)[0]);
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1633,6 +2070,11 @@ namespace phylanx { namespace execution_tree
                 return std::int64_t(util::get<4>(std::move(val))[0]);
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(std::move(val))[0]);
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1656,13 +2098,37 @@ namespace phylanx { namespace execution_tree
                 name, codename));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type variable_slot_operand(variable_slot const& slot)
+    {
+        return primitive_argument_type{ir::node_data<std::int64_t>{
+            blaze::DynamicVector<std::int64_t>{slot.depth_, slot.index_}}};
+    }
+
+    variable_slot extract_variable_slot(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        auto slot = extract_integer_value_strict(val, name, codename);
+        if (slot.num_dimensions() != 1 || slot.size() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::extract_variable_slot",
+                util::generate_error_message(
+                    "the location of a variable must be represented by a "
+                    "vector of two integers",
+                    name, codename));
+        }
+        return variable_slot{slot[0], slot[1]};
+    }
+
     bool is_integer_operand(primitive_argument_type const& val)
     {
         switch (val.index())
         {
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index:
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
             return true;
 
         case primitive_argument_type::future_index:
@@ -1699,6 +2165,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1734,6 +2201,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1768,6 +2236,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1803,6 +2272,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1833,6 +2303,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1984,6 +2455,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::uint8_t>{util::get<4>(val).ref()};
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::uint8_t>{util::get<9>(val).ref()};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2015,6 +2489,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2047,6 +2522,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::uint8_t>{util::get<4>(std::move(val))};
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::uint8_t>{util::get<9>(std::move(val))};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
@@ -2079,6 +2557,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2115,6 +2594,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return bool(util::get<4>(val));
 
+        case primitive_argument_type::float32_index:
+            return bool(util::get<9>(val));
+
         case primitive_argument_type::list_index:
             return !(util::get<7>(val).empty());
 
@@ -2154,6 +2636,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return bool(util::get<4>(std::move(val)));
 
+        case primitive_argument_type::float32_index:
+            return bool(util::get<9>(std::move(val)));
+
         case primitive_argument_type::list_index:
             return !(util::get<7>(std::move(val)).empty());
 
@@ -2188,6 +2673,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
@@ -2218,6 +2704,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
@@ -2244,6 +2731,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index:
             return true;
 
@@ -2268,6 +2756,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2292,6 +2781,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2321,6 +2811,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2349,6 +2840,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2371,6 +2863,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2400,6 +2893,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2428,6 +2922,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2454,6 +2949,10 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return {ast::expression(util::get<4>(val))};
 
+        case primitive_argument_type::float32_index:
+            return {ast::expression(
+                ir::node_data<double>{util::get<9>(val)})};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
@@ -2488,6 +2987,10 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return {ast::expression(util::get<4>(std::move(val)))};
 
+        case primitive_argument_type::float32_index:
+            return {ast::expression(
+                ir::node_data<double>{util::get<9>(std::move(val))})};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
@@ -2533,6 +3036,10 @@ namespace phylanx { namespace execution_tree
             return primitive_arguments_type{primitive_argument_type{
                 util::get<4>(val).ref(), val.annotation()}};
 
+        case primitive_argument_type::float32_index:
+            return primitive_arguments_type{primitive_argument_type{
+                util::get<9>(val).ref(), val.annotation()}};
+
         case primitive_argument_type::list_index:
             return util::get<7>(val);
 
@@ -2560,6 +3067,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -2590,6 +3098,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2616,6 +3125,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2645,6 +3155,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2675,6 +3186,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2703,6 +3215,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2724,6 +3237,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2741,6 +3255,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
             return true;
 
@@ -2768,6 +3283,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2797,6 +3313,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2834,6 +3351,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -2873,6 +3392,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -2912,6 +3433,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -2949,6 +3472,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -4453,6 +4978,10 @@ namespace phylanx { namespace execution_tree
             ast::detail::to_string{os}(util::get<4>(val));
             break;
 
+        case primitive_argument_type::float32_index:
+            ast::detail::to_string{os}(util::get<9>(val));
+            break;
+
         case primitive_argument_type::primitive_index:
             break;
 
@@ -4585,6 +5114,10 @@ namespace std
             return phylanx::execution_tree::hash_node_data_zero_dim_value(
                 phylanx::util::get<4>(val));
 
+        case primitive_argument_type::float32_index:
+            return phylanx::execution_tree::hash_node_data_zero_dim_value(
+                phylanx::util::get<9>(val));
+
         case primitive_argument_type::future_index:
             return (*this)(phylanx::util::get<6>(val).get().get());
 
@@ -105,13 +105,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
       , define_globally_(detail::extract_define_variable_type(
             compiler::extract_primitive_name(name_)))
     {
-        // body is assumed to be operands_[0]
-        if (operands_.size() != 1)
+        // body is assumed to be operands_[0], operands_[1] is the (optional)
+        // location of the variable as resolved by the compiler
+        if (operands_.empty() || operands_.size() > 2)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "define_variable::define_variable",
                 generate_error_message("the define_variable primitive requires "
-                    "exactly one operand"));
+                    "one or two operands"));
+        }
+
+        if (operands_.size() == 2)
+        {
+            slot_ = extract_variable_slot(operands_[1], name_, codename_);
         }
 
         // try to bind to the factory object locally
@@ -153,7 +159,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     // store the variable in the evaluation context
                     auto& result = ctx.set_var(this_->target_name_,
-                        std::move(var), this_->define_globally_);
+                        this_->slot_, std::move(var), this_->define_globally_);
 
                     // return a reference to this variable
                     return extract_ref_value(result, this_->name_,
@@ -174,7 +180,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // store the variable in the evaluation context
-        auto& result = ctx.set_var(target_name_, std::move(var));
+        auto& result = ctx.set_var(
+            target_name_, slot_, std::move(var), define_globally_);
 
         // return a reference to this variable
         return hpx::make_ready_future(
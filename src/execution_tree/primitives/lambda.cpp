@@ -99,7 +99,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             eval_mode(eval_dont_evaluate_lambdas | eval_dont_wrap_functions));
 
         return value_operand(operands_[0], args, name_, codename_,
-            add_frame(std::move(next_ctx), name_, codename_));
+            add_frame(std::move(next_ctx), name_, codename_, num_slots_));
     }
 
     void lambda::store(primitive_arguments_type&& data,
@@ -138,6 +138,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             operands_[0] = std::move(data[0]);
         }
+
+        // data[1] (if given) is the number of variables the compiler has
+        // assigned a slot in the frame of this function
+        if (data.size() > 1)
+        {
+            num_slots_ = static_cast<std::size_t>(
+                extract_scalar_integer_value_strict(data[1], name_, codename_));
+        }
     }
 
     topology lambda::expression_topology(std::set<std::string>&& functions,
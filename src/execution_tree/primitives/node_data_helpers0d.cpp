@@ -35,6 +35,10 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_int64;
         }
+        else if (spec == "float32")
+        {
+            result = node_data_type_float;
+        }
         else if (spec.find("float") == 0)
         {
             result = node_data_type_double;
@@ -66,6 +70,10 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_double;
         }
+        else if (is_float_operand_strict(arg))
+        {
+            result = node_data_type_float;
+        }
         else if (is_integer_operand_strict(arg))
         {
             result = node_data_type_int64;
@@ -89,6 +97,10 @@ namespace phylanx { namespace execution_tree
                 result = node_data_type_double;
                 break;
             }
+            else if (is_float_operand_strict(arg))
+            {
+                result = node_data_type_float;
+            }
             else if (is_integer_operand_strict(arg) &&
                 (result == node_data_type_unknown ||
                     result == node_data_type_bool))
@@ -354,6 +366,9 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_scalar<std::uint8_t>(primitive_argument_type const& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_scalar<double>(primitive_argument_type&& val,
@@ -364,4 +379,7 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_scalar<std::uint8_t>(primitive_argument_type&& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename);
 }}
@@ -248,6 +248,10 @@ namespace phylanx { namespace execution_tree
     extract_value_matrix<std::uint8_t>(primitive_argument_type const& val,
         std::size_t rows, std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_matrix<float>(primitive_argument_type const& val,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double> extract_value_matrix<double>(
         primitive_argument_type&& val, std::size_t rows, std::size_t columns,
@@ -260,4 +264,8 @@ namespace phylanx { namespace execution_tree
     extract_value_matrix<std::uint8_t>(primitive_argument_type&& val,
         std::size_t rows, std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_matrix<float>(primitive_argument_type&& val,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
 }}
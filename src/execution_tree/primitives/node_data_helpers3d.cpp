@@ -342,6 +342,10 @@ namespace phylanx { namespace execution_tree
     extract_value_tensor<std::uint8_t>(primitive_argument_type const& val,
         std::size_t pages, std::size_t rows, std::size_t columns,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_tensor<float>(primitive_argument_type const& val,
+        std::size_t pages, std::size_t rows, std::size_t columns,
+        std::string const& name, std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_tensor<double>(primitive_argument_type&& val,
@@ -355,5 +359,9 @@ namespace phylanx { namespace execution_tree
     extract_value_tensor<std::uint8_t>(primitive_argument_type&& val,
         std::size_t pages, std::size_t rows, std::size_t columns,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_tensor<float>(primitive_argument_type&& val,
+        std::size_t pages, std::size_t rows, std::size_t columns,
+        std::string const& name, std::string const& codename);
 }}
 
@@ -53,15 +53,20 @@ namespace phylanx { namespace execution_tree
     void variable_frame::serialize(
         hpx::serialization::output_archive& ar, unsigned)
     {
+        // the slots refer to the map, they are re-established while the
+        // variables are being re-defined
+        std::uint64_t num_slots = slots_.size();
         int lang = static_cast<int>(lang_);
-        ar & variables_ & lang & name_ & codename_;
+        ar & num_slots & variables_ & lang & name_ & codename_;
     }
 
     void variable_frame::serialize(
         hpx::serialization::input_archive& ar, unsigned)
     {
+        std::uint64_t num_slots = 0;
         int lang = 0;
-        ar & variables_ & lang & name_ & codename_;
+        ar & num_slots & variables_ & lang & name_ & codename_;
+        slots_.assign(num_slots, nullptr);
         lang_ = static_cast<language>(lang);
     }
 
@@ -9,15 +9,18 @@
 #include <phylanx/execution_tree/primitives/primitive_component.hpp>
 
 #include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
 #include <hpx/include/components.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/modules/naming.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <map>
 #include <memory>
 #include <set>
@@ -138,6 +141,95 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_->do_eval(std::move(param), std::move(ctx));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> primitive_component::eval_local(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        hpx::launch policy = select_local_execution();
+        if (policy == hpx::launch::sync ||
+            ((ctx.mode_ & eval_dont_evaluate_partials) &&
+                primitive_->no_operands()))
+        {
+            // deliver exceptions through the returned future, as the eval
+            // actions do
+            try
+            {
+                return eval(params, std::move(ctx));
+            }
+            catch (...)
+            {
+                return hpx::make_exceptional_future<primitive_argument_type>(
+                    std::current_exception());
+            }
+        }
+
+        // keep the primitive alive until the new thread has run
+        return hpx::future<primitive_argument_type>(hpx::async(policy,
+            [p = primitive_, params, ctx = std::move(ctx)]() mutable
+            {
+                return p->do_eval(params, std::move(ctx));
+            }));
+    }
+
+    hpx::future<primitive_argument_type> primitive_component::eval_local(
+        primitive_arguments_type&& params, eval_context ctx) const
+    {
+        hpx::launch policy = select_local_execution();
+        if (policy == hpx::launch::sync ||
+            ((ctx.mode_ & eval_dont_evaluate_partials) &&
+                primitive_->no_operands()))
+        {
+            // deliver exceptions through the returned future, as the eval
+            // actions do
+            try
+            {
+                return eval(params, std::move(ctx));
+            }
+            catch (...)
+            {
+                return hpx::make_exceptional_future<primitive_argument_type>(
+                    std::current_exception());
+            }
+        }
+
+        // the arguments are moved into the new thread instead of being copied
+        return hpx::future<primitive_argument_type>(hpx::async(policy,
+            [p = primitive_, params = std::move(params),
+                ctx = std::move(ctx)]() mutable
+            {
+                return p->do_eval(params, std::move(ctx));
+            }));
+    }
+
+    hpx::future<primitive_argument_type> primitive_component::eval_local(
+        primitive_argument_type && param, eval_context ctx) const
+    {
+        hpx::launch policy = select_local_execution();
+        if (policy == hpx::launch::sync ||
+            ((ctx.mode_ & eval_dont_evaluate_partials) &&
+                primitive_->no_operands()))
+        {
+            // deliver exceptions through the returned future, as the eval
+            // actions do
+            try
+            {
+                return eval_single(std::move(param), std::move(ctx));
+            }
+            catch (...)
+            {
+                return hpx::make_exceptional_future<primitive_argument_type>(
+                    std::current_exception());
+            }
+        }
+
+        return hpx::future<primitive_argument_type>(hpx::async(policy,
+            [p = primitive_, param = std::move(param),
+                ctx = std::move(ctx)]() mutable
+            {
+                return p->do_eval(std::move(param), std::move(ctx));
+            }));
+    }
+
     // store_action
     void primitive_component::store(primitive_arguments_type&& args,
         primitive_arguments_type&& params, eval_context ctx)
@@ -188,6 +280,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_->get_transferred_bytes(reset);
     }
 
+    std::int64_t primitive_component::get_copied_bytes(bool reset) const
+    {
+        return primitive_->get_copied_bytes(reset);
+    }
+
+    std::int64_t primitive_component::get_moved_bytes(bool reset) const
+    {
+        return primitive_->get_moved_bytes(reset);
+    }
+
+    std::int64_t primitive_component::get_reused_bytes(bool reset) const
+    {
+        return primitive_->get_reused_bytes(reset);
+    }
+
     void primitive_component::enable_measurements()
     {
         primitive_->enable_measurements();
@@ -217,6 +324,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return this_->primitive_->select_direct_eval_execution(policy);
 #endif
     }
+
+    // make the same decision as select_direct_execution above for local
+    // evaluations that don't go through an action
+    hpx::launch primitive_component::select_local_execution() const
+    {
+#if defined(PHYLANX_HAVE_TASK_INLINING_POLICY) && defined(HPX_HAVE_APEX)
+        return primitive_->select_direct_eval_policy_thres(hpx::launch::async);
+#else
+        return primitive_->select_direct_eval_execution(hpx::launch::async);
+#endif
+    }
+
+    bool primitive_component::enable_local_eval()
+    {
+        static bool local_eval =
+            hpx::get_config_entry("phylanx.direct_local_eval", "1") == "1";
+        return local_eval;
+    }
 }}}
 
 namespace phylanx { namespace execution_tree
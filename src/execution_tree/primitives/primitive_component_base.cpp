@@ -115,6 +115,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ++eval_count_;
         }
 
+        // attribute the node_data copies made while evaluating to this
+        // primitive
+        ir::node_data_bytes_scope bytes_scope(
+            measurements_enabled_ ? &node_data_bytes_ : nullptr);
+
         auto f = this->eval(params, std::move(ctx));
 
         if (enable_timer && !f.is_ready())
@@ -147,6 +152,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ++eval_count_;
         }
 
+        // attribute the node_data copies made while evaluating to this
+        // primitive
+        ir::node_data_bytes_scope bytes_scope(
+            measurements_enabled_ ? &node_data_bytes_ : nullptr);
+
         auto f = this->eval(std::move(param), std::move(ctx));
 
         if (enable_timer && !f.is_ready())
@@ -308,6 +318,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return 0;
     }
 
+    std::int64_t primitive_component_base::get_copied_bytes(bool reset) const
+    {
+        return hpx::util::get_and_reset_value(node_data_bytes_.copied_, reset);
+    }
+
+    std::int64_t primitive_component_base::get_moved_bytes(bool reset) const
+    {
+        return hpx::util::get_and_reset_value(node_data_bytes_.moved_, reset);
+    }
+
+    std::int64_t primitive_component_base::get_reused_bytes(bool reset) const
+    {
+        return hpx::util::get_and_reset_value(node_data_bytes_.reused_, reset);
+    }
+
     void primitive_component_base::enable_measurements()
     {
         measurements_enabled_ = true;
@@ -11,6 +11,7 @@
 #include <phylanx/execution_tree/primitives/slice_node_data_1d.hpp>
 #include <phylanx/execution_tree/primitives/slice_node_data_2d.hpp>
 #include <phylanx/execution_tree/primitives/slice_node_data_3d.hpp>
+#include <phylanx/execution_tree/primitives/slice_node_data_sparse.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 
@@ -35,6 +36,18 @@ namespace phylanx { namespace execution_tree
         std::string const& name, std::string const& codename,
         eval_context ctx)
     {
+        if (data.is_sparse())
+        {
+            if (detail::is_basic_sparse_index(indices, name, codename))
+            {
+                return slice_extract_sparse(data, indices,
+                    execution_tree::primitive_argument_type{}, name, codename,
+                    ctx);
+            }
+            return slice_extract(detail::sparse_to_dense(data), indices, name,
+                codename, std::move(ctx));
+        }
+
         switch (data.num_dimensions())
         {
         case 0:
@@ -93,6 +106,18 @@ namespace phylanx { namespace execution_tree
         std::string const& name, std::string const& codename,
         eval_context ctx)
     {
+        if (data.is_sparse())
+        {
+            if (detail::is_basic_sparse_index(rows, name, codename) &&
+                detail::is_basic_sparse_index(columns, name, codename))
+            {
+                return slice_extract_sparse(
+                    data, rows, columns, name, codename, ctx);
+            }
+            return slice_extract(detail::sparse_to_dense(data), rows, columns,
+                name, codename, std::move(ctx));
+        }
+
         switch (data.num_dimensions())
         {
         case 1:
@@ -16,6 +16,7 @@
 #include <hpx/include/serialization.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/threading_base.hpp>
 
 #include <atomic>
 #include <cmath>
@@ -98,6 +99,120 @@ namespace phylanx { namespace ir
         return hpx::util::get_and_reset_value(count_move_assignments_, reset);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The node_data_bytes instance the bytes are attributed to is stored as
+    // the thread data of the current HPX thread
+    namespace detail
+    {
+        node_data_bytes* get_node_data_bytes()
+        {
+            if (hpx::threads::get_self_ptr() == nullptr)
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<node_data_bytes*>(
+                hpx::threads::get_thread_data(hpx::threads::get_self_id()));
+        }
+
+        void set_node_data_bytes(node_data_bytes* bytes)
+        {
+            hpx::threads::set_thread_data(hpx::threads::get_self_id(),
+                reinterpret_cast<std::size_t>(bytes));
+        }
+
+        void count_bytes(std::atomic<std::int64_t> node_data_bytes::*which,
+            std::size_t bytes)
+        {
+            if (enable_counts_.load(std::memory_order_relaxed))
+            {
+                node_data_bytes* p = get_node_data_bytes();
+                if (p != nullptr)
+                {
+                    (p->*which) += static_cast<std::int64_t>(bytes);
+                }
+            }
+        }
+
+        // number of bytes occupied by the elements, sparse data holds the
+        // non-zero elements and their (column) indices, sparse matrices in
+        // addition the offsets of the rows
+        template <typename T>
+        std::size_t data_bytes(node_data<T> const& d)
+        {
+            switch (d.index())
+            {
+            case node_data<T>::sparse_storage1d: HPX_FALLTHROUGH;
+            case node_data<T>::custom_sparse_storage1d:
+                return d.sparse_vector().nonZeros() *
+                    (sizeof(T) + sizeof(std::size_t));
+
+            case node_data<T>::sparse_storage2d: HPX_FALLTHROUGH;
+            case node_data<T>::custom_sparse_storage2d:
+                {
+                    auto const& m = d.sparse_matrix();
+                    return m.nonZeros() * (sizeof(T) + sizeof(std::size_t)) +
+                        (m.rows() + 1) * sizeof(std::size_t);
+                }
+
+            default:
+                break;
+            }
+            return d.size() * sizeof(T);
+        }
+
+        template <typename T>
+        void count_copied_bytes(node_data<T> const& d)
+        {
+            if (enable_counts_.load(std::memory_order_relaxed))
+            {
+                count_bytes(&node_data_bytes::copied_, data_bytes(d));
+            }
+        }
+
+        template <typename T>
+        void count_moved_bytes(node_data<T> const& d)
+        {
+            if (enable_counts_.load(std::memory_order_relaxed))
+            {
+                count_bytes(&node_data_bytes::moved_, data_bytes(d));
+            }
+        }
+    }
+
+    node_data_bytes_scope::node_data_bytes_scope(node_data_bytes* bytes)
+      : previous_(nullptr)
+      , installed_(bytes != nullptr && hpx::threads::get_self_ptr() != nullptr)
+    {
+        if (installed_)
+        {
+            previous_ = detail::get_node_data_bytes();
+            detail::set_node_data_bytes(bytes);
+        }
+    }
+
+    node_data_bytes_scope::~node_data_bytes_scope()
+    {
+        if (installed_)
+        {
+            detail::set_node_data_bytes(previous_);
+        }
+    }
+
+    void count_copied_bytes(std::size_t bytes)
+    {
+        detail::count_bytes(&node_data_bytes::copied_, bytes);
+    }
+
+    void count_moved_bytes(std::size_t bytes)
+    {
+        detail::count_bytes(&node_data_bytes::moved_, bytes);
+    }
+
+    void count_reused_bytes(std::size_t bytes)
+    {
+        detail::count_bytes(&node_data_bytes::reused_, bytes);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// Create node data for a 0-dimensional value
     template <typename T>
@@ -300,6 +415,49 @@ namespace phylanx { namespace ir
         increment_move_construction_count();
     }
 
+    /// Create node data for sparse 1- and 2-dimensional values
+    template <typename T>
+    node_data<T>::node_data(sparse_storage1d_type const& values)
+      : data_(values)
+    {
+        increment_copy_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage1d_type&& values)
+      : data_(std::move(values))
+    {
+        increment_move_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type const& values)
+      : data_(values)
+    {
+        increment_copy_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type&& values)
+      : data_(std::move(values))
+    {
+        increment_move_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(custom_sparse_storage1d_type const& values)
+      : data_(values)
+    {
+        increment_move_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(custom_sparse_storage2d_type const& values)
+      : data_(values)
+    {
+        increment_move_construction_count();
+    }
+
     // conversion helpers for Python bindings and AST parsing
     template <typename T>
     node_data<T>::node_data(std::vector<T> const& values)
@@ -396,6 +554,7 @@ namespace phylanx { namespace ir
         case storage2d:
             {
                 increment_copy_construction_count();
+                detail::count_copied_bytes(d);
                 return d.data_;
             }
             break;
@@ -428,6 +587,7 @@ namespace phylanx { namespace ir
         case storage3d:
             {
                 increment_copy_construction_count();
+                detail::count_copied_bytes(d);
                 return d.data_;
             }
             break;
@@ -441,9 +601,20 @@ namespace phylanx { namespace ir
             }
             break;
 
-        case storage4d:
+        case storage4d: HPX_FALLTHROUGH;
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             {
                 increment_copy_construction_count();
+                detail::count_copied_bytes(d);
+                return d.data_;
+            }
+            break;
+
+        case custom_sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            {
+                increment_move_construction_count();
                 return d.data_;
             }
             break;
@@ -476,6 +647,7 @@ namespace phylanx { namespace ir
       : data_(std::move(d.data_))
     {
         increment_move_construction_count();
+        detail::count_moved_bytes(*this);
     }
 
     template <typename T>
@@ -635,6 +807,39 @@ namespace phylanx { namespace ir
         return *this;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage1d_type const& val)
+    {
+        increment_copy_assignment_count();
+        data_ = val;
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage1d_type && val)
+    {
+        increment_move_assignment_count();
+        data_ = std::move(val);
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type const& val)
+    {
+        increment_copy_assignment_count();
+        data_ = val;
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type && val)
+    {
+        increment_move_assignment_count();
+        data_ = std::move(val);
+        return *this;
+    }
+
     // conversion helpers for Python bindings and AST parsing
     template <typename T>
     node_data<T>& node_data<T>::operator=(std::vector<T> const& values)
@@ -732,6 +937,7 @@ namespace phylanx { namespace ir
         case storage2d:
             {
                 increment_copy_assignment_count();
+                detail::count_copied_bytes(d);
                 return d.data_;
             }
             break;
@@ -765,6 +971,7 @@ namespace phylanx { namespace ir
         case storage3d:
             {
                 increment_copy_assignment_count();
+                detail::count_copied_bytes(d);
                 return d.data_;
             }
             break;
@@ -778,9 +985,20 @@ namespace phylanx { namespace ir
             }
             break;
 
-        case storage4d:
+        case storage4d: HPX_FALLTHROUGH;
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             {
                 increment_copy_assignment_count();
+                detail::count_copied_bytes(d);
+                return d.data_;
+            }
+            break;
+
+        case custom_sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            {
+                increment_move_assignment_count();
                 return d.data_;
             }
             break;
@@ -817,6 +1035,7 @@ namespace phylanx { namespace ir
         if (this != &d)
         {
             increment_move_assignment_count();
+            detail::count_moved_bytes(d);
             data_ = std::move(d.data_);
         }
         return *this;
@@ -1082,6 +1301,17 @@ namespace phylanx { namespace ir
                 return q.quats() * q.pages() * q.rows() * q.columns() ;
             }
 
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d:
+            return sparse_vector().size();
+
+        case sparse_storage2d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return m.rows() * m.columns();
+            }
+
         default:
             break;
         }
@@ -1151,12 +1381,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage4d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage4d_type{*ct};
         }
 
         storage4d_type* t = util::get_if<storage4d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *t;
         }
 
@@ -1172,12 +1404,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage4d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage4d_type{*ct};
         }
 
         storage4d_type const* t = util::get_if<storage4d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *t;
         }
 
@@ -1193,12 +1427,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage4d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage4d_type{*ct};
         }
 
         storage4d_type* t = util::get_if<storage4d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_moved_bytes(*this);
             return std::move(*t);
         }
 
@@ -1214,12 +1450,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage4d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage4d_type{*ct};
         }
 
         storage4d_type const* t = util::get_if<storage4d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *t;
         }
 
@@ -1341,12 +1579,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage3d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage3d_type{*ct};
         }
 
         storage3d_type* t = util::get_if<storage3d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *t;
         }
 
@@ -1362,12 +1602,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage3d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage3d_type{*ct};
         }
 
         storage3d_type const* t = util::get_if<storage3d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *t;
         }
 
@@ -1383,12 +1625,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage3d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage3d_type{*ct};
         }
 
         storage3d_type* t = util::get_if<storage3d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_moved_bytes(*this);
             return std::move(*t);
         }
 
@@ -1404,12 +1648,14 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage3d_type>(&data_);
         if (ct != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage3d_type{*ct};
         }
 
         storage3d_type const* t = util::get_if<storage3d_type>(&data_);
         if (t != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *t;
         }
 
@@ -1530,15 +1776,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage2d_type>(&data_);
         if (cm != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage2d_type{*cm};
         }
 
         storage2d_type* m = util::get_if<storage2d_type>(&data_);
         if (m != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *m;
         }
 
+        // densify sparse data
+        sparse_storage2d_type* sm = sparse_matrix_ptr();
+        if (sm != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage2d_type{*sm};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() &",
             "node_data object holds unsupported data type");
@@ -1551,15 +1807,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage2d_type>(&data_);
         if (cm != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage2d_type{*cm};
         }
 
         storage2d_type const* m = util::get_if<storage2d_type>(&data_);
         if (m != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *m;
         }
 
+        // densify sparse data
+        sparse_storage2d_type const* sm = sparse_matrix_ptr();
+        if (sm != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage2d_type{*sm};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() const&",
             "node_data object holds unsupported data type");
@@ -1572,15 +1838,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage2d_type>(&data_);
         if (cm != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage2d_type{*cm};
         }
 
         storage2d_type* m = util::get_if<storage2d_type>(&data_);
         if (m != nullptr)
         {
+            detail::count_moved_bytes(*this);
             return std::move(*m);
         }
 
+        // densify sparse data
+        sparse_storage2d_type* sm = sparse_matrix_ptr();
+        if (sm != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage2d_type{*sm};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() &&",
             "node_data object holds unsupported data type");
@@ -1593,15 +1869,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage2d_type>(&data_);
         if (cm != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage2d_type{*cm};
         }
 
         storage2d_type const* m = util::get_if<storage2d_type>(&data_);
         if (m != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *m;
         }
 
+        // densify sparse data
+        sparse_storage2d_type const* sm = sparse_matrix_ptr();
+        if (sm != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage2d_type{*sm};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() const&&",
             "node_data object holds unsupported data type");
@@ -1718,15 +2004,25 @@ namespace phylanx { namespace ir
         custom_storage1d_type* cv = util::get_if<custom_storage1d_type>(&data_);
         if (cv != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage1d_type{*cv};
         }
 
         storage1d_type* v = util::get_if<storage1d_type>(&data_);
         if (v != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *v;
         }
 
+        // densify sparse data
+        sparse_storage1d_type* sv = sparse_vector_ptr();
+        if (sv != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage1d_type{*sv};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::vector_copy() &",
             "node_data object holds unsupported data type");
@@ -1739,15 +2035,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage1d_type>(&data_);
         if (cv != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage1d_type{*cv};
         }
 
         storage1d_type const* v = util::get_if<storage1d_type>(&data_);
         if (v != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *v;
         }
 
+        // densify sparse data
+        sparse_storage1d_type const* sv = sparse_vector_ptr();
+        if (sv != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage1d_type{*sv};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::vector_copy() const&",
             "node_data object holds unsupported data type");
@@ -1760,15 +2066,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage1d_type>(&data_);
         if (cv != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage1d_type{*cv};
         }
 
         storage1d_type* v = util::get_if<storage1d_type>(&data_);
         if (v != nullptr)
         {
+            detail::count_moved_bytes(*this);
             return std::move(*v);
         }
 
+        // densify sparse data
+        sparse_storage1d_type* sv = sparse_vector_ptr();
+        if (sv != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage1d_type{*sv};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::vector_copy() &&",
             "node_data object holds unsupported data type");
@@ -1781,15 +2097,25 @@ namespace phylanx { namespace ir
             util::get_if<custom_storage1d_type>(&data_);
         if (cv != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return storage1d_type{*cv};
         }
 
         storage1d_type const* v = util::get_if<storage1d_type>(&data_);
         if (v != nullptr)
         {
+            detail::count_copied_bytes(*this);
             return *v;
         }
 
+        // densify sparse data
+        sparse_storage1d_type const* sv = sparse_vector_ptr();
+        if (sv != nullptr)
+        {
+            detail::count_copied_bytes(*this);
+            return storage1d_type{*sv};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::vector_copy() const&&",
             "node_data object holds unsupported data type");
@@ -2050,6 +2376,146 @@ namespace phylanx { namespace ir
         return *s;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    bool node_data<T>::is_sparse() const
+    {
+        return data_.index() == sparse_storage1d ||
+            data_.index() == sparse_storage2d ||
+            data_.index() == custom_sparse_storage1d ||
+            data_.index() == custom_sparse_storage2d;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type*
+    node_data<T>::sparse_vector_ptr()
+    {
+        custom_sparse_storage1d_type* csv =
+            util::get_if<custom_sparse_storage1d_type>(&data_);
+        if (csv != nullptr)
+        {
+            return &csv->get();
+        }
+        return util::get_if<sparse_storage1d_type>(&data_);
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type const*
+    node_data<T>::sparse_vector_ptr() const
+    {
+        custom_sparse_storage1d_type const* csv =
+            util::get_if<custom_sparse_storage1d_type>(&data_);
+        if (csv != nullptr)
+        {
+            return &csv->get();
+        }
+        return util::get_if<sparse_storage1d_type>(&data_);
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type*
+    node_data<T>::sparse_matrix_ptr()
+    {
+        custom_sparse_storage2d_type* csm =
+            util::get_if<custom_sparse_storage2d_type>(&data_);
+        if (csm != nullptr)
+        {
+            return &csm->get();
+        }
+        return util::get_if<sparse_storage2d_type>(&data_);
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type const*
+    node_data<T>::sparse_matrix_ptr() const
+    {
+        custom_sparse_storage2d_type const* csm =
+            util::get_if<custom_sparse_storage2d_type>(&data_);
+        if (csm != nullptr)
+        {
+            return &csm->get();
+        }
+        return util::get_if<sparse_storage2d_type>(&data_);
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type const&
+    node_data<T>::sparse_vector() const&
+    {
+        sparse_storage1d_type const* sv = sparse_vector_ptr();
+        if (sv != nullptr)
+        {
+            return *sv;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::sparse_vector() const&",
+            "node_data object holds unsupported data type");
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type
+    node_data<T>::sparse_vector() &&
+    {
+        // referenced data can't be moved from
+        custom_sparse_storage1d_type* csv =
+            util::get_if<custom_sparse_storage1d_type>(&data_);
+        if (csv != nullptr)
+        {
+            return csv->get();
+        }
+
+        sparse_storage1d_type* sv =
+            util::get_if<sparse_storage1d_type>(&data_);
+        if (sv != nullptr)
+        {
+            return std::move(*sv);
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::sparse_vector() &&",
+            "node_data object holds unsupported data type");
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type const&
+    node_data<T>::sparse_matrix() const&
+    {
+        sparse_storage2d_type const* sm = sparse_matrix_ptr();
+        if (sm != nullptr)
+        {
+            return *sm;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::sparse_matrix() const&",
+            "node_data object holds unsupported data type");
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type
+    node_data<T>::sparse_matrix() &&
+    {
+        // referenced data can't be moved from
+        custom_sparse_storage2d_type* csm =
+            util::get_if<custom_sparse_storage2d_type>(&data_);
+        if (csm != nullptr)
+        {
+            return csm->get();
+        }
+
+        sparse_storage2d_type* sm =
+            util::get_if<sparse_storage2d_type>(&data_);
+        if (sm != nullptr)
+        {
+            return std::move(*sm);
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::sparse_matrix() &&",
+            "node_data object holds unsupported data type");
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// Extract the dimensionality of the underlying data array.
     template <typename T>
@@ -2062,11 +2528,15 @@ namespace phylanx { namespace ir
             return 0;
 
         case storage1d:         HPX_FALLTHROUGH;
-        case custom_storage1d:
+        case custom_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case custom_sparse_storage1d:
             return 1;
 
         case storage2d:         HPX_FALLTHROUGH;
-        case custom_storage2d:
+        case custom_storage2d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:  HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
             return 2;
 
         case storage3d:         HPX_FALLTHROUGH;
@@ -2120,6 +2590,17 @@ namespace phylanx { namespace ir
                 return dimensions_type{
                     q.quats(), q.pages(), q.rows(), q.columns()};
             }
+
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d:
+            return dimensions_type{sparse_vector().size()};
+
+        case sparse_storage2d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return dimensions_type{m.rows(), m.columns()};
+            }
         default:
             break;
         }
@@ -2222,6 +2703,21 @@ namespace phylanx { namespace ir
                     break;
                 }
             }
+
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            {
+                auto dims = dimensions();
+                if (dim < 0 || std::size_t(dim) >= num_dimensions())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::ir::node_data<T>::dimension()",
+                        "unknown dimension requested");
+                }
+                return dims[dim];
+            }
         default:
             break;
         }
@@ -2256,9 +2752,19 @@ namespace phylanx { namespace ir
         case custom_storage1d: HPX_FALLTHROUGH;
         case custom_storage2d: HPX_FALLTHROUGH;
         case custom_storage3d: HPX_FALLTHROUGH;
-        case custom_storage4d:
+        case custom_storage4d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
             return *this;
 
+        case sparse_storage1d:
+            return node_data<T>{custom_sparse_storage1d_type{
+                util::get<sparse_storage1d>(data_)}};
+
+        case sparse_storage2d:
+            return node_data<T>{custom_sparse_storage2d_type{
+                util::get<sparse_storage2d>(data_)}};
+
         default:
             break;
         }
@@ -2292,9 +2798,21 @@ namespace phylanx { namespace ir
         case custom_storage1d: HPX_FALLTHROUGH;
         case custom_storage2d: HPX_FALLTHROUGH;
         case custom_storage3d: HPX_FALLTHROUGH;
-        case custom_storage4d:
+        case custom_storage4d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
             return *this;
 
+        case sparse_storage1d:
+            return node_data<T>{custom_sparse_storage1d_type{
+                const_cast<sparse_storage1d_type&>(
+                    util::get<sparse_storage1d>(data_))}};
+
+        case sparse_storage2d:
+            return node_data<T>{custom_sparse_storage2d_type{
+                const_cast<sparse_storage2d_type&>(
+                    util::get<sparse_storage2d>(data_))}};
+
         default:
             break;
         }
@@ -2330,7 +2848,9 @@ namespace phylanx { namespace ir
         case storage1d: HPX_FALLTHROUGH;
         case storage2d: HPX_FALLTHROUGH;
         case storage3d: HPX_FALLTHROUGH;
-        case storage4d:
+        case storage4d: HPX_FALLTHROUGH;
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             return *this;
 
         case custom_storage0d:
@@ -2348,6 +2868,11 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             return node_data<T>{quatern_copy()};
 
+        case custom_sparse_storage1d:
+            return node_data<T>{sparse_vector()};
+
+        case custom_sparse_storage2d:
+            return node_data<T>{sparse_matrix()};
 
         default:
             break;
@@ -2376,11 +2901,15 @@ namespace phylanx { namespace ir
             return true;
 
         case storage3d: HPX_FALLTHROUGH;
-        case storage4d:
+        case storage4d: HPX_FALLTHROUGH;
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             return false;
 
         case custom_storage3d: HPX_FALLTHROUGH;
-        case custom_storage4d:
+        case custom_storage4d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
             return true;
 
         default:
@@ -2405,6 +2934,13 @@ namespace phylanx { namespace ir
                 return std::vector<T>(v.begin(), v.end());
             }
 
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d:
+            {
+                auto v = vector_copy();
+                return std::vector<T>(v.begin(), v.end());
+            }
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage2d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2440,6 +2976,18 @@ namespace phylanx { namespace ir
                 return result;
             }
 
+        case sparse_storage2d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            {
+                auto m = matrix_copy();
+                std::vector<std::vector<T>> result(m.rows());
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    result[i].assign(m.begin(i), m.end(i));
+                }
+                return result;
+            }
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage1d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2542,6 +3090,30 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // comparisons and printing operate on a dense copy of sparse data
+        template <typename T>
+        node_data<T> densify(node_data<T> const& nd)
+        {
+            switch (nd.index())
+            {
+            case node_data<T>::sparse_storage1d: HPX_FALLTHROUGH;
+            case node_data<T>::custom_sparse_storage1d:
+                return node_data<T>{nd.vector_copy()};
+
+            case node_data<T>::sparse_storage2d: HPX_FALLTHROUGH;
+            case node_data<T>::custom_sparse_storage2d:
+                return node_data<T>{nd.matrix_copy()};
+
+            default:
+                break;
+            }
+            return nd.ref();
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool operator==(node_data<double> const& lhs, node_data<double> const& rhs)
     {
@@ -2551,6 +3123,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::densify(lhs) == detail::densify(rhs);
+        }
+
         switch (lhs.index())
         {
         case node_data<double>::storage0d:          HPX_FALLTHROUGH;
@@ -2581,6 +3158,49 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    bool operator==(node_data<float> const& lhs, node_data<float> const& rhs)
+    {
+        if (lhs.num_dimensions() != rhs.num_dimensions() ||
+            lhs.dimensions() != rhs.dimensions())
+        {
+            return false;
+        }
+
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::densify(lhs) == detail::densify(rhs);
+        }
+
+        switch (lhs.index())
+        {
+        case node_data<float>::storage0d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage0d:
+            return lhs.scalar() == rhs.scalar();
+
+        case node_data<float>::storage1d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage1d:
+            return lhs.vector() == rhs.vector();
+
+        case node_data<float>::storage2d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage2d:
+            return lhs.matrix() == rhs.matrix();
+
+        case node_data<float>::storage3d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage3d:
+            return lhs.tensor() == rhs.tensor();
+
+        case node_data<float>::storage4d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage4d:
+            return lhs.quatern() == rhs.quatern();
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::operator==()",
+            "node_data object holds unsupported data type");
+    }
+
     bool operator==(
         node_data<std::uint8_t> const& lhs, node_data<std::uint8_t> const& rhs)
     {
@@ -2590,6 +3210,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::densify(lhs) == detail::densify(rhs);
+        }
+
         switch (lhs.index())
         {
         case node_data<std::uint8_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2629,6 +3254,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::densify(lhs) == detail::densify(rhs);
+        }
+
         switch (lhs.index())
         {
         case node_data<std::int64_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2685,6 +3315,12 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return allclose(detail::densify(lhs), detail::densify(rhs), rtol,
+                atol, equal_nan);
+        }
+
         auto isclose = detail::isclose{atol, rtol, equal_nan};
 
         switch (lhs.index())
@@ -2725,6 +3361,61 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    bool allclose(node_data<float> const& lhs, node_data<float> const& rhs,
+        double rtol, double atol, bool equal_nan)
+    {
+        if (lhs.num_dimensions() != rhs.num_dimensions() ||
+            lhs.dimensions() != rhs.dimensions())
+        {
+            return false;
+        }
+
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return allclose(detail::densify(lhs), detail::densify(rhs), rtol,
+                atol, equal_nan);
+        }
+
+        auto isclose = detail::isclose{atol, rtol, equal_nan};
+
+        switch (lhs.index())
+        {
+        case node_data<float>::storage0d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage0d:
+            return isclose(lhs.scalar(), rhs.scalar());
+
+        case node_data<float>::storage1d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage1d:
+            return blaze::reduce(
+                blaze::map(lhs.vector(), rhs.vector(), isclose),
+                std::logical_and<bool>{});
+
+        case node_data<float>::storage2d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage2d:
+            return blaze::reduce(
+                blaze::map(lhs.matrix(), rhs.matrix(), isclose),
+                std::logical_and<bool>{});
+
+        case node_data<float>::storage3d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage3d:
+            return blaze::reduce(
+                blaze::map(lhs.tensor(), rhs.tensor(), isclose),
+                std::logical_and<bool>{});
+
+        case node_data<float>::storage4d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage4d:
+            return blaze::reduce(
+                blaze::map(lhs.quatern(), rhs.quatern(), isclose),
+                std::logical_and<bool>{});
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<float>::allclose)",
+            "node_data object holds unsupported data type");
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -2792,6 +3483,11 @@ namespace phylanx { namespace ir
     ///////////////////////////////////////////////////////////////////////////
     std::ostream& operator<<(std::ostream& out, node_data<double> const& nd)
     {
+        if (nd.is_sparse())
+        {
+            return out << detail::densify(nd);
+        }
+
         auto f = [&]()
         {
             switch (nd.index())
@@ -2842,9 +3538,70 @@ namespace phylanx { namespace ir
         return out;
     }
 
+    std::ostream& operator<<(std::ostream& out, node_data<float> const& nd)
+    {
+        if (nd.is_sparse())
+        {
+            return out << detail::densify(nd);
+        }
+
+        auto f = [&]()
+        {
+            switch (nd.index())
+            {
+            case node_data<float>::storage0d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage0d:
+                out << nd.scalar();
+                break;
+
+            case node_data<float>::storage1d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage1d:
+                detail::print_vector<float>(out, nd.vector(), nd.size());
+                break;
+
+            case node_data<float>::storage2d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage2d:
+                {
+                    auto m = nd.matrix();
+                    detail::print_matrix<float>(out, m, m.rows(), m.columns());
+                }
+                break;
+
+            case node_data<float>::storage3d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage3d:
+                {
+                    auto t = nd.tensor();
+                    detail::print_tensor<float>(
+                        out, t, t.pages(), t.rows(), t.columns());
+                }
+                break;
+
+            case node_data<float>::storage4d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage4d:
+                {
+                    auto q = nd.quatern();
+                    detail::print_quatern<float>(
+                        out, q, q.quats(), q.pages(), q.rows(), q.columns());
+                }
+                break;
+            default:
+                throw std::runtime_error("invalid dimensionality: " +
+                    std::to_string(nd.num_dimensions()));
+            }
+        };
+
+        f();
+
+        return out;
+    }
+
     std::ostream& operator<<(
         std::ostream& out, node_data<std::int64_t> const& nd)
     {
+        if (nd.is_sparse())
+        {
+            return out << detail::densify(nd);
+        }
 
         auto f = [&]()
         {
@@ -2901,6 +3658,11 @@ namespace phylanx { namespace ir
     std::ostream& operator<<(
         std::ostream& out, node_data<std::uint8_t> const& nd)
     {
+        if (nd.is_sparse())
+        {
+            return out << detail::densify(nd);
+        }
+
         auto f = [&]()
         {
             switch (nd.index())
@@ -2978,6 +3740,14 @@ namespace phylanx { namespace ir
         case storage4d:          HPX_FALLTHROUGH;
         case custom_storage4d:
             return quatern().nonZeros() != 0;
+
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d:
+            return sparse_vector().nonZeros() != 0;
+
+        case sparse_storage2d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:
+            return sparse_matrix().nonZeros() != 0;
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<double>::operator bool",
@@ -3035,6 +3805,22 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             ar << util::get<custom_storage4d>(data_);
             break;
+
+        case sparse_storage1d:
+            ar << util::get<sparse_storage1d>(data_);
+            break;
+
+        case sparse_storage2d:
+            ar << util::get<sparse_storage2d>(data_);
+            break;
+
+        case custom_sparse_storage1d:
+            ar << util::get<custom_sparse_storage1d>(data_).get();
+            break;
+
+        case custom_sparse_storage2d:
+            ar << util::get<custom_sparse_storage2d>(data_).get();
+            break;
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -3095,6 +3881,24 @@ namespace phylanx { namespace ir
                 data_ = std::move(q);
             }
             break;
+
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case custom_sparse_storage1d:   // deserialize as CompressedVector
+            {
+                sparse_storage1d_type v;
+                ar >> v;
+                data_ = std::move(v);
+            }
+            break;
+
+        case sparse_storage2d: HPX_FALLTHROUGH;
+        case custom_sparse_storage2d:   // deserialize as CompressedMatrix
+            {
+                sparse_storage2d_type m;
+                ar >> m;
+                data_ = std::move(m);
+            }
+            break;
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -3104,5 +3908,6 @@ namespace phylanx { namespace ir
 }}
 
 template class PHYLANX_EXPORT phylanx::ir::node_data<double>;
+template class PHYLANX_EXPORT phylanx::ir::node_data<float>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::uint8_t>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::int64_t>;
@@ -552,6 +552,206 @@ namespace phylanx { namespace performance_counters {
         return hpx::naming::invalid_gid;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of bytes of node_data copied, moved, or reused in place while
+    // evaluating the primitives (requires the node_data counts to be enabled)
+    class node_data_bytes_counter
+      : public hpx::performance_counters::base_performance_counter<
+            node_data_bytes_counter>
+    {
+    public:
+        node_data_bytes_counter()
+          : first_init_(false)
+          , kind_(copied)
+        {
+        }
+
+        node_data_bytes_counter(
+            hpx::performance_counters::counter_info const& info)
+          : hpx::performance_counters::base_performance_counter<
+                node_data_bytes_counter>(info)
+          , first_init_(false)
+          , kind_(copied)
+        {
+            hpx::performance_counters::counter_path_elements paths;
+            hpx::performance_counters::get_counter_path_elements(
+                info.fullname_, paths);
+            if (paths.countername_.find("moved_bytes") != std::string::npos)
+            {
+                kind_ = moved;
+            }
+            else if (paths.countername_.find("reused_bytes") !=
+                std::string::npos)
+            {
+                kind_ = reused;
+            }
+        }
+
+        // Produce the counter value
+        hpx::performance_counters::counter_values_array
+        get_counter_values_array(bool reset) override
+        {
+            // Need to call reinit here if it has never been called before.
+            bool expected = false;
+            if (first_init_.compare_exchange_strong(expected, true))
+            {
+                reinit(false);
+            }
+
+            hpx::performance_counters::counter_values_array value;
+
+            value.time_ = static_cast<std::int64_t>(hpx::get_system_uptime());
+            value.status_ = hpx::performance_counters::status_new_data;
+            value.count_ = ++invocation_count_;
+
+            std::vector<std::int64_t> result;
+            result.reserve(instances_.size());
+
+            // Extract the values from instances_
+            for (auto const& instance : instances_)
+            {
+                result.push_back(get_bytes(*instance, reset));
+            }
+
+            value.values_ = std::move(result);
+
+            return value;
+        }
+
+        // Retrieve the list of existing primitives for the current execution
+        // tree and keep it
+        void reinit(bool reset) override
+        {
+            // Structure of primitives in symbolic namespace:
+            // /phylanx$<locality_id>/<primitive>$<sequence-nr>[$<instance>]/
+            //      <compile_id>$<tag>
+            auto entries = hpx::agas::find_symbols(hpx::launch::sync,
+                hpx::util::format("/phylanx${}/{}$*", hpx::get_locality_id(),
+                    detail::extract_primitive_type(info_)));
+
+            std::map<std::int64_t, base_primitive_ptr> instances_sorted;
+
+            for (auto const& value : entries)
+            {
+                auto const& instance = hpx::get_ptr<
+                    phylanx::execution_tree::primitives::primitive_component>(
+                    hpx::launch::sync, value.second);
+
+                auto instance_info =
+                    phylanx::execution_tree::compiler::parse_primitive_name(
+                        value.first);
+
+                // Consider the reset flag
+                if (reset)
+                {
+                    get_bytes(*instance, true);
+                }
+                instances_sorted[instance_info.sequence_number] = instance;
+            }
+
+            instances_.clear();
+            instances_.reserve(entries.size());
+            for (auto const& value : instances_sorted)
+            {
+                instances_.push_back(value.second);
+            }
+
+            first_init_ = true;
+        }
+
+    private:
+        using base_primitive_ptr = std::shared_ptr<
+            phylanx::execution_tree::primitives::primitive_component>;
+
+        enum bytes_kind
+        {
+            copied,
+            moved,
+            reused
+        };
+
+        std::int64_t get_bytes(
+            phylanx::execution_tree::primitives::primitive_component const&
+                instance,
+            bool reset) const
+        {
+            switch (kind_)
+            {
+            case moved:
+                return instance.get_moved_bytes(reset);
+
+            case reused:
+                return instance.get_reused_bytes(reset);
+
+            default:
+                break;
+            }
+            return instance.get_copied_bytes(reset);
+        }
+
+        std::vector<base_primitive_ptr> instances_;
+        std::atomic<bool> first_init_;
+        bytes_kind kind_;
+    };
+
+    hpx::naming::gid_type node_data_bytes_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        namespace pc = hpx::performance_counters;
+
+        // Break down the counter name
+        pc::counter_path_elements paths;
+        pc::get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return hpx::naming::invalid_gid;
+
+        // If another counter's name was give
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::bad_parameter,
+                "node_data_bytes_counter_creator",
+                "invalid counter instance parent name: " +
+                    paths.parentinstancename_);
+            return hpx::naming::invalid_gid;
+        }
+
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            pc::counter_info complemented_info = info;
+            pc::complement_counter_info(complemented_info, info, ec);
+            if (ec)
+                return hpx::naming::invalid_gid;
+
+            hpx::naming::gid_type id;
+            try
+            {
+                // Try constructing the actual counter
+                using node_data_bytes_counter_type =
+                    hpx::components::component<node_data_bytes_counter>;
+
+                id = hpx::components::server::construct<
+                    node_data_bytes_counter_type>(complemented_info);
+            }
+            catch (hpx::exception const& e)
+            {
+                if (&ec == &hpx::throws)
+                    throw;
+                ec = hpx::make_error_code(e.get_error(), e.what());
+                return hpx::naming::invalid_gid;
+            }
+
+            if (&ec != &hpx::throws)
+                ec = hpx::make_success_code();
+            return id;
+        }
+
+        HPX_THROWS_IF(ec, hpx::bad_parameter,
+            "node_data_bytes_counter_creator",
+            "invalid counter instance name: " + paths.instancename_);
+        return hpx::naming::invalid_gid;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     // That means it will be executed in an HPX-thread before hpx_main, but
@@ -633,6 +833,20 @@ namespace phylanx { namespace performance_counters {
                     name + " primitive",
                 &transferred_bytes_counter_creator,
                 &hpx::performance_counters::locality_counter_discoverer);
+
+            // Register the node_data bytes performance counters
+            for (char const* kind : {"copied", "moved", "reused"})
+            {
+                hpx::performance_counters::install_counter_type(
+                    "/phylanx/primitives/" + name + "/" + kind + "_bytes",
+                    hpx::performance_counters::counter_raw_values,
+                    "returns a list whose elements contain the number of "
+                    "bytes of node_data " + std::string(kind) +
+                        " while evaluating each " + name + " primitive",
+                    &node_data_bytes_counter_creator,
+                    &hpx::performance_counters::locality_counter_discoverer,
+                    HPX_PERFORMANCE_COUNTER_V1, "bytes");
+            }
         }
     }
 }}    // namespace phylanx::performance_counters
@@ -661,3 +875,11 @@ using transferred_bytes_counter =
 
 HPX_REGISTER_DERIVED_COMPONENT_FACTORY(transferred_bytes_type,
     transferred_bytes_counter, "base_performance_counter");
+
+using node_data_bytes_type = hpx::components::component<
+    phylanx::performance_counters::node_data_bytes_counter>;
+using node_data_bytes_counter =
+    phylanx::performance_counters::node_data_bytes_counter;
+
+HPX_REGISTER_DERIVED_COMPONENT_FACTORY(node_data_bytes_type,
+    node_data_bytes_counter, "base_performance_counter");
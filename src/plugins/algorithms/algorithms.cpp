@@ -13,7 +13,13 @@ PHYLANX_REGISTER_PLUGIN_MODULE();
 
 PHYLANX_REGISTER_PLUGIN_FACTORY(als_plugin,
     phylanx::execution_tree::primitives::als::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_als_plugin,
+    phylanx::execution_tree::primitives::dist_als::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(kmeans_plugin,
     phylanx::execution_tree::primitives::kmeans::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_kmeans_plugin,
+    phylanx::execution_tree::primitives::dist_kmeans::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(lda_trainer_plugin,
+    phylanx::execution_tree::primitives::lda_trainer::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(lra_plugin,
     phylanx::execution_tree::primitives::lra::match_data);
@@ -5,6 +5,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/plugins/algorithms/als.hpp>
+#include <phylanx/plugins/algorithms/als_kernels.hpp>
 
 #include <hpx/iostream.hpp>
 #include <hpx/include/lcos.hpp>
@@ -15,7 +16,6 @@
 #include <cstdint>
 #include <iostream>
 #include <memory>
-#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -34,7 +34,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         Args:
 
             ratings (matrix): the matrix representing user feedback over
-                             different items
+                             different items, sparse ratings are
+                             processed without being densified
             reg (float): the regularization parameter
             num (integer): the number of factors
             iters (integer): the number of iterations
@@ -57,6 +58,33 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Matrix>
+    void als::calculate_als_iterations(Matrix const& conf,
+        Matrix const& conf_t, blaze::DynamicMatrix<double>& X,
+        blaze::DynamicMatrix<double>& Y, double regularization,
+        std::int64_t iterations, bool enable_output) const
+    {
+        using matrix_type = blaze::DynamicMatrix<double>;
+
+        for (std::int64_t step = 0; step < iterations; ++step)
+        {
+            if (enable_output)
+            {
+                hpx::cout << "iteration " << step << "\nX: " << X
+                          << "\nY: " << Y << std::endl;
+            }
+
+            // both Gram matrices are based on the factors at the start of
+            // the iteration
+            matrix_type YtY = als_gram_matrix(Y, regularization);
+            matrix_type XtX = als_gram_matrix(X, regularization);
+
+            als_update_rows(conf, Y, YtY, X);
+            als_update_rows(conf_t, X, XtX, Y);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type als::calculate_als(
         primitive_arguments_type&& args) const
@@ -70,7 +98,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the als algorithm primitive requires for the first "
                     "argument ('ratings') to represent a matrix"));
         }
-        auto ratings = arg1.matrix();
 
         auto arg2 = extract_numeric_value(args[1], name_, codename_);
         if (arg2.num_dimensions() != 0)
@@ -103,83 +130,38 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_scalar_integer_value(args[5], name_, codename_) != 0;
         }
 
-        using vector_type = ir::node_data<double>::storage1d_type;
         using matrix_type = ir::node_data<double>::storage2d_type;
 
         // perform calculations
-        std::int64_t num_users = ratings.rows();
-        std::int64_t num_items = ratings.columns();
-        auto conf = alpha * ratings;
+        std::int64_t num_users = arg1.dimension(0);
+        std::int64_t num_items = arg1.dimension(1);
 
         matrix_type X(num_users, num_factors);
         matrix_type Y(num_items, num_factors);
 
-        matrix_type XtX(num_factors, num_factors);
-        matrix_type YtY(num_factors, num_factors);
+        // initialize X and Y the same way as 'random' does after calling
+        // 'set_seed(0)', i.e. using the first two keys derived from seed 0
+        als_initialize_factors(X, 0);
+        als_initialize_factors(Y, 1);
 
-        std::uint32_t seed_ = 0;
-        std::mt19937 rng_{seed_};
-        std::normal_distribution<double> dist;
-
-        for (std::size_t row = 0; row != blaze::rows(X); ++row)
+        // sparse ratings are kept compressed, only the non-zero confidences
+        // contribute to the update of a row of X or Y
+        if (arg1.is_sparse())
         {
-            for (auto& val : blaze::row(X, row))
-            {
-                val = dist(rng_);
-            }
-        }
+            blaze::CompressedMatrix<double> conf =
+                alpha * arg1.sparse_matrix();
+            blaze::CompressedMatrix<double> conf_t = blaze::trans(conf);
 
-        for (std::size_t row = 0; row != blaze::rows(Y); ++row)
-        {
-            for (auto& val : blaze::row(Y, row))
-            {
-                val = dist(rng_);
-            }
+            calculate_als_iterations(conf, conf_t, X, Y, regularization,
+                iterations, enable_output);
         }
-
-        blaze::IdentityMatrix<double> I_f(num_factors);
-        blaze::IdentityMatrix<double> I_i(num_items);
-        blaze::IdentityMatrix<double> I_u(num_users);
-
-        blaze::DynamicMatrix<double> c_u(num_items, num_items, 0);
-        blaze::DynamicMatrix<double> c_i(num_users, num_users, 0);
-
-        for (std::int64_t step = 0; step < iterations; ++step)
+        else
         {
-            YtY = (blaze::trans(Y) * Y) + regularization * I_f;
-            XtX = (blaze::trans(X) * X) + regularization * I_f;
-
-            if (enable_output)
-            {
-                hpx::cout << "iteration " << step << "\nX: " << X
-                          << "\nY: " << Y << std::endl;
-            }
+            matrix_type conf = alpha * arg1.matrix();
+            matrix_type conf_t = blaze::trans(conf);
 
-            for (std::int64_t u = 0; u < num_users; u++)
-            {
-                auto conf_u = blaze::trans(blaze::row(conf, u));
-                auto diag = blaze::band(c_u, 0);
-                diag = conf_u;
-                blaze::DynamicVector<double> p_u =
-                    blaze::map(conf_u, [&](double x) { return (x != 0.0); });
-                auto A = (blaze::trans(Y) * c_u) * Y + YtY;
-                auto b = (blaze::trans(Y) * (c_u + I_i)) * (p_u);
-                auto row_x = blaze::row(X, u);
-                row_x = (trans(b) * blaze::inv(A));
-            }
-
-            for (std::int64_t i = 0; i < num_items; i++)
-            {
-                auto conf_i = blaze::column(conf, i);
-                auto diag = blaze::band(c_i, 0);
-                diag = conf_i;
-                blaze::DynamicVector<double> p_i =
-                    blaze::map(conf_i, [&](double x) { return (x != 0.0); });
-                auto A = (blaze::trans(X) * c_i) * X + XtX;
-                auto b = (blaze::trans(X) * (c_i + I_u)) * (p_i);
-                auto row_y = blaze::row(Y, i);
-                row_y = (trans(b) * blaze::inv(A));
-            }
+            calculate_als_iterations(conf, conf_t, X, Y, regularization,
+                iterations, enable_output);
         }
 
         return primitive_argument_type
@@ -0,0 +1,161 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/algorithms/als_kernels.hpp>
+#include <phylanx/util/random.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        // minimal number of rows handled by a single task
+        constexpr std::size_t als_min_block_size = 64;
+
+        template <typename F>
+        void als_for_each_nonzero(blaze::CompressedMatrix<double> const& conf,
+            std::size_t r, F&& f)
+        {
+            for (auto it = conf.cbegin(r); it != conf.cend(r); ++it)
+            {
+                if (it->value() != 0.0)
+                {
+                    f(it->index(), it->value());
+                }
+            }
+        }
+
+        template <typename F>
+        void als_for_each_nonzero(blaze::DynamicMatrix<double> const& conf,
+            std::size_t r, F&& f)
+        {
+            for (std::size_t i = 0; i != conf.columns(); ++i)
+            {
+                if (conf(r, i) != 0.0)
+                {
+                    f(i, conf(r, i));
+                }
+            }
+        }
+
+        template <typename Matrix>
+        void als_update_rows(Matrix const& conf,
+            blaze::DynamicMatrix<double> const& factors,
+            blaze::DynamicMatrix<double> const& FtF,
+            blaze::DynamicMatrix<double>& result)
+        {
+            std::size_t num_rows = conf.rows();
+            std::size_t num_factors = factors.columns();
+
+            std::size_t blocks = (std::min)(
+                (num_rows + als_min_block_size - 1) / als_min_block_size,
+                std::size_t(4 * hpx::get_os_thread_count()));
+            std::size_t block_size =
+                blocks == 0 ? 0 : (num_rows + blocks - 1) / blocks;
+
+            hpx::for_loop(hpx::execution::par, std::size_t(0), blocks,
+                [&](std::size_t block)
+                {
+                    // workspaces, reused for all rows of this block
+                    blaze::DynamicMatrix<double> F, CF, A;
+                    blaze::DynamicVector<double> b(num_factors);
+
+                    std::size_t end =
+                        (std::min)(num_rows, (block + 1) * block_size);
+                    for (std::size_t r = block * block_size; r < end; ++r)
+                    {
+                        std::size_t nonzeros = conf.nonZeros(r);
+                        if (F.rows() < nonzeros)
+                        {
+                            F.resize(nonzeros, num_factors, false);
+                            CF.resize(nonzeros, num_factors, false);
+                        }
+
+                        // gather the factors of the non-zero confidences
+                        std::size_t n = 0;
+                        b = 0.0;
+                        als_for_each_nonzero(conf, r,
+                            [&](std::size_t i, double c)
+                            {
+                                auto f = blaze::row(factors, i);
+                                blaze::row(F, n) = f;
+                                blaze::row(CF, n) = c * f;
+                                b += (c + 1.0) * blaze::trans(f);
+                                ++n;
+                            });
+
+                        A = FtF;
+                        if (n != 0)
+                        {
+                            auto Fn = blaze::submatrix(F, 0, 0, n, num_factors);
+                            A += blaze::trans(Fn) *
+                                blaze::submatrix(CF, 0, 0, n, num_factors);
+                        }
+
+                        // A is symmetric positive definite, b is overwritten
+                        // with the solution
+                        blaze::posv(A, b, 'L');
+                        blaze::row(result, r) = blaze::trans(b);
+                    }
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicMatrix<double> als_gram_matrix(
+        blaze::DynamicMatrix<double> const& factors, double regularization)
+    {
+        blaze::DynamicMatrix<double> result =
+            blaze::trans(factors) * factors;
+        blaze::band(result, 0) += regularization;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void als_update_rows(blaze::CompressedMatrix<double> const& conf,
+        blaze::DynamicMatrix<double> const& factors,
+        blaze::DynamicMatrix<double> const& FtF,
+        blaze::DynamicMatrix<double>& result)
+    {
+        detail::als_update_rows(conf, factors, FtF, result);
+    }
+
+    void als_update_rows(blaze::DynamicMatrix<double> const& conf,
+        blaze::DynamicMatrix<double> const& factors,
+        blaze::DynamicMatrix<double> const& FtF,
+        blaze::DynamicMatrix<double>& result)
+    {
+        detail::als_update_rows(conf, factors, FtF, result);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void als_initialize_factors(blaze::DynamicMatrix<double>& factors,
+        std::uint64_t key, std::size_t row_offset)
+    {
+        std::size_t columns = factors.columns();
+        hpx::for_loop(hpx::execution::par, std::size_t(0), factors.rows(),
+            [&](std::size_t row)
+            {
+                util::random_element_generator<std::normal_distribution<double>>
+                    gen(std::normal_distribution<double>{}, key);
+                for (std::size_t col = 0; col != columns; ++col)
+                {
+                    factors(row, col) =
+                        gen((row_offset + row) * columns + col);
+                }
+            });
+    }
+}}}
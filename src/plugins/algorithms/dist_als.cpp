@@ -0,0 +1,416 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/plugins/algorithms/als_kernels.hpp>
+#include <phylanx/plugins/algorithms/dist_als.hpp>
+#include <phylanx/plugins/dist_matrixops/tile_calculation_helper.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/iostream.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const dist_als::match_data =
+    {
+        hpx::make_tuple("als_d",
+        std::vector<std::string>{R"(
+                als_d(
+                    _1_ratings,
+                    _2_regularization,
+                    _3_num_factors,
+                    _4_iterations,
+                    _5_alpha,
+                    __arg(_6_enable_output, false)
+                )
+            )"},
+            &create_dist_als, &create_primitive<dist_als>, R"(
+            ratings, regularization, num_factors, iterations, alpha,
+            enable_output
+
+            Args:
+
+                ratings (matrix): a row-tiled matrix (for instance as read by
+                    file_read_csv_d) representing user feedback over
+                    different items, the users are distributed over the
+                    localities. Sparse ratings are processed without being
+                    densified.
+                regularization (float): the regularization parameter
+                num_factors (integer): the number of factors
+                iterations (integer): the number of iterations
+                alpha (float): the scaling factor
+                enable_output (boolean, optional): whether output should be
+                    enabled, defaults to false.
+
+            Returns:
+
+            The algorithm returns a list of two row-tiled matrices: [X, Y],
+            X: user-factors matrix, tiled the same way as the ratings
+            Y: item-factors matrix, the items are evenly distributed over the
+               localities
+
+            The result is the same as calculated by als for the same
+            ratings.)")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_als::dist_als(primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the global indices of the first row of all tiles (plus the overall
+        // number of rows)
+        std::vector<std::size_t> als_user_offsets(
+            localities_information const& locs, std::size_t num_users)
+        {
+            std::size_t num_localities = locs.locality_.num_localities_;
+
+            std::vector<std::size_t> offsets(num_localities + 1, num_users);
+            for (std::size_t i = 0; i != num_localities; ++i)
+            {
+                offsets[i] = locs.tiles_[i].spans_[0].start_;
+            }
+            return offsets;
+        }
+
+        std::vector<std::size_t> als_item_offsets(
+            std::uint32_t num_localities, std::size_t num_items)
+        {
+            std::vector<std::size_t> offsets(num_localities + 1, num_items);
+            for (std::uint32_t i = 0; i != num_localities; ++i)
+            {
+                std::int64_t start;
+                std::size_t size;
+                std::tie(start, size) = tile_calculation::tile_calculation_1d(
+                    i, num_items, num_localities);
+                offsets[i] = static_cast<std::size_t>(start);
+            }
+            return offsets;
+        }
+
+        // collect the (row-tiled) factors from all localities
+        blaze::DynamicMatrix<double> all_gather_als_factors(
+            blaze::DynamicMatrix<double> const& factors,
+            std::vector<std::size_t> const& offsets,
+            localities_information const& locs, std::string const& basename)
+        {
+            if (locs.locality_.num_localities_ == 1)
+            {
+                return factors;
+            }
+
+            std::vector<blaze::DynamicMatrix<double>> parts =
+                hpx::all_gather(basename.c_str(), factors,
+                    locs.locality_.num_localities_, std::size_t(-1),
+                    locs.locality_.locality_id_)
+                    .get();
+
+            blaze::DynamicMatrix<double> result(
+                offsets.back(), factors.columns());
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                blaze::submatrix(result, offsets[i], 0, parts[i].rows(),
+                    parts[i].columns()) = parts[i];
+            }
+            return result;
+        }
+
+        // X^T X + reg * I for the row-tiled factors X
+        blaze::DynamicMatrix<double> all_reduce_als_gram_matrix(
+            blaze::DynamicMatrix<double> const& factors,
+            double regularization, localities_information const& locs,
+            std::string const& basename)
+        {
+            if (locs.locality_.num_localities_ == 1)
+            {
+                return als_gram_matrix(factors, regularization);
+            }
+
+            blaze::DynamicMatrix<double> result =
+                hpx::all_reduce(basename.c_str(),
+                    blaze::DynamicMatrix<double>(
+                        blaze::trans(factors) * factors),
+                    blaze::Add{}, locs.locality_.num_localities_,
+                    std::size_t(-1), locs.locality_.locality_id_)
+                    .get();
+            blaze::band(result, 0) += regularization;
+            return result;
+        }
+
+        // Create the local part of the transposed confidences, i.e. the
+        // confidences of all users for the items assigned to this locality.
+        // Each locality sends the columns of its rows that belong to the
+        // items of locality j to that locality.
+        blaze::CompressedMatrix<double> all_to_all_als_transpose(
+            blaze::CompressedMatrix<double> const& conf,
+            std::vector<std::size_t> const& user_offsets,
+            std::vector<std::size_t> const& item_offsets,
+            localities_information const& locs, std::string const& basename)
+        {
+            std::size_t num_localities = locs.locality_.num_localities_;
+            if (num_localities == 1)
+            {
+                return blaze::trans(conf);
+            }
+
+            std::vector<blaze::CompressedMatrix<double>> blocks;
+            blocks.reserve(num_localities);
+            for (std::size_t j = 0; j != num_localities; ++j)
+            {
+                blocks.emplace_back(blaze::trans(blaze::submatrix(conf, 0,
+                    item_offsets[j], conf.rows(),
+                    item_offsets[j + 1] - item_offsets[j])));
+            }
+
+            std::vector<blaze::CompressedMatrix<double>> parts =
+                hpx::all_to_all(basename.c_str(), std::move(blocks),
+                    num_localities, std::size_t(-1),
+                    locs.locality_.locality_id_)
+                    .get();
+
+            // concatenate the received blocks in the order of the users
+            std::vector<std::size_t> order(num_localities);
+            std::size_t nonzeros = 0;
+            for (std::size_t i = 0; i != num_localities; ++i)
+            {
+                order[i] = i;
+                nonzeros += parts[i].nonZeros();
+            }
+            std::sort(order.begin(), order.end(),
+                [&](std::size_t lhs, std::size_t rhs)
+                {
+                    return user_offsets[lhs] < user_offsets[rhs];
+                });
+
+            std::size_t locality_id = locs.locality_.locality_id_;
+            std::size_t num_items =
+                item_offsets[locality_id + 1] - item_offsets[locality_id];
+
+            blaze::CompressedMatrix<double> result(
+                num_items, user_offsets.back());
+            result.reserve(nonzeros);
+            for (std::size_t r = 0; r != num_items; ++r)
+            {
+                for (std::size_t i : order)
+                {
+                    auto const& part = parts[i];
+                    for (auto it = part.cbegin(r); it != part.cend(r); ++it)
+                    {
+                        result.append(r, user_offsets[i] + it->index(),
+                            it->value());
+                    }
+                }
+                result.finalize(r);
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        primitive_argument_type als_tile(blaze::DynamicMatrix<double>&& m,
+            std::size_t row_start, std::string const& basename,
+            localities_information const& locs, std::string const& name,
+            std::string const& codename)
+        {
+            tiling_information_2d tile_info(
+                tiling_span(row_start, row_start + m.rows()),
+                tiling_span(0, m.columns()));
+
+            locality_information locality_info(locs.locality_.locality_id_,
+                locs.locality_.num_localities_);
+            annotation locality_ann = locality_info.as_annotation();
+
+            annotation_information ann_info(basename, 0);    //generation 0
+
+            auto attached_annotation =
+                std::make_shared<annotation>(localities_annotation(
+                    locality_ann, tile_info.as_annotation(name, codename),
+                    ann_info, name, codename));
+
+            return primitive_argument_type(std::move(m), attached_annotation);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dist_als::calculate_als(
+        primitive_arguments_type&& args) const
+    {
+        // the ratings are expected to be tiled by rows, a non-annotated
+        // matrix is treated as being local to this locality
+        localities_information locs =
+            extract_localities_information(args[0], name_, codename_);
+
+        auto arg0 = extract_numeric_value(std::move(args[0]), name_, codename_);
+        if (arg0.num_dimensions() != 2 || locs.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_als::calculate_als",
+                generate_error_message(
+                    "the als_d algorithm primitive requires for the first "
+                    "argument ('ratings') to represent a matrix"));
+        }
+        if (!locs.is_row_tiled(name_, codename_))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_als::calculate_als",
+                generate_error_message(
+                    "the als_d algorithm primitive requires for the first "
+                    "argument ('ratings') to be tiled by rows"));
+        }
+
+        double regularization =
+            extract_scalar_numeric_value(std::move(args[1]), name_, codename_);
+        std::int64_t num_factors = extract_scalar_positive_integer_value_strict(
+            std::move(args[2]), name_, codename_);
+        std::int64_t iterations = extract_scalar_integer_value(
+            std::move(args[3]), name_, codename_);
+        double alpha =
+            extract_scalar_numeric_value(std::move(args[4]), name_, codename_);
+
+        bool enable_output = false;
+        if (args.size() > 5 && valid(args[5]))
+        {
+            enable_output = extract_scalar_boolean_value(
+                std::move(args[5]), name_, codename_);
+        }
+
+        using matrix_type = blaze::DynamicMatrix<double>;
+
+        // sparse ratings are kept compressed, dense ratings are compressed
+        // as only the non-zero confidences are needed (and exchanged)
+        blaze::CompressedMatrix<double> conf = arg0.is_sparse() ?
+            blaze::CompressedMatrix<double>(alpha * arg0.sparse_matrix()) :
+            blaze::CompressedMatrix<double>(alpha * arg0.matrix());
+
+        std::size_t num_users = locs.rows(name_, codename_);
+        std::size_t num_items = conf.columns();
+        std::uint32_t locality_id = locs.locality_.locality_id_;
+
+        std::vector<std::size_t> user_offsets =
+            detail::als_user_offsets(locs, num_users);
+        std::vector<std::size_t> item_offsets = detail::als_item_offsets(
+            locs.locality_.num_localities_, num_items);
+
+        std::string basename = "als_d_" + locs.annotation_.name_;
+
+        blaze::CompressedMatrix<double> conf_t =
+            detail::all_to_all_als_transpose(conf, user_offsets, item_offsets,
+                locs, basename + "_transpose");
+
+        // local tiles of the factors, initialized the same way as by als
+        std::size_t user_start = locs.get_span(0).start_;
+        std::size_t item_start = item_offsets[locality_id];
+
+        matrix_type X(conf.rows(), num_factors);
+        matrix_type Y(conf_t.rows(), num_factors);
+
+        als_initialize_factors(X, 0, user_start);
+        als_initialize_factors(Y, 1, item_start);
+
+        matrix_type X_all;
+        if (enable_output)
+        {
+            X_all = detail::all_gather_als_factors(
+                X, user_offsets, locs, basename + "_X");
+        }
+
+        // each half-iteration requires the complete factors of the other
+        // half, the Gram matrices are based on the factors at the start of
+        // each iteration
+        for (std::int64_t step = 0; step < iterations; ++step)
+        {
+            matrix_type Y_all = detail::all_gather_als_factors(
+                Y, item_offsets, locs, basename + "_Y");
+
+            if (enable_output && locality_id == 0)
+            {
+                hpx::cout << "iteration " << step << "\nX: " << X_all
+                          << "\nY: " << Y_all << std::endl;
+            }
+
+            matrix_type YtY = als_gram_matrix(Y_all, regularization);
+            matrix_type XtX = detail::all_reduce_als_gram_matrix(
+                X, regularization, locs, basename + "_XtX");
+
+            als_update_rows(conf, Y_all, YtY, X);
+
+            X_all = detail::all_gather_als_factors(
+                X, user_offsets, locs, basename + "_X");
+
+            als_update_rows(conf_t, X_all, XtX, Y);
+        }
+
+        return primitive_argument_type{primitive_arguments_type{
+            detail::als_tile(std::move(X), user_start, basename + "_X", locs,
+                name_, codename_),
+            detail::als_tile(std::move(Y), item_start, basename + "_Y", locs,
+                name_, codename_)}};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> dist_als::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() < 5 || operands.size() > 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_als::eval",
+                generate_error_message(
+                    "the als_d algorithm primitive requires either five or "
+                    "six operands"));
+        }
+
+        for (std::size_t i = 0; i != 5; ++i)
+        {
+            if (!valid(operands[i]))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_als::eval",
+                    generate_error_message(
+                        "the als_d algorithm primitive requires that the "
+                        "arguments given by the operands array are valid"));
+            }
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::util::unwrapping(
+                [this_ = std::move(this_)](primitive_arguments_type&& args)
+                    -> primitive_argument_type
+                {
+                    return this_->calculate_als(std::move(args));
+                }),
+            detail::map_operands(
+                operands, functional::value_operand{}, args, name_, codename_,
+                std::move(ctx)));
+    }
+}}}
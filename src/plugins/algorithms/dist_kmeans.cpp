@@ -0,0 +1,284 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/plugins/algorithms/dist_kmeans.hpp>
+#include <phylanx/plugins/algorithms/kmeans_kernels.hpp>
+#include <phylanx/util/random.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const dist_kmeans::match_data =
+    {
+        hpx::make_tuple("kmeans_d",
+        std::vector<std::string>{R"(
+                kmeans_d(
+                    _1_points,
+                    __arg(_2_num_centroid, 3),
+                    __arg(_3_iterations, 10),
+                    __arg(_4_show_result, false),
+                    __arg(_5_seed, nil),
+                    __arg(_6_initial_centroids, nil)
+                )
+            )"},
+            &create_dist_kmeans, &create_primitive<dist_kmeans>, R"(
+            points, num_centroids, iterations, show_result, seed,
+            initial_centroids
+
+            Args:
+
+                points (matrix): a row-tiled matrix (for instance as read by
+                    file_read_csv_d) with any number of rows (points) and any
+                    number of columns (features).
+                num_centroids (int, optional): the number of clusters in which
+                    we need to break down the data. It sets to 3 by default
+                iterations (int, optional): the number of iterations. It sets
+                    to 10 by default.
+                show_result (bool, optional): defaults to false.
+                seed (int) : the seed of a random number generator, all
+                    localities have to use the same seed.
+                initial_centroids (matrix): if not given, the centroids are
+                    initialized by num_centroids randomly chosen points. If
+                    given there is no use for a seed. The initial_centroids
+                    matrix should have num_centroids rows and as many columns
+                    as the points matrix.
+
+            Returns:
+
+            Number of centroids points that shows the center of clusters given
+            the points matrix. The centroids are the same on all localities.)")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_kmeans::dist_kmeans(primitive_arguments_type && operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // combine the partial sums calculated by all localities
+        blaze::DynamicMatrix<double> all_reduce_kmeans_sums(
+            blaze::DynamicMatrix<double>&& sums,
+            localities_information const& locs, std::string const& basename)
+        {
+            if (locs.locality_.num_localities_ == 1)
+            {
+                return std::move(sums);
+            }
+
+            return hpx::all_reduce(basename.c_str(), std::move(sums),
+                blaze::Add{}, locs.locality_.num_localities_, std::size_t(-1),
+                locs.locality_.locality_id_)
+                .get();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // choose num_centroids random points as the initial centroids, all
+    // localities generate the same (global) indices, the locality owning the
+    // selected point contributes its coordinates
+    blaze::DynamicMatrix<double> dist_kmeans::initialize_centroids(
+        blaze::DynamicMatrix<double> const& points, std::size_t num_centroids,
+        localities_information const& locs, std::string const& basename) const
+    {
+        std::size_t row_start = locs.get_span(0).start_;
+        std::size_t num_points = locs.rows(name_, codename_);
+
+        blaze::DynamicMatrix<double> centroids(
+            num_centroids, points.columns(), 0.0);
+
+        std::vector<std::size_t> indices =
+            kmeans_random_indices(num_points, num_centroids);
+        for (std::size_t i = 0; i != num_centroids; ++i)
+        {
+            if (indices[i] >= row_start &&
+                indices[i] - row_start < points.rows())
+            {
+                blaze::row(centroids, i) =
+                    blaze::row(points, indices[i] - row_start);
+            }
+        }
+
+        return detail::all_reduce_kmeans_sums(
+            std::move(centroids), locs, basename);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dist_kmeans::calculate_kmeans(
+        primitive_arguments_type&& args) const
+    {
+        // the points are expected to be tiled by rows, a non-annotated
+        // matrix is treated as being local to this locality
+        localities_information locs =
+            extract_localities_information(args[0], name_, codename_);
+
+        auto arg0 = extract_numeric_value(std::move(args[0]), name_, codename_);
+        if (arg0.num_dimensions() != 2 || locs.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires for the first "
+                    "argument, points, to represent a matrix"));
+        }
+        if (!locs.is_row_tiled(name_, codename_))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires for the first "
+                    "argument, points, to be tiled by rows"));
+        }
+        blaze::DynamicMatrix<double> const points = arg0.matrix();
+
+        std::size_t num_centroids = 3;
+        if (valid(args[1]))
+        {
+            num_centroids = extract_scalar_positive_integer_value_strict(
+                std::move(args[1]), name_, codename_);
+        }
+
+        std::size_t iterations = 10;
+        if (valid(args[2]))
+        {
+            iterations = extract_scalar_positive_integer_value_strict(
+                std::move(args[2]), name_, codename_);
+        }
+
+        bool show_result = false;
+        if (valid(args[3]))
+        {
+            show_result = extract_scalar_boolean_value(
+                std::move(args[3]), name_, codename_);
+        }
+
+        std::uint32_t seed = 42;
+        if (valid(args[4]))
+        {
+            seed = extract_scalar_positive_integer_value_strict(
+                std::move(args[4]), name_, codename_);
+        }
+        util::set_seed(seed);
+
+        std::string basename = "kmeans_d_" + locs.annotation_.name_;
+
+        // initializing the centroids
+        blaze::DynamicMatrix<double> centroids;
+        if (valid(args[5]))
+        {
+            auto arg5 =
+                extract_numeric_value(std::move(args[5]), name_, codename_);
+            if (arg5.num_dimensions() != 2)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "initial_centroids to represent a matrix"));
+            }
+            centroids = arg5.matrix();
+            if (centroids.columns() != points.columns() ||
+                centroids.rows() != num_centroids)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "initial_centroids to have num_centroids rows and as "
+                        "many columns as the points"));
+            }
+        }
+        else
+        {
+            if (num_centroids > locs.rows(name_, codename_))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "number of points to be not smaller than the number "
+                        "of centroids"));
+            }
+            centroids =
+                initialize_centroids(points, num_centroids, locs, basename);
+        }
+
+        // kmeans calculations, each iteration requires one all_reduce of
+        // the partial sums of the points assigned to each centroid
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            centroids = kmeans_move_centroids(
+                detail::all_reduce_kmeans_sums(
+                    kmeans_partial_sums(points,
+                        kmeans_closest_centroids(points, centroids),
+                        num_centroids),
+                    locs, basename));
+
+            if (show_result && locs.locality_.locality_id_ == 0)
+            {
+                std::cout << "centroids after iteration " << i << ": "
+                          << centroids << std::endl;
+            }
+        }
+
+        return primitive_argument_type{std::move(centroids)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> dist_kmeans::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.empty() || operands.size() > 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_kmeans::eval",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires at least one "
+                    "and at most 6 operands"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_kmeans::eval",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires that the "
+                    "arguments given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::util::unwrapping(
+                [this_ = std::move(this_)](primitive_arguments_type&& args)
+                    -> primitive_argument_type
+                {
+                    return this_->calculate_kmeans(std::move(args));
+                }),
+            detail::map_operands(
+                operands, functional::value_operand{}, args, name_, codename_,
+                std::move(ctx)));
+    }
+}}}
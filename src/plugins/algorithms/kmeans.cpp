@@ -7,6 +7,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/plugins/algorithms/kmeans.hpp>
+#include <phylanx/plugins/algorithms/kmeans_kernels.hpp>
 #include <phylanx/util/random.hpp>
 
 #include <hpx/iostream.hpp>
@@ -49,9 +50,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             Args:
 
-                points (matrix): a matrix with any number of rows and two
-                    columns. Any data that can be represented by two features
-                    can create the point matrix.
+                points (matrix): a matrix with any number of rows (points)
+                    and any number of columns (features).
                 num_centroids (int, optional): the number of clusters in which
                     we need to break down the data. It sets to 3 by default
                 iterations (int, optional): the number of iterations. It sets
@@ -61,7 +61,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 initial_centroids (matrix): if not given, the centroids are
                     initialized by num_centroids randomly chosen points. If
                     given there is no use for a seed. The initial_centroids
-                    matrix should have num_centroids rows and 2 columns.
+                    matrix should have num_centroids rows and as many columns
+                    as the points matrix.
 
             Returns:
 
@@ -78,85 +79,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     ///////////////////////////////////////////////////////////////////////////
     // choose num_centroids random points as the initial centroids
     blaze::DynamicMatrix<double> kmeans::initialize_centroids(
-        blaze::DynamicMatrix<double> const& points, std::size_t num_points,
-        std::size_t num_centroids) const
-    {
-        blaze::DynamicMatrix<double> centroids(num_centroids, 2);
-        std::uniform_int_distribution<std::int64_t> distribution(
-            0, num_points - 1);
-        std::vector<std::size_t> indices;
-        std::int64_t rand_index;
-
-        for (std::size_t i = 0; i != num_centroids; ++i)
-        {
-            rand_index = distribution(util::rng_);
-
-            // rand indices should be unique
-            while (std::find(indices.begin(), indices.end(), rand_index) !=
-                indices.end())
-            {
-                rand_index = distribution(util::rng_);
-            }
-            indices.emplace_back(rand_index);
-
-            blaze::row(centroids, i) = blaze::row(points, rand_index);
-        }
-        return std::move(centroids);
-    }
-
-    // assign each point to its closest centroid
-    blaze::DynamicVector<std::size_t> kmeans::closest_centroids(
         blaze::DynamicMatrix<double> const& points,
-        blaze::DynamicMatrix<double> const& centroids, std::size_t num_points,
         std::size_t num_centroids) const
     {
-        auto points_x = blaze::column(points, 0);
-        auto points_y = blaze::column(points, 1);
-        auto centroids_x = blaze::column(centroids, 0);
-        auto centroids_y = blaze::column(centroids, 1);
-
-        // calculating the index for each row of points
-        blaze::DynamicVector<std::size_t> result(num_points);
-        for (std::size_t i = 0; i != num_points; ++i)
-        {
-            auto temp = blaze::DynamicVector<double>(num_centroids);
-            for (std::size_t j = 0; j != num_centroids; ++j)
-            {
-                temp[j] = blaze::sqrt(
-                    blaze::pow(points_x[i] - centroids_x[j], 2) +
-                    blaze::pow(points_y[i] - centroids_y[j], 2));
-            }
-            result[i] = blaze::argmin(temp);
-        }
-        return std::move(result);
-    }
+        blaze::DynamicMatrix<double> centroids(num_centroids, points.columns());
 
-    // generates new centroids as the centers of clusters
-    blaze::DynamicMatrix<double> kmeans::move_centroids(
-        blaze::DynamicMatrix<double> const& points,
-        blaze::DynamicVector<std::size_t>&& closest,
-        blaze::DynamicMatrix<double>&& centroids,
-        std::size_t num_points, std::size_t num_centroids) const
-    {
-        blaze::DynamicMatrix<double> result(num_centroids, 2, 0.0);
-        std::size_t count;
-        for (size_t k = 0; k != num_centroids; ++k)
+        std::vector<std::size_t> indices =
+            kmeans_random_indices(points.rows(), num_centroids);
+        for (std::size_t i = 0; i != num_centroids; ++i)
         {
-            count = 0;
-            for (size_t i = 0; i != num_points; ++i)
-            {
-                if (closest[i] == k)
-                {
-                    blaze::row(result, k) += blaze::row(points, i);
-                    count += 1;
-                }
-            }
-            if (count != 0)
-            {
-                blaze::row(result, k) /= count;
-            }
+            blaze::row(centroids, i) = blaze::row(points, indices[i]);
         }
-        return std::move(result);
+        return centroids;
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -172,13 +106,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the kmeans algorithm primitive requires for the first "
                     "argument, points, to represent a matrix"));
         }
-        auto const points = arg0.matrix();
-        if (points.columns() != 2)
+        blaze::DynamicMatrix<double> const points = arg0.matrix();
+        if (points.columns() == 0)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "kmeans::calculate_kmeans",
                 generate_error_message(
                     "the kmeans algorithm primitive requires for the first "
-                    "argument, points, to have exacty 2 columns"));
+                    "argument, points, to have at least one column"));
         }
 
         std::size_t num_centroids = 3;
@@ -227,29 +161,36 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         "initial_centroids to represent a matrix"));
             }
             centroids = arg5.matrix();
-            if (centroids.columns() != 2 || centroids.rows() != num_centroids)
+            if (centroids.columns() != points.columns() ||
+                centroids.rows() != num_centroids)
             {
                 HPX_THROW_EXCEPTION(hpx::bad_parameter,
                     "kmeans::calculate_kmeans",
                     generate_error_message(
                         "the kmeans algorithm primitive requires for the "
-                        "initial_centroids to have num_centroids rows and 2 "
-                        "columns"));
+                        "initial_centroids to have num_centroids rows and as "
+                        "many columns as the points"));
             }
         }
         else
         {
-            centroids = initialize_centroids(points, num_points, num_centroids);
+            if (num_centroids > num_points)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans algorithm primitive requires for the "
+                        "number of points to be not smaller than the number "
+                        "of centroids"));
+            }
+            centroids = initialize_centroids(points, num_centroids);
         }
 
         // kmeans calculations
-        blaze::DynamicVector<std::size_t> closest;
         for (std::size_t i = 0; i != iterations; ++i)
         {
-            closest =
-                closest_centroids(points, centroids, num_points, num_centroids);
-            centroids = move_centroids(points, std::move(closest),
-                std::move(centroids), num_points, num_centroids);
+            centroids = kmeans_move_centroids(kmeans_partial_sums(points,
+                kmeans_closest_centroids(points, centroids), num_centroids));
             if (show_result)
             {
                 std::cout << "centroids after iteration " << i << ": "
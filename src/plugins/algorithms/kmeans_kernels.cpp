@@ -0,0 +1,173 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/algorithms/kmeans_kernels.hpp>
+#include <phylanx/util/random.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        // number of points handled by a single task
+        constexpr std::size_t kmeans_block_size = 1024;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicVector<std::size_t> kmeans_closest_centroids(
+        blaze::DynamicMatrix<double> const& points,
+        blaze::DynamicMatrix<double> const& centroids)
+    {
+        std::size_t num_points = points.rows();
+        std::size_t num_features = points.columns();
+        std::size_t num_centroids = centroids.rows();
+
+        // ||x||^2 is the same for all centroids and does not influence which
+        // of the centroids is the closest one
+        blaze::DynamicVector<double> centroid_norms(num_centroids);
+        for (std::size_t j = 0; j != num_centroids; ++j)
+        {
+            centroid_norms[j] = blaze::sqrNorm(blaze::row(centroids, j));
+        }
+
+        blaze::DynamicVector<std::size_t> result(num_points);
+
+        std::size_t blocks = (num_points + detail::kmeans_block_size - 1) /
+            detail::kmeans_block_size;
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), blocks,
+            [&](std::size_t block)
+            {
+                std::size_t begin = block * detail::kmeans_block_size;
+                std::size_t rows =
+                    (std::min)(detail::kmeans_block_size, num_points - begin);
+
+                blaze::DynamicMatrix<double> products =
+                    blaze::submatrix(points, begin, 0, rows, num_features) *
+                    blaze::trans(centroids);
+
+                for (std::size_t i = 0; i != rows; ++i)
+                {
+                    std::size_t closest = 0;
+                    double min_distance = (std::numeric_limits<double>::max)();
+                    for (std::size_t j = 0; j != num_centroids; ++j)
+                    {
+                        double distance =
+                            centroid_norms[j] - 2.0 * products(i, j);
+                        if (distance < min_distance)
+                        {
+                            min_distance = distance;
+                            closest = j;
+                        }
+                    }
+                    result[begin + i] = closest;
+                }
+            });
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicMatrix<double> kmeans_partial_sums(
+        blaze::DynamicMatrix<double> const& points,
+        blaze::DynamicVector<std::size_t> const& closest,
+        std::size_t num_centroids)
+    {
+        std::size_t num_points = points.rows();
+        std::size_t num_features = points.columns();
+
+        // each task accumulates into its own matrix, those are combined
+        // afterwards
+        std::size_t num_chunks = (std::max)(std::size_t(1),
+            (std::min)(
+                (num_points + detail::kmeans_block_size - 1) /
+                    detail::kmeans_block_size,
+                std::size_t(hpx::get_os_thread_count())));
+        std::size_t chunk_size = (num_points + num_chunks - 1) / num_chunks;
+
+        std::vector<blaze::DynamicMatrix<double>> partial_sums(num_chunks,
+            blaze::DynamicMatrix<double>(num_centroids, num_features + 1, 0.0));
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), num_chunks,
+            [&](std::size_t chunk)
+            {
+                auto& sums = partial_sums[chunk];
+                std::size_t end =
+                    (std::min)(num_points, (chunk + 1) * chunk_size);
+                for (std::size_t i = chunk * chunk_size; i < end; ++i)
+                {
+                    std::size_t k = closest[i];
+                    blaze::subvector(blaze::row(sums, k), 0, num_features) +=
+                        blaze::row(points, i);
+                    sums(k, num_features) += 1.0;
+                }
+            });
+
+        for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
+        {
+            partial_sums[0] += partial_sums[chunk];
+        }
+        return std::move(partial_sums[0]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicMatrix<double> kmeans_move_centroids(
+        blaze::DynamicMatrix<double> const& sums)
+    {
+        std::size_t num_centroids = sums.rows();
+        std::size_t num_features = sums.columns() - 1;
+
+        blaze::DynamicMatrix<double> result(num_centroids, num_features, 0.0);
+        for (std::size_t k = 0; k != num_centroids; ++k)
+        {
+            double count = sums(k, num_features);
+            if (count != 0)
+            {
+                blaze::row(result, k) =
+                    blaze::subvector(blaze::row(sums, k), 0, num_features) /
+                    count;
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::size_t> kmeans_random_indices(
+        std::size_t num_points, std::size_t num_centroids)
+    {
+        std::uniform_int_distribution<std::int64_t> distribution(
+            0, num_points - 1);
+
+        std::vector<std::size_t> indices;
+        indices.reserve(num_centroids);
+
+        for (std::size_t i = 0; i != num_centroids; ++i)
+        {
+            std::size_t rand_index = distribution(util::rng_);
+
+            // rand indices should be unique
+            while (std::find(indices.begin(), indices.end(), rand_index) !=
+                indices.end())
+            {
+                rand_index = distribution(util::rng_);
+            }
+            indices.push_back(rand_index);
+        }
+        return indices;
+    }
+}}}
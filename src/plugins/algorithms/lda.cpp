@@ -63,15 +63,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type && args) const
     {
         // extract arguments
-        auto arg1 = extract_numeric_value(args[0], name_, codename_);
-        if (arg1.num_dimensions() != 2)
-        {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter, "lda_trainer::eval",
-                generate_error_message(
-                    "the lda_trainer algorithm primitive requires for the first "
-                    "argument ('n_topics') to represent a matrix"));
-        }
-        auto topics = arg1.scalar();
+        auto topics = extract_scalar_integer_value(args[0], name_, codename_);
 
         auto arg2 = extract_numeric_value(args[1], name_, codename_);
         if (arg2.num_dimensions() != 0)
@@ -134,21 +126,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 */
 
-        if (arg5.num_dimensions() > 0)
+        if (arg5.num_dimensions() != 2)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "lda_trainer::eval",
                 generate_error_message(
                     "the lda_trainer algorithm primitive requires for the second "
                     "argument ('word_doc_mat') to represent a matrix"));
         }
-        auto word_doc_mat = arg5.matrix();
 
         using lda_trainer_t =
             phylanx::execution_tree::primitives::lda_trainer_impl;
 
         lda_trainer_t trainer(alpha, beta);
 
-        auto result = trainer(word_doc_mat, topics, iterations);
+        // sparse word-document matrices are processed without densifying
+        auto result = arg5.is_sparse() ?
+            trainer(arg5.sparse_matrix(), topics, iterations) :
+            trainer(lda_trainer_t::dmatrix_t{arg5.matrix()}, topics,
+                iterations);
 
         return primitive_argument_type
         {
@@ -162,7 +157,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> lda_trainer::eval(
         primitive_arguments_type const& operands,
-        primitive_arguments_type const& args) const
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (operands.size() != 5)
         {
@@ -200,7 +195,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     return this_->calculate_lda_trainer(std::move(args));
                 }),
             detail::map_operands(
-                operands, functional::value_operand{}, args, name_, codename_));
+                operands, functional::value_operand{}, args, name_, codename_,
+                std::move(ctx)));
     }
 
 /*
@@ -4,7 +4,16 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include "phylanx/plugins/algorithms/lda_trainer.hpp"
+#include "phylanx/util/random.hpp"
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <cstddef>
 #include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
@@ -12,179 +21,407 @@ REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
 /////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives {
 
-// https://bitbucket.org/blaze-lib/blaze/issues/158/random-number-distributions
+// Vose's construction of the alias table
 //
-template< typename Rand    // Random number generator
-        , typename Dist >  // Random distribution
-decltype(auto) random( size_t size, Rand& rand, Dist& dist ) {
-  return blaze::generate( size, [&rand,&dist]( size_t ){
-     return dist( rand );
-  } );
+template< typename F >
+void lda_alias_table::build(const std::int64_t n, F && weight) {
+
+    prob.resize(n);
+    alias.resize(n);
+
+    std::vector<double> scaled(n);
+    total_weight = 0.0;
+    for(std::int64_t i = 0; i < n; ++i) {
+        scaled[i] = weight(i);
+        total_weight += scaled[i];
+    }
+
+    std::vector<std::int64_t> small, large;
+    for(std::int64_t i = 0; i < n; ++i) {
+        scaled[i] *= static_cast<double>(n) / total_weight;
+        if(scaled[i] < 1.0) { small.push_back(i); }
+        else { large.push_back(i); }
+    }
+
+    while(!small.empty() && !large.empty()) {
+        const std::int64_t s = small.back();
+        small.pop_back();
+        const std::int64_t l = large.back();
+
+        prob[s] = scaled[s];
+        alias[s] = l;
+
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        if(scaled[l] < 1.0) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+
+    // remaining entries are (up to rounding errors) exactly one
+    for(const std::int64_t i : large) { prob[i] = 1.0; alias[i] = i; }
+    for(const std::int64_t i : small) { prob[i] = 1.0; alias[i] = i; }
 }
 
-void lda_trainer_impl::gibbs(
+template< typename Engine >
+std::int64_t lda_alias_table::sample(Engine & eng) const {
+
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    const double u = dist(eng) * static_cast<double>(prob.size());
+    const std::int64_t i = (std::min)(
+        static_cast<std::int64_t>(u),
+        static_cast<std::int64_t>(prob.size()) - 1);
+
+    return (u - static_cast<double>(i)) < prob[i] ? i : alias[i];
+}
+
+// visit the (document, word, count) entries of the word-document matrix,
+// sparse matrices only visit their non-zero entries
+//
+template< typename F >
+void for_each_word(
     const blaze::DynamicMatrix<double> & word_doc_mat,
-    const double alpha,
-    const double beta,
-    blaze::DynamicVector<std::int64_t> & z,
-    blaze::DynamicMatrix<double> & wp0,
-    blaze::DynamicMatrix<double> & dp,
-    blaze::DynamicVector<double, blaze::rowVector> & ztot) {
+    const std::int64_t d, F && f) {
 
-    const std::int64_t D = word_doc_mat.rows();
     const std::int64_t W = word_doc_mat.columns();
-    const std::int64_t T = z.size();
+    for(std::int64_t w = 0; w < W; ++w) {
+        f(w, word_doc_mat(d, w));
+    }
+}
 
-    const double wbeta = static_cast<double>(W) * beta;
-    blaze::DynamicMatrix<double> wp(W, T);
-    wp = wp0;
+template< typename F >
+void for_each_word(
+    const blaze::CompressedMatrix<double> & word_doc_mat,
+    const std::int64_t d, F && f) {
 
-    blaze::DynamicVector<double> lhs(T), rhs(T), zprob(T), probs(T);
+    for(auto it = word_doc_mat.cbegin(d); it != word_doc_mat.cend(d); ++it) {
+        f(static_cast<std::int64_t>(it->index()), it->value());
+    }
+}
 
-    using row_iterator =
-        blaze::DynamicMatrix<double, blaze::rowMajor>::Iterator;
+// the tokens of all documents, stored document by document: the tokens of
+// document d are [doc_offset[d], doc_offset[d+1])
+//
+struct lda_corpus {
+    std::vector<std::int64_t> doc_offset;
+    std::vector<std::int64_t> token_word;
+};
+
+template< typename Matrix >
+lda_corpus make_lda_corpus(const Matrix & word_doc_mat) {
+
+    const std::int64_t D = word_doc_mat.rows();
 
-    using vec_iterator =
-        blaze::DynamicVector<double>::Iterator;
+    lda_corpus corpus;
+    corpus.doc_offset.resize(D + 1, 0);
 
-    // N (total instance count of words) == sum(word_doc_mat)
-    std::int64_t n = 0;
+    hpx::for_loop(hpx::execution::par, std::int64_t(0), D,
+        [&](const std::int64_t d) {
+            std::int64_t n = 0;
+            for_each_word(word_doc_mat, d,
+                [&](const std::int64_t, const double count) {
+                    n += (std::max)(static_cast<std::int64_t>(count),
+                        std::int64_t(0));
+            });
+            corpus.doc_offset[d + 1] = n;
+    });
 
     for(std::int64_t d = 0; d < D; ++d) {
-        for(std::int64_t w = 0; w < W; ++w) {
+        corpus.doc_offset[d + 1] += corpus.doc_offset[d];
+    }
 
-            const auto wdf =
-                static_cast<std::int64_t>(word_doc_mat(d, w));
+    corpus.token_word.resize(corpus.doc_offset[D]);
+
+    hpx::for_loop(hpx::execution::par, std::int64_t(0), D,
+        [&](const std::int64_t d) {
+            std::int64_t n = corpus.doc_offset[d];
+            for_each_word(word_doc_mat, d,
+                [&](const std::int64_t w, const double count) {
+                    const auto wdf = static_cast<std::int64_t>(count);
+                    for(std::int64_t f = 0; f < wdf; ++f) {
+                        corpus.token_word[n++] = w;
+                    }
+            });
+    });
+
+    return corpus;
+}
 
-            if(wdf < 1) { continue; }
+// the topic counts of the document currently being sampled, the topics
+// with a non-zero count are kept in a list to allow for iterating over
+// them in O(k_d)
+//
+class lda_doc_topics {
 
-            for(std::int64_t f = 0; f < wdf; ++f) {
+    private:
 
-                std::int64_t t = z[n];
-                --ztot[t];
-                --wp(w, t);
-                --dp(d, t);
+    std::vector<std::int64_t> count;
+    std::vector<std::int64_t> pos;
 
-                row_iterator wp_beg = wp.begin(w);
-                row_iterator wp_end = wp.end(w);
+    public:
 
-                std::transform(wp_beg, wp_end, lhs.begin(),
-                    [&beta](const auto& val) {
-                        return val + beta;
-                });
+    std::vector<std::int64_t> topics;
 
-                row_iterator dp_beg = dp.begin(d);
-                row_iterator dp_end = dp.end(d);
+    explicit lda_doc_topics(const std::int64_t T) : count(T, 0), pos(T, 0) {
+    }
 
-                std::transform(dp_beg, dp_end, rhs.begin(),
-                    [&alpha](const auto& val) {
-                        return val + alpha;
-                });
+    std::int64_t operator[](const std::int64_t t) const { return count[t]; }
 
-                vec_iterator ztot_beg = ztot.begin();
-                vec_iterator ztot_end = ztot.end();
+    void increment(const std::int64_t t) {
+        if(count[t]++ == 0) {
+            pos[t] = static_cast<std::int64_t>(topics.size());
+            topics.push_back(t);
+        }
+    }
 
-                std::transform(ztot_beg, ztot_end, zprob.begin(),
-                    [&wbeta](const auto& val) {
-                        return val + wbeta;
-                });
+    void decrement(const std::int64_t t) {
+        if(--count[t] == 0) {
+            const std::int64_t last = topics.back();
+            topics[pos[t]] = last;
+            pos[last] = pos[t];
+            topics.pop_back();
+        }
+    }
 
-                probs = (lhs * ( rhs / zprob ));
+    void clear() {
+        for(const std::int64_t t : topics) { count[t] = 0; }
+        topics.clear();
+    }
+};
 
-                double max_prob = std::abs(rand() / (RAND_MAX + 1.0)) *
-                    (*std::max_element(probs.begin(), probs.end())) * 2.0;
+// the updates of the word-topic counts done by one task during a sweep
+//
+struct lda_partition_delta {
+    std::unordered_map<std::int64_t, std::int64_t> wp;
+    std::vector<std::int64_t> ztot;
+};
 
-                t = static_cast<std::int64_t>(
-                    std::abs(rand() / (RAND_MAX + 1.0)) * T);
+// sample the topics of the tokens of the documents [d_begin, d_end)
+//
+template< typename Engine >
+void sample_partition(
+    const lda_corpus & corpus,
+    const std::int64_t d_begin,
+    const std::int64_t d_end,
+    const double alpha,
+    const double beta,
+    const blaze::DynamicMatrix<double> & wp,
+    const blaze::DynamicVector<double, blaze::rowVector> & ztot,
+    const std::vector<lda_alias_table> & word_tables,
+    blaze::DynamicVector<std::int64_t> & z,
+    lda_partition_delta & delta,
+    Engine & eng) {
 
-                while(max_prob > 1e-10) {
-                    max_prob -= probs[t];
-                    t = ((t+1) % T);
+    const std::int64_t W = wp.rows();
+    const std::int64_t T = wp.columns();
+    const double wbeta = static_cast<double>(W) * beta;
+
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    lda_doc_topics dt(T);
+
+    for(std::int64_t d = d_begin; d < d_end; ++d) {
+
+        const std::int64_t n_begin = corpus.doc_offset[d];
+        const std::int64_t n_end = corpus.doc_offset[d + 1];
+
+        for(std::int64_t n = n_begin; n < n_end; ++n) {
+            dt.increment(z[n]);
+        }
+
+        for(std::int64_t n = n_begin; n < n_end; ++n) {
+
+            const std::int64_t w = corpus.token_word[n];
+            const std::int64_t s = z[n];
+
+            dt.decrement(s);
+            --delta.wp[w * T + s];
+            --delta.ztot[s];
+
+            // current word-topic and topic counts as seen by this task
+            const auto nwt = [&](const std::int64_t t) {
+                auto it = delta.wp.find(w * T + t);
+                return wp(w, t) +
+                    (it != delta.wp.end() ? double(it->second) : 0.0);
+            };
+            const auto nt = [&](const std::int64_t t) {
+                return ztot[t] + double(delta.ztot[t]);
+            };
+
+            // exact sparse part of the proposal, O(k_d)
+            double sparse_total = 0.0;
+            for(const std::int64_t t : dt.topics) {
+                sparse_total += dt[t] * (nwt(t) + beta) / (nt(t) + wbeta);
+            }
+
+            const lda_alias_table & table = word_tables[w];
+
+            std::int64_t t = s;
+            double u = dist(eng) * (sparse_total + table.total());
+            if(u < sparse_total) {
+                for(const std::int64_t k : dt.topics) {
+                    t = k;
+                    u -= dt[k] * (nwt(k) + beta) / (nt(k) + wbeta);
+                    if(u <= 0.0) { break; }
                 }
+            }
+            else {
+                t = table.sample(eng);
+            }
 
-                z[n] = t;
-                ++ztot[t];
-                ++wp(w, t);
-                ++dp(d, t);
-                ++n;
+            // Metropolis-Hastings correction for the stale alias table
+            if(t != s) {
+                const auto target = [&](const std::int64_t k) {
+                    return (dt[k] + alpha) * (nwt(k) + beta) /
+                        (nt(k) + wbeta);
+                };
+                const auto proposal = [&](const std::int64_t k) {
+                    return dt[k] * (nwt(k) + beta) / (nt(k) + wbeta) +
+                        alpha * (wp(w, k) + beta) / (ztot[k] + wbeta);
+                };
+
+                const double accept = (target(t) * proposal(s)) /
+                    (target(s) * proposal(t));
+                if(accept < 1.0 && dist(eng) >= accept) {
+                    t = s;
+                }
             }
+
+            z[n] = t;
+            dt.increment(t);
+            ++delta.wp[w * T + t];
+            ++delta.ztot[t];
         }
+
+        dt.clear();
     }
 }
 
 using dmatrix_t = blaze::DynamicMatrix<double>;
+using smatrix_t = blaze::CompressedMatrix<double>;
 using dvector_t = blaze::DynamicVector<double>;
 using i64vector_t = blaze::DynamicVector<std::int64_t>;
 
-std::tuple<dmatrix_t, dmatrix_t> lda_trainer_impl::operator()(
-    const dmatrix_t & word_doc_mat,
+template< typename Matrix >
+std::tuple<dmatrix_t, dmatrix_t> lda_trainer_impl::train(
+    const Matrix & word_doc_mat,
     const std::int64_t T,
     const std::int64_t iter) {
 
     const std::int64_t D = word_doc_mat.rows();
     const std::int64_t W = word_doc_mat.columns();
-    const std::int64_t N =
-        static_cast<std::int64_t>(blaze::sum(word_doc_mat));
+    const double wbeta = static_cast<double>(W) * beta;
 
-    dmatrix_t wp(W, T); // this component stores information that
-                            // contains a distributed reduce and scatter
-                            //
-    dmatrix_t dp(D, T); // this component is distributed, but unchanging
-    i64vector_t z(N);
+    const lda_corpus corpus = make_lda_corpus(word_doc_mat);
+    const std::int64_t N = corpus.doc_offset[D];
 
-    {
-        // values near the mean are the most likely
-        // standard deviation affects the dispersion of generated values from the mean
-        {
-            std::random_device rd{};
-            std::default_random_engine eng{rd()};
-            std::uniform_int_distribution<> dist(0, T-1);
-            z = random(N, eng, dist);
-        }
+    // partition the documents such that each task samples roughly the
+    // same number of tokens
+    const std::int64_t P = (std::max)(std::int64_t(1), (std::min)(D,
+        static_cast<std::int64_t>(hpx::get_os_thread_count())));
 
-        blaze::DynamicVector<double, blaze::columnwise> word_index_pos;
-        blaze::DynamicVector<double, blaze::rowwise> doc_index_pos;
+    std::vector<std::int64_t> doc_begin(P + 1, D);
+    doc_begin[0] = 0;
+    for(std::int64_t p = 1; p < P; ++p) {
+        doc_begin[p] = std::lower_bound(corpus.doc_offset.begin(),
+            corpus.doc_offset.end() - 1, (N * p) / P) -
+            corpus.doc_offset.begin();
+    }
 
-        word_index_pos = blaze::sum<blaze::rowwise>(word_doc_mat);
-        doc_index_pos = blaze::sum<blaze::columnwise>(word_doc_mat);
+    // the random numbers only depend on the seed, the sweep, and the
+    // partition, which makes runs reproducible after set_seed
+    const std::uint64_t key = util::next_random_key();
 
-        // word and doc topic updates are parallel blocks
-        {
-            std::int64_t k = 0;
-            for(std::int64_t i = 0; i < W; ++i) {
-                for(std::int64_t j = 0; j < word_index_pos[i]; ++j) {
-                    wp(i, z[k]) += 1.0;
-                    ++k;
-                }
-            }
-        }
+    dmatrix_t wp(W, T, 0.0);
+    blaze::DynamicVector<double, blaze::rowVector> ztot(T, 0.0);
+    i64vector_t z(N);
 
-        {
-            std::int64_t k = 0;
-            for(std::int64_t i = 0; i < D; ++i) {
-                for(std::int64_t j = 0; j < doc_index_pos[i]; ++j) {
-                    dp(i, z[k]) += 1.0;
-                    ++k;
-                }
+    std::vector<lda_partition_delta> deltas(P);
+
+    // merge the updates of all tasks into the global counts
+    const auto merge = [&]() {
+        for(auto & delta : deltas) {
+            for(const auto & entry : delta.wp) {
+                wp(entry.first / T, entry.first % T) += entry.second;
+            }
+            for(std::int64_t t = 0; t < T; ++t) {
+                ztot[t] += delta.ztot[t];
             }
+            delta.wp.clear();
+            delta.ztot.assign(T, 0);
         }
-    }
+    };
+
+    // random initial topic assignments
+    hpx::for_loop(hpx::execution::par, std::int64_t(0), P,
+        [&](const std::int64_t p) {
+            util::philox_engine eng(key, static_cast<std::uint64_t>(p));
+            std::uniform_int_distribution<std::int64_t> dist(0, T - 1);
+
+            auto & delta = deltas[p];
+            delta.ztot.assign(T, 0);
+            for(std::int64_t n = corpus.doc_offset[doc_begin[p]];
+                n < corpus.doc_offset[doc_begin[p + 1]]; ++n) {
+                z[n] = dist(eng);
+                ++delta.wp[corpus.token_word[n] * T + z[n]];
+                ++delta.ztot[z[n]];
+            }
+    });
+    merge();
 
-    blaze::DynamicMatrix<double> wp0(W, T);
-    blaze::DynamicVector<double, blaze::rowVector> ztot0; //(T);
+    std::vector<lda_alias_table> word_tables(W);
 
     for(std::int64_t i = 0; i < iter; ++i) {
-        wp0 = wp;
-        ztot0 = blaze::eval( blaze::sum<blaze::columnwise>(wp0) );
-        // parallel portion
-        //
-        // z, wp, dp
-        //
-        gibbs(word_doc_mat, alpha, beta, z, wp, dp, ztot0);
-        wp = wp0 + (wp - wp0);
+
+        // alias tables for the dense part of the proposal distribution,
+        // built from the counts at the start of the sweep
+        hpx::for_loop(hpx::execution::par, std::int64_t(0), W,
+            [&](const std::int64_t w) {
+                word_tables[w].build(T, [&](const std::int64_t t) {
+                    return alpha * (wp(w, t) + beta) / (ztot[t] + wbeta);
+                });
+        });
+
+        hpx::for_loop(hpx::execution::par, std::int64_t(0), P,
+            [&](const std::int64_t p) {
+                util::philox_engine eng(key,
+                    (static_cast<std::uint64_t>(i + 1) << 32) +
+                        static_cast<std::uint64_t>(p));
+
+                sample_partition(corpus, doc_begin[p], doc_begin[p + 1],
+                    alpha, beta, wp, ztot, word_tables, z, deltas[p], eng);
+        });
+
+        merge();
     }
 
+    // document-topic counts
+    dmatrix_t dp(D, T, 0.0);
+    hpx::for_loop(hpx::execution::par, std::int64_t(0), D,
+        [&](const std::int64_t d) {
+            for(std::int64_t n = corpus.doc_offset[d];
+                n < corpus.doc_offset[d + 1]; ++n) {
+                dp(d, z[n]) += 1.0;
+            }
+    });
+
     return std::make_tuple(wp, dp);
 }
 
+std::tuple<dmatrix_t, dmatrix_t> lda_trainer_impl::operator()(
+    const dmatrix_t & word_doc_mat,
+    const std::int64_t T,
+    const std::int64_t iter) {
+
+    return train(word_doc_mat, T, iter);
+}
+
+std::tuple<dmatrix_t, dmatrix_t> lda_trainer_impl::operator()(
+    const smatrix_t & word_doc_mat,
+    const std::int64_t T,
+    const std::int64_t iter) {
+
+    return train(word_doc_mat, T, iter);
+}
+
 } } } // end namespaces
@@ -0,0 +1,826 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/compiler/elementwise_fusion.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/arithmetics/fused_elementwise_operation.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const fused_elementwise_operation::match_data =
+    {
+        match_pattern_type{"__fused_elementwise",
+            std::vector<std::string>{"__fused_elementwise(_1, __2)"},
+            &create_fused_elementwise_operation,
+            &create_primitive<fused_elementwise_operation>, R"(
+            program, *args
+            Args:
+
+                program (vector of int) : the postfix encoded expression tree
+                    of elementwise operations as generated by the compiler
+                *args (arg list) : the values referenced by the expression
+
+            Returns:
+
+            The result of evaluating the fused elementwise expression. This
+            primitive is generated by the compiler for nested elementwise
+            operations, it is not meant to be used directly.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        using compiler::fused_opcode;
+
+        // number of elements evaluated at once, all intermediate blocks of
+        // an expression should fit into the L1 cache
+        constexpr std::size_t fused_block_size = 256;
+
+        // minimal number of elements for parallel evaluation
+        constexpr std::size_t fused_parallel_threshold = 65536;
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct fused_operand
+        {
+            T const* data_ = nullptr;       // nullptr for scalar operands
+            std::size_t spacing_ = 0;
+            T value_ = T();
+        };
+
+        template <typename T>
+        using fused_block =
+            blaze::CustomVector<T, blaze::unaligned, blaze::unpadded>;
+
+        template <typename T>
+        typename std::enable_if<std::is_floating_point<T>::value>::type
+        apply_fused_float_op(fused_opcode op, fused_block<T>& b)
+        {
+            switch (op)
+            {
+            case fused_opcode::exp:
+                b = blaze::exp(b);
+                break;
+
+            case fused_opcode::log:
+                b = blaze::log(b);
+                break;
+
+            case fused_opcode::sqrt:
+                b = blaze::sqrt(b);
+                break;
+
+            case fused_opcode::tanh:
+                b = blaze::tanh(b);
+                break;
+
+            case fused_opcode::sigmoid:
+                b = blaze::map(blaze::exp(-b),
+                    [](T x) { return T(1) / (T(1) + x); });
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+        }
+
+        template <typename T>
+        typename std::enable_if<!std::is_floating_point<T>::value>::type
+        apply_fused_float_op(fused_opcode, fused_block<T>&)
+        {
+            // floating point operations are always evaluated using double
+            HPX_ASSERT(false);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // evaluate one block of (at most fused_block_size) elements of the
+        // given row
+        template <typename T>
+        void execute_fused_block(
+            std::vector<fused_elementwise_operation::fused_instruction> const&
+                code,
+            std::vector<fused_operand<T>> const& operands, std::size_t row,
+            std::size_t col, std::size_t count, T* stack, T* dest)
+        {
+            std::size_t top = 0;
+            for (auto const& instr : code)
+            {
+                if (instr.opcode_ == fused_opcode::load)
+                {
+                    T* block = stack + top++ * fused_block_size;
+
+                    auto const& op = operands[instr.arg_];
+                    if (op.data_ == nullptr)
+                    {
+                        std::fill(block, block + count, op.value_);
+                    }
+                    else
+                    {
+                        T const* src = op.data_ + row * op.spacing_ + col;
+                        std::copy(src, src + count, block);
+                    }
+                    continue;
+                }
+
+                std::size_t n = instr.arg_;
+                top -= n;
+
+                fused_block<T> lhs(stack + top * fused_block_size, count);
+                switch (instr.opcode_)
+                {
+                case fused_opcode::add:
+                    for (std::size_t i = 1; i != n; ++i)
+                    {
+                        lhs += fused_block<T>(
+                            stack + (top + i) * fused_block_size, count);
+                    }
+                    break;
+
+                case fused_opcode::sub:
+                    for (std::size_t i = 1; i != n; ++i)
+                    {
+                        lhs -= fused_block<T>(
+                            stack + (top + i) * fused_block_size, count);
+                    }
+                    break;
+
+                case fused_opcode::mul:
+                    for (std::size_t i = 1; i != n; ++i)
+                    {
+                        lhs *= fused_block<T>(
+                            stack + (top + i) * fused_block_size, count);
+                    }
+                    break;
+
+                case fused_opcode::div:
+                    for (std::size_t i = 1; i != n; ++i)
+                    {
+                        lhs /= fused_block<T>(
+                            stack + (top + i) * fused_block_size, count);
+                    }
+                    break;
+
+                case fused_opcode::minus:
+                    lhs = -lhs;
+                    break;
+
+                case fused_opcode::square:
+                    lhs = lhs * lhs;
+                    break;
+
+                default:
+                    apply_fused_float_op(instr.opcode_, lhs);
+                    break;
+                }
+                ++top;
+            }
+
+            HPX_ASSERT(top == 1);
+            std::copy(stack, stack + count, dest);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        inline std::size_t fused_stack_depth(
+            std::vector<fused_elementwise_operation::fused_instruction> const&
+                code)
+        {
+            std::size_t top = 0;
+            std::size_t depth = 0;
+            for (auto const& instr : code)
+            {
+                if (instr.opcode_ == fused_opcode::load)
+                {
+                    depth = (std::max)(depth, ++top);
+                }
+                else
+                {
+                    top -= instr.arg_ - 1;
+                }
+            }
+            return depth;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        ir::node_data<T> run_fused_program(
+            std::vector<fused_elementwise_operation::fused_instruction> const&
+                code,
+            std::vector<ir::node_data<T>>& values, std::size_t ndim,
+            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes)
+        {
+            std::vector<T> stack(fused_stack_depth(code) * fused_block_size);
+
+            std::vector<fused_operand<T>> operands(values.size());
+            if (ndim == 0)
+            {
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    operands[i].value_ = values[i].scalar();
+                }
+
+                T result = T();
+                execute_fused_block(
+                    code, operands, 0, 0, 1, stack.data(), &result);
+                return ir::node_data<T>{result};
+            }
+
+            // reuse the memory of a temporary operand for the result, if
+            // possible
+            ir::node_data<T> result;
+            auto it = std::find_if(values.begin(), values.end(),
+                [&](ir::node_data<T> const& v) {
+                    return !v.is_ref() && v.num_dimensions() == ndim;
+                });
+            if (it != values.end())
+            {
+                result = std::move(*it);
+                *it = result.ref();     // the operand is still being read
+            }
+            else
+            {
+                switch (ndim)
+                {
+                case 1:
+                    result = ir::node_data<T>{
+                        typename ir::node_data<T>::storage1d_type(sizes[0])};
+                    break;
+
+                case 2:
+                    result = ir::node_data<T>{
+                        typename ir::node_data<T>::storage2d_type(
+                            sizes[0], sizes[1])};
+                    break;
+
+                default:
+                    result = ir::node_data<T>{
+                        typename ir::node_data<T>::storage3d_type(
+                            sizes[0], sizes[1], sizes[2])};
+                    break;
+                }
+            }
+
+            // rows of all operands are addressed as 'data_ + row * spacing_'
+            T* out = nullptr;
+            std::size_t out_spacing = 0;
+            switch (ndim)
+            {
+            case 1:
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    if (values[i].num_dimensions() == 0)
+                    {
+                        operands[i].value_ = values[i].scalar();
+                        continue;
+                    }
+                    operands[i].data_ = values[i].vector().data();
+                }
+                out = result.vector().data();
+                break;
+
+            case 2:
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    if (values[i].num_dimensions() == 0)
+                    {
+                        operands[i].value_ = values[i].scalar();
+                        continue;
+                    }
+                    auto m = values[i].matrix();
+                    operands[i].data_ = m.data();
+                    operands[i].spacing_ = m.spacing();
+                }
+                {
+                    auto m = result.matrix();
+                    out = m.data();
+                    out_spacing = m.spacing();
+                }
+                break;
+
+            default:
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    if (values[i].num_dimensions() == 0)
+                    {
+                        operands[i].value_ = values[i].scalar();
+                        continue;
+                    }
+                    auto t = values[i].tensor();
+                    operands[i].data_ = t.data();
+                    operands[i].spacing_ = t.spacing();
+                }
+                {
+                    auto t = result.tensor();
+                    out = t.data();
+                    out_spacing = t.spacing();
+                }
+                break;
+            }
+
+            std::size_t columns = sizes[ndim - 1];
+            std::size_t rows = 1;
+            for (std::size_t i = 0; i != ndim - 1; ++i)
+            {
+                rows *= sizes[i];
+            }
+
+            std::size_t blocks_per_row =
+                (columns + fused_block_size - 1) / fused_block_size;
+            std::size_t num_blocks = rows * blocks_per_row;
+
+            auto run = [&](std::size_t first, std::size_t last,
+                           std::vector<T>& stack) {
+                for (std::size_t b = first; b != last; ++b)
+                {
+                    std::size_t row = b / blocks_per_row;
+                    std::size_t col = (b % blocks_per_row) * fused_block_size;
+                    std::size_t count =
+                        (std::min)(fused_block_size, columns - col);
+
+                    // all loads of a block are done before its result is
+                    // stored, which allows for writing to one of the operands
+                    execute_fused_block(code, operands, row, col, count,
+                        stack.data(), out + row * out_spacing + col);
+                }
+            };
+
+            if (rows * columns < fused_parallel_threshold)
+            {
+                run(0, num_blocks, stack);
+                return result;
+            }
+
+            std::size_t chunks = (std::min)(
+                num_blocks, std::size_t(4 * hpx::get_os_thread_count()));
+
+            hpx::for_loop(hpx::execution::par, std::size_t(0), chunks,
+                [&](std::size_t chunk)
+                {
+                    std::vector<T> chunk_stack(stack.size());
+                    run(chunk * num_blocks / chunks,
+                        (chunk + 1) * num_blocks / chunks, chunk_stack);
+                });
+
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::vector<fused_elementwise_operation::fused_node>
+        parse_fused_program(primitive_argument_type const& program,
+            std::size_t num_leaves, std::string const& name,
+            std::string const& codename)
+        {
+            auto p = extract_integer_value(program, name, codename);
+            if (p.num_dimensions() != 1 || p.size() % 2 != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise_operation::fused_elementwise_operation",
+                    util::generate_error_message(
+                        "the program must be a vector of (opcode, argument) "
+                        "pairs",
+                        name, codename));
+            }
+
+            auto v = p.vector();
+
+            std::vector<fused_elementwise_operation::fused_node> nodes;
+            nodes.reserve(v.size() / 2);
+
+            std::vector<std::size_t> stack;
+            for (std::size_t i = 0; i != v.size(); i += 2)
+            {
+                std::int64_t opcode = v[i];
+                std::int64_t arg = v[i + 1];
+
+                if (opcode < 0 || opcode > std::int64_t(fused_opcode::last))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "fused_elementwise_operation::"
+                            "fused_elementwise_operation",
+                        util::generate_error_message(
+                            "invalid opcode in program", name, codename));
+                }
+
+                fused_elementwise_operation::fused_node n{
+                    fused_opcode(opcode), 0, {}};
+
+                if (n.opcode_ == fused_opcode::load)
+                {
+                    if (arg < 0 || std::size_t(arg) >= num_leaves)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "fused_elementwise_operation::"
+                                "fused_elementwise_operation",
+                            util::generate_error_message(
+                                "invalid argument index in program", name,
+                                codename));
+                    }
+                    n.leaf_ = std::size_t(arg);
+                }
+                else
+                {
+                    if (arg < 1 || std::size_t(arg) > stack.size())
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "fused_elementwise_operation::"
+                                "fused_elementwise_operation",
+                            util::generate_error_message(
+                                "invalid number of arguments in program",
+                                name, codename));
+                    }
+                    n.children_.assign(stack.end() - arg, stack.end());
+                    stack.resize(stack.size() - arg);
+                }
+
+                stack.push_back(nodes.size());
+                nodes.push_back(std::move(n));
+            }
+
+            if (stack.size() != 1)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise_operation::fused_elementwise_operation",
+                    util::generate_error_message(
+                        "the program must produce exactly one value", name,
+                        codename));
+            }
+
+            return nodes;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    fused_elementwise_operation::fused_elementwise_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {
+        if (operands_.size() < 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise_operation::fused_elementwise_operation",
+                generate_error_message(
+                    "the fused_elementwise_operation primitive requires a "
+                    "program and at least one argument"));
+        }
+
+        // the first operand holds the program, the remaining ones are the
+        // leaves of the fused expression
+        nodes_ = detail::parse_fused_program(
+            operands_[0], operands_.size() - 1, name_, codename_);
+        operands_.erase(operands_.begin());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void fused_elementwise_operation::compile_region(std::size_t node,
+        node_data_type t, std::vector<fused_instruction>& code,
+        primitive_arguments_type& leaves,
+        std::vector<node_data_type> const& types,
+        std::vector<std::size_t>& uses) const
+    {
+        auto const& n = nodes_[node];
+        if (n.opcode_ == compiler::fused_opcode::load)
+        {
+            code.push_back(fused_instruction{n.opcode_, n.leaf_});
+            return;
+        }
+
+        if (types[node] != t)
+        {
+            // sub-expressions of a different type are evaluated separately,
+            // this preserves the type promotion semantics of the unfused
+            // primitives
+            leaves.push_back(evaluate_region(node, leaves, types, uses));
+            uses.push_back(1);
+            code.push_back(fused_instruction{
+                compiler::fused_opcode::load, leaves.size() - 1});
+            return;
+        }
+
+        for (std::size_t child : n.children_)
+        {
+            compile_region(child, t, code, leaves, types, uses);
+        }
+        code.push_back(fused_instruction{n.opcode_, n.children_.size()});
+    }
+
+    template <typename T>
+    primitive_argument_type fused_elementwise_operation::evaluate_region(
+        std::vector<fused_instruction>&& code,
+        primitive_arguments_type& leaves, std::vector<std::size_t>& uses) const
+    {
+        // map the leaves referenced by this region onto operand slots
+        std::map<std::size_t, std::size_t> slots;
+        std::vector<std::size_t> counts;
+        for (auto& instr : code)
+        {
+            if (instr.opcode_ == compiler::fused_opcode::load)
+            {
+                auto p = slots.emplace(instr.arg_, slots.size());
+                if (p.second)
+                {
+                    counts.push_back(0);
+                }
+                ++counts[p.first->second];
+                instr.arg_ = p.first->second;
+            }
+        }
+
+        primitive_arguments_type ops(slots.size());
+        for (auto const& slot : slots)
+        {
+            uses[slot.first] -= counts[slot.second];
+            if (uses[slot.first] == 0)
+            {
+                // last use of this value, allow for its memory to be reused
+                ops[slot.second] = std::move(leaves[slot.first]);
+            }
+            else
+            {
+                ops[slot.second] =
+                    extract_ref_value(leaves[slot.first], name_, codename_);
+            }
+        }
+
+        std::size_t ndim = extract_largest_dimension(ops, name_, codename_);
+        auto sizes = extract_largest_dimensions(ops, name_, codename_);
+
+        // broadcast all non-scalar operands to the shape of the result
+        std::vector<ir::node_data<T>> values;
+        values.reserve(ops.size());
+
+        for (auto&& op : std::move(ops))
+        {
+            if (ndim == 0 ||
+                extract_numeric_value_dimension(op, name_, codename_) == 0)
+            {
+                values.emplace_back(
+                    extract_value_scalar<T>(std::move(op), name_, codename_));
+                continue;
+            }
+
+            switch (ndim)
+            {
+            case 1:
+                values.emplace_back(extract_value_vector<T>(
+                    std::move(op), sizes[0], name_, codename_));
+                break;
+
+            case 2:
+                values.emplace_back(extract_value_matrix<T>(
+                    std::move(op), sizes[0], sizes[1], name_, codename_));
+                break;
+
+            case 3:
+                values.emplace_back(extract_value_tensor<T>(std::move(op),
+                    sizes[0], sizes[1], sizes[2], name_, codename_));
+                break;
+
+            default:
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise_operation::evaluate_region",
+                    generate_error_message(
+                        "operands have unsupported number of dimensions"));
+            }
+        }
+
+        return primitive_argument_type{
+            detail::run_fused_program<T>(code, values, ndim, sizes)};
+    }
+
+    primitive_argument_type fused_elementwise_operation::evaluate_region(
+        std::size_t node, primitive_arguments_type& leaves,
+        std::vector<node_data_type> const& types,
+        std::vector<std::size_t>& uses) const
+    {
+        node_data_type t = types[node];
+
+        std::vector<fused_instruction> code;
+        compile_region(node, t, code, leaves, types, uses);
+
+        switch (t)
+        {
+        case node_data_type_bool:
+            return evaluate_region<std::uint8_t>(std::move(code), leaves, uses);
+
+        case node_data_type_int64:
+            return evaluate_region<std::int64_t>(std::move(code), leaves, uses);
+
+        case node_data_type_float:
+            return evaluate_region<float>(std::move(code), leaves, uses);
+
+        case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_double:
+            return evaluate_region<double>(std::move(code), leaves, uses);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "fused_elementwise_operation::evaluate_region",
+            generate_error_message("operand has unsupported type"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // evaluate the expression tree rooted at the given node by invoking the
+    // original (unfused) primitives
+    primitive_argument_type fused_elementwise_operation::evaluate_unfused(
+        std::size_t node, primitive_arguments_type& leaves,
+        std::vector<std::size_t>& uses, eval_context const& ctx) const
+    {
+        auto const& n = nodes_[node];
+        if (n.opcode_ == compiler::fused_opcode::load)
+        {
+            if (--uses[n.leaf_] == 0)
+            {
+                return std::move(leaves[n.leaf_]);
+            }
+            return extract_ref_value(leaves[n.leaf_], name_, codename_);
+        }
+
+        primitive_arguments_type ops;
+        ops.reserve(n.children_.size());
+        for (std::size_t child : n.children_)
+        {
+            ops.push_back(evaluate_unfused(child, leaves, uses, ctx));
+        }
+
+        compiler::fusable_operation const* op =
+            compiler::find_fusable_operation(n.opcode_);
+        HPX_ASSERT(op != nullptr);
+
+        // generic primitives (square, exp, etc.) derive the function to
+        // invoke from their name
+        std::string name(op->name_);
+        compiler::primitive_name_parts name_parts;
+        if (compiler::parse_primitive_name(name_, name_parts))
+        {
+            name_parts.primitive = name;
+            name = compiler::compose_primitive_name(name_parts);
+        }
+
+        primitive p = create_primitive_component(hpx::find_here(), op->name_,
+            std::move(ops), name, codename_, false);
+        return p.eval(hpx::launch::sync, ctx);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type fused_elementwise_operation::evaluate(
+        primitive_arguments_type&& leaves, eval_context const& ctx) const
+    {
+        using compiler::fused_opcode;
+
+        // the compiler can't know the types of the leaves, __add for instance
+        // concatenates lists and strings, fall back to the unfused primitives
+        // whenever a leaf does not refer to numeric data
+        bool all_numeric = std::all_of(leaves.begin(), leaves.end(),
+            [](primitive_argument_type const& leaf)
+            {
+                return extract_common_type(leaf) != node_data_type_unknown;
+            });
+
+        if (!all_numeric)
+        {
+            std::vector<std::size_t> uses(leaves.size(), 0);
+            for (auto const& n : nodes_)
+            {
+                if (n.opcode_ == fused_opcode::load)
+                {
+                    ++uses[n.leaf_];
+                }
+            }
+            return evaluate_unfused(nodes_.size() - 1, leaves, uses, ctx);
+        }
+
+        // determine the result type of each node, this mirrors the type
+        // handling of the corresponding (unfused) primitives
+        std::vector<node_data_type> types(nodes_.size());
+        std::vector<std::size_t> uses(leaves.size(), 0);
+
+        for (std::size_t i = 0; i != nodes_.size(); ++i)
+        {
+            auto const& n = nodes_[i];
+            switch (n.opcode_)
+            {
+            case fused_opcode::load:
+                types[i] = extract_common_type(leaves[n.leaf_]);
+                ++uses[n.leaf_];
+                continue;
+
+            case fused_opcode::add: HPX_FALLTHROUGH;
+            case fused_opcode::sub: HPX_FALLTHROUGH;
+            case fused_opcode::mul: HPX_FALLTHROUGH;
+            case fused_opcode::div:
+                {
+                    node_data_type t = node_data_type_unknown;
+                    for (std::size_t child : n.children_)
+                    {
+                        t = (std::min)(t, types[child]);
+                    }
+                    types[i] = t;
+                }
+                break;
+
+            case fused_opcode::minus:
+                types[i] = types[n.children_[0]];
+                break;
+
+            case fused_opcode::square:
+                // square retains integer and single precision types only
+                types[i] = types[n.children_[0]] == node_data_type_int64 ||
+                        types[n.children_[0]] == node_data_type_float ?
+                    types[n.children_[0]] :
+                    node_data_type_double;
+                break;
+
+            default:
+                // exp, log, sqrt, tanh, and sigmoid retain single precision
+                types[i] = types[n.children_[0]] == node_data_type_float ?
+                    node_data_type_float :
+                    node_data_type_double;
+                break;
+            }
+
+            if (types[i] == node_data_type_unknown)
+            {
+                types[i] = node_data_type_double;
+            }
+        }
+
+        return evaluate_region(nodes_.size() - 1, leaves, types, uses);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> fused_elementwise_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.empty())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise_operation::eval",
+                generate_error_message(
+                    "the fused_elementwise_operation primitive requires at "
+                    "least one operand"));
+        }
+
+        for (auto const& operand : operands)
+        {
+            if (!valid(operand))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise_operation::eval",
+                    generate_error_message(
+                        "the fused_elementwise_operation primitive requires "
+                        "that the arguments given by the operands array are "
+                        "valid"));
+            }
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_), ctx](primitive_arguments_type&& leaves)
+            ->  primitive_argument_type
+            {
+                annotation_wrapper wrap(leaves);
+                return wrap.propagate(this_->evaluate(std::move(leaves), ctx),
+                    this_->name_, this_->codename_);
+            }),
+            detail::map_operands(
+                operands, functional::value_operand{}, args,
+                name_, codename_, ctx));
+    }
+}}}
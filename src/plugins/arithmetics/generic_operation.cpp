@@ -152,8 +152,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
@@ -162,6 +165,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic0d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float:
+            return generic0d(
+                extract_float_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -179,8 +186,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
@@ -189,6 +199,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic1d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float:
+            return generic1d(
+                extract_float_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -206,8 +220,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
@@ -216,6 +233,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic2d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float:
+            return generic2d(
+                extract_float_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -233,8 +254,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
@@ -243,6 +267,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic3d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float:
+            return generic3d(
+                extract_float_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
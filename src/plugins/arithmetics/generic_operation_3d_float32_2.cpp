@@ -0,0 +1,35 @@
+// Copyright (c) 2018 Tianyi Zhang
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+
+#include <phylanx/plugins/arithmetics/generic_operation.hpp>
+#include <phylanx/plugins/arithmetics/generic_operation_3d.hpp>
+#include <phylanx/plugins/arithmetics/generic_operation_3d_definitions.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    GENERIC_OPERATION_3D_INSTANTIATION(log, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(log2, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(log10, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(sin, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(cos, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(tan, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(sinh, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(cosh, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(tanh, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(asin, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(acos, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(atan, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(asinh, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(acosh, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(atanh, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(erf, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(erfc, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(square, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(sign, float);
+}}}
+
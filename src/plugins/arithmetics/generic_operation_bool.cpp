@@ -119,6 +119,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_double:
         case node_data_type_bool:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return generic0d_bool(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -146,6 +147,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_double:
         case node_data_type_bool:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return generic1d_bool(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -173,6 +175,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_double:
         case node_data_type_bool:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return generic2d_bool(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -200,6 +203,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_double:
         case node_data_type_bool:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return generic3d_bool(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -8,9 +8,12 @@
 #include <phylanx/config.hpp>
 #include <phylanx/plugins/arithmetics/mul_operation.hpp>
 #include <phylanx/plugins/arithmetics/numeric_impl.hpp>
+#include <phylanx/plugins/common/sparse_operations.hpp>
 #include <phylanx/util/detail/mul_simd.hpp>
 #include <phylanx/util/blaze_traits.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <type_traits>
@@ -138,6 +141,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type mul_operation::handle_numeric_operands_helper(
         primitive_arguments_type&& ops) const
     {
+        // sparse operands are multiplied pair-wise to keep the data sparse
+        if (std::any_of(ops.begin(), ops.end(),
+                [](primitive_argument_type const& op)
+                {
+                    return is_sparse_operand(op);
+                }))
+        {
+            primitive_argument_type result = std::move(ops[0]);
+            for (std::size_t i = 1; i != ops.size(); ++i)
+            {
+                result = handle_numeric_operands_helper<T>(
+                    std::move(result), std::move(ops[i]));
+            }
+            return result;
+        }
+
         if (extract_largest_dimension(ops, name_, codename_) ==
             extract_smallest_dimension(ops, name_, codename_))
         {
@@ -160,11 +179,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template primitive_argument_type
     mul_operation::handle_numeric_operands_helper<double>(
         primitive_arguments_type&& ops) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<float>(
+        primitive_arguments_type&& ops) const;
 
     template <typename T>
     primitive_argument_type mul_operation::handle_numeric_operands_helper(
         primitive_argument_type&& op1, primitive_argument_type&& op2) const
     {
+        if (is_sparse_operand(op1) || is_sparse_operand(op2))
+        {
+            return common::sparse_mul(
+                std::move(op1), std::move(op2), name_, codename_);
+        }
+
         return this->base_type::handle_numeric_operands_helper<T>(
             std::move(op1), std::move(op2));
     }
@@ -178,4 +206,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template primitive_argument_type
     mul_operation::handle_numeric_operands_helper<double>(
         primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<float>(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const;
 }}}
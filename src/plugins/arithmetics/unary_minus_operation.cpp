@@ -133,6 +133,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg0d(extract_value_scalar<std::int64_t>(
                 std::move(op), name_, codename_));
 
+        case node_data_type_float:
+            return neg0d(
+                extract_value_scalar<float>(std::move(op), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg0d(
@@ -167,6 +171,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg1d(extract_value_vector<std::int64_t>(
                 std::move(op), sizes[0], name_, codename_));
 
+        case node_data_type_float:
+            return neg1d(extract_value_vector<float>(
+                std::move(op), sizes[0], name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg1d(extract_value_vector<double>(
@@ -201,6 +209,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg2d(extract_value_matrix<std::int64_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
+        case node_data_type_float:
+            return neg2d(extract_value_matrix<float>(
+                std::move(op), sizes[0], sizes[1], name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg2d(extract_value_matrix<double>(
@@ -235,6 +247,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg3d(extract_value_matrix<std::int64_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
+        case node_data_type_float:
+            return neg3d(extract_value_matrix<float>(
+                std::move(op), sizes[0], sizes[1], name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg3d(extract_value_matrix<double>(
@@ -0,0 +1,41 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/autodiff/autodiff.hpp>
+#include <phylanx/plugins/plugin_factory.hpp>
+
+PHYLANX_REGISTER_PLUGIN_MODULE();
+
+PHYLANX_REGISTER_PLUGIN_FACTORY(conv1d_grad_input_plugin,
+    phylanx::execution_tree::primitives::conv_gradient_operation::
+        match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(conv1d_grad_kernel_plugin,
+    phylanx::execution_tree::primitives::conv_gradient_operation::
+        match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(conv2d_grad_input_plugin,
+    phylanx::execution_tree::primitives::conv_gradient_operation::
+        match_data[2]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(conv2d_grad_kernel_plugin,
+    phylanx::execution_tree::primitives::conv_gradient_operation::
+        match_data[3]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dot_grad_lhs_plugin,
+    phylanx::execution_tree::primitives::dot_gradient_operation::
+        match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dot_grad_rhs_plugin,
+    phylanx::execution_tree::primitives::dot_gradient_operation::
+        match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(max_pool2d_grad_plugin,
+    phylanx::execution_tree::primitives::pool2d_gradient_operation::
+        match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(avg_pool2d_grad_plugin,
+    phylanx::execution_tree::primitives::pool2d_gradient_operation::
+        match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(unbroadcast_operation_plugin,
+    phylanx::execution_tree::primitives::unbroadcast_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(unreduce_plugin,
+    phylanx::execution_tree::primitives::unreduce_operation::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(unreduce_mean_plugin,
+    phylanx::execution_tree::primitives::unreduce_operation::match_data[1]);
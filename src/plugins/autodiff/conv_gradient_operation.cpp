@@ -0,0 +1,320 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/autodiff/conv_gradient_operation.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const conv_gradient_operation::match_data =
+    {
+        match_pattern_type{"__conv1d_grad_input",
+            std::vector<std::string>{
+                "__conv1d_grad_input(_1, _2, _3, _4, _5, _6)"},
+            &create_conv_gradient_operation,
+            &create_primitive<conv_gradient_operation>, R"(
+            g, x, kernel, padding, strides, dilation_rate
+            Args:
+
+                g (array) : the adjoint of the result of conv1d
+                x, kernel, padding, strides, dilation_rate : the arguments
+                    of conv1d
+
+            Returns:
+
+            The gradient of conv1d with respect to 'x'. This is used by the
+            code generated for grad().)"
+        },
+        match_pattern_type{"__conv1d_grad_kernel",
+            std::vector<std::string>{
+                "__conv1d_grad_kernel(_1, _2, _3, _4, _5, _6)"},
+            &create_conv_gradient_operation,
+            &create_primitive<conv_gradient_operation>, R"(
+            g, x, kernel, padding, strides, dilation_rate
+            Args:
+
+                g (array) : the adjoint of the result of conv1d
+                x, kernel, padding, strides, dilation_rate : the arguments
+                    of conv1d
+
+            Returns:
+
+            The gradient of conv1d with respect to 'kernel'. This is used by
+            the code generated for grad().)"
+        },
+        match_pattern_type{"__conv2d_grad_input",
+            std::vector<std::string>{
+                "__conv2d_grad_input(_1, _2, _3, _4, _5, _6)"},
+            &create_conv_gradient_operation,
+            &create_primitive<conv_gradient_operation>, R"(
+            g, x, kernel, padding, strides, dilation_rate
+            Args:
+
+                g (array) : the adjoint of the result of conv2d
+                x, kernel, padding, strides, dilation_rate : the arguments
+                    of conv2d
+
+            Returns:
+
+            The gradient of conv2d with respect to 'x'. This is used by the
+            code generated for grad().)"
+        },
+        match_pattern_type{"__conv2d_grad_kernel",
+            std::vector<std::string>{
+                "__conv2d_grad_kernel(_1, _2, _3, _4, _5, _6)"},
+            &create_conv_gradient_operation,
+            &create_primitive<conv_gradient_operation>, R"(
+            g, x, kernel, padding, strides, dilation_rate
+            Args:
+
+                g (array) : the adjoint of the result of conv2d
+                x, kernel, padding, strides, dilation_rate : the arguments
+                    of conv2d
+
+            Returns:
+
+            The gradient of conv2d with respect to 'kernel'. This is used by
+            the code generated for grad().)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        conv_gradient_operation::operation extract_conv_gradient_operation(
+            std::string const& name)
+        {
+            compiler::primitive_name_parts name_parts;
+            if (!compiler::parse_primitive_name(name, name_parts))
+            {
+                name_parts.primitive = name;
+            }
+
+            if (name_parts.primitive == "__conv1d_grad_kernel")
+            {
+                return conv_gradient_operation::operation::conv1d_kernel;
+            }
+            if (name_parts.primitive == "__conv2d_grad_input")
+            {
+                return conv_gradient_operation::operation::conv2d_input;
+            }
+            if (name_parts.primitive == "__conv2d_grad_kernel")
+            {
+                return conv_gradient_operation::operation::conv2d_kernel;
+            }
+            return conv_gradient_operation::operation::conv1d_input;
+        }
+    }
+
+    conv_gradient_operation::conv_gradient_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , operation_(detail::extract_conv_gradient_operation(name))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    // strides and dilation_rate are given as a single integer or as a list of
+    // 'count' integers
+    std::array<std::int64_t, 2> conv_gradient_operation::extract_sizes(
+        primitive_argument_type const& arg, std::size_t count,
+        char const* what) const
+    {
+        std::array<std::int64_t, 2> result = {1, 1};
+        if (!is_list_operand_strict(arg))
+        {
+            result.fill(extract_scalar_positive_integer_value_strict(
+                arg, name_, codename_));
+            return result;
+        }
+
+        ir::range sizes = extract_list_value_strict(arg, name_, codename_);
+        if (sizes.size() != count)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "conv_gradient_operation::extract_sizes",
+                generate_error_message(std::string("the ") + what +
+                    " argument has an unexpected number of elements"));
+        }
+
+        std::size_t i = 0;
+        for (auto const& size : sizes)
+        {
+            result[i++] = extract_scalar_positive_integer_value_strict(size);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type conv_gradient_operation::conv1d_gradient(
+        ir::node_data<double>&& g, ir::node_data<double>&& x,
+        ir::node_data<double>&& kernel, std::string const& padding,
+        std::int64_t stride, std::int64_t dilation) const
+    {
+        if (x.num_dimensions() != 3 || kernel.num_dimensions() != 3 ||
+            g.num_dimensions() != 3)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "conv_gradient_operation::conv1d_gradient",
+                generate_error_message(
+                    "the gradient of conv1d requires the input, the kernel, "
+                    "and the adjoint to be tensors"));
+        }
+
+        std::int64_t input_length = x.dimension(1);
+        std::int64_t filter_length = kernel.dimension(0);
+
+        // the result length is known from the adjoint
+        common::conv_dimension length(input_length, filter_length,
+            g.dimension(1),
+            common::conv_padding(
+                padding, input_length, filter_length, stride, dilation),
+            stride, dilation);
+
+        if (operation_ == operation::conv1d_input)
+        {
+            return primitive_argument_type{common::conv1d_gemm_input_gradient(
+                g, common::conv1d_kernel_matrix(kernel), length)};
+        }
+        return primitive_argument_type{common::conv1d_kernel_from_matrix(
+            common::conv1d_gemm_kernel_gradient(x, g, length),
+            filter_length)};
+    }
+
+    primitive_argument_type conv_gradient_operation::conv2d_gradient(
+        ir::node_data<double>&& g, ir::node_data<double>&& x,
+        ir::node_data<double>&& kernel, std::string const& padding,
+        std::array<std::int64_t, 2> const& strides,
+        std::array<std::int64_t, 2> const& dilation) const
+    {
+        if (x.num_dimensions() != 4 || kernel.num_dimensions() != 4 ||
+            g.num_dimensions() != 4)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "conv_gradient_operation::conv2d_gradient",
+                generate_error_message(
+                    "the gradient of conv2d requires the input, the kernel, "
+                    "and the adjoint to be 4d arrays"));
+        }
+
+        std::int64_t input_height = x.dimension(1);
+        std::int64_t input_width = x.dimension(2);
+        std::int64_t filter_height = kernel.dimension(0);
+        std::int64_t filter_width = kernel.dimension(1);
+
+        common::conv_dimension height(input_height, filter_height,
+            g.dimension(1),
+            common::conv_padding(padding, input_height, filter_height,
+                strides[0], dilation[0]),
+            strides[0], dilation[0]);
+        common::conv_dimension width(input_width, filter_width,
+            g.dimension(2),
+            common::conv_padding(padding, input_width, filter_width,
+                strides[1], dilation[1]),
+            strides[1], dilation[1]);
+
+        if (operation_ == operation::conv2d_input)
+        {
+            return primitive_argument_type{common::conv2d_gemm_input_gradient(
+                g, common::conv2d_kernel_matrix(kernel), height, width)};
+        }
+        return primitive_argument_type{common::conv2d_kernel_from_matrix(
+            common::conv2d_gemm_kernel_gradient(x, g, height, width),
+            filter_height, filter_width)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> conv_gradient_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "conv_gradient_operation::eval",
+                generate_error_message(
+                    "the convolution gradient primitives require exactly six "
+                    "operands"));
+        }
+
+        for (auto const& operand : operands)
+        {
+            if (!valid(operand))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "conv_gradient_operation::eval",
+                    generate_error_message(
+                        "the convolution gradient primitives require that "
+                        "the arguments given by the operands array are "
+                        "valid"));
+            }
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+            -> primitive_argument_type
+            {
+                bool is_conv1d =
+                    this_->operation_ == operation::conv1d_input ||
+                    this_->operation_ == operation::conv1d_kernel;
+
+                std::string padding = extract_string_value_strict(
+                    args[3], this_->name_, this_->codename_);
+                if (padding != "valid" && padding != "same" &&
+                    (!is_conv1d || padding != "causal"))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "conv_gradient_operation::eval",
+                        this_->generate_error_message(
+                            "invalid padding. Padding can be either 'valid', "
+                            "'same', or (for conv1d only) 'causal'"));
+                }
+
+                auto strides =
+                    this_->extract_sizes(args[4], is_conv1d ? 1 : 2, "strides");
+                auto dilation = this_->extract_sizes(
+                    args[5], is_conv1d ? 1 : 2, "dilation_rate");
+
+                auto g = extract_numeric_value(
+                    std::move(args[0]), this_->name_, this_->codename_);
+                auto x = extract_numeric_value(
+                    std::move(args[1]), this_->name_, this_->codename_);
+                auto kernel = extract_numeric_value(
+                    std::move(args[2]), this_->name_, this_->codename_);
+
+                if (is_conv1d)
+                {
+                    return this_->conv1d_gradient(std::move(g), std::move(x),
+                        std::move(kernel), padding, strides[0], dilation[0]);
+                }
+                return this_->conv2d_gradient(std::move(g), std::move(x),
+                    std::move(kernel), padding, strides, dilation);
+            }),
+            detail::map_operands(operands, functional::value_operand{},
+                args, name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -0,0 +1,263 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/autodiff/array_helpers.hpp>
+#include <phylanx/plugins/autodiff/dot_gradient_operation.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const dot_gradient_operation::match_data =
+    {
+        match_pattern_type{"__dot_grad_lhs",
+            std::vector<std::string>{"__dot_grad_lhs(_1, _2, _3)"},
+            &create_dot_gradient_operation,
+            &create_primitive<dot_gradient_operation>, R"(
+            g, a, b
+            Args:
+
+                g (array_like) : the adjoint of the result of dot(a, b)
+                a (array_like) : the first argument of dot
+                b (array_like) : the second argument of dot
+
+            Returns:
+
+            The gradient of dot(a, b) with respect to 'a'. This is used by
+            the code generated for grad().)"
+        },
+        match_pattern_type{"__dot_grad_rhs",
+            std::vector<std::string>{"__dot_grad_rhs(_1, _2, _3)"},
+            &create_dot_gradient_operation,
+            &create_primitive<dot_gradient_operation>, R"(
+            g, a, b
+            Args:
+
+                g (array_like) : the adjoint of the result of dot(a, b)
+                a (array_like) : the first argument of dot
+                b (array_like) : the second argument of dot
+
+            Returns:
+
+            The gradient of dot(a, b) with respect to 'b'. This is used by
+            the code generated for grad().)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        dot_gradient_operation::operation extract_dot_gradient_operation(
+            std::string const& name)
+        {
+            compiler::primitive_name_parts name_parts;
+            if (!compiler::parse_primitive_name(name, name_parts))
+            {
+                name_parts.primitive = name;
+            }
+
+            if (name_parts.primitive == "__dot_grad_rhs")
+            {
+                return dot_gradient_operation::operation::rhs;
+            }
+            return dot_gradient_operation::operation::lhs;
+        }
+
+        // sum of the element-wise product of two arrays of the same shape
+        double dot_gradient_sum(
+            ir::node_data<double> const& lhs, ir::node_data<double> const& rhs)
+        {
+            std::vector<double> l = gradient_values(lhs);
+            std::vector<double> r = gradient_values(rhs);
+
+            double result = 0.0;
+            for (std::size_t i = 0; i != l.size(); ++i)
+            {
+                result += l[i] * r[i];
+            }
+            return result;
+        }
+
+        // product of an array with a scalar
+        ir::node_data<double> dot_gradient_scale(
+            ir::node_data<double> const& arg, double scale)
+        {
+            std::vector<double> values = gradient_values(arg);
+            for (double& value : values)
+            {
+                value *= scale;
+            }
+            return gradient_array(
+                values, gradient_shape(arg), arg.num_dimensions());
+        }
+    }
+
+    dot_gradient_operation::dot_gradient_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , operation_(detail::extract_dot_gradient_operation(name))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dot_gradient_operation::dot_gradient_lhs(
+        ir::node_data<double>&& g, ir::node_data<double>&& a,
+        ir::node_data<double>&& b) const
+    {
+        std::size_t a_dims = a.num_dimensions();
+        std::size_t b_dims = b.num_dimensions();
+
+        if (a_dims == 0)
+        {
+            // dot(a, b) = a * b
+            return primitive_argument_type{detail::dot_gradient_sum(g, b)};
+        }
+        if (b_dims == 0)
+        {
+            return primitive_argument_type{
+                detail::dot_gradient_scale(g, b.scalar())};
+        }
+
+        if (a_dims == 1 && b_dims == 1)
+        {
+            blaze::DynamicVector<double> result = g.scalar() * b.vector();
+            return primitive_argument_type{std::move(result)};
+        }
+        if (a_dims == 2 && b_dims == 1)
+        {
+            blaze::DynamicMatrix<double> result =
+                g.vector() * blaze::trans(b.vector());
+            return primitive_argument_type{std::move(result)};
+        }
+        if (a_dims == 1 && b_dims == 2)
+        {
+            blaze::DynamicVector<double> result = b.matrix() * g.vector();
+            return primitive_argument_type{std::move(result)};
+        }
+        if (a_dims == 2 && b_dims == 2)
+        {
+            blaze::DynamicMatrix<double> result =
+                g.matrix() * blaze::trans(b.matrix());
+            return primitive_argument_type{std::move(result)};
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dot_gradient_operation::dot_gradient_lhs",
+            generate_error_message(
+                "the gradient of dot is supported for arguments with at "
+                "most two dimensions only"));
+    }
+
+    primitive_argument_type dot_gradient_operation::dot_gradient_rhs(
+        ir::node_data<double>&& g, ir::node_data<double>&& a,
+        ir::node_data<double>&& b) const
+    {
+        std::size_t a_dims = a.num_dimensions();
+        std::size_t b_dims = b.num_dimensions();
+
+        if (a_dims == 0)
+        {
+            return primitive_argument_type{
+                detail::dot_gradient_scale(g, a.scalar())};
+        }
+        if (b_dims == 0)
+        {
+            return primitive_argument_type{detail::dot_gradient_sum(g, a)};
+        }
+
+        if (a_dims == 1 && b_dims == 1)
+        {
+            blaze::DynamicVector<double> result = g.scalar() * a.vector();
+            return primitive_argument_type{std::move(result)};
+        }
+        if (a_dims == 2 && b_dims == 1)
+        {
+            blaze::DynamicVector<double> result =
+                blaze::trans(a.matrix()) * g.vector();
+            return primitive_argument_type{std::move(result)};
+        }
+        if (a_dims == 1 && b_dims == 2)
+        {
+            blaze::DynamicMatrix<double> result =
+                a.vector() * blaze::trans(g.vector());
+            return primitive_argument_type{std::move(result)};
+        }
+        if (a_dims == 2 && b_dims == 2)
+        {
+            blaze::DynamicMatrix<double> result =
+                blaze::trans(a.matrix()) * g.matrix();
+            return primitive_argument_type{std::move(result)};
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dot_gradient_operation::dot_gradient_rhs",
+            generate_error_message(
+                "the gradient of dot is supported for arguments with at "
+                "most two dimensions only"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> dot_gradient_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 3)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot_gradient_operation::eval",
+                generate_error_message(
+                    "the dot gradient primitives require exactly three "
+                    "operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]) || !valid(operands[2]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot_gradient_operation::eval",
+                generate_error_message(
+                    "the dot gradient primitives require that the arguments "
+                    "given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+            -> primitive_argument_type
+            {
+                auto g = extract_numeric_value(
+                    std::move(args[0]), this_->name_, this_->codename_);
+                auto a = extract_numeric_value(
+                    std::move(args[1]), this_->name_, this_->codename_);
+                auto b = extract_numeric_value(
+                    std::move(args[2]), this_->name_, this_->codename_);
+
+                if (this_->operation_ == operation::lhs)
+                {
+                    return this_->dot_gradient_lhs(
+                        std::move(g), std::move(a), std::move(b));
+                }
+                return this_->dot_gradient_rhs(
+                    std::move(g), std::move(a), std::move(b));
+            }),
+            detail::map_operands(operands, functional::value_operand{},
+                args, name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -0,0 +1,277 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/autodiff/pool2d_gradient_operation.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
+#include <phylanx/plugins/keras_support/pool_indices_helper.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const
+        pool2d_gradient_operation::match_data =
+    {
+        match_pattern_type{"__max_pool2d_grad",
+            std::vector<std::string>{
+                "__max_pool2d_grad(_1, _2, _3, _4, _5)"},
+            &create_pool2d_gradient_operation,
+            &create_primitive<pool2d_gradient_operation>, R"(
+            g, x, pool_size, padding, strides
+            Args:
+
+                g (array) : the adjoint of the result of max_pool2d
+                x, pool_size, padding, strides : the arguments of max_pool2d
+
+            Returns:
+
+            The gradient of max_pool2d with respect to 'x', the adjoint of
+            each result element is passed on to the (first) maximum of its
+            pool. This is used by the code generated for grad().)"
+        },
+        match_pattern_type{"__avg_pool2d_grad",
+            std::vector<std::string>{
+                "__avg_pool2d_grad(_1, _2, _3, _4, _5)"},
+            &create_pool2d_gradient_operation,
+            &create_primitive<pool2d_gradient_operation>, R"(
+            g, x, pool_size, padding, strides
+            Args:
+
+                g (array) : the adjoint of the result of avg_pool2d
+                x, pool_size, padding, strides : the arguments of avg_pool2d
+
+            Returns:
+
+            The gradient of avg_pool2d with respect to 'x'. This is used by
+            the code generated for grad().)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        pool2d_gradient_operation::operation
+        extract_pool2d_gradient_operation(std::string const& name)
+        {
+            compiler::primitive_name_parts name_parts;
+            if (!compiler::parse_primitive_name(name, name_parts))
+            {
+                name_parts.primitive = name;
+            }
+
+            if (name_parts.primitive == "__avg_pool2d_grad")
+            {
+                return pool2d_gradient_operation::operation::avg_pool2d;
+            }
+            return pool2d_gradient_operation::operation::max_pool2d;
+        }
+    }
+
+    pool2d_gradient_operation::pool2d_gradient_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , operation_(detail::extract_pool2d_gradient_operation(name))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::array<std::int64_t, 2> pool2d_gradient_operation::extract_sizes(
+        primitive_argument_type const& arg, char const* what) const
+    {
+        ir::range sizes = extract_list_value_strict(arg, name_, codename_);
+        if (sizes.size() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "pool2d_gradient_operation::extract_sizes",
+                generate_error_message(std::string("the ") + what +
+                    " argument has to be a tuple of two integers"));
+        }
+
+        std::array<std::int64_t, 2> result;
+        auto it = sizes.begin();
+        result[0] = extract_scalar_positive_integer_value_strict(*it);
+        result[1] = extract_scalar_positive_integer_value_strict(*++it);
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type pool2d_gradient_operation::pool2d_gradient(
+        ir::node_data<double>&& g, ir::node_data<double>&& x,
+        std::array<std::int64_t, 2> const& pool_size,
+        std::string const& padding,
+        std::array<std::int64_t, 2> const& strides) const
+    {
+        if (x.num_dimensions() != 4 || g.num_dimensions() != 4)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "pool2d_gradient_operation::pool2d_gradient",
+                generate_error_message(
+                    "the gradient of pool2d requires the input and the "
+                    "adjoint to be 4d arrays"));
+        }
+
+        auto q = x.quatern();
+        auto gq = g.quatern();
+
+        std::int64_t nrows = q.pages();
+        std::int64_t ncolumns = q.rows();
+        std::size_t batch = q.quats();
+        std::size_t channels = q.columns();
+
+        // the windows are placed exactly as by max_pool2d and avg_pool2d
+        std::int64_t pad_top =
+            common::conv_padding(padding, nrows, pool_size[0], strides[0]);
+        std::int64_t pad_left =
+            common::conv_padding(padding, ncolumns, pool_size[1], strides[1]);
+
+        std::size_t result_height = gq.pages();
+        std::size_t result_width = gq.rows();
+
+        blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
+            batch, nrows, ncolumns, channels);
+
+        for (std::size_t l = 0; l != batch; ++l)
+        {
+            auto res_tensor = blaze::quatslice(result, l);
+            auto t = blaze::quatslice(q, l);
+            auto g_tensor = blaze::quatslice(gq, l);
+            for (std::size_t j = 0; j != channels; ++j)
+            {
+                auto res_slice = blaze::columnslice(res_tensor, j);
+                auto slice = blaze::columnslice(t, j);
+                auto g_slice = blaze::columnslice(g_tensor, j);
+                for (std::size_t r = 0; r != result_height; ++r)
+                {
+                    auto sub_row = pool_indices::get_subsizes(nrows,
+                        pool_size[0], std::int64_t(r) * strides[0] - pad_top);
+                    for (std::size_t c = 0; c != result_width; ++c)
+                    {
+                        auto sub_column = pool_indices::get_subsizes(ncolumns,
+                            pool_size[1],
+                            std::int64_t(c) * strides[1] - pad_left);
+
+                        auto window = blaze::submatrix(res_slice,
+                            sub_row.image_beg_, sub_column.image_beg_,
+                            sub_row.size_, sub_column.size_);
+
+                        if (operation_ == operation::avg_pool2d)
+                        {
+                            double value = g_slice(r, c) /
+                                (sub_row.size_ * sub_column.size_);
+                            for (std::size_t i = 0; i != window.rows(); ++i)
+                            {
+                                for (std::size_t k = 0; k != window.columns();
+                                     ++k)
+                                {
+                                    window(i, k) += value;
+                                }
+                            }
+                            continue;
+                        }
+
+                        // max_pool2d, find the position of the maximum
+                        auto values = blaze::submatrix(slice,
+                            sub_row.image_beg_, sub_column.image_beg_,
+                            sub_row.size_, sub_column.size_);
+
+                        std::size_t max_row = 0;
+                        std::size_t max_column = 0;
+                        for (std::size_t i = 0; i != values.rows(); ++i)
+                        {
+                            for (std::size_t k = 0; k != values.columns(); ++k)
+                            {
+                                if (values(i, k) >
+                                    values(max_row, max_column))
+                                {
+                                    max_row = i;
+                                    max_column = k;
+                                }
+                            }
+                        }
+                        window(max_row, max_column) += g_slice(r, c);
+                    }
+                }
+            }
+        }
+
+        return primitive_argument_type{std::move(result)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> pool2d_gradient_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 5)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "pool2d_gradient_operation::eval",
+                generate_error_message(
+                    "the pooling gradient primitives require exactly five "
+                    "operands"));
+        }
+
+        for (auto const& operand : operands)
+        {
+            if (!valid(operand))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "pool2d_gradient_operation::eval",
+                    generate_error_message(
+                        "the pooling gradient primitives require that the "
+                        "arguments given by the operands array are valid"));
+            }
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+            -> primitive_argument_type
+            {
+                auto pool_size = this_->extract_sizes(args[2], "pool_size");
+
+                std::string padding = extract_string_value_strict(
+                    args[3], this_->name_, this_->codename_);
+                if (padding != "valid" && padding != "same")
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "pool2d_gradient_operation::eval",
+                        this_->generate_error_message(
+                            "invalid padding. Padding can be either 'valid' "
+                            "or 'same'"));
+                }
+
+                auto strides = this_->extract_sizes(args[4], "strides");
+
+                return this_->pool2d_gradient(
+                    extract_numeric_value(
+                        std::move(args[0]), this_->name_, this_->codename_),
+                    extract_numeric_value(
+                        std::move(args[1]), this_->name_, this_->codename_),
+                    pool_size, padding, strides);
+            }),
+            detail::map_operands(operands, functional::value_operand{},
+                args, name_, codename_, std::move(ctx)));
+    }
+}}}
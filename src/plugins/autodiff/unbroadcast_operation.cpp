@@ -0,0 +1,153 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/autodiff/array_helpers.hpp>
+#include <phylanx/plugins/autodiff/unbroadcast_operation.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const unbroadcast_operation::match_data =
+    {
+        hpx::make_tuple("__unbroadcast",
+            std::vector<std::string>{"__unbroadcast(_1, _2)"},
+            &create_unbroadcast_operation,
+            &create_primitive<unbroadcast_operation>, R"(
+            g, like
+            Args:
+
+                g (array_like) : the adjoint of the result of a broadcasting
+                    operation
+                like (array_like) : the argument of the operation
+
+            Returns:
+
+            The sum of 'g' over all dimensions 'like' was broadcast along,
+            the result has the shape of 'like'. This is used by the code
+            generated for grad().)")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    unbroadcast_operation::unbroadcast_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type unbroadcast_operation::unbroadcast(
+        ir::node_data<double>&& g,
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
+        std::size_t ndim) const
+    {
+        detail::padded_shape shape = detail::gradient_shape(dims, ndim);
+        detail::padded_shape g_shape = detail::gradient_shape(g);
+
+        // nothing to do if the argument was not broadcast
+        if (g.num_dimensions() == ndim && shape == g_shape)
+        {
+            return primitive_argument_type{std::move(g)};
+        }
+
+        for (std::size_t i = 0; i != PHYLANX_MAX_DIMENSIONS; ++i)
+        {
+            if (shape[i] != g_shape[i] && shape[i] != 1)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "unbroadcast_operation::unbroadcast",
+                    generate_error_message(
+                        "the shape of the adjoint is not a broadcast of the "
+                        "shape of the argument"));
+            }
+        }
+
+        std::vector<double> values = detail::gradient_values(g);
+        std::vector<double> result(detail::gradient_size(shape), 0.0);
+
+        // every element of g is added to the element of the result it was
+        // broadcast from
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> index = {};
+        for (double value : values)
+        {
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i != PHYLANX_MAX_DIMENSIONS; ++i)
+            {
+                offset = offset * shape[i] + (shape[i] == 1 ? 0 : index[i]);
+            }
+            result[offset] += value;
+
+            // advance the (row major) index into g
+            for (std::size_t i = PHYLANX_MAX_DIMENSIONS; i != 0; --i)
+            {
+                if (++index[i - 1] != g_shape[i - 1])
+                {
+                    break;
+                }
+                index[i - 1] = 0;
+            }
+        }
+
+        return primitive_argument_type{
+            detail::gradient_array(result, shape, ndim)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> unbroadcast_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unbroadcast_operation::eval",
+                generate_error_message(
+                    "the __unbroadcast primitive requires exactly two "
+                    "operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unbroadcast_operation::eval",
+                generate_error_message(
+                    "the __unbroadcast primitive requires that the arguments "
+                    "given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+            -> primitive_argument_type
+            {
+                // only the shape of the argument is needed
+                std::size_t ndim = extract_numeric_value_dimension(
+                    args[1], this_->name_, this_->codename_);
+                auto dims = extract_numeric_value_dimensions(
+                    args[1], this_->name_, this_->codename_);
+
+                return this_->unbroadcast(
+                    extract_numeric_value(
+                        std::move(args[0]), this_->name_, this_->codename_),
+                    dims, ndim);
+            }),
+            detail::map_operands(operands, functional::value_operand{},
+                args, name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -0,0 +1,247 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/autodiff/array_helpers.hpp>
+#include <phylanx/plugins/autodiff/unreduce_operation.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const unreduce_operation::match_data =
+    {
+        match_pattern_type{"__unreduce",
+            std::vector<std::string>{"__unreduce(_1, _2, _3)"},
+            &create_unreduce_operation,
+            &create_primitive<unreduce_operation>, R"(
+            value, like, axis
+            Args:
+
+                value (array_like) : the result of a reduction of 'like'
+                like (array_like) : the argument of the reduction
+                axis (int, list of ints, or nil) : the axis (or axes) the
+                    reduction was performed along, nil if all elements were
+                    reduced
+
+            Returns:
+
+            An array of the shape of 'like' holding the element of 'value'
+            each element of 'like' was reduced into. This is used by the code
+            generated for grad().)"
+        },
+        match_pattern_type{"__unreduce_mean",
+            std::vector<std::string>{"__unreduce_mean(_1, _2, _3)"},
+            &create_unreduce_operation,
+            &create_primitive<unreduce_operation>, R"(
+            value, like, axis
+            Args:
+
+                value (array_like) : the adjoint of the mean of 'like'
+                like (array_like) : the argument of the reduction
+                axis (int, list of ints, or nil) : the axis (or axes) the
+                    mean was calculated along, nil if all elements were
+                    reduced
+
+            Returns:
+
+            The same as __unreduce, with all elements divided by the number
+            of elements reduced into each element of 'value'. This is used by
+            the code generated for grad().)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        unreduce_operation::operation extract_unreduce_operation(
+            std::string const& name)
+        {
+            compiler::primitive_name_parts name_parts;
+            if (!compiler::parse_primitive_name(name, name_parts))
+            {
+                name_parts.primitive = name;
+            }
+
+            if (name_parts.primitive == "__unreduce_mean")
+            {
+                return unreduce_operation::operation::unreduce_mean;
+            }
+            return unreduce_operation::operation::unreduce;
+        }
+    }
+
+    unreduce_operation::unreduce_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , operation_(detail::extract_unreduce_operation(name))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type unreduce_operation::unreduce(
+        ir::node_data<double>&& value,
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
+        std::size_t ndim, std::vector<std::int64_t> const& axes) const
+    {
+        detail::padded_shape shape = detail::gradient_shape(dims, ndim);
+
+        // the shape of the value if the reduction had kept the dimensions
+        detail::padded_shape value_shape = shape;
+        std::size_t count = 1;
+        if (axes.empty())
+        {
+            value_shape.fill(1);
+            count = detail::gradient_size(shape);
+        }
+        else
+        {
+            for (std::int64_t axis : axes)
+            {
+                if (axis < 0)
+                {
+                    axis += std::int64_t(ndim);
+                }
+                if (axis < 0 || axis >= std::int64_t(ndim))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "unreduce_operation::unreduce",
+                        generate_error_message(
+                            "the given axis is out of range"));
+                }
+
+                std::size_t i = PHYLANX_MAX_DIMENSIONS - ndim + axis;
+                if (value_shape[i] != 1)
+                {
+                    count *= value_shape[i];
+                    value_shape[i] = 1;
+                }
+            }
+        }
+
+        if (value.size() != detail::gradient_size(value_shape))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unreduce_operation::unreduce",
+                generate_error_message(
+                    "the shape of the value does not match the result of "
+                    "reducing the given array along the given axis"));
+        }
+
+        std::vector<double> values = detail::gradient_values(value);
+        if (operation_ == operation::unreduce_mean)
+        {
+            for (double& v : values)
+            {
+                v /= count;
+            }
+        }
+
+        std::vector<double> result(detail::gradient_size(shape));
+
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> index = {};
+        for (double& element : result)
+        {
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i != PHYLANX_MAX_DIMENSIONS; ++i)
+            {
+                offset = offset * value_shape[i] +
+                    (value_shape[i] == 1 ? 0 : index[i]);
+            }
+            element = values[offset];
+
+            // advance the (row major) index into the result
+            for (std::size_t i = PHYLANX_MAX_DIMENSIONS; i != 0; --i)
+            {
+                if (++index[i - 1] != shape[i - 1])
+                {
+                    break;
+                }
+                index[i - 1] = 0;
+            }
+        }
+
+        return primitive_argument_type{
+            detail::gradient_array(result, shape, ndim)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> unreduce_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 3)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unreduce_operation::eval",
+                generate_error_message(
+                    "the __unreduce primitive requires exactly three "
+                    "operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unreduce_operation::eval",
+                generate_error_message(
+                    "the __unreduce primitive requires that the arguments "
+                    "given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+            -> primitive_argument_type
+            {
+                // the axis is either nil, a list of integers, or an integer
+                std::vector<std::int64_t> axes;
+                if (valid(args[2]) && !is_explicit_nil(args[2]))
+                {
+                    if (is_list_operand_strict(args[2]))
+                    {
+                        for (auto const& axis : extract_list_value_strict(
+                                 args[2], this_->name_, this_->codename_))
+                        {
+                            axes.push_back(extract_scalar_integer_value_strict(
+                                axis, this_->name_, this_->codename_));
+                        }
+                    }
+                    else
+                    {
+                        axes.push_back(extract_scalar_integer_value_strict(
+                            args[2], this_->name_, this_->codename_));
+                    }
+                }
+
+                // only the shape of the reduced argument is needed
+                std::size_t ndim = extract_numeric_value_dimension(
+                    args[1], this_->name_, this_->codename_);
+                auto dims = extract_numeric_value_dimensions(
+                    args[1], this_->name_, this_->codename_);
+
+                return this_->unreduce(
+                    extract_numeric_value(
+                        std::move(args[0]), this_->name_, this_->codename_),
+                    dims, ndim, axes);
+            }),
+            detail::map_operands(operands, functional::value_operand{},
+                args, name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -473,6 +473,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return that_.where_elements<std::int64_t>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
 
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return that_.where_elements<double>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
@@ -9,12 +9,11 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/export_definitions.hpp>
 #include <phylanx/plugins/common/conv1d_all_paddings.hpp>
-#include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
 
 #include <hpx/errors/throw_exception.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
-#include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/util.hpp>
 
 #include <cstddef>
@@ -29,85 +28,44 @@
 namespace phylanx { namespace common {
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_valid(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel)
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        std::size_t batch = a.pages();
-        std::size_t filter_length = k.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
-        std::size_t result_length = a.rows() - filter_length + 1;
-
-        blaze::DynamicTensor<double> result(batch, result_length, out_channels);
-
-        hpx::for_loop(hpx::execution::par, std::size_t(0),
-            batch, [&](std::size_t p) {
-                for (std::size_t c = 0; c != out_channels; ++c)
-                {
-                    auto kslice = blaze::columnslice(k, c);
-                    for (std::size_t i = 0; i != result_length; ++i)
-                    {
-                        auto schur_product = blaze::subtensor(a, 0, i, 0, batch,
-                                                 filter_length, in_channels) %
-                            kslice;
-
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
+
+        conv_dimension length(data_length, filter_length,
+            data_length - filter_length + 1, 0);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_valid(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t strides)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        std::size_t batch = a.pages();
-        std::size_t filter_length = k.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
-        std::size_t result_length = blaze::ceil(
-            static_cast<double>(a.rows() - filter_length + 1) / strides);
-
-        blaze::DynamicTensor<double> result(batch, result_length, out_channels);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != result_length; ++i)
-                {
-                    auto schur_product =
-                        blaze::subtensor(a, 0, i * strides, 0, batch,
-                            filter_length, in_channels) %
-                        kslice;
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
+        std::int64_t result_length = blaze::ceil(
+            static_cast<double>(data_length - filter_length + 1) / strides);
+
+        conv_dimension length(
+            data_length, filter_length, result_length, 0, strides);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_valid_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t dilation_rate)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
 
         std::int64_t result_length =
             data_length - dilation_rate * (filter_length - 1);
@@ -118,79 +76,36 @@ namespace phylanx { namespace common {
                     "this dilation_rate causes non-positive "
                     "result_length where padding is valid"));
 
-        blaze::DynamicTensor<double> result(batch, result_length, out_channels);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != result_length; ++i)
-                {
-                    auto schur_product =
-                        blaze::dilatedsubtensor(a, 0, i, 0, batch,
-                            filter_length, in_channels, 1, dilation_rate, 1) %
-                        kslice;
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(
+            data_length, filter_length, result_length, 0, 1, dilation_rate);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_same(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel)
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length   = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
 
         std::int64_t pad_top = (filter_length - 1) / 2;
 
-        blaze::DynamicTensor<double> result(batch, data_length, out_channels);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != data_length; ++i)
-                {
-                    auto sub = conv_indices::get_subsizes(
-                        data_length, filter_length, i - pad_top);
-                    auto schur_product = blaze::subtensor(a, 0, sub.image_beg_,
-                                             0, batch, sub.size_, in_channels) %
-                        blaze::submatrix(
-                            kslice, sub.kernel_beg_, 0, sub.size_, in_channels);
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(data_length, filter_length, data_length, pad_top);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_same(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t strides)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length   = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t pad_width;
 
         if (data_length % strides == 0)
@@ -205,206 +120,91 @@ namespace phylanx { namespace common {
                 static_cast<std::int64_t>(0);
         }
 
-        std::size_t result_length = blaze::ceil(
+        std::int64_t result_length = blaze::ceil(
             static_cast<double>(data_length + pad_width - filter_length + 1) /
             strides);
 
-        blaze::DynamicTensor<double> result(batch, result_length, out_channels);
-        std::size_t pad_top = pad_width / 2;
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != result_length; ++i)
-                {
-                    auto sub = conv_indices::get_subsizes(
-                        data_length, filter_length, i * strides - pad_top);
-                    auto schur_product = blaze::subtensor(a, 0, sub.image_beg_,
-                                             0, batch, sub.size_, in_channels) %
-                        blaze::submatrix(
-                            kslice, sub.kernel_beg_, 0, sub.size_, in_channels);
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(data_length, filter_length, result_length,
+            pad_width / 2, strides);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_same_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t dilation_rate)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length   = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
+
         std::int64_t pad_top = (dilation_rate * (filter_length - 1)) / 2;
 
-        blaze::DynamicTensor<double> result(
-            batch, data_length, out_channels, 0.);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != data_length; ++i)
-                {
-                    auto sub = conv_indices::get_subsizes_dilated(
-                        data_length, filter_length, i - pad_top, dilation_rate);
-
-                    if (sub.size_ == 0)
-                        continue;
-
-                    auto schur_product =
-                        blaze::dilatedsubtensor(a, 0, sub.image_beg_, 0, batch,
-                            sub.size_, in_channels, 1, dilation_rate, 1) %
-                        blaze::submatrix(
-                            kslice, sub.kernel_beg_, 0, sub.size_, in_channels);
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(data_length, filter_length, data_length, pad_top,
+            1, dilation_rate);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_causal(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel)
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length   = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
+
         std::int64_t pad_top = filter_length - 1;    // no pad_bottom
 
-        blaze::DynamicTensor<double> result(batch, data_length, out_channels);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != data_length; ++i)
-                {
-                    auto sub = conv_indices::get_subsizes_causal(
-                        filter_length, i - pad_top);
-                    auto schur_product = blaze::subtensor(a, 0, sub.image_beg_,
-                                             0, batch, sub.size_, in_channels) %
-                        blaze::submatrix(
-                            kslice, sub.kernel_beg_, 0, sub.size_, in_channels);
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(data_length, filter_length, data_length, pad_top);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_causal(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t strides)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length   = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
-        std::int64_t pad_top = filter_length - 1;    // no pad_bottom
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
 
-        std::size_t result_length =
+        std::int64_t pad_top = filter_length - 1;    // no pad_bottom
+        std::int64_t result_length =
             blaze::ceil(static_cast<double>(data_length) / strides);
 
-        blaze::DynamicTensor<double> result(batch, result_length, out_channels);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != result_length; ++i)
-                {
-                    auto sub = conv_indices::get_subsizes_causal(
-                        filter_length, i * strides - pad_top);
-                    auto schur_product = blaze::subtensor(a, 0, sub.image_beg_,
-                                             0, batch, sub.size_, in_channels) %
-                        blaze::submatrix(
-                            kslice, sub.kernel_beg_, 0, sub.size_, in_channels);
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(
+            data_length, filter_length, result_length, pad_top, strides);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_causal_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t dilation_rate)
     {
-        auto a = arg.tensor();
-        auto k = kernel.tensor();
-        auto filter_length = static_cast<std::int64_t>(k.pages());
-        auto data_length   = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_length = static_cast<std::int64_t>(kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
+
         std::int64_t pad_top =
             dilation_rate * (filter_length - 1);    // no pad_bottom
 
-        blaze::DynamicTensor<double> result(batch, data_length, out_channels);
-
-        hpx::for_loop(
-            hpx::execution::par, std::size_t(0), out_channels,
-            [&](std::size_t c)
-            {
-                auto kslice = blaze::columnslice(k, c);
-                for (std::size_t i = 0; i != data_length; ++i)
-                {
-                    auto sub = conv_indices::get_subsizes_causal_dilated(
-                        filter_length, i - pad_top, dilation_rate);
-
-                    if (sub.size_ == 0)
-                        continue;
-
-                    auto schur_product =
-                        blaze::dilatedsubtensor(a, 0, sub.image_beg_, 0, batch,
-                            sub.size_, in_channels, 1, dilation_rate, 1) %
-                        blaze::submatrix(
-                            kslice, sub.kernel_beg_, 0, sub.size_, in_channels);
-                    for (std::size_t p = 0; p != batch; ++p)
-                    {
-                        auto pslice = blaze::pageslice(schur_product, p);
-                        result(p, i, c) = blaze::sum(pslice);
-                    }
-                }
-            });
-        return execution_tree::primitive_argument_type{std::move(result)};
+        conv_dimension length(data_length, filter_length, data_length, pad_top,
+            1, dilation_rate);
+
+        return execution_tree::primitive_argument_type{
+            conv1d_gemm(arg, conv1d_kernel_matrix(kernel), length)};
     }
 
     /////////////////////////////////////////////////////////////////////////////
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_all_paddings(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::string&& padding, std::string const& name,
         std::string const& codename)
     {
@@ -434,8 +234,9 @@ namespace phylanx { namespace common {
         return conv1d_causal(std::move(arg), std::move(kernel));
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_all_paddings(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::string&& padding, std::int64_t strides, std::string const& name,
         std::string const& codename)
     {
@@ -465,8 +266,9 @@ namespace phylanx { namespace common {
         return conv1d_causal(std::move(arg), std::move(kernel), strides);
     }
 
+    template <typename T>
     execution_tree::primitive_argument_type conv1d_all_paddings_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::string&& padding, std::int64_t dilation_rate,
         std::string const& name, std::string const& codename)
     {
@@ -498,4 +300,72 @@ namespace phylanx { namespace common {
         return conv1d_causal_dilation(
             std::move(arg), std::move(kernel), dilation_rate);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // explicitly instantiate the convolutions for double and single precision
+    // data
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_valid(ir::node_data<double>&&, ir::node_data<double>&&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_valid(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_valid_dilation(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_same(ir::node_data<double>&&, ir::node_data<double>&&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_same(ir::node_data<double>&&, ir::node_data<double>&&, std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_same_dilation(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_causal(ir::node_data<double>&&, ir::node_data<double>&&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_causal(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_causal_dilation(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_all_paddings(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::string&&, std::string const&, std::string const&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_all_paddings(ir::node_data<double>&&, ir::node_data<double>&&,
+        std::string&&, std::int64_t, std::string const&, std::string const&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_all_paddings_dilation(ir::node_data<double>&&,
+        ir::node_data<double>&&, std::string&&, std::int64_t,
+        std::string const&, std::string const&);
+
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_valid(ir::node_data<float>&&, ir::node_data<float>&&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_valid(ir::node_data<float>&&, ir::node_data<float>&&, std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_valid_dilation(ir::node_data<float>&&, ir::node_data<float>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_same(ir::node_data<float>&&, ir::node_data<float>&&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_same(ir::node_data<float>&&, ir::node_data<float>&&, std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_same_dilation(ir::node_data<float>&&, ir::node_data<float>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_causal(ir::node_data<float>&&, ir::node_data<float>&&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_causal(ir::node_data<float>&&, ir::node_data<float>&&, std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_causal_dilation(ir::node_data<float>&&, ir::node_data<float>&&,
+        std::int64_t);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_all_paddings(ir::node_data<float>&&, ir::node_data<float>&&,
+        std::string&&, std::string const&, std::string const&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_all_paddings(ir::node_data<float>&&, ir::node_data<float>&&,
+        std::string&&, std::int64_t, std::string const&, std::string const&);
+    template PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    conv1d_all_paddings_dilation(ir::node_data<float>&&, ir::node_data<float>&&,
+        std::string&&, std::int64_t, std::string const&, std::string const&);
 }}
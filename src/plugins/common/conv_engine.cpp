@@ -0,0 +1,765 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace common {
+
+    namespace detail
+    {
+        // number of elements of the patch matrix built by a single task
+        // (256kB, should fit into the L2 cache)
+        constexpr std::size_t patch_block_size = 32768;
+
+        // For all output positions i and kernel taps t, calculate the index of
+        // the input element to use, -1 if the position refers to the padding
+        // (or to a zero inserted by upsampling)
+        std::vector<std::int64_t> input_indices(conv_dimension const& dim)
+        {
+            std::vector<std::int64_t> indices(
+                dim.output_size_ * dim.kernel_size_, -1);
+
+            for (std::int64_t i = 0; i != dim.output_size_; ++i)
+            {
+                for (std::int64_t t = 0; t != dim.kernel_size_; ++t)
+                {
+                    std::int64_t pos =
+                        i * dim.stride_ - dim.pad_ + t * dim.dilation_;
+                    if (pos < 0 || pos % dim.upsampling_ != 0 ||
+                        pos / dim.upsampling_ >= dim.input_size_)
+                    {
+                        continue;
+                    }
+                    indices[i * dim.kernel_size_ + t] = pos / dim.upsampling_;
+                }
+            }
+            return indices;
+        }
+
+        // the output element i depends on input element i only
+        bool is_pointwise(conv_dimension const& dim)
+        {
+            return dim.kernel_size_ == 1 && dim.stride_ == 1 &&
+                dim.pad_ == 0 && dim.upsampling_ == 1 &&
+                dim.output_size_ == dim.input_size_;
+        }
+
+        // number of output rows of row_size patch elements each handled by a
+        // single task
+        std::size_t rows_per_block(std::size_t row_size, std::size_t rows)
+        {
+            std::size_t block_size = (std::max)(std::size_t(1),
+                patch_block_size / (std::max)(row_size, std::size_t(1)));
+            return (std::max)(std::size_t(1), (std::min)(block_size, rows));
+        }
+
+        // Fill the (zero-initialized) patch matrix for the output positions
+        // starting at begin from page p of the input
+        template <typename Tensor, typename Matrix>
+        void conv1d_patches(Tensor const& a, std::size_t p,
+            std::vector<std::int64_t> const& indices,
+            std::size_t filter_length, std::size_t begin, Matrix& patches)
+        {
+            std::size_t in_channels = a.columns();
+            for (std::size_t i = 0; i != patches.rows(); ++i)
+            {
+                std::int64_t const* index =
+                    &indices[(begin + i) * filter_length];
+                for (std::size_t t = 0; t != filter_length; ++t)
+                {
+                    if (index[t] < 0)
+                    {
+                        continue;
+                    }
+                    for (std::size_t c = 0; c != in_channels; ++c)
+                    {
+                        patches(i, t * in_channels + c) = a(p, index[t], c);
+                    }
+                }
+            }
+        }
+
+        // Fill the (zero-initialized) patch matrix for the output rows
+        // starting at begin from tensor p of the input, each output row
+        // contributes res_width rows to the patch matrix
+        template <typename Quatern, typename Matrix>
+        void conv2d_patches(Quatern const& q, std::size_t p,
+            std::vector<std::int64_t> const& height_indices,
+            std::vector<std::int64_t> const& width_indices,
+            conv_dimension const& height, conv_dimension const& width,
+            std::size_t begin, Matrix& patches)
+        {
+            std::size_t in_channels = q.columns();
+            std::size_t filter_height = height.kernel_size_;
+            std::size_t filter_width = width.kernel_size_;
+            std::size_t res_width = width.output_size_;
+            std::size_t rows = patches.rows() / res_width;
+
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                std::int64_t const* h_index =
+                    &height_indices[(begin + i) * filter_height];
+                for (std::size_t j = 0; j != res_width; ++j)
+                {
+                    std::int64_t const* w_index =
+                        &width_indices[j * filter_width];
+                    std::size_t row = i * res_width + j;
+                    for (std::size_t s = 0; s != filter_height; ++s)
+                    {
+                        if (h_index[s] < 0)
+                        {
+                            continue;
+                        }
+                        for (std::size_t t = 0; t != filter_width; ++t)
+                        {
+                            if (w_index[t] < 0)
+                            {
+                                continue;
+                            }
+                            std::size_t col =
+                                (s * filter_width + t) * in_channels;
+                            for (std::size_t c = 0; c != in_channels; ++c)
+                            {
+                                patches(row, col + c) =
+                                    q(p, h_index[s], w_index[t], c);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t conv_padding(std::string const& padding,
+        std::int64_t input_size, std::int64_t kernel_size, std::int64_t stride,
+        std::int64_t dilation)
+    {
+        if (padding == "same")
+        {
+            if (stride == 1)
+            {
+                return (dilation * (kernel_size - 1)) / 2;
+            }
+
+            std::int64_t remainder = input_size % stride;
+            std::int64_t pad_total = (remainder == 0) ?
+                (std::max)(kernel_size - stride, std::int64_t(0)) :
+                (std::max)(kernel_size - remainder, std::int64_t(0));
+            return pad_total / 2;
+        }
+
+        if (padding == "causal")
+        {
+            return dilation * (kernel_size - 1);
+        }
+
+        return 0;    // padding == "valid"
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // kernel is a (filter_length, in_channels, out_channels) tensor
+    template <typename T>
+    blaze::DynamicMatrix<T> conv1d_kernel_matrix(
+        ir::node_data<T> const& kernel)
+    {
+        auto k = kernel.tensor();
+        std::size_t filter_length = k.pages();
+        std::size_t in_channels = k.rows();
+
+        blaze::DynamicMatrix<T> result(
+            filter_length * in_channels, k.columns());
+
+        for (std::size_t t = 0; t != filter_length; ++t)
+        {
+            blaze::submatrix(result, t * in_channels, 0, in_channels,
+                k.columns()) = blaze::pageslice(k, t);
+        }
+        return result;
+    }
+
+    // depth_kernel is a (filter_length, in_channels, depth_multiplier) tensor,
+    // point_kernel is a (1, in_channels * depth_multiplier, out_channels)
+    // tensor. The depthwise and the pointwise convolutions are combined into
+    // a single convolution.
+    template <typename T>
+    blaze::DynamicMatrix<T> separable_conv1d_kernel_matrix(
+        ir::node_data<T> const& depth_kernel,
+        ir::node_data<T> const& point_kernel)
+    {
+        auto dk = depth_kernel.tensor();
+        auto pk = point_kernel.tensor();
+        std::size_t filter_length = dk.pages();
+        std::size_t in_channels = dk.rows();
+        std::size_t multiplier = dk.columns();
+        std::size_t out_channels = pk.columns();
+
+        auto pk_matrix = blaze::pageslice(pk, 0);
+        blaze::DynamicMatrix<T> result(
+            filter_length * in_channels, out_channels);
+
+        for (std::size_t t = 0; t != filter_length; ++t)
+        {
+            auto dk_slice = blaze::pageslice(dk, t);
+            for (std::size_t c = 0; c != in_channels; ++c)
+            {
+                blaze::row(result, t * in_channels + c) =
+                    blaze::row(dk_slice, c) *
+                    blaze::submatrix(pk_matrix, c * multiplier, 0,
+                        multiplier, out_channels);
+            }
+        }
+        return result;
+    }
+
+    // kernel is a (filter_height, filter_width, in_channels, out_channels)
+    // array
+    template <typename T>
+    blaze::DynamicMatrix<T> conv2d_kernel_matrix(
+        ir::node_data<T> const& kernel)
+    {
+        auto k = kernel.quatern();
+        std::size_t filter_height = k.quats();
+        std::size_t filter_width = k.pages();
+        std::size_t in_channels = k.rows();
+
+        blaze::DynamicMatrix<T> result(
+            filter_height * filter_width * in_channels, k.columns());
+
+        for (std::size_t s = 0; s != filter_height; ++s)
+        {
+            auto k_tensor = blaze::quatslice(k, s);
+            for (std::size_t t = 0; t != filter_width; ++t)
+            {
+                blaze::submatrix(result, (s * filter_width + t) * in_channels,
+                    0, in_channels, k.columns()) =
+                    blaze::pageslice(k_tensor, t);
+            }
+        }
+        return result;
+    }
+
+    // kernel is a (filter_height, filter_width, out_channels, in_channels)
+    // array, the transposed convolution uses the spatially flipped kernel
+    template <typename T>
+    blaze::DynamicMatrix<T> conv2d_transpose_kernel_matrix(
+        ir::node_data<T> const& kernel)
+    {
+        auto k = kernel.quatern();
+        std::size_t filter_height = k.quats();
+        std::size_t filter_width = k.pages();
+        std::size_t in_channels = k.columns();
+
+        blaze::DynamicMatrix<T> result(
+            filter_height * filter_width * in_channels, k.rows());
+
+        for (std::size_t s = 0; s != filter_height; ++s)
+        {
+            auto k_tensor = blaze::quatslice(k, filter_height - s - 1);
+            for (std::size_t t = 0; t != filter_width; ++t)
+            {
+                blaze::submatrix(result, (s * filter_width + t) * in_channels,
+                    0, in_channels, k.rows()) = blaze::trans(
+                    blaze::pageslice(k_tensor, filter_width - t - 1));
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    blaze::DynamicTensor<T> conv1d_gemm(ir::node_data<T> const& arg,
+        blaze::DynamicMatrix<T> const& kernel,
+        conv_dimension const& length)
+    {
+        auto a = arg.tensor();
+        std::size_t batch = a.pages();
+        std::size_t in_channels = a.columns();
+        std::size_t out_channels = kernel.columns();
+        std::size_t result_length = length.output_size_;
+
+        blaze::DynamicTensor<T> result(batch, result_length, out_channels);
+
+        // a pointwise convolution does not need the patches
+        if (detail::is_pointwise(length))
+        {
+            hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+                [&](std::size_t p)
+                {
+                    blaze::pageslice(result, p) =
+                        blaze::pageslice(a, p) * kernel;
+                });
+            return result;
+        }
+
+        std::vector<std::int64_t> const indices = detail::input_indices(length);
+
+        std::size_t filter_length = length.kernel_size_;
+        std::size_t patch_size = filter_length * in_channels;
+        std::size_t block_size =
+            detail::rows_per_block(patch_size, result_length);
+        std::size_t blocks = (result_length + block_size - 1) / block_size;
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch * blocks,
+            [&](std::size_t task)
+            {
+                std::size_t p = task / blocks;
+                std::size_t begin = (task % blocks) * block_size;
+                std::size_t rows = (std::min)(block_size, result_length - begin);
+
+                blaze::DynamicMatrix<T> patches(rows, patch_size, T(0));
+                detail::conv1d_patches(
+                    a, p, indices, filter_length, begin, patches);
+
+                blaze::submatrix(blaze::pageslice(result, p), begin, 0, rows,
+                    out_channels) = patches * kernel;
+            });
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    blaze::DynamicArray<4UL, T> conv2d_gemm(
+        ir::node_data<T> const& arg,
+        blaze::DynamicMatrix<T> const& kernel,
+        conv_dimension const& height, conv_dimension const& width)
+    {
+        auto q = arg.quatern();
+        std::size_t batch = q.quats();
+        std::size_t in_channels = q.columns();
+        std::size_t out_channels = kernel.columns();
+        std::size_t res_height = height.output_size_;
+        std::size_t res_width = width.output_size_;
+
+        blaze::DynamicArray<4UL, T> result(
+            batch, res_height, res_width, out_channels);
+
+        // a pointwise convolution does not need the patches
+        if (detail::is_pointwise(height) && detail::is_pointwise(width))
+        {
+            hpx::for_loop(hpx::execution::par, std::size_t(0),
+                batch * res_height,
+                [&](std::size_t task)
+                {
+                    std::size_t p = task / res_height;
+                    std::size_t i = task % res_height;
+                    blaze::pageslice(blaze::quatslice(result, p), i) =
+                        blaze::pageslice(blaze::quatslice(q, p), i) * kernel;
+                });
+            return result;
+        }
+
+        std::vector<std::int64_t> const height_indices =
+            detail::input_indices(height);
+        std::vector<std::int64_t> const width_indices =
+            detail::input_indices(width);
+
+        std::size_t filter_height = height.kernel_size_;
+        std::size_t filter_width = width.kernel_size_;
+        std::size_t patch_size = filter_height * filter_width * in_channels;
+        std::size_t block_size =
+            detail::rows_per_block(res_width * patch_size, res_height);
+        std::size_t blocks = (res_height + block_size - 1) / block_size;
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch * blocks,
+            [&](std::size_t task)
+            {
+                std::size_t p = task / blocks;
+                std::size_t begin = (task % blocks) * block_size;
+                std::size_t rows = (std::min)(block_size, res_height - begin);
+
+                blaze::DynamicMatrix<T> patches(
+                    rows * res_width, patch_size, T(0));
+                detail::conv2d_patches(q, p, height_indices, width_indices,
+                    height, width, begin, patches);
+
+                blaze::DynamicMatrix<T> product = patches * kernel;
+
+                auto res_tensor = blaze::quatslice(result, p);
+                for (std::size_t i = 0; i != rows; ++i)
+                {
+                    blaze::pageslice(res_tensor, begin + i) =
+                        blaze::submatrix(product, i * res_width, 0, res_width,
+                            out_channels);
+                }
+            });
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The gradient with respect to the patches is the product of the gradient
+    // of the result with the transposed kernel, it is accumulated into the
+    // input elements the patches were built from. The patches of different
+    // output positions overlap, thus only the batches are handled
+    // concurrently.
+    blaze::DynamicTensor<double> conv1d_gemm_input_gradient(
+        ir::node_data<double> const& grad,
+        blaze::DynamicMatrix<double> const& kernel,
+        conv_dimension const& length)
+    {
+        auto g = grad.tensor();
+        std::size_t batch = g.pages();
+        std::size_t filter_length = length.kernel_size_;
+        std::size_t in_channels = kernel.rows() / filter_length;
+        std::size_t out_channels = kernel.columns();
+        std::size_t result_length = length.output_size_;
+
+        blaze::DynamicTensor<double> result(
+            batch, length.input_size_, in_channels, 0.0);
+
+        std::vector<std::int64_t> const indices = detail::input_indices(length);
+        blaze::DynamicMatrix<double> const kernel_t = blaze::trans(kernel);
+
+        std::size_t block_size =
+            detail::rows_per_block(kernel.rows(), result_length);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t p)
+            {
+                auto g_slice = blaze::pageslice(g, p);
+                auto result_slice = blaze::pageslice(result, p);
+
+                for (std::size_t begin = 0; begin < result_length;
+                     begin += block_size)
+                {
+                    std::size_t rows =
+                        (std::min)(block_size, result_length - begin);
+
+                    blaze::DynamicMatrix<double> patches =
+                        blaze::submatrix(g_slice, begin, 0, rows,
+                            out_channels) * kernel_t;
+
+                    for (std::size_t i = 0; i != rows; ++i)
+                    {
+                        std::int64_t const* index =
+                            &indices[(begin + i) * filter_length];
+                        for (std::size_t t = 0; t != filter_length; ++t)
+                        {
+                            if (index[t] < 0)
+                            {
+                                continue;
+                            }
+                            for (std::size_t c = 0; c != in_channels; ++c)
+                            {
+                                result_slice(index[t], c) +=
+                                    patches(i, t * in_channels + c);
+                            }
+                        }
+                    }
+                }
+            });
+        return result;
+    }
+
+    // The gradient with respect to the kernel is the sum of the products of
+    // the transposed patches with the gradient of the result, every batch
+    // contributes a partial sum
+    blaze::DynamicMatrix<double> conv1d_gemm_kernel_gradient(
+        ir::node_data<double> const& arg, ir::node_data<double> const& grad,
+        conv_dimension const& length)
+    {
+        auto a = arg.tensor();
+        auto g = grad.tensor();
+        std::size_t batch = a.pages();
+        std::size_t in_channels = a.columns();
+        std::size_t out_channels = g.columns();
+        std::size_t filter_length = length.kernel_size_;
+        std::size_t result_length = length.output_size_;
+
+        std::vector<std::int64_t> const indices = detail::input_indices(length);
+
+        std::size_t patch_size = filter_length * in_channels;
+        std::size_t block_size =
+            detail::rows_per_block(patch_size, result_length);
+
+        std::vector<blaze::DynamicMatrix<double>> partials(batch);
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t p)
+            {
+                auto g_slice = blaze::pageslice(g, p);
+
+                blaze::DynamicMatrix<double> partial(
+                    patch_size, out_channels, 0.0);
+                for (std::size_t begin = 0; begin < result_length;
+                     begin += block_size)
+                {
+                    std::size_t rows =
+                        (std::min)(block_size, result_length - begin);
+
+                    blaze::DynamicMatrix<double> patches(
+                        rows, patch_size, 0.0);
+                    detail::conv1d_patches(
+                        a, p, indices, filter_length, begin, patches);
+
+                    partial += blaze::trans(patches) *
+                        blaze::submatrix(
+                            g_slice, begin, 0, rows, out_channels);
+                }
+                partials[p] = std::move(partial);
+            });
+
+        blaze::DynamicMatrix<double> result(patch_size, out_channels, 0.0);
+        for (auto const& partial : partials)
+        {
+            result += partial;
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Gather the gradient of the result for the output rows starting at
+        // begin into the layout of the patch matrix
+        template <typename Quatern>
+        blaze::DynamicMatrix<double> conv2d_gradient_rows(Quatern const& g,
+            std::size_t p, std::size_t begin, std::size_t rows)
+        {
+            std::size_t res_width = g.rows();
+            std::size_t out_channels = g.columns();
+
+            auto g_tensor = blaze::quatslice(g, p);
+
+            blaze::DynamicMatrix<double> result(
+                rows * res_width, out_channels);
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                blaze::submatrix(result, i * res_width, 0, res_width,
+                    out_channels) = blaze::pageslice(g_tensor, begin + i);
+            }
+            return result;
+        }
+    }
+
+    blaze::DynamicArray<4UL, double> conv2d_gemm_input_gradient(
+        ir::node_data<double> const& grad,
+        blaze::DynamicMatrix<double> const& kernel,
+        conv_dimension const& height, conv_dimension const& width)
+    {
+        auto g = grad.quatern();
+        std::size_t batch = g.quats();
+        std::size_t filter_height = height.kernel_size_;
+        std::size_t filter_width = width.kernel_size_;
+        std::size_t in_channels =
+            kernel.rows() / (filter_height * filter_width);
+        std::size_t res_height = height.output_size_;
+        std::size_t res_width = width.output_size_;
+
+        blaze::DynamicArray<4UL, double> result(
+            batch, height.input_size_, width.input_size_, in_channels);
+
+        std::vector<std::int64_t> const height_indices =
+            detail::input_indices(height);
+        std::vector<std::int64_t> const width_indices =
+            detail::input_indices(width);
+        blaze::DynamicMatrix<double> const kernel_t = blaze::trans(kernel);
+
+        std::size_t block_size =
+            detail::rows_per_block(res_width * kernel.rows(), res_height);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t p)
+            {
+                blaze::DynamicTensor<double> input_grad(height.input_size_,
+                    width.input_size_, in_channels, 0.0);
+
+                for (std::size_t begin = 0; begin < res_height;
+                     begin += block_size)
+                {
+                    std::size_t rows =
+                        (std::min)(block_size, res_height - begin);
+
+                    blaze::DynamicMatrix<double> patches =
+                        detail::conv2d_gradient_rows(g, p, begin, rows) *
+                        kernel_t;
+
+                    for (std::size_t i = 0; i != rows; ++i)
+                    {
+                        std::int64_t const* h_index =
+                            &height_indices[(begin + i) * filter_height];
+                        for (std::size_t j = 0; j != res_width; ++j)
+                        {
+                            std::int64_t const* w_index =
+                                &width_indices[j * filter_width];
+                            std::size_t row = i * res_width + j;
+                            for (std::size_t s = 0; s != filter_height; ++s)
+                            {
+                                if (h_index[s] < 0)
+                                {
+                                    continue;
+                                }
+                                for (std::size_t t = 0; t != filter_width;
+                                     ++t)
+                                {
+                                    if (w_index[t] < 0)
+                                    {
+                                        continue;
+                                    }
+                                    std::size_t col =
+                                        (s * filter_width + t) * in_channels;
+                                    for (std::size_t c = 0; c != in_channels;
+                                         ++c)
+                                    {
+                                        input_grad(h_index[s], w_index[t],
+                                            c) += patches(row, col + c);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+
+                auto result_tensor = blaze::quatslice(result, p);
+                for (std::size_t i = 0; i != input_grad.pages(); ++i)
+                {
+                    blaze::pageslice(result_tensor, i) =
+                        blaze::pageslice(input_grad, i);
+                }
+            });
+        return result;
+    }
+
+    blaze::DynamicMatrix<double> conv2d_gemm_kernel_gradient(
+        ir::node_data<double> const& arg, ir::node_data<double> const& grad,
+        conv_dimension const& height, conv_dimension const& width)
+    {
+        auto q = arg.quatern();
+        auto g = grad.quatern();
+        std::size_t batch = q.quats();
+        std::size_t in_channels = q.columns();
+        std::size_t out_channels = g.columns();
+        std::size_t res_height = height.output_size_;
+        std::size_t res_width = width.output_size_;
+
+        std::vector<std::int64_t> const height_indices =
+            detail::input_indices(height);
+        std::vector<std::int64_t> const width_indices =
+            detail::input_indices(width);
+
+        std::size_t patch_size =
+            height.kernel_size_ * width.kernel_size_ * in_channels;
+        std::size_t block_size =
+            detail::rows_per_block(res_width * patch_size, res_height);
+
+        std::vector<blaze::DynamicMatrix<double>> partials(batch);
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t p)
+            {
+                blaze::DynamicMatrix<double> partial(
+                    patch_size, out_channels, 0.0);
+                for (std::size_t begin = 0; begin < res_height;
+                     begin += block_size)
+                {
+                    std::size_t rows =
+                        (std::min)(block_size, res_height - begin);
+
+                    blaze::DynamicMatrix<double> patches(
+                        rows * res_width, patch_size, 0.0);
+                    detail::conv2d_patches(q, p, height_indices,
+                        width_indices, height, width, begin, patches);
+
+                    partial += blaze::trans(patches) *
+                        detail::conv2d_gradient_rows(g, p, begin, rows);
+                }
+                partials[p] = std::move(partial);
+            });
+
+        blaze::DynamicMatrix<double> result(patch_size, out_channels, 0.0);
+        for (auto const& partial : partials)
+        {
+            result += partial;
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicTensor<double> conv1d_kernel_from_matrix(
+        blaze::DynamicMatrix<double> const& kernel, std::size_t filter_length)
+    {
+        std::size_t in_channels = kernel.rows() / filter_length;
+
+        blaze::DynamicTensor<double> result(
+            filter_length, in_channels, kernel.columns());
+        for (std::size_t t = 0; t != filter_length; ++t)
+        {
+            blaze::pageslice(result, t) = blaze::submatrix(
+                kernel, t * in_channels, 0, in_channels, kernel.columns());
+        }
+        return result;
+    }
+
+    blaze::DynamicArray<4UL, double> conv2d_kernel_from_matrix(
+        blaze::DynamicMatrix<double> const& kernel, std::size_t filter_height,
+        std::size_t filter_width)
+    {
+        std::size_t in_channels =
+            kernel.rows() / (filter_height * filter_width);
+
+        blaze::DynamicArray<4UL, double> result(
+            filter_height, filter_width, in_channels, kernel.columns());
+        for (std::size_t s = 0; s != filter_height; ++s)
+        {
+            auto result_tensor = blaze::quatslice(result, s);
+            for (std::size_t t = 0; t != filter_width; ++t)
+            {
+                blaze::pageslice(result_tensor, t) =
+                    blaze::submatrix(kernel,
+                        (s * filter_width + t) * in_channels, 0, in_channels,
+                        kernel.columns());
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // explicitly instantiate the forward convolutions for double and single
+    // precision data
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double>
+    conv1d_kernel_matrix(ir::node_data<double> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double>
+    separable_conv1d_kernel_matrix(
+        ir::node_data<double> const&, ir::node_data<double> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double>
+    conv2d_kernel_matrix(ir::node_data<double> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double>
+    conv2d_transpose_kernel_matrix(ir::node_data<double> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicTensor<double> conv1d_gemm(
+        ir::node_data<double> const&, blaze::DynamicMatrix<double> const&,
+        conv_dimension const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, double> conv2d_gemm(
+        ir::node_data<double> const&, blaze::DynamicMatrix<double> const&,
+        conv_dimension const&, conv_dimension const&);
+
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<float>
+    conv1d_kernel_matrix(ir::node_data<float> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<float>
+    separable_conv1d_kernel_matrix(
+        ir::node_data<float> const&, ir::node_data<float> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<float>
+    conv2d_kernel_matrix(ir::node_data<float> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<float>
+    conv2d_transpose_kernel_matrix(ir::node_data<float> const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicTensor<float> conv1d_gemm(
+        ir::node_data<float> const&, blaze::DynamicMatrix<float> const&,
+        conv_dimension const&);
+    template PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, float> conv2d_gemm(
+        ir::node_data<float> const&, blaze::DynamicMatrix<float> const&,
+        conv_dimension const&, conv_dimension const&);
+}}
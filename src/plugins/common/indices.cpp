@@ -77,6 +77,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return indices1d_helper<std::int64_t>(size);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -146,6 +148,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return indices2d_helper<std::int64_t>(rows, columns);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -223,6 +227,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return indices3d_helper<std::int64_t>(pages, rows, columns);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -313,6 +319,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return indices4d_helper<std::int64_t>(quats, pages, rows, columns);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -421,6 +429,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return sparse_indices1d_helper<std::int64_t>(size);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -488,6 +498,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return sparse_indices2d_helper<std::int64_t>(rows, columns);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -562,6 +574,8 @@ namespace phylanx { namespace common {
         case node_data_type_int64:
             return sparse_indices3d_helper<std::int64_t>(pages, rows, columns);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -650,6 +664,8 @@ namespace phylanx { namespace common {
             return sparse_indices4d_helper<std::int64_t>(
                 quats, pages, rows, columns);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -0,0 +1,423 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+#include <phylanx/plugins/common/sparse_operations.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <blaze/Math.h>
+
+////////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace common
+{
+    namespace detail
+    {
+        using sparse_vector_type =
+            ir::node_data<double>::sparse_storage1d_type;
+        using sparse_matrix_type =
+            ir::node_data<double>::sparse_storage2d_type;
+
+        template <typename T>
+        struct is_sparse
+          : std::integral_constant<bool,
+                blaze::IsSparseVector<T>::value ||
+                    blaze::IsSparseMatrix<T>::value>
+        {
+        };
+
+        // products are sparse only if both operands are sparse
+        template <typename Lhs, typename Rhs>
+        using product_vector_type = typename std::conditional<
+            is_sparse<Lhs>::value && is_sparse<Rhs>::value,
+            sparse_vector_type, blaze::DynamicVector<double>>::type;
+
+        template <typename Lhs, typename Rhs>
+        using product_matrix_type = typename std::conditional<
+            is_sparse<Lhs>::value && is_sparse<Rhs>::value,
+            sparse_matrix_type, blaze::DynamicMatrix<double>>::type;
+
+        // element-wise products are sparse if any of the operands is sparse
+        template <typename Lhs, typename Rhs>
+        using elementwise_vector_type = typename std::conditional<
+            is_sparse<Lhs>::value || is_sparse<Rhs>::value,
+            sparse_vector_type, blaze::DynamicVector<double>>::type;
+
+        template <typename Lhs, typename Rhs>
+        using elementwise_matrix_type = typename std::conditional<
+            is_sparse<Lhs>::value || is_sparse<Rhs>::value,
+            sparse_matrix_type, blaze::DynamicMatrix<double>>::type;
+
+        ////////////////////////////////////////////////////////////////////////
+        // invoke the given function with either the sparse or the dense
+        // representation of the given data
+        template <typename F>
+        execution_tree::primitive_argument_type visit_vector(
+            ir::node_data<double> const& data, F&& f)
+        {
+            if (data.is_sparse())
+            {
+                return f(data.sparse_vector());
+            }
+            return f(data.vector());
+        }
+
+        template <typename F>
+        execution_tree::primitive_argument_type visit_matrix(
+            ir::node_data<double> const& data, F&& f)
+        {
+            if (data.is_sparse())
+            {
+                return f(data.sparse_matrix());
+            }
+            return f(data.matrix());
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        execution_tree::primitive_argument_type sparse_scale(
+            ir::node_data<double>&& arg, double factor)
+        {
+            HPX_ASSERT(arg.is_sparse());
+            if (arg.num_dimensions() == 1)
+            {
+                sparse_vector_type result = factor * arg.sparse_vector();
+                return execution_tree::primitive_argument_type{
+                    ir::node_data<double>{std::move(result)}};
+            }
+
+            sparse_matrix_type result = factor * arg.sparse_matrix();
+            return execution_tree::primitive_argument_type{
+                ir::node_data<double>{std::move(result)}};
+        }
+
+        void throw_incompatible_shapes(char const* func,
+            std::string const& name, std::string const& codename)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, func,
+                util::generate_error_message(
+                    "the operands have incompatible shapes", name,
+                    codename));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type to_sparse(
+        execution_tree::primitive_argument_type&& arg,
+        std::string const& name, std::string const& codename)
+    {
+        using namespace execution_tree;
+
+        if (is_sparse_operand(arg))
+        {
+            return std::move(arg);
+        }
+
+        auto data = extract_numeric_value(std::move(arg), name, codename);
+        switch (data.num_dimensions())
+        {
+        case 1:
+            return primitive_argument_type{ir::node_data<double>{
+                detail::sparse_vector_type{data.vector()}}};
+
+        case 2:
+            return primitive_argument_type{ir::node_data<double>{
+                detail::sparse_matrix_type{data.matrix()}}};
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter, "common::to_sparse",
+            util::generate_error_message(
+                "only vectors and matrices can be converted to sparse data",
+                name, codename));
+    }
+
+    execution_tree::primitive_argument_type to_dense(
+        execution_tree::primitive_argument_type&& arg,
+        std::string const& name, std::string const& codename)
+    {
+        using namespace execution_tree;
+
+        if (!is_sparse_operand(arg))
+        {
+            return std::move(arg);
+        }
+
+        auto data = extract_numeric_value(std::move(arg), name, codename);
+        if (data.num_dimensions() == 1)
+        {
+            return primitive_argument_type{std::move(data).vector_copy()};
+        }
+        return primitive_argument_type{std::move(data).matrix_copy()};
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type sparse_dot(
+        execution_tree::primitive_argument_type&& lhs_arg,
+        execution_tree::primitive_argument_type&& rhs_arg,
+        std::string const& name, std::string const& codename)
+    {
+        using namespace execution_tree;
+
+        auto lhs = extract_numeric_value(std::move(lhs_arg), name, codename);
+        auto rhs = extract_numeric_value(std::move(rhs_arg), name, codename);
+
+        if (lhs.num_dimensions() == 0)
+        {
+            return detail::sparse_scale(std::move(rhs), lhs.scalar());
+        }
+        if (rhs.num_dimensions() == 0)
+        {
+            return detail::sparse_scale(std::move(lhs), rhs.scalar());
+        }
+
+        switch (lhs.num_dimensions() * 10 + rhs.num_dimensions())
+        {
+        case 11:
+            return detail::visit_vector(lhs, [&](auto const& l)
+            {
+                return detail::visit_vector(rhs, [&](auto const& r)
+                {
+                    if (l.size() != r.size())
+                    {
+                        detail::throw_incompatible_shapes(
+                            "common::sparse_dot", name, codename);
+                    }
+                    double result = blaze::trans(l) * r;
+                    return primitive_argument_type{result};
+                });
+            });
+
+        case 12:
+            return detail::visit_vector(lhs, [&](auto const& l)
+            {
+                return detail::visit_matrix(rhs, [&](auto const& r)
+                {
+                    if (l.size() != r.rows())
+                    {
+                        detail::throw_incompatible_shapes(
+                            "common::sparse_dot", name, codename);
+                    }
+                    detail::product_vector_type<std::decay_t<decltype(l)>,
+                        std::decay_t<decltype(r)>>
+                        result = blaze::trans(blaze::trans(l) * r);
+                    return primitive_argument_type{
+                        ir::node_data<double>{std::move(result)}};
+                });
+            });
+
+        case 21:
+            return detail::visit_matrix(lhs, [&](auto const& l)
+            {
+                return detail::visit_vector(rhs, [&](auto const& r)
+                {
+                    if (l.columns() != r.size())
+                    {
+                        detail::throw_incompatible_shapes(
+                            "common::sparse_dot", name, codename);
+                    }
+                    detail::product_vector_type<std::decay_t<decltype(l)>,
+                        std::decay_t<decltype(r)>>
+                        result = l * r;
+                    return primitive_argument_type{
+                        ir::node_data<double>{std::move(result)}};
+                });
+            });
+
+        case 22:
+            return detail::visit_matrix(lhs, [&](auto const& l)
+            {
+                return detail::visit_matrix(rhs, [&](auto const& r)
+                {
+                    if (l.columns() != r.rows())
+                    {
+                        detail::throw_incompatible_shapes(
+                            "common::sparse_dot", name, codename);
+                    }
+                    detail::product_matrix_type<std::decay_t<decltype(l)>,
+                        std::decay_t<decltype(r)>>
+                        result = l * r;
+                    return primitive_argument_type{
+                        ir::node_data<double>{std::move(result)}};
+                });
+            });
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter, "common::sparse_dot",
+            util::generate_error_message(
+                "sparse data supports dot products of vectors and matrices "
+                "only",
+                name, codename));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type sparse_mul(
+        execution_tree::primitive_argument_type&& lhs_arg,
+        execution_tree::primitive_argument_type&& rhs_arg,
+        std::string const& name, std::string const& codename)
+    {
+        using namespace execution_tree;
+
+        auto lhs = extract_numeric_value(std::move(lhs_arg), name, codename);
+        auto rhs = extract_numeric_value(std::move(rhs_arg), name, codename);
+
+        if (lhs.num_dimensions() == 0)
+        {
+            return detail::sparse_scale(std::move(rhs), lhs.scalar());
+        }
+        if (rhs.num_dimensions() == 0)
+        {
+            return detail::sparse_scale(std::move(lhs), rhs.scalar());
+        }
+
+        if (lhs.dimensions() != rhs.dimensions())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "common::sparse_mul",
+                util::generate_error_message(
+                    "sparse data can be multiplied element-wise with scalars "
+                    "or with arrays of the same shape only",
+                    name, codename));
+        }
+
+        if (lhs.num_dimensions() == 1)
+        {
+            return detail::visit_vector(lhs, [&](auto const& l)
+            {
+                return detail::visit_vector(rhs, [&](auto const& r)
+                {
+                    detail::elementwise_vector_type<std::decay_t<decltype(l)>,
+                        std::decay_t<decltype(r)>>
+                        result = l * r;
+                    return primitive_argument_type{
+                        ir::node_data<double>{std::move(result)}};
+                });
+            });
+        }
+
+        return detail::visit_matrix(lhs, [&](auto const& l)
+        {
+            return detail::visit_matrix(rhs, [&](auto const& r)
+            {
+                detail::elementwise_matrix_type<std::decay_t<decltype(l)>,
+                    std::decay_t<decltype(r)>>
+                    result = l % r;
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(result)}};
+            });
+        });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type sparse_transpose(
+        execution_tree::primitive_argument_type&& arg,
+        std::string const& name, std::string const& codename)
+    {
+        using namespace execution_tree;
+
+        auto data = extract_numeric_value(std::move(arg), name, codename);
+        if (data.num_dimensions() == 1)
+        {
+            return primitive_argument_type{std::move(data)};    // no-op
+        }
+
+        detail::sparse_matrix_type result =
+            blaze::trans(data.sparse_matrix());
+        return primitive_argument_type{
+            ir::node_data<double>{std::move(result)}};
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type sparse_sum(
+        execution_tree::primitive_argument_type&& arg,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        std::string const& name, std::string const& codename)
+    {
+        using namespace execution_tree;
+
+        auto data = extract_numeric_value(std::move(arg), name, codename);
+        std::int64_t dims = data.num_dimensions();
+
+        std::int64_t a = -1;
+        if (axis)
+        {
+            a = *axis < 0 ? *axis + dims : *axis;
+            if (a < 0 || a >= dims)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter, "common::sparse_sum",
+                    util::generate_error_message(
+                        "the given axis is out of range", name, codename));
+            }
+        }
+
+        if (dims == 1)
+        {
+            double result = blaze::sum(data.sparse_vector());
+            if (keepdims)
+            {
+                return primitive_argument_type{
+                    blaze::DynamicVector<double>(1, result)};
+            }
+            return primitive_argument_type{result};
+        }
+
+        auto const& m = data.sparse_matrix();
+        switch (a)
+        {
+        case 0:
+            {
+                blaze::DynamicVector<double, blaze::rowVector> result =
+                    blaze::sum<blaze::columnwise>(m);
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<double> r(1, result.size());
+                    blaze::row(r, 0) = result;
+                    return primitive_argument_type{std::move(r)};
+                }
+                return primitive_argument_type{
+                    blaze::DynamicVector<double>{blaze::trans(result)}};
+            }
+
+        case 1:
+            {
+                blaze::DynamicVector<double> result =
+                    blaze::sum<blaze::rowwise>(m);
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<double> r(result.size(), 1);
+                    blaze::column(r, 0) = result;
+                    return primitive_argument_type{std::move(r)};
+                }
+                return primitive_argument_type{std::move(result)};
+            }
+
+        default:
+            break;
+        }
+
+        double result = blaze::sum(m);
+        if (keepdims)
+        {
+            return primitive_argument_type{
+                blaze::DynamicMatrix<double>(1, 1, result)};
+        }
+        return primitive_argument_type{result};
+    }
+}}
@@ -8,6 +8,7 @@
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/export_definitions.hpp>
+#include <phylanx/plugins/common/sparse_operations.hpp>
 #include <phylanx/plugins/common/transpose_operation_nd.hpp>
 #include <phylanx/plugins/matrixops/transpose_operation.hpp>
 #include <phylanx/util/generate_error_message.hpp>
@@ -53,6 +54,11 @@ namespace phylanx { namespace common
     {
         using namespace execution_tree;
 
+        if (is_sparse_operand(arg))
+        {
+            return sparse_transpose(std::move(arg), name, codename);
+        }
+
         switch (extract_common_type(arg))
         {
         case node_data_type_bool:
@@ -63,6 +69,7 @@ namespace phylanx { namespace common
             return transpose2d(
                 extract_integer_value_strict(std::move(arg), name, codename));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
@@ -103,6 +110,16 @@ namespace phylanx { namespace common
     {
         using namespace execution_tree;
 
+        if (is_sparse_operand(arg))
+        {
+            auto v = axes.vector();
+            if (v[0] == 0 || v[0] == -2)
+            {
+                return std::move(arg);      // identity permutation
+            }
+            return sparse_transpose(std::move(arg), name, codename);
+        }
+
         switch (extract_common_type(arg))
         {
         case node_data_type_bool:
@@ -115,6 +132,8 @@ namespace phylanx { namespace common
                 extract_integer_value_strict(std::move(arg), name, codename),
                 std::move(axes));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -214,6 +233,7 @@ namespace phylanx { namespace common
             return transpose3d(
                 extract_integer_value_strict(std::move(arg), name, codename));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
@@ -274,6 +294,8 @@ namespace phylanx { namespace common
                 extract_integer_value_strict(std::move(arg), name, codename),
                 std::move(axes));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -492,6 +514,7 @@ namespace phylanx { namespace common
             return transpose4d(
                 extract_integer_value_strict(std::move(arg), name, codename));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose4d(
@@ -635,6 +658,8 @@ namespace phylanx { namespace common
                 extract_integer_value_strict(std::move(arg), name, codename),
                 std::move(axes));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -4,6 +4,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/plugins/controls/chunking_policy.hpp>
 #include <phylanx/plugins/controls/fmap_operation.hpp>
 
 #include <hpx/assert.hpp>
@@ -32,11 +33,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
         hpx::make_tuple("fmap",
             std::vector<std::string>{"fmap(_1, __2)"},
             &create_fmap_operation, &create_primitive<fmap_operation>,
-            R"(func, listv
+            R"(func, chunking, listv
 
             Args:
 
                 func (function) : a function that takes one argument
+                chunking (optional, string) : A string literal describing how
+                    the elements are grouped into tasks: 'sequential' (the
+                    default), 'auto', 'static[:N]', or 'dynamic[:N]' (see
+                    parallel_map)
                 listv (iterator) : a set of values
 
             Returns:
@@ -71,35 +76,36 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             static vector_type call(primitive const* p,
                 vector_view_type const& vec, std::string const& name,
-                std::string const& codename, eval_context ctx)
+                std::string const& codename, chunking_policy const& policy,
+                eval_context ctx)
             {
                 vector_type result(vec.size(), T{0});
 
-                std::size_t i = 0;
-                for (auto && val : vec)
-                {
-                    auto r = p->eval(hpx::launch::sync,
-                        primitive_argument_type{std::move(val)}, ctx);
-
-                    if (valid(r))
+                chunked_for_loop(policy, vec.size(),
+                    [&](std::size_t i)
                     {
-                        auto num_result =
-                            extract_numeric_value(std::move(r), name, codename);
+                        auto r = p->eval(hpx::launch::sync,
+                            primitive_argument_type{T(vec[i])}, ctx);
 
-                        if (num_result.num_dimensions() != 0)
+                        if (valid(r))
                         {
-                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                                "detail::fmap_1_vector::call",
-                                util::generate_error_message(
-                                    "the invoked lambda returned an unexpected "
-                                    "type ("
-                                    "should be a scalar value)",
-                                    name, codename));
+                            auto num_result = extract_numeric_value(
+                                std::move(r), name, codename);
+
+                            if (num_result.num_dimensions() != 0)
+                            {
+                                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                    "detail::fmap_1_vector::call",
+                                    util::generate_error_message(
+                                        "the invoked lambda returned an "
+                                        "unexpected type (should be a scalar "
+                                        "value)",
+                                        name, codename));
+                            }
+
+                            result[i] = num_result.scalar();
                         }
-
-                        result[i++] = num_result.scalar();
-                    }
-                }
+                    });
 
                 return result;
             }
@@ -107,7 +113,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }    // namespace detail
 
     primitive_argument_type fmap_operation::fmap_1_vector(primitive const* p,
-        primitive_argument_type&& arg, eval_context ctx) const
+        primitive_argument_type&& arg, chunking_policy const& policy,
+        eval_context ctx) const
     {
         if (is_integer_operand_strict(arg))
         {
@@ -115,7 +122,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             HPX_ASSERT(v.num_dimensions() == 1);
             return primitive_argument_type{ir::node_data<std::int64_t>{
                 detail::fmap_1_vector<std::int64_t>::call(
-                    p, v.vector(), name_, codename_, std::move(ctx))}};
+                    p, v.vector(), name_, codename_, policy, std::move(ctx))}};
         }
 
         if (is_boolean_operand_strict(arg))
@@ -124,7 +131,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             HPX_ASSERT(v.num_dimensions() == 1);
             return primitive_argument_type{ir::node_data<std::uint8_t>{
                 detail::fmap_1_vector<std::uint8_t>::call(
-                    p, v.vector(), name_, codename_, std::move(ctx))}};
+                    p, v.vector(), name_, codename_, policy, std::move(ctx))}};
         }
 
         if (is_numeric_operand(arg))
@@ -133,7 +140,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             HPX_ASSERT(v.num_dimensions() == 1);
             return primitive_argument_type{
                 ir::node_data<double>{detail::fmap_1_vector<double>::call(
-                    p, v.vector(), name_, codename_, std::move(ctx))}};
+                    p, v.vector(), name_, codename_, policy, std::move(ctx))}};
         }
 
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -208,21 +215,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             static ir::node_data<T> call(primitive const* p,
                 matrix_view_type const& m, std::string const& name,
-                std::string const& codename, eval_context ctx)
+                std::string const& codename, chunking_policy const& policy,
+                eval_context ctx)
             {
-                std::vector<ir::node_data<T>> result;
-                result.reserve(m.rows());
+                std::vector<ir::node_data<T>> result(m.rows());
 
                 using vector_type = typename ir::node_data<T>::storage1d_type;
-                for (std::size_t i = 0; i != m.rows(); ++i)
-                {
-                    vector_type row{blaze::trans(blaze::row(m, i))};
+                chunked_for_loop(policy, m.rows(),
+                    [&](std::size_t i)
+                    {
+                        vector_type row{blaze::trans(blaze::row(m, i))};
 
-                    result.emplace_back(extract_numeric_value(
-                        p->eval(hpx::launch::sync,
-                            primitive_argument_type{std::move(row)}, ctx),
-                        name, codename));
-                }
+                        result[i] = extract_numeric_value(
+                            p->eval(hpx::launch::sync,
+                                primitive_argument_type{std::move(row)}, ctx),
+                            name, codename);
+                    });
 
                 return to_array_type_2d(
                     std::move(result), m.columns(), name, codename);
@@ -231,7 +239,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }    // namespace detail
 
     primitive_argument_type fmap_operation::fmap_1_matrix(primitive const* p,
-        primitive_argument_type&& arg, eval_context ctx) const
+        primitive_argument_type&& arg, chunking_policy const& policy,
+        eval_context ctx) const
     {
         if (is_integer_operand_strict(arg))
         {
@@ -239,7 +248,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             HPX_ASSERT(m.num_dimensions() == 2);
             return primitive_argument_type{
                 detail::fmap_1_matrix<std::int64_t>::call(
-                    p, m.matrix(), name_, codename_, std::move(ctx))};
+                    p, m.matrix(), name_, codename_, policy, std::move(ctx))};
         }
 
         if (is_boolean_operand_strict(arg))
@@ -248,7 +257,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             HPX_ASSERT(m.num_dimensions() == 2);
             return primitive_argument_type{
                 detail::fmap_1_matrix<std::uint8_t>::call(
-                    p, m.matrix(), name_, codename_, std::move(ctx))};
+                    p, m.matrix(), name_, codename_, policy, std::move(ctx))};
         }
 
         if (is_numeric_operand(arg))
@@ -256,7 +265,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             auto m = extract_numeric_value(std::move(arg), name_, codename_);
             HPX_ASSERT(m.num_dimensions() == 2);
             return primitive_argument_type{detail::fmap_1_matrix<double>::call(
-                p, m.matrix(), name_, codename_, std::move(ctx))};
+                p, m.matrix(), name_, codename_, policy, std::move(ctx))};
         }
 
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -266,12 +275,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> fmap_operation::fmap_1(
-        primitive_arguments_type const& operands,
-        primitive_arguments_type const& args, eval_context ctx) const
+        primitive_argument_type const& list_operand,
+        primitive_arguments_type const& args, chunking_policy const& policy,
+        eval_context ctx) const
     {
         auto this_ = this->shared_from_this();
         return hpx::dataflow(hpx::launch::sync,
-            [this_ = std::move(this_), ctx](
+            [this_ = std::move(this_), policy, ctx](
                     hpx::future<primitive_argument_type>&& f,
                     hpx::future<primitive_argument_type>&& l) mutable
             -> primitive_argument_type
@@ -291,20 +301,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                 if (is_list_operand_strict(arg))
                 {
-                    // Sequentially evaluate all elements in the given list
                     ir::range&& list = extract_list_value_strict(
                         std::move(arg), this_->name_, this_->codename_);
 
-                    primitive_arguments_type result;
-                    result.reserve(list.size());
-
+                    primitive_arguments_type elements;
+                    elements.reserve(list.size());
                     for (auto && elem : list)
                     {
-                        // Evaluate function for each of the argument sets
-                        result.push_back(
-                            p->eval(hpx::launch::sync, std::move(elem), ctx));
+                        elements.emplace_back(std::move(elem));
                     }
 
+                    // Evaluate all elements in the given list as described
+                    // by the chunking policy (sequentially by default)
+                    primitive_arguments_type result(elements.size());
+                    chunked_for_loop(policy, elements.size(),
+                        [&](std::size_t i)
+                        {
+                            result[i] = p->eval(hpx::launch::sync,
+                                std::move(elements[i]), ctx);
+                        });
+
                     return primitive_argument_type{std::move(result)};
                 }
 
@@ -321,11 +337,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     case 1:
                         return this_->fmap_1_vector(
-                            p, std::move(arg), std::move(ctx));
+                            p, std::move(arg), policy, std::move(ctx));
 
                     case 2:
                         return this_->fmap_1_matrix(
-                            p, std::move(arg), std::move(ctx));
+                            p, std::move(arg), policy, std::move(ctx));
 
                     default:
                         break;
@@ -340,7 +356,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             },
             value_operand(operands[0], args, name_, codename_,
                 add_mode(ctx, eval_dont_evaluate_lambdas)),
-            value_operand(operands[1], args, name_, codename_, ctx));
+            value_operand(list_operand, args, name_, codename_, ctx));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -388,7 +404,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     primitive_argument_type fmap_operation::fmap_n_lists(primitive const* p,
-        primitive_arguments_type&& args, eval_context ctx) const
+        primitive_arguments_type&& args, chunking_policy const& policy,
+        eval_context ctx) const
     {
         std::vector<ir::range> lists;
         lists.reserve(args.size());
@@ -412,7 +429,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
             }
         }
 
-        // Sequentially evaluate all operations
         std::size_t numlists = lists.size();
 
         std::vector<ir::range_iterator> iters;
@@ -423,24 +439,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
             iters.push_back(j.begin());
         }
 
-        primitive_arguments_type result;
-        result.reserve(size);
-
+        // Each invocation has its own argument set
+        std::vector<primitive_arguments_type> elements(size);
         for (std::size_t i = 0; i != size; ++i)
         {
-            primitive_arguments_type args;
-            args.reserve(numlists);
-
-            // Each invocation has its own argument set
+            elements[i].reserve(numlists);
             for (ir::range_iterator& j : iters)
             {
-                args.push_back(*j++);
+                elements[i].push_back(*j++);
             }
-
-            // Evaluate function for each of the argument sets
-            result.push_back(p->eval(hpx::launch::sync, std::move(args), ctx));
         }
 
+        // Evaluate function for each of the argument sets
+        primitive_arguments_type result(size);
+        chunked_for_loop(policy, size,
+            [&](std::size_t i)
+            {
+                result[i] = p->eval(
+                    hpx::launch::sync, std::move(elements[i]), ctx);
+            });
+
         return primitive_argument_type{std::move(result)};
     }
 
@@ -451,7 +469,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     primitive_argument_type fmap_operation::fmap_n_vector(primitive const* p,
-        primitive_arguments_type&& args, eval_context ctx) const
+        primitive_arguments_type&& args, chunking_policy const& policy,
+        eval_context ctx) const
     {
         std::vector<ir::node_data<double>> values;
         values.reserve(args.size());
@@ -464,39 +483,41 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::size_t size = values[0].vector().size();
         ir::node_data<double>::storage1d_type result(size, 0.0);
 
-        for (std::size_t i = 0; i != size; ++i)
-        {
-            primitive_arguments_type params;
-            params.reserve(args.size());
-            for (std::size_t j = 0; j != args.size(); ++j)
+        chunked_for_loop(policy, size,
+            [&](std::size_t i)
             {
-                params.emplace_back(values[j].vector()[i]);
-            }
-
-            auto r = p->eval(hpx::launch::sync, std::move(params), ctx);
-            if (valid(r))
-            {
-                auto num_result =
-                    extract_numeric_value(std::move(r), name_, codename_);
-
-                if (num_result.num_dimensions() != 0)
+                primitive_arguments_type params;
+                params.reserve(values.size());
+                for (std::size_t j = 0; j != values.size(); ++j)
                 {
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "fmap_operation::fmap_n_vector",
-                        generate_error_message(
-                            "the invoked lambda returned an unexpected type ("
-                            "should be a scalar value)"));
+                    params.emplace_back(values[j].vector()[i]);
                 }
 
-                result[i] = num_result.scalar();
-            }
-        }
+                auto r = p->eval(hpx::launch::sync, std::move(params), ctx);
+                if (valid(r))
+                {
+                    auto num_result =
+                        extract_numeric_value(std::move(r), name_, codename_);
+
+                    if (num_result.num_dimensions() != 0)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "fmap_operation::fmap_n_vector",
+                            generate_error_message(
+                                "the invoked lambda returned an unexpected "
+                                "type (should be a scalar value)"));
+                    }
+
+                    result[i] = num_result.scalar();
+                }
+            });
 
         return primitive_argument_type{std::move(result)};
     }
 
     primitive_argument_type fmap_operation::fmap_n_matrix(primitive const* p,
-        primitive_arguments_type&& args, eval_context ctx) const
+        primitive_arguments_type&& args, chunking_policy const& policy,
+        eval_context ctx) const
     {
         std::vector<ir::node_data<double>> values;
         values.reserve(args.size());
@@ -510,54 +531,50 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>::storage2d_type result(
             m0.rows(), m0.columns(), 0.0);
 
-        for (std::size_t i = 0; i != m0.rows(); ++i)
-        {
-            primitive_arguments_type params;
-            params.reserve(args.size());
-            for (std::size_t j = 0; j != args.size(); ++j)
+        chunked_for_loop(policy, m0.rows(),
+            [&](std::size_t i)
             {
-                using vector_type = ir::node_data<double>::storage1d_type;
-                vector_type row{
-                    blaze::trans(blaze::row(values[j].matrix(), i))};
-                params.emplace_back(std::move(row));
-            }
-
-            auto r = p->eval(hpx::launch::sync, std::move(params), ctx);
+                primitive_arguments_type params;
+                params.reserve(values.size());
+                for (std::size_t j = 0; j != values.size(); ++j)
+                {
+                    using vector_type = ir::node_data<double>::storage1d_type;
+                    vector_type row{
+                        blaze::trans(blaze::row(values[j].matrix(), i))};
+                    params.emplace_back(std::move(row));
+                }
 
-            if (valid(r))
-            {
-                auto num_result =
-                    extract_numeric_value(std::move(r), name_, codename_);
+                auto r = p->eval(hpx::launch::sync, std::move(params), ctx);
 
-                if (num_result.num_dimensions() != 1)
+                if (valid(r))
                 {
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "fmap_operation::fmap_n_matrix",
-                        generate_error_message(
-                            "the invoked lambda returned an unexpected type ("
-                            "should be a vector value)"));
-                }
+                    auto num_result =
+                        extract_numeric_value(std::move(r), name_, codename_);
 
-                blaze::row(result, i) = blaze::trans(num_result.vector());
-            }
-        }
+                    if (num_result.num_dimensions() != 1)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "fmap_operation::fmap_n_matrix",
+                            generate_error_message(
+                                "the invoked lambda returned an unexpected "
+                                "type (should be a vector value)"));
+                    }
+
+                    blaze::row(result, i) = blaze::trans(num_result.vector());
+                }
+            });
 
         return primitive_argument_type{std::move(result)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> fmap_operation::fmap_n(
-        primitive_arguments_type const& operands,
-        primitive_arguments_type const& args, eval_context ctx) const
+        primitive_arguments_type&& lists, primitive_arguments_type const& args,
+        chunking_policy const& policy, eval_context ctx) const
     {
-        // all remaining operands have to be lists
-        primitive_arguments_type lists;
-        std::copy(operands.begin() + 1, operands.end(),
-            std::back_inserter(lists));
-
         auto this_ = this->shared_from_this();
         return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
-            [this_ = std::move(this_), ctx](
+            [this_ = std::move(this_), policy, ctx](
                     primitive_argument_type&& bound_func,
                     primitive_arguments_type&& args) mutable
             ->  primitive_argument_type
@@ -575,7 +592,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 if (detail::all_list_operands(args))
                 {
                     return this_->fmap_n_lists(
-                        p, std::move(args), std::move(ctx));
+                        p, std::move(args), policy, std::move(ctx));
                 }
 
                 if (detail::all_numeric_operands(args))
@@ -591,11 +608,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     case 1:
                         return this_->fmap_n_vector(
-                            p, std::move(args), std::move(ctx));
+                            p, std::move(args), policy, std::move(ctx));
 
                     case 2:
                         return this_->fmap_n_matrix(
-                            p, std::move(args), std::move(ctx));
+                            p, std::move(args), policy, std::move(ctx));
 
                     default:
                         break;
@@ -656,12 +673,29 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the first argument to fmap must be an invocable object"));
         }
 
+        // the optional second argument is a string literal describing the
+        // chunking policy, all elements are evaluated sequentially otherwise
+        std::size_t first_list = 1;
+        chunking_policy policy;
+        if (operands.size() > 2 && is_string_operand_strict(operands[1]))
+        {
+            policy = parse_chunking_policy(
+                extract_string_value_strict(operands[1], name_, codename_),
+                name_, codename_);
+            first_list = 2;
+        }
+
         // handle common case separately
-        if (operands.size() == 2)
+        if (operands.size() == first_list + 1)
         {
-            return fmap_1(operands, args, std::move(ctx));
+            return fmap_1(operands[first_list], args, policy, std::move(ctx));
         }
 
-        return fmap_n(operands, args, std::move(ctx));
+        // all remaining operands have to be lists
+        primitive_arguments_type lists;
+        std::copy(operands.begin() + first_list, operands.end(),
+            std::back_inserter(lists));
+
+        return fmap_n(std::move(lists), args, policy, std::move(ctx));
     }
 }}}
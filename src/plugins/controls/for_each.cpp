@@ -6,6 +6,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/controls/chunking_policy.hpp>
 #include <phylanx/plugins/controls/for_each.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
 
@@ -25,14 +26,19 @@
 namespace phylanx { namespace execution_tree { namespace primitives {
     ///////////////////////////////////////////////////////////////////////////
     match_pattern_type const for_each::match_data = {hpx::make_tuple("for_each",
-        std::vector<std::string>{"for_each(_1, _2)"}, &create_for_each,
-        &create_primitive<for_each>,
-        R"(func, range
+        std::vector<std::string>{"for_each(_1, _2)", "for_each(_1, _2, _3)"},
+        &create_for_each, &create_primitive<for_each>,
+        R"(func, chunking, range
             The for_each primitive calls a function `func` for
             each item in the iterator.
             Args:
 
                 func (function): a function that takes one argument
+                chunking (optional, string): A string literal describing how
+                    the items are grouped into tasks: 'sequential' (the
+                    default), 'auto', 'static[:N]', or 'dynamic[:N]' (see
+                    parallel_map). If the items are evaluated concurrently,
+                    returning True from `func` does not stop the iteration.
                 range (iter): an iterator
 
             Returns:
@@ -67,9 +73,22 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         template <typename T>
         void iterate_over_array_vector_helper(primitive const* p,
-            ir::node_data<T>&& value, eval_context ctx, std::string const& name,
+            ir::node_data<T>&& value, chunking_policy const& policy,
+            eval_context ctx, std::string const& name,
             std::string const& codename)
         {
+            if (policy.kind_ != chunking_policy::sequential)
+            {
+                auto v = value.vector();
+                chunked_for_loop(policy, v.size(),
+                    [&](std::size_t i)
+                    {
+                        p->eval(hpx::launch::sync,
+                            primitive_argument_type{T(v[i])}, ctx);
+                    });
+                return;
+            }
+
             for (auto&& e : value.vector())
             {
                 auto result =
@@ -88,7 +107,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
     }    // namespace detail
 
     void for_each::iterate_over_array_vector(primitive const* p,
-        primitive_argument_type&& value, eval_context ctx) const
+        primitive_argument_type&& value, chunking_policy const& policy,
+        eval_context ctx) const
     {
         switch (extract_common_type(value))
         {
@@ -96,21 +116,23 @@ namespace phylanx { namespace execution_tree { namespace primitives {
             return detail::iterate_over_array_vector_helper(p,
                 extract_boolean_value_strict(
                     std::move(value), name_, codename_),
-                std::move(ctx), name_, codename_);
+                policy, std::move(ctx), name_, codename_);
 
         case node_data_type_int64:
             return detail::iterate_over_array_vector_helper(p,
                 extract_integer_value_strict(
                     std::move(value), name_, codename_),
-                std::move(ctx), name_, codename_);
+                policy, std::move(ctx), name_, codename_);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
             return detail::iterate_over_array_vector_helper(p,
-                extract_numeric_value_strict(
+                extract_numeric_value(
                     std::move(value), name_, codename_),
-                std::move(ctx), name_, codename_);
+                policy, std::move(ctx), name_, codename_);
 
         default:
             break;
@@ -127,11 +149,25 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         template <typename T>
         void iterate_over_array_matrix_helper(primitive const* p,
-            ir::node_data<T>&& value, eval_context ctx, std::string const& name,
+            ir::node_data<T>&& value, chunking_policy const& policy,
+            eval_context ctx, std::string const& name,
             std::string const& codename)
         {
             auto m = value.matrix();
 
+            if (policy.kind_ != chunking_policy::sequential)
+            {
+                using vector_type = typename ir::node_data<T>::storage1d_type;
+                chunked_for_loop(policy, m.rows(),
+                    [&](std::size_t i)
+                    {
+                        vector_type row{blaze::trans(blaze::row(m, i))};
+                        p->eval(hpx::launch::sync,
+                            primitive_argument_type{std::move(row)}, ctx);
+                    });
+                return;
+            }
+
             using phylanx::util::matrix_row_iterator;
             matrix_row_iterator<decltype(m)> begin(m, 0);
             matrix_row_iterator<decltype(m)> end(m, m.rows());
@@ -157,7 +193,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
     }    // namespace detail
 
     void for_each::iterate_over_array_matrix(primitive const* p,
-        primitive_argument_type&& value, eval_context ctx) const
+        primitive_argument_type&& value, chunking_policy const& policy,
+        eval_context ctx) const
     {
         switch (extract_common_type(value))
         {
@@ -165,21 +202,23 @@ namespace phylanx { namespace execution_tree { namespace primitives {
             return detail::iterate_over_array_matrix_helper(p,
                 extract_boolean_value_strict(
                     std::move(value), name_, codename_),
-                std::move(ctx), name_, codename_);
+                policy, std::move(ctx), name_, codename_);
 
         case node_data_type_int64:
             return detail::iterate_over_array_matrix_helper(p,
                 extract_integer_value_strict(
                     std::move(value), name_, codename_),
-                std::move(ctx), name_, codename_);
+                policy, std::move(ctx), name_, codename_);
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
             return detail::iterate_over_array_matrix_helper(p,
-                extract_numeric_value_strict(
+                extract_numeric_value(
                     std::move(value), name_, codename_),
-                std::move(ctx), name_, codename_);
+                policy, std::move(ctx), name_, codename_);
 
         default:
             break;
@@ -193,7 +232,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
     ///////////////////////////////////////////////////////////////////////////
     void for_each::iterate_over_array(primitive const* p,
-        primitive_argument_type&& value, eval_context ctx) const
+        primitive_argument_type&& value, chunking_policy const& policy,
+        eval_context ctx) const
     {
         std::size_t dim =
             extract_numeric_value_dimension(value, name_, codename_);
@@ -205,11 +245,13 @@ namespace phylanx { namespace execution_tree { namespace primitives {
             return;
 
         case 1:
-            iterate_over_array_vector(p, std::move(value), std::move(ctx));
+            iterate_over_array_vector(
+                p, std::move(value), policy, std::move(ctx));
             return;
 
         case 2:
-            iterate_over_array_matrix(p, std::move(value), std::move(ctx));
+            iterate_over_array_matrix(
+                p, std::move(value), policy, std::move(ctx));
             return;
 
         default:
@@ -225,15 +267,16 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
     {
-        if (operands.size() != 2)
+        if (operands.size() != 2 && operands.size() != 3)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "for_each::eval",
                 generate_error_message("the for_each primitive requires "
-                                       "exactly two operands",
+                                       "two or three operands",
                     ctx));
         }
 
-        if (!valid(operands[0]) || !valid(operands[1]))
+        if (!valid(operands[0]) || !valid(operands[1]) ||
+            (operands.size() == 3 && !valid(operands[2])))
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "for_each::eval",
                 generate_error_message(
@@ -252,16 +295,27 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                     ctx));
         }
 
+        // the optional second argument is a string literal describing the
+        // chunking policy, all items are evaluated sequentially otherwise
+        chunking_policy policy;
+        if (operands.size() == 3)
+        {
+            policy = parse_chunking_policy(
+                extract_string_value_strict(operands[1], name_, codename_),
+                name_, codename_);
+        }
+
         ctx.remove_mode(eval_dont_wrap_functions);
 
         auto op0 = value_operand(operands_[0], args, name_, codename_,
             add_mode(ctx, eval_dont_evaluate_lambdas));
-        auto op1 = value_operand(operands_[1], args, name_, codename_, ctx);
+        auto op1 = value_operand(
+            operands_[operands.size() - 1], args, name_, codename_, ctx);
 
         auto this_ = this->shared_from_this();
         return hpx::dataflow(
             hpx::launch::sync,
-            [this_ = std::move(this_), ctx = std::move(ctx)](
+            [this_ = std::move(this_), policy, ctx = std::move(ctx)](
                 hpx::future<primitive_argument_type>&& f,
                 hpx::future<primitive_argument_type>&& fval) mutable
             -> primitive_argument_type {
@@ -281,7 +335,27 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 // range
                 auto&& value = fval.get();
 
-                if (is_list_operand_strict(value))
+                if (is_list_operand_strict(value) &&
+                    policy.kind_ != chunking_policy::sequential)
+                {
+                    auto&& list = extract_list_value_strict(
+                        std::move(value), this_->name_, this_->codename_);
+
+                    primitive_arguments_type elements;
+                    elements.reserve(list.size());
+                    for (auto&& e : std::move(list))
+                    {
+                        elements.emplace_back(std::move(e));
+                    }
+
+                    chunked_for_loop(policy, elements.size(),
+                        [&](std::size_t i)
+                        {
+                            p->eval(hpx::launch::sync, std::move(elements[i]),
+                                ctx);
+                        });
+                }
+                else if (is_list_operand_strict(value))
                 {
                     auto&& list = extract_list_value_strict(
                         std::move(value), this_->name_, this_->codename_);
@@ -323,7 +397,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                     is_integer_operand_strict(value))
                 {
                     this_->iterate_over_array(
-                        p, std::move(value), std::move(ctx));
+                        p, std::move(value), policy, std::move(ctx));
                 }
                 else
                 {
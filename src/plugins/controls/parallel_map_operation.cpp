@@ -4,6 +4,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/plugins/controls/chunking_policy.hpp>
 #include <phylanx/plugins/controls/parallel_map_operation.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -28,10 +29,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::vector<std::string>{"parallel_map(_1, __2)"},
             &create_parallel_map_operation,
             &create_primitive<parallel_map_operation>,
-            R"(func, listv
+            R"(func, chunking, listv
             Args:
 
                 func (function) : A function that takes a single argument
+                chunking (optional, string) : A string literal describing how
+                    the elements are grouped into tasks: 'auto' (the default,
+                    the chunk size is derived from the measured time it takes
+                    to evaluate an element), 'static[:N]' (N elements per
+                    task), 'dynamic[:N]' (idle cores pick up the next N
+                    elements), or 'sequential'. The default can be changed
+                    using the configuration setting phylanx.chunking_policy.
                 listv (iterator) : A sequence of values to apply the function to
 
             Returns:
@@ -55,14 +63,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {}
 
     hpx::future<primitive_argument_type> parallel_map_operation::map_1(
-        primitive_arguments_type const& operands,
-        primitive_arguments_type const& args, eval_context ctx) const
+        primitive_argument_type const& list_operand,
+        primitive_arguments_type const& args, chunking_policy const& policy,
+        eval_context ctx) const
     {
         auto this_ = this->shared_from_this();
         return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
-            [this_ = std::move(this_), ctx](
+            [this_ = std::move(this_), policy, ctx](
                     primitive_argument_type&& bound_func, ir::range&& list)
-            ->  hpx::future<primitive_argument_type>
+            ->  primitive_argument_type
             {
                 primitive const* p = util::get_if<primitive>(&bound_func);
                 if (p == nullptr)
@@ -74,50 +83,40 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 "object"));
                 }
 
-                // Concurrently evaluate all operations
-                std::vector<hpx::future<primitive_argument_type>,
-                    arguments_allocator<hpx::future<primitive_argument_type>>>
-                    result;
-                result.reserve(list.size());
-
+                primitive_arguments_type elements;
+                elements.reserve(list.size());
                 for (auto && elem : list)
                 {
-                    // Evaluate function for each of the argument sets
-                    primitive_arguments_type args;
-                    args.emplace_back(std::move(elem));
-                    result.push_back(p->eval(std::move(args), ctx));
+                    elements.emplace_back(std::move(elem));
                 }
 
-                return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
-                    [](primitive_arguments_type&& result)
-                    -> primitive_argument_type
+                // Concurrently evaluate all operations, each task evaluates
+                // a contiguous chunk of elements
+                primitive_arguments_type result(elements.size());
+                chunked_for_loop(policy, elements.size(),
+                    [&](std::size_t i)
                     {
-                        return primitive_argument_type{std::move(result)};
-                    }),
-                    std::move(result));
+                        result[i] = p->eval(
+                            hpx::launch::sync, std::move(elements[i]), ctx);
+                    });
+
+                return primitive_argument_type{std::move(result)};
             }),
             value_operand(operands_[0], args, name_, codename_,
                 add_mode(ctx, eval_dont_evaluate_lambdas)),
-            list_operand_strict(operands[1], args, name_, codename_, ctx));
+            list_operand_strict(list_operand, args, name_, codename_, ctx));
     }
 
     hpx::future<primitive_argument_type> parallel_map_operation::map_n(
-        primitive_arguments_type const& operands,
-        primitive_arguments_type const& args, eval_context ctx) const
+        primitive_arguments_type&& lists, primitive_arguments_type const& args,
+        chunking_policy const& policy, eval_context ctx) const
     {
-        // all remaining operands have to be lists
-        primitive_arguments_type lists;
-        lists.reserve(operands.size() - 1);
-
-        std::copy(operands.begin() + 1, operands.end(),
-            std::back_inserter(lists));
-
         auto this_ = this->shared_from_this();
         return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
-            [this_ = std::move(this_), ctx](
+            [this_ = std::move(this_), policy, ctx](
                 primitive_argument_type&& bound_func,
                 std::vector<ir::range, arguments_allocator<ir::range>>&& lists)
-            ->  hpx::future<primitive_argument_type>
+            ->  primitive_argument_type
             {
                 primitive const* p = util::get_if<primitive>(&bound_func);
                 if (p == nullptr)
@@ -142,7 +141,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     }
                 }
 
-                // Concurrently evaluate all operations
                 std::size_t numlists = lists.size();
 
                 std::vector<ir::range_iterator,
@@ -154,33 +152,28 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     iters.push_back(j.begin());
                 }
 
-                std::vector<hpx::future<primitive_argument_type>,
-                    arguments_allocator<hpx::future<primitive_argument_type>>>
-                    result;
-                result.reserve(size);
-
+                // Each invocation has its own argument set
+                std::vector<primitive_arguments_type> elements(size);
                 for (std::size_t i = 0; i != size; ++i)
                 {
-                    primitive_arguments_type args;
-                    args.reserve(numlists);
-
-                    // Each invocation has its own argument set
+                    elements[i].reserve(numlists);
                     for (ir::range_iterator& j : iters)
                     {
-                        args.push_back(*j++);
+                        elements[i].push_back(*j++);
                     }
-
-                    // Evaluate function for each of the argument sets
-                    result.push_back(p->eval(std::move(args), ctx));
                 }
 
-                return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
-                    [](primitive_arguments_type&& result)
-                    -> primitive_argument_type
+                // Concurrently evaluate all operations, each task evaluates
+                // a contiguous chunk of argument sets
+                primitive_arguments_type result(size);
+                chunked_for_loop(policy, size,
+                    [&](std::size_t i)
                     {
-                        return primitive_argument_type{std::move(result)};
-                    }),
-                    std::move(result));
+                        result[i] = p->eval(
+                            hpx::launch::sync, std::move(elements[i]), ctx);
+                    });
+
+                return primitive_argument_type{std::move(result)};
             }),
             value_operand(operands_[0], args, name_, codename_,
                 add_mode(ctx,
@@ -231,12 +224,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the first argument to map must be an invocable object"));
         }
 
+        // the optional second argument is a string literal describing the
+        // chunking policy
+        std::size_t first_list = 1;
+        chunking_policy policy;
+        if (operands.size() > 2 && is_string_operand_strict(operands[1]))
+        {
+            policy = parse_chunking_policy(
+                extract_string_value_strict(operands[1], name_, codename_),
+                name_, codename_);
+            first_list = 2;
+        }
+        else
+        {
+            policy = default_chunking_policy(name_, codename_);
+        }
+
         // handle common case separately
-        if (operands.size() == 2)
+        if (operands.size() == first_list + 1)
         {
-            return map_1(operands, args, std::move(ctx));
+            return map_1(operands[first_list], args, policy, std::move(ctx));
         }
 
-        return map_n(operands, args, std::move(ctx));
+        // all remaining operands have to be lists
+        primitive_arguments_type lists;
+        lists.reserve(operands.size() - first_list);
+
+        std::copy(operands.begin() + first_list, operands.end(),
+            std::back_inserter(lists));
+
+        return map_n(std::move(lists), args, policy, std::move(ctx));
     }
 }}}
@@ -295,6 +295,11 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(locs));
 
+        case node_data_type_float:
+            return all_gather2d(
+                extract_float_value_strict(std::move(arr), name_, codename_),
+                std::move(locs));
+
         case node_data_type_unknown:
             return all_gather2d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -100,6 +100,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 extract_integer_value(std::move(rhs), name_, codename_),
                 std::move(lhs_localities), rhs_localities);
 
+        case node_data_type_float:
+            return dot2d2d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), rhs_localities);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
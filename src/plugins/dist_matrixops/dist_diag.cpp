@@ -390,6 +390,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 k, tiling_type, tile_idx, numtiles, std::move(arr_localities),
                 std::move(ctx));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return dist_diag1d(
                 extract_numeric_value(std::move(arr), name_, codename_), k,
@@ -87,6 +87,11 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return dot0d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot0d(
@@ -118,8 +123,9 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
 
         execution_tree::localities_information lhs_localities =
             extract_localities_information(lhs, name_, codename_);
-        execution_tree::localities_information rhs_localities =
-            extract_localities_information(rhs, name_, codename_);
+        auto rhs_tiles = get_localities_information(rhs, name_, codename_);
+        execution_tree::localities_information const& rhs_localities =
+            *rhs_tiles;
 
         switch (extract_common_type(lhs, rhs))
         {
@@ -135,6 +141,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value(std::move(rhs), name_, codename_),
                 std::move(lhs_localities), rhs_localities);
 
+        case node_data_type_float:
+            return dot1d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), rhs_localities);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot1d(
@@ -167,8 +179,9 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
 
         execution_tree::localities_information lhs_localities =
             extract_localities_information(lhs, name_, codename_);
-        execution_tree::localities_information rhs_localities =
-            extract_localities_information(rhs, name_, codename_);
+        auto rhs_tiles = get_localities_information(rhs, name_, codename_);
+        execution_tree::localities_information const& rhs_localities =
+            *rhs_tiles;
 
         switch (extract_common_type(lhs, rhs))
         {
@@ -184,6 +197,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value(std::move(rhs), name_, codename_),
                 std::move(lhs_localities), rhs_localities);
 
+        case node_data_type_float:
+            return dot2d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), rhs_localities);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot2d(
@@ -214,10 +233,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(lhs), std::move(rhs), name_, codename_);
         }
 
-        execution_tree::localities_information lhs_localities =
-            extract_localities_information(lhs, name_, codename_);
-        execution_tree::localities_information rhs_localities =
-            extract_localities_information(rhs, name_, codename_);
+        auto lhs_tiles = get_localities_information(lhs, name_, codename_);
+        execution_tree::localities_information const& lhs_localities =
+            *lhs_tiles;
+        auto rhs_tiles = get_localities_information(rhs, name_, codename_);
+        execution_tree::localities_information const& rhs_localities =
+            *rhs_tiles;
 
         switch (extract_common_type(lhs, rhs))
         {
@@ -233,6 +254,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value(std::move(rhs), name_, codename_),
                 lhs_localities, rhs_localities);
 
+        case node_data_type_float:
+            return dot3d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_),
+                lhs_localities, rhs_localities);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot3d(
@@ -180,6 +180,8 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             return dist_identity_helper<std::int64_t>(sz, tile_idx, numtiles,
                 std::move(given_name), tiling_type, std::move(ctx));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
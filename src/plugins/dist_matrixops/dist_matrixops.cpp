@@ -31,6 +31,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(dist_inverse_operation_plugin,
     phylanx::dist_matrixops::primitives::dist_inverse::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_random_plugin,
     phylanx::dist_matrixops::primitives::dist_random::match_data)
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_sort_plugin,
+    phylanx::dist_matrixops::primitives::dist_sort::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_transpose_operation_plugin,
     phylanx::dist_matrixops::primitives::dist_transpose_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(retile_annotations_plugin,
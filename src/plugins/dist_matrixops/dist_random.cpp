@@ -134,11 +134,18 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
+        // the values are a function of the global index, thus the tiles are
+        // identical to the corresponding parts of the array generated by
+        // 'random'
+        std::uint64_t key = util::next_random_key();
+
         blaze::DynamicVector<double> v(size);
-        for (std::size_t i = 0; i != size; ++i)
-        {
-            v[i] = dist(util::rng_);
-        }
+        util::random_for_loop(dist, key, size,
+            [&](util::random_element_generator<std::normal_distribution<>>& gen,
+                std::size_t i)
+            {
+                v[i] = gen(start + i);
+            });
 
         return primitive_argument_type(std::move(v), attached_annotation);
     }
@@ -181,14 +188,22 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 locality_ann, tile_info.as_annotation(name_, codename_),
                 ann_info, name_, codename_));
 
+        // the values are a function of the global index, thus the tiles are
+        // identical to the corresponding parts of the array generated by
+        // 'random'
+        std::uint64_t key = util::next_random_key();
+
         blaze::DynamicMatrix<double> m(row_size, column_size);
-        for (std::size_t i = 0; i != row_size; ++i)
-        {
-            for (std::size_t j = 0; j != column_size; ++j)
+        util::random_for_loop(dist, key, row_size,
+            [&](util::random_element_generator<std::normal_distribution<>>& gen,
+                std::size_t i)
             {
-                m(i, j) = dist(util::rng_);
-            }
-        }
+                std::size_t index = (row_start + i) * columns + column_start;
+                for (std::size_t j = 0; j != column_size; ++j)
+                {
+                    m(i, j) = gen(index + j);
+                }
+            });
 
         return primitive_argument_type(std::move(m), attached_annotation);
     }
@@ -233,17 +248,26 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 locality_ann, tile_info.as_annotation(name_, codename_),
                 ann_info, name_, codename_));
 
+        // the values are a function of the global index, thus the tiles are
+        // identical to the corresponding parts of the array generated by
+        // 'random'
+        std::uint64_t key = util::next_random_key();
+
         blaze::DynamicTensor<double> t(page_size, row_size, column_size);
-        for (std::size_t k = 0; k != page_size; ++k)
-        {
-            for (std::size_t i = 0; i != row_size; ++i)
+        util::random_for_loop(dist, key, page_size * row_size,
+            [&](util::random_element_generator<std::normal_distribution<>>& gen,
+                std::size_t n)
             {
+                std::size_t k = n / row_size;
+                std::size_t i = n % row_size;
+                std::size_t index =
+                    ((page_start + k) * rows + row_start + i) * columns +
+                    column_start;
                 for (std::size_t j = 0; j != column_size; ++j)
                 {
-                    t(k, i, j) = dist(util::rng_);
+                    t(k, i, j) = gen(index + j);
                 }
-            }
-        }
+            });
 
         return primitive_argument_type(std::move(t), attached_annotation);
     }
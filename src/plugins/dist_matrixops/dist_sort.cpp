@@ -0,0 +1,342 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/sort_kernels.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_sort.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::match_pattern_type const dist_sort::match_data =
+    {
+        hpx::make_tuple("sort_d",
+            std::vector<std::string>{"sort_d(_1)"},
+            &create_dist_sort,
+            &execution_tree::create_primitive<dist_sort>, R"(
+            a
+            Args:
+
+                a (array_like) : a vector tiled over several localities
+
+            Returns:
+
+            The sorted vector, tiled over the same localities. The sizes of
+            the tiles depend on the distribution of the values.)")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_sort::dist_sort(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Select the values separating the parts of the result that are
+        // sent to the localities from regular samples of the sorted local
+        // parts of all localities
+        template <typename T>
+        std::vector<T> sort_splitters(blaze::DynamicVector<T> const& local,
+            std::uint32_t num_localities, std::uint32_t locality_id,
+            std::string const& basename)
+        {
+            blaze::DynamicVector<T> samples(
+                local.empty() ? 0 : num_localities);
+            for (std::size_t i = 0; i != samples.size(); ++i)
+            {
+                samples[i] = local[i * local.size() / num_localities];
+            }
+
+            std::vector<blaze::DynamicVector<T>> all_samples =
+                hpx::all_gather(basename.c_str(), std::move(samples),
+                    num_localities, std::size_t(-1), locality_id)
+                    .get();
+
+            std::vector<T> gathered;
+            for (auto const& s : all_samples)
+            {
+                gathered.insert(gathered.end(), s.begin(), s.end());
+            }
+            std::sort(gathered.begin(), gathered.end());
+
+            std::vector<T> splitters;
+            if (!gathered.empty())
+            {
+                splitters.reserve(num_localities - 1);
+                for (std::size_t i = 1; i != num_localities; ++i)
+                {
+                    splitters.push_back(
+                        gathered[i * gathered.size() / num_localities]);
+                }
+            }
+            return splitters;
+        }
+
+        // Merge the sorted runs of data given by the boundaries (pairwise,
+        // the runs of each round are merged concurrently)
+        template <typename T>
+        void merge_sorted_runs(
+            blaze::DynamicVector<T>& data, std::vector<std::size_t> bounds)
+        {
+            T* p = data.data();
+            while (bounds.size() > 2)
+            {
+                std::size_t pairs = (bounds.size() - 1) / 2;
+                common::sort_for_loop(pairs, data.size(), [&](std::size_t i) {
+                    std::inplace_merge(p + bounds[2 * i],
+                        p + bounds[2 * i + 1], p + bounds[2 * i + 2]);
+                });
+
+                std::vector<std::size_t> next;
+                next.reserve(pairs + 2);
+                for (std::size_t i = 0; i < bounds.size(); i += 2)
+                {
+                    next.push_back(bounds[i]);
+                }
+                if (next.back() != bounds.back())
+                {
+                    next.push_back(bounds.back());
+                }
+                bounds = std::move(next);
+            }
+        }
+
+        template <typename T>
+        blaze::DynamicVector<T> sample_sort(blaze::DynamicVector<T>&& local,
+            std::uint32_t num_localities, std::uint32_t locality_id,
+            std::string const& basename)
+        {
+            common::sort_values(local.data(), local.data() + local.size());
+            if (num_localities == 1)
+            {
+                return std::move(local);
+            }
+
+            std::vector<T> splitters = sort_splitters(
+                local, num_localities, locality_id, basename + "_samples");
+
+            // locality j receives the values in (splitters[j-1], splitters[j]]
+            std::vector<blaze::DynamicVector<T>> blocks;
+            blocks.reserve(num_localities);
+
+            T const* begin = local.data();
+            T const* end = local.data() + local.size();
+            for (std::size_t j = 0; j != num_localities; ++j)
+            {
+                T const* last = (j < splitters.size()) ?
+                    std::upper_bound(begin, end, splitters[j]) :
+                    end;
+
+                blaze::DynamicVector<T> block(last - begin);
+                std::copy(begin, last, block.data());
+                blocks.push_back(std::move(block));
+
+                begin = last;
+            }
+
+            std::vector<blaze::DynamicVector<T>> parts =
+                hpx::all_to_all((basename + "_exchange").c_str(),
+                    std::move(blocks), num_localities, std::size_t(-1),
+                    locality_id)
+                    .get();
+
+            std::size_t size = 0;
+            for (auto const& part : parts)
+            {
+                size += part.size();
+            }
+
+            blaze::DynamicVector<T> result(size);
+            std::vector<std::size_t> bounds(1, 0);
+            for (auto const& part : parts)
+            {
+                std::copy(part.begin(), part.end(),
+                    result.data() + bounds.back());
+                bounds.push_back(bounds.back() + part.size());
+            }
+
+            merge_sorted_runs(result, std::move(bounds));
+            return result;
+        }
+
+        // global index of the first element of the local part of the result
+        inline std::size_t sorted_tile_start(std::size_t size,
+            std::uint32_t num_localities, std::uint32_t locality_id,
+            std::string const& basename)
+        {
+            std::vector<std::size_t> sizes =
+                hpx::all_gather(basename.c_str(), size, num_localities,
+                    std::size_t(-1), locality_id)
+                    .get();
+
+            std::size_t start = 0;
+            for (std::uint32_t i = 0; i != locality_id; ++i)
+            {
+                start += sizes[i];
+            }
+            return start;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    execution_tree::primitive_argument_type dist_sort::sort1d(
+        ir::node_data<T>&& arg,
+        execution_tree::localities_information* plocs) const
+    {
+        using namespace execution_tree;
+
+        // non-distributed vectors are sorted locally
+        if (plocs == nullptr)
+        {
+            return primitive_argument_type{
+                detail::sample_sort(std::move(arg).vector_copy(), 1, 0, "")};
+        }
+
+        localities_information& locs = *plocs;
+        std::uint32_t const num_localities = locs.locality_.num_localities_;
+        std::uint32_t const locality_id = locs.locality_.locality_id_;
+
+        std::string basename = "sort_d_" + locs.annotation_.name_;
+
+        blaze::DynamicVector<T> result = detail::sample_sort(
+            std::move(arg).vector_copy(), num_localities, locality_id,
+            basename);
+
+        std::size_t start = detail::sorted_tile_start(
+            result.size(), num_localities, locality_id, basename + "_sizes");
+
+        // the result is a new distributed vector, its tiles have changed
+        tiling_information_1d tile_info(
+            locs.tiles_[locality_id], name_, codename_);
+        tile_info.span_ = tiling_span(start, start + result.size());
+
+        ++locs.annotation_.generation_;
+        auto locality_ann = locs.locality_.as_annotation();
+        auto attached_annotation =
+            std::make_shared<annotation>(localities_annotation(locality_ann,
+                tile_info.as_annotation(name_, codename_), locs.annotation_,
+                name_, codename_));
+
+        return primitive_argument_type(std::move(result), attached_annotation);
+    }
+
+    execution_tree::primitive_argument_type dist_sort::sort1d(
+        execution_tree::primitive_argument_type&& arg) const
+    {
+        using namespace execution_tree;
+
+        if (extract_numeric_value_dimension(arg, name_, codename_) != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::sort1d",
+                generate_error_message(
+                    "the sort_d primitive requires for its argument to be "
+                    "a (tiled) vector"));
+        }
+
+        localities_information locs;
+        localities_information* plocs = nullptr;
+        if (arg.has_annotation())
+        {
+            locs = extract_localities_information(arg, name_, codename_);
+            plocs = &locs;
+        }
+
+        switch (extract_common_type(arg))
+        {
+        case node_data_type_bool:
+            return sort1d(
+                extract_boolean_value_strict(std::move(arg), name_, codename_),
+                plocs);
+
+        case node_data_type_int64:
+            return sort1d(
+                extract_integer_value_strict(std::move(arg), name_, codename_),
+                plocs);
+
+        case node_data_type_double:
+            return sort1d(
+                extract_numeric_value_strict(std::move(arg), name_, codename_),
+                plocs);
+
+        case node_data_type_float: HPX_FALLTHROUGH;
+        case node_data_type_unknown:
+            return sort1d(
+                extract_numeric_value(std::move(arg), name_, codename_), plocs);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_sort::sort1d",
+            generate_error_message(
+                "the sort_d primitive requires for all arguments to be "
+                "numeric data types"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type> dist_sort::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        if (operands.size() != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::eval",
+                generate_error_message(
+                    "the sort_d primitive requires exactly one operand"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::eval",
+                generate_error_message(
+                    "the sort_d primitive requires that the arguments given "
+                    "by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_)](
+                    execution_tree::primitive_arguments_type&& args)
+            -> execution_tree::primitive_argument_type
+            {
+                return this_->sort1d(std::move(args[0]));
+            }),
+            execution_tree::primitives::detail::map_operands(operands,
+                execution_tree::functional::value_operand{}, args, name_,
+                codename_, std::move(ctx)));
+    }
+}}}
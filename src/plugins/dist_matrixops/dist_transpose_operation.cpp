@@ -232,6 +232,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
@@ -294,6 +295,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
@@ -383,6 +385,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
@@ -476,6 +479,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(axes), std::move(localities_info));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
@@ -510,6 +510,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return retile1d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -718,6 +719,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return retile2d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -961,6 +963,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return retile3d(
                 extract_numeric_value(std::move(arr), name_, codename_),
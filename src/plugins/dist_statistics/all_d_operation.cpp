@@ -0,0 +1,48 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics_base_impl.hpp>
+#include <phylanx/plugins/dist_statistics/all_d_operation.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const all_d_operation::match_data = {
+        match_pattern_type{"all_d",
+            std::vector<std::string>{
+                "all_d(_1, __arg(_2_axis, nil), __arg(_3_keepdims, nil), "
+                    "__arg(_4_dummy0, nil), __arg(_5_dummy1, nil))"},
+            &create_all_d_operation, &create_primitive<all_d_operation>, R"(
+            a, axis, keepdims, dummy0, dummy1
+            Args:
+
+                a (array_like) : a scalar, vector, matrix, or tensor, usually
+                   tiled over several localities
+                axis (optional, integer): an axis to reduce along. By default,
+                   the flattened input is used.
+                keepdims (optional, bool): If this is set to True, the axes
+                   which are reduced are left in the result as dimensions with
+                   size one. False by default
+
+            Returns:
+
+            True if all values in the array are nonzero, False otherwise.
+            The result is tiled over the localities if the reduced axis is
+            not tiled, otherwise it is available on all localities.)"}};
+
+    ///////////////////////////////////////////////////////////////////////////
+    all_d_operation::all_d_operation(primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : base_type(std::move(operands), name, codename)
+    {
+    }
+}}}    // namespace phylanx::execution_tree::primitives
@@ -0,0 +1,52 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics_base_impl.hpp>
+#include <phylanx/plugins/dist_statistics/min_d_operation.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const min_d_operation::match_data = {
+        match_pattern_type{"amin_d",
+            std::vector<std::string>{
+                "amin_d(_1, __arg(_2_axis, nil), __arg(_3_keepdims, nil), "
+                    "__arg(_4_initial, nil), __arg(_5_dtype, nil))"},
+            &create_amin_d_operation, &create_primitive<min_d_operation>, R"(
+            a, axis, keepdims, initial, dtype
+            Args:
+
+                a (array_like) : a scalar, vector, matrix, or tensor, usually
+                   tiled over several localities
+                axis (optional, integer): an axis to reduce along. By default,
+                   the flattened input is used.
+                keepdims (optional, bool): If this is set to True, the axes
+                   which are reduced are left in the result as dimensions with
+                   size one. False by default
+                initial (optional, scalar): The maximum value of an output
+                   element.
+                dtype (optional, string) : the data-type of the returned array,
+                  defaults to dtype of input array.
+
+            Returns:
+
+            Returns the minimum of an array or minimum along an axis.
+            The result is tiled over the localities if the reduced axis is
+            not tiled, otherwise it is available on all localities.)"}};
+
+    ///////////////////////////////////////////////////////////////////////////
+    min_d_operation::min_d_operation(primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : base_type(std::move(operands), name, codename)
+    {
+    }
+}}}    // namespace phylanx::execution_tree::primitives
@@ -22,7 +22,9 @@
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
+#include <hpx/collectives/all_gather.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -30,8 +32,10 @@
 #include <fstream>
 #include <iomanip>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -109,6 +113,105 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             return std::move(given_name);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The line structure of a csv file read by all localities. The file
+        // is split into equally sized byte ranges, one for each locality.
+        // Each locality counts the lines starting in its own range only, the
+        // counts are exchanged between the localities. This allows for each
+        // locality to load the lines of its tile without reading the whole
+        // file.
+        class csv_file_lines
+        {
+        public:
+            csv_file_lines(std::ifstream& infile, std::string const& filename,
+                std::string const& basename)
+            {
+                std::tie(header_, n_cols_) =
+                    csv_file::read_header(infile, filename);
+
+                infile.seekg(0, std::ios::end);
+                size_ = static_cast<std::size_t>(infile.tellg());
+
+                std::uint32_t const num_localities =
+                    hpx::get_num_localities(hpx::launch::sync);
+                std::uint32_t const locality_id = hpx::get_locality_id();
+
+                ranges_.resize(num_localities + 1);
+                for (std::size_t i = 0; i != ranges_.size(); ++i)
+                {
+                    ranges_[i] = size_ * i / num_localities;
+                }
+
+                std::size_t count = csv_file::count_lines(infile,
+                    ranges_[locality_id], ranges_[locality_id + 1]);
+
+                std::vector<std::size_t> counts{count};
+                if (num_localities != 1)
+                {
+                    counts = hpx::all_gather(basename.c_str(), count,
+                        num_localities, std::size_t(-1), locality_id)
+                        .get();
+                }
+
+                // first_lines_[i] is the index of the first line starting in
+                // the byte range i
+                first_lines_.resize(num_localities + 1, 0);
+                std::partial_sum(
+                    counts.begin(), counts.end(), first_lines_.begin() + 1);
+            }
+
+            std::size_t rows() const
+            {
+                return first_lines_.back() - header_;
+            }
+
+            std::size_t columns() const
+            {
+                return n_cols_;
+            }
+
+            // Load the data rows [row_start, row_start + row_size) of the
+            // file, the loaded rows are numbered starting with zero
+            csv_file load_rows(std::ifstream& infile,
+                std::string const& filename, std::size_t row_start,
+                std::size_t row_size) const
+            {
+                if (row_size == 0)
+                {
+                    return csv_file(infile, filename, 0, 0, 0, n_cols_);
+                }
+
+                std::size_t first_line = header_ + row_start;
+                std::size_t last_line = first_line + row_size - 1;
+
+                // the byte ranges the first and the last line start in
+                std::size_t first_range = range_of(first_line);
+                std::size_t last_range = range_of(last_line);
+
+                std::size_t begin =
+                    csv_file::next_line(infile, ranges_[first_range], size_);
+                std::size_t end = csv_file::next_line(
+                    infile, ranges_[last_range + 1], size_);
+
+                return csv_file(infile, filename, begin, end,
+                    first_line - first_lines_[first_range], n_cols_);
+            }
+
+        private:
+            std::size_t range_of(std::size_t line) const
+            {
+                return std::size_t(std::upper_bound(first_lines_.begin(),
+                                       first_lines_.end(), line) -
+                    first_lines_.begin() - 1);
+            }
+
+            std::size_t header_ = 0;
+            std::size_t n_cols_ = 0;
+            std::size_t size_ = 0;
+            std::vector<std::size_t> ranges_;
+            std::vector<std::size_t> first_lines_;
+        };
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -118,10 +221,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
         std::string&& given_name, std::uint32_t numtiles) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        std::string base_name =
+            detail::generate_csv_name(std::move(given_name));
+
+        detail::csv_file_lines lines(
+            infile, filename, "file_read_csv_d_" + base_name);
+
+        std::size_t n_rows = lines.rows();
+        std::size_t n_cols = lines.columns();
 
         std::int64_t row_start, column_start;
         std::size_t row_size, column_size;
@@ -153,9 +260,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
         locality_information locality_info(tile_idx, numtiles);
         annotation locality_ann = locality_info.as_annotation();
 
-        std::string base_name =
-            detail::generate_csv_name(std::move(given_name));
-
         annotation_information ann_info(
             std::move(base_name), 0);    //generation 0
 
@@ -164,10 +268,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
-        blaze::DynamicMatrix<double> whole_data(n_rows, n_cols, data.data());
-        blaze::DynamicMatrix<double> result =
-            blaze::submatrix(std::move(whole_data), row_start, column_start,
-                row_size, column_size);
+        // load and parse the rows of the local tile only
+        csv_file file = lines.load_rows(
+            infile, filename, std::size_t(row_start), row_size);
+
+        blaze::DynamicMatrix<double> result(row_size, column_size);
+        file.parse_rows(0, row_size, column_start, column_size,
+            [&](std::size_t row) { return result.data(row); });
 
         return primitive_argument_type(result, attached_annotation);
     }
@@ -179,10 +286,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
         std::string&& given_name, std::uint32_t numtiles) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        std::string base_name =
+            detail::generate_csv_name(std::move(given_name));
+
+        detail::csv_file_lines lines(
+            infile, filename, "file_read_csv_d_" + base_name);
+
+        std::size_t n_rows = lines.rows();
+        std::size_t n_cols = lines.columns();
         std::size_t n_pages = static_cast<std::size_t>(n_rows / given_nrows);
 
         if (n_rows % given_nrows != 0)
@@ -230,9 +341,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
         locality_information locality_info(tile_idx, numtiles);
         annotation locality_ann = locality_info.as_annotation();
 
-        std::string base_name =
-            detail::generate_csv_name(std::move(given_name));
-
         annotation_information ann_info(
             std::move(base_name), 0);    //generation 0
 
@@ -241,11 +349,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
-        blaze::DynamicTensor<double> whole_data(
-            n_pages, given_nrows, n_cols, data.data());
-        blaze::DynamicTensor<double> result =
-            blaze::subtensor(std::move(whole_data), page_start, row_start,
-                column_start, page_size, row_size, column_size);
+        // load the range of rows spanning the local tile only, each page is
+        // a contiguous range of rows in the file
+        std::size_t first_row = page_start * given_nrows + row_start;
+        std::size_t num_rows = 0;
+        if (page_size != 0 && row_size != 0)
+        {
+            num_rows = (page_size - 1) * given_nrows + row_size;
+        }
+        csv_file file = lines.load_rows(infile, filename, first_row, num_rows);
+
+        blaze::DynamicTensor<double> result(page_size, row_size, column_size);
+        for (std::size_t k = 0; k != page_size; ++k)
+        {
+            file.parse_rows(k * given_nrows, row_size, column_start,
+                column_size,
+                [&](std::size_t row) { return result.data(row, k); });
+        }
 
         return primitive_argument_type(result, attached_annotation);
     }
@@ -384,7 +504,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[6]), this_->name_, this_->codename_);
                     }
 
-                    std::ifstream infile(filename.c_str(), std::ios::in);
+                    // the file is accessed using byte offsets
+                    std::ifstream infile(
+                        filename.c_str(), std::ios::in | std::ios::binary);
 
                     if (!infile.is_open())
                     {
@@ -0,0 +1,338 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/tile_calculation_helper.hpp>
+#include <phylanx/plugins/fileio/dist_file_read_hdf5.hpp>
+#include <phylanx/plugins/fileio/file_read_hdf5_impl.hpp>
+#include <phylanx/util/detail/range_dimension.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const dist_file_read_hdf5::match_data =
+    {
+        hpx::make_tuple("file_read_hdf5_d",
+            std::vector<std::string>{R"(
+                file_read_hdf5_d(
+                    _1_filename,
+                    _2_dataset,
+                    __arg(_3_tiling_type, "sym"),
+                    __arg(_4_intersection, nil),
+                    __arg(_5_name, ""),
+                    __arg(_6_numtiles, num_localities())
+                )
+            )"},
+            &create_dist_file_read_hdf5, &create_primitive<dist_file_read_hdf5>,
+            R"(filename, dataset, tiling_type, intersection, name, numtiles
+            Args:
+
+                filename (string) : file name including its path.
+                dataset (string) : the name of the dataset to read, the
+                    dataset can have one, two, or three dimensions.
+                tiling_type (string, optional): defaults to `sym` which is a
+                    balanced way of tiling among all the numtiles localities.
+                    Other options are `page`, `row` or `column` tiling. For a
+                    vector all these tiling_types are the same.
+                intersection (int or a tuple of ints, optional): the size of
+                    overlapped part on each dimension. If an integer is given,
+                    that would be the intersection length on all dimensions
+                    that are tiled. The middle parts get to have two
+                    intersections, one with the tile before it and one with the
+                    tile after it.
+                name (string, optional): the array given name. If not given, a
+                    globally unique name will be generated.
+                numtiles (int, optional): number of tiles of the returned array.
+                    if not given it sets to the number of localities in the
+                    application.
+
+            Returns:
+
+            Returns a distributed array representing the contents of the given
+            dataset. Each locality reads the part of the dataset that
+            corresponds to its tile only.
+            )")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_file_read_hdf5::dist_file_read_hdf5(
+        primitive_arguments_type&& operands, std::string const& name,
+        std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        static std::atomic<std::size_t> hdf5_count(0);
+        std::string generate_hdf5_name(std::string&& given_name)
+        {
+            if (given_name.empty())
+            {
+                return "hdf5_file_" + std::to_string(++hdf5_count);
+            }
+
+            return std::move(given_name);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dist_file_read_hdf5::dist_read(
+        hdf5_dataset const& dataset, std::string const& tiling_type,
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
+        std::string&& given_name, std::uint32_t numtiles) const
+    {
+        std::size_t ndims = dataset.num_dimensions();
+        std::uint32_t tile_idx = hpx::get_locality_id();
+
+        std::array<std::int64_t, PHYLANX_MAX_DIMENSIONS> start{0};
+        hdf5_dataset::dimensions_type size{0};
+
+        switch (ndims)
+        {
+        case 1:
+            std::tie(start[0], size[0]) = tile_calculation::tile_calculation_1d(
+                tile_idx, dataset.dimension(0), numtiles);
+            break;
+
+        case 2:
+            std::tie(start[0], start[1], size[0], size[1]) =
+                tile_calculation::tile_calculation_2d(tile_idx,
+                    dataset.dimension(0), dataset.dimension(1), numtiles,
+                    tiling_type);
+            break;
+
+        case 3:
+            std::tie(start[0], start[1], start[2], size[0], size[1],
+                size[2]) = tile_calculation::tile_calculation_3d(tile_idx,
+                dataset.dimension(0), dataset.dimension(1),
+                dataset.dimension(2), numtiles, tiling_type);
+            break;
+
+        default:
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_file_read_hdf5::dist_read",
+                generate_error_message(
+                    "the file_read_hdf5_d primitive supports datasets with "
+                    "one, two, or three dimensions only"));
+        }
+
+        // adding overlap on all dimensions that are tiled
+        for (std::size_t i = 0; i != ndims; ++i)
+        {
+            if (size[i] != dataset.dimension(i) && intersections[i] != 0)
+            {
+                std::tie(start[i], size[i]) =
+                    tile_calculation::tile_calculation_overlap_1d(start[i],
+                        size[i], dataset.dimension(i), intersections[i]);
+            }
+        }
+
+        annotation tile_ann;
+        switch (ndims)
+        {
+        case 1:
+            tile_ann = tiling_information_1d(
+                tiling_information_1d::tile1d_type::columns,
+                tiling_span(start[0], start[0] + size[0]))
+                           .as_annotation(name_, codename_);
+            break;
+
+        case 2:
+            tile_ann = tiling_information_2d(
+                tiling_span(start[0], start[0] + size[0]),
+                tiling_span(start[1], start[1] + size[1]))
+                           .as_annotation(name_, codename_);
+            break;
+
+        default:
+            tile_ann = tiling_information_3d(
+                tiling_span(start[0], start[0] + size[0]),
+                tiling_span(start[1], start[1] + size[1]),
+                tiling_span(start[2], start[2] + size[2]))
+                           .as_annotation(name_, codename_);
+            break;
+        }
+
+        locality_information locality_info(tile_idx, numtiles);
+        annotation locality_ann = locality_info.as_annotation();
+
+        std::string base_name =
+            detail::generate_hdf5_name(std::move(given_name));
+
+        annotation_information ann_info(
+            std::move(base_name), 0);    //generation 0
+
+        auto attached_annotation =
+            std::make_shared<annotation>(localities_annotation(locality_ann,
+                std::move(tile_ann), ann_info, name_, codename_));
+
+        // read the local tile only
+        hdf5_dataset::dimensions_type tile_start{0};
+        for (std::size_t i = 0; i != ndims; ++i)
+        {
+            tile_start[i] = static_cast<std::size_t>(start[i]);
+        }
+
+        return primitive_argument_type(
+            dataset.read(tile_start, size, hdf5_dataset::dimensions_type{0}),
+            attached_annotation);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> dist_file_read_hdf5::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() < 2 || operands.size() > 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_file_read_hdf5::eval",
+                generate_error_message("the file_read_hdf5_d primitive "
+                                       "requires at least 2 and at most 6 "
+                                       "operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_file_read_hdf5::eval",
+                generate_error_message(
+                    "the file_read_hdf5_d primitive requires that the given "
+                        "operands are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+                [this_ = std::move(this_)](
+                    primitive_arguments_type&& args)
+                    -> primitive_argument_type
+                {
+                    std::string filename = extract_string_value_strict(
+                        std::move(args[0]), this_->name_, this_->codename_);
+                    std::string dataset_name = extract_string_value_strict(
+                        std::move(args[1]), this_->name_, this_->codename_);
+
+                    hdf5_dataset dataset(filename, dataset_name,
+                        this_->name_, this_->codename_);
+                    std::size_t numdims = dataset.num_dimensions();
+
+                    // using balanced symmetric tiles as the default
+                    std::string tiling_type = "sym";
+                    if (args.size() > 2 && valid(args[2]))
+                    {
+                        tiling_type = extract_string_value(
+                            std::move(args[2]), this_->name_, this_->codename_);
+                        if ((tiling_type != "sym" && tiling_type != "page") &&
+                            tiling_type != "row" && tiling_type != "column")
+                        {
+                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                "dist_file_read_hdf5::eval",
+                                this_->generate_error_message(
+                                    "invalid tiling_type. The tiling_type can "
+                                    "be one of these: `sym`, `page`, `row` or "
+                                    "`column`"));
+                        }
+                    }
+
+                    std::array<std::size_t, PHYLANX_MAX_DIMENSIONS>
+                        intersections{0};
+                    if (args.size() > 3 && valid(args[3]))
+                    {
+                        if (is_list_operand_strict(args[3]))
+                        {
+                            ir::range&& intersection_list =
+                                extract_list_value_strict(std::move(args[3]),
+                                    this_->name_, this_->codename_);
+
+                            if (intersection_list.size() != 1 &&
+                                intersection_list.size() != numdims)
+                            {
+                                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                    "dist_file_read_hdf5::eval",
+                                    this_->generate_error_message(
+                                        "intersection should have the same "
+                                        "number of dimensions as the array, or "
+                                        "be represented with an integer for "
+                                        "all dimensions"));
+                            }
+                            intersections =
+                                util::detail::extract_nonneg_range_dimensions(
+                                    intersection_list, this_->name_,
+                                    this_->codename_);
+                        }
+                        else if (is_numeric_operand(args[3]))
+                        {
+                            intersections[0] =
+                                extract_scalar_nonneg_integer_value_strict(
+                                    std::move(args[3]), this_->name_,
+                                    this_->codename_);
+
+                            // we assume all dimensions have the same
+                            // intersection length which is the given one
+                            for (std::size_t i = 1; i < numdims; ++i)
+                            {
+                                intersections[i] = intersections[0];
+                            }
+                        }
+                        else
+                        {
+                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                "dist_file_read_hdf5::eval",
+                                this_->generate_error_message(
+                                    "intersection can be an integer or a list "
+                                    "of integers"));
+                        }
+                    }
+
+                    std::string given_name = "";
+                    if (args.size() > 4 && valid(args[4]))
+                    {
+                        given_name = extract_string_value(std::move(args[4]),
+                            this_->name_, this_->codename_);
+                    }
+
+                    std::uint32_t numtiles =
+                        hpx::get_num_localities(hpx::launch::sync);
+                    if (args.size() > 5 && valid(args[5]))
+                    {
+                        numtiles = extract_scalar_positive_integer_value_strict(
+                            std::move(args[5]), this_->name_, this_->codename_);
+                    }
+
+                    return this_->dist_read(dataset, tiling_type,
+                        intersections, std::move(given_name), numtiles);
+                }),
+            detail::map_operands(operands, functional::value_operand{}, args,
+                name_, codename_, std::move(ctx)));
+    }
+}}}
+
+#endif
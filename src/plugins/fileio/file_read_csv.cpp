@@ -71,29 +71,33 @@ namespace phylanx { namespace execution_tree { namespace primitives
     inline primitive_argument_type file_read_csv::read(
         std::ifstream&& infile, std::string const& filename) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        csv_file file(std::move(infile), filename);
+
+        std::size_t n_rows = file.rows();
+        std::size_t n_cols = file.columns();
 
         if (n_rows == 1)
         {
+            // vector
+            blaze::DynamicVector<double> vector(n_cols);
+            file.parse_rows(0, 1, 0, n_cols,
+                [&](std::size_t) { return vector.data(); });
+
             if (n_cols == 1)
             {
                 // scalar value
                 return primitive_argument_type{
-                    ir::node_data<double>{data[0]}};
+                    ir::node_data<double>{vector[0]}};
             }
 
-            // vector
-            blaze::DynamicVector<double> vector(n_cols, data.data());
-
             return primitive_argument_type{
                 ir::node_data<double>{std::move(vector)}};
         }
 
         // matrix
-        blaze::DynamicMatrix<double> matrix(n_rows, n_cols, data.data());
+        blaze::DynamicMatrix<double> matrix(n_rows, n_cols);
+        file.parse_rows(0, n_rows, 0, n_cols,
+            [&](std::size_t row) { return matrix.data(row); });
 
         return primitive_argument_type{
             ir::node_data<double>{std::move(matrix)}};
@@ -103,10 +107,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::ifstream&& infile, std::string const& filename,
         std::int64_t given_nrows) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        csv_file file(std::move(infile), filename);
+
+        std::size_t n_rows = file.rows();
+        std::size_t n_cols = file.columns();
 
         if (n_rows % given_nrows != 0)
         {
@@ -117,9 +121,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // tensor
-        blaze::DynamicTensor<double> result(
-            static_cast<std::size_t>(n_rows / given_nrows), given_nrows, n_cols,
-            data.data());
+        std::size_t n_pages = static_cast<std::size_t>(n_rows / given_nrows);
+
+        blaze::DynamicTensor<double> result(n_pages, given_nrows, n_cols);
+        file.parse_rows(0, n_rows, 0, n_cols,
+            [&](std::size_t row)
+            {
+                return result.data(row % given_nrows, row / given_nrows);
+            });
 
         return primitive_argument_type{
             ir::node_data<double>{std::move(result)}};
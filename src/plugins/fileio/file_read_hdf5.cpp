@@ -8,19 +8,16 @@
 #if defined(PHYLANX_HAVE_HIGHFIVE)
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/fileio/file_read_hdf5.hpp>
+#include <phylanx/plugins/fileio/file_read_hdf5_impl.hpp>
+#include <phylanx/util/detail/range_dimension.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
 
-#include <phylanx/util/detail/blaze-highfive.hpp>
-#include <highfive/H5DataSet.hpp>
-#include <highfive/H5DataSpace.hpp>
-#include <highfive/H5File.hpp>
-
+#include <array>
 #include <cstddef>
-#include <fstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,17 +29,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
     match_pattern_type const file_read_hdf5::match_data =
     {
         hpx::make_tuple("file_read_hdf5",
-            std::vector<std::string>{"file_read_hdf5(_1, _2)"},
+            std::vector<std::string>{R"(
+                file_read_hdf5(
+                    _1_fname,
+                    _2_dsetname,
+                    __arg(_3_start, nil),
+                    __arg(_4_count, nil),
+                    __arg(_5_stride, nil)
+                )
+            )"},
             &create_file_read_hdf5, &create_primitive<file_read_hdf5>,
-            R"(fname,dsetname
+            R"(fname, dsetname, start, count, stride
             Args:
 
                 fname (string) : a file name
                 dsetname (string) : a dataset name
+                start (list of ints, optional) : the index of the first
+                    element to read for each of the dimensions of the dataset,
+                    defaults to zero for all dimensions
+                count (list of ints, optional) : the number of elements to
+                    read for each of the dimensions of the dataset, defaults
+                    to all elements starting at 'start'
+                stride (list of ints, optional) : the distance between the
+                    elements to read for each of the dimensions of the
+                    dataset, defaults to one for all dimensions
 
             Returns:
 
-            The dataset, either a matrix or vector.)"
+            The selected part of the dataset, either a scalar, a vector, a
+            matrix, a tensor, or a 4d array.)"
             )
     };
 
@@ -54,18 +69,43 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
     }
 
-    // read data from given file and return content
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // extract one value for each of the dimensions of the dataset
+        hdf5_dataset::dimensions_type extract_hyperslab_dimensions(
+            primitive_argument_type&& arg, std::size_t ndims,
+            std::string const& name, std::string const& codename)
+        {
+            ir::range&& list =
+                extract_list_value_strict(std::move(arg), name, codename);
+            if (list.size() != ndims)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::primitives::"
+                        "file_read_hdf5::eval",
+                    util::generate_error_message(
+                        "the start, count, and stride arguments should have "
+                        "as many elements as the dataset has dimensions",
+                        name, codename));
+            }
+            return util::detail::extract_nonneg_range_dimensions(
+                list, name, codename);
+        }
+    }
+
+    // read (part of the) data from given file and return content
     hpx::future<primitive_argument_type> file_read_hdf5::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
     {
-        if (operands.size() != 2)
+        if (operands.size() < 2 || operands.size() > 5)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "phylanx::execution_tree::primitives::file_read_hdf5::eval",
                 generate_error_message(
-                    "the file_read_hdf5 primitive requires exactly two "
-                        "literal arguments"));
+                    "the file_read_hdf5 primitive requires at least two and "
+                        "at most five arguments"));
         }
 
         if (!valid(operands[0]) || !valid(operands[1]))
@@ -82,47 +122,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::string datasetName =
             string_operand_sync(operands[1], args, name_, codename_, ctx);
 
-        HighFive::File infile(filename, HighFive::File::ReadOnly);
-        HighFive::DataSet dataSet = infile.getDataSet(datasetName);
-        HighFive::DataSpace dataSpace = dataSet.getSpace();
+        hdf5_dataset dataset(filename, datasetName, name_, codename_);
+        std::size_t ndims = dataset.num_dimensions();
 
-        switch (dataSpace.getNumberDimensions())
+        // a missing (or nil) start, count, or stride selects all elements
+        std::array<hdf5_dataset::dimensions_type, 3> selection{};
+        for (std::size_t i = 0; i != selection.size(); ++i)
         {
-        case 0:
+            if (operands.size() > i + 2 && valid(operands[i + 2]))
             {
-                // scalar value
-                double scalar;
-                dataSet.read(scalar);
-                return hpx::make_ready_future(
-                    primitive_argument_type{ir::node_data<double>{scalar}});
+                auto arg = value_operand_sync(
+                    operands[i + 2], args, name_, codename_, ctx);
+                if (valid(arg))
+                {
+                    selection[i] = detail::extract_hyperslab_dimensions(
+                        std::move(arg), ndims, name_, codename_);
+                }
             }
-
-        case 1:
-            {
-                // vector
-                std::vector<std::size_t> dims = dataSpace.getDimensions();
-                blaze::DynamicVector<double> vector(dims[0]);
-                dataSet.read(vector);
-                return hpx::make_ready_future(primitive_argument_type{
-                    ir::node_data<double>{std::move(vector)}});
-            }
-
-        case 2:
-            {
-                // matrix
-                std::vector<std::size_t> dims = dataSpace.getDimensions();
-                blaze::DynamicMatrix<double> matrix(dims[0], dims[1]);
-                dataSet.read(matrix);
-                return hpx::make_ready_future(primitive_argument_type{
-                    ir::node_data<double>{std::move(matrix)}});
-            }
-
-        default:
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::file_read_hdf5::eval",
-                generate_error_message(
-                    "the input file has incompatible number of dimensions"));
         }
+
+        return hpx::make_ready_future(primitive_argument_type{
+            dataset.read(selection[0], selection[1], selection[2])});
     }
 }}}
 
@@ -21,6 +21,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(file_write_csv_plugin,
     phylanx::execution_tree::primitives::file_write_csv::match_data);
 
 #if defined(PHYLANX_HAVE_HIGHFIVE)
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_file_read_hdf5_plugin,
+    phylanx::execution_tree::primitives::dist_file_read_hdf5::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(file_read_hdf5_plugin,
     phylanx::execution_tree::primitives::file_read_hdf5::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(file_write_hdf5_plugin,
@@ -574,6 +574,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             extract_integer_value(
                                 std::move(op2), this_->name_, this_->codename_));
 
+                    case node_data_type_float:
+                        HPX_FALLTHROUGH;
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
                     case node_data_type_double:
@@ -635,6 +637,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(op2), this_->name_, this_->codename_),
                             std::move(axes));
 
+                    case node_data_type_float:
+                        HPX_FALLTHROUGH;
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
                     case node_data_type_double:
@@ -68,6 +68,31 @@ namespace phylanx { namespace execution_tree { namespace primitives
       : primitive_component_base(std::move(operands), name, codename)
     {}
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type conv1d_operation::conv1d_any(
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
+        std::string&& padding, std::int64_t strides,
+        std::int64_t dilation_rate) const
+    {
+        if (strides == 1 && dilation_rate == 1)
+        {
+            return common::conv1d_all_paddings(std::move(arg),
+                std::move(kernel), std::move(padding), name_, codename_);
+        }
+        if (dilation_rate == 1) // strides > 1
+        {
+            return common::conv1d_all_paddings(std::move(arg),
+                std::move(kernel), std::move(padding), strides, name_,
+                codename_);
+        }
+
+        // strides == 1 and dilation_rate > 1
+        return common::conv1d_all_paddings_dilation(std::move(arg),
+            std::move(kernel), std::move(padding), dilation_rate, name_,
+            codename_);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> conv1d_operation::eval(
         primitive_arguments_type const& operands,
@@ -214,34 +239,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             "dilation_rate > 1"));
                 }
 
-                if (strides == 1 && dilation_rate == 1)
+                // the result is float for single precision arguments
+                // and double otherwise
+                if (extract_common_type(args[0], args[1]) ==
+                    node_data_type_float)
                 {
-                    return common::conv1d_all_paddings(
-                        extract_numeric_value(
+                    return this_->conv1d_any(
+                        extract_float_value(
                             std::move(args[0]), this_->name_, this_->codename_),
-                        extract_numeric_value(
+                        extract_float_value(
                             std::move(args[1]), this_->name_, this_->codename_),
-                        std::move(padding), this_->name_, this_->codename_);
+                        std::move(padding), strides, dilation_rate);
                 }
-                if (dilation_rate == 1) // strides > 1
-                {
-                    return common::conv1d_all_paddings(
-                        extract_numeric_value(
-                            std::move(args[0]), this_->name_, this_->codename_),
-                        extract_numeric_value(
-                            std::move(args[1]), this_->name_, this_->codename_),
-                        std::move(padding), strides, this_->name_,
-                        this_->codename_);
-                }
-
-                // strides == 1 and dilation_rate > 1
-                return common::conv1d_all_paddings_dilation(
+                return this_->conv1d_any(
                     extract_numeric_value(
                         std::move(args[0]), this_->name_, this_->codename_),
                     extract_numeric_value(
                         std::move(args[1]), this_->name_, this_->codename_),
-                    std::move(padding), dilation_rate, this_->name_,
-                    this_->codename_);
+                    std::move(padding), strides, dilation_rate);
             }),
             detail::map_operands(operands, functional::value_operand{},
                 args, name_, codename_, std::move(ctx)));
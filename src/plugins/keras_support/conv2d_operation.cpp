@@ -7,8 +7,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
 #include <phylanx/plugins/keras_support/conv2d_operation.hpp>
-#include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
 
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/include/lcos.hpp>
@@ -71,112 +71,57 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {}
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_valid(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel) const
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_height = q.pages();
-        std::size_t in_width = q.rows();
-        std::size_t in_channels = q.columns();
-        std::size_t filter_height = k.quats();
-        std::size_t filter_width = k.pages();
-        std::size_t out_channels = k.columns();
-
-        std::size_t res_height = in_height - filter_height + 1;
-        std::size_t res_width = in_width - filter_width + 1;
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, i, j, 0, filter_height,
-                                filter_width, in_channels) %
-                            k_tensor;
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+
+        common::conv_dimension height(
+            in_height, filter_height, in_height - filter_height + 1, 0);
+        common::conv_dimension width(
+            in_width, filter_width, in_width - filter_width + 1, 0);
+
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, common::conv2d_kernel_matrix(kernel), height, width)};
     }
 
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_valid(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t stride_height, std::int64_t stride_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_height = q.pages();
-        std::size_t in_width = q.rows();
-        std::size_t in_channels = q.columns();
-        std::size_t filter_height = k.quats();
-        std::size_t filter_width = k.pages();
-        std::size_t out_channels = k.columns();
-
-        std::size_t res_height = blaze::ceil(
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+
+        std::int64_t res_height = blaze::ceil(
             static_cast<double>(in_height - filter_height + 1) / stride_height);
-        std::size_t res_width = blaze::ceil(
+        std::int64_t res_width = blaze::ceil(
             static_cast<double>(in_width - filter_width + 1) / stride_width);
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, i * stride_height,
-                                j * stride_width, 0, filter_height,
-                                filter_width, in_channels) %
-                            k_tensor;
+        common::conv_dimension height(
+            in_height, filter_height, res_height, 0, stride_height);
+        common::conv_dimension width(
+            in_width, filter_width, res_width, 0, stride_width);
 
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, common::conv2d_kernel_matrix(kernel), height, width)};
     }
 
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_valid_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t dilation_height, std::int64_t dilation_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
 
         std::int64_t res_height =
             in_height - dilation_height * (filter_height - 1);
@@ -188,102 +133,46 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 generate_error_message("this dilation_rate causes non-positive "
                                        "result_length where padding is valid"));
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto schur_product =
-                            blaze::dilatedsubtensor(a_tensor, i, j, 0,
-                                filter_height, filter_width, in_channels,
-                                dilation_height, dilation_width, 1) %
-                            k_tensor;
+        common::conv_dimension height(
+            in_height, filter_height, res_height, 0, 1, dilation_height);
+        common::conv_dimension width(
+            in_width, filter_width, res_width, 0, 1, dilation_width);
 
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, common::conv2d_kernel_matrix(kernel), height, width)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_same(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel) const
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
 
         std::int64_t pad_top = (filter_height - 1) / 2;
         std::int64_t pad_left = (filter_width - 1) / 2;
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, in_height, in_width, out_channels);
+        common::conv_dimension height(
+            in_height, filter_height, in_height, pad_top);
+        common::conv_dimension width(
+            in_width, filter_width, in_width, pad_left);
 
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != in_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes(
-                        in_height, filter_height, i - pad_top);
-                    for (std::size_t j = 0; j != in_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes(
-                            in_width, filter_width, j - pad_left);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::subtensor(k_tensor, sub_height.kernel_beg_,
-                                sub_width.kernel_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, common::conv2d_kernel_matrix(kernel), height, width)};
     }
 
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_same(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t stride_height, std::int64_t stride_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
         std::int64_t pad_height;
         std::int64_t pad_width;
 
@@ -313,112 +202,48 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 static_cast<std::int64_t>(0);
         }
 
-        std::size_t res_width = blaze::ceil(
+        std::int64_t res_width = blaze::ceil(
             static_cast<double>(in_width + pad_width - filter_width + 1) /
             stride_width);
-        std::size_t res_height = blaze::ceil(
+        std::int64_t res_height = blaze::ceil(
             static_cast<double>(in_height + pad_height - filter_height + 1) /
             stride_height);
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-        std::int64_t pad_top  = pad_height / 2;
-        std::int64_t pad_left = pad_width / 2;
+        common::conv_dimension height(in_height, filter_height, res_height,
+            pad_height / 2, stride_height);
+        common::conv_dimension width(
+            in_width, filter_width, res_width, pad_width / 2, stride_width);
 
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes(
-                        in_height, filter_height, i * stride_height - pad_top);
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes(in_width,
-                            filter_width, j * stride_width - pad_left);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::subtensor(k_tensor, sub_height.kernel_beg_,
-                                sub_width.kernel_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, common::conv2d_kernel_matrix(kernel), height, width)};
     }
 
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_same_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::int64_t dilation_height, std::int64_t dilation_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
 
         std::int64_t pad_top = (dilation_height * (filter_height - 1)) / 2;
         std::int64_t pad_left = (dilation_width * (filter_width - 1)) / 2;
 
-        blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
-            batch, in_height, in_width, out_channels);
+        common::conv_dimension height(in_height, filter_height, in_height,
+            pad_top, 1, dilation_height);
+        common::conv_dimension width(
+            in_width, filter_width, in_width, pad_left, 1, dilation_width);
 
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != in_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes_dilated(
-                        in_height, filter_height, i - pad_top, dilation_height);
-                    for (std::size_t j = 0; j != in_width; ++j)
-                    {
-                        auto sub_width =
-                            conv_indices::get_subsizes_dilated(in_width,
-                                filter_width, j - pad_left, dilation_width);
-                        if (sub_height.size_ == 0 || sub_width.size_ == 0)
-                            continue;
-
-                        auto schur_product =
-                            blaze::dilatedsubtensor(a_tensor,
-                                sub_height.image_beg_, sub_width.image_beg_, 0,
-                                sub_height.size_, sub_width.size_, in_channels,
-                                dilation_height, dilation_width, 1) %
-                            blaze::subtensor(k_tensor, sub_height.kernel_beg_,
-                                sub_width.kernel_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, common::conv2d_kernel_matrix(kernel), height, width)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_any_pad(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::string&& padding) const
     {
         if (padding == "valid")
@@ -430,8 +255,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return conv2d_same(std::move(arg), std::move(kernel));
     }
 
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_any_pad(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::string&& padding, std::int64_t stride_height,
         std::int64_t stride_width) const
     {
@@ -446,8 +272,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(arg), std::move(kernel), stride_height, stride_width);
     }
 
+    template <typename T>
     primitive_argument_type conv2d_operation::conv2d_any_pad_dilation(
-        ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
         std::string&& padding, std::int64_t dilation_height,
             std::int64_t dilation_width) const
     {
@@ -462,6 +289,30 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(arg), std::move(kernel), dilation_height, dilation_width);
     }
 
+    template <typename T>
+    primitive_argument_type conv2d_operation::conv2d_any(
+        ir::node_data<T>&& arg, ir::node_data<T>&& kernel,
+        std::string&& padding, std::int64_t stride_height,
+        std::int64_t stride_width, std::int64_t dilation_height,
+        std::int64_t dilation_width) const
+    {
+        if (stride_height == 1 && stride_width == 1 && dilation_height == 1 &&
+            dilation_width == 1)
+        {
+            return conv2d_any_pad(
+                std::move(arg), std::move(kernel), std::move(padding));
+        }
+        if (dilation_height == 1 && dilation_width == 1) // strides != (1,1)
+        {
+            return conv2d_any_pad(std::move(arg), std::move(kernel),
+                std::move(padding), stride_height, stride_width);
+        }
+
+        // strides == (1,1) and dilation_rate != (1,1)
+        return conv2d_any_pad_dilation(std::move(arg), std::move(kernel),
+            std::move(padding), dilation_height, dilation_width);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> conv2d_operation::eval(
         primitive_arguments_type const& operands,
@@ -556,8 +407,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 }
 
                 ir::range strides(0); // an empty range
-                std::size_t stride_height;
-                std::size_t stride_width;
+                std::size_t stride_height = 1;
+                std::size_t stride_width = 1;
                 if (args.size() > 3)
                 {
                     strides = extract_list_value_strict(
@@ -584,8 +435,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 }
 
                 ir::range dilation_rate(0); // an empty range
-                std::int64_t dilation_height;
-                std::int64_t dilation_width;
+                std::int64_t dilation_height = 1;
+                std::int64_t dilation_width = 1;
                 if (args.size() > 4)
                 {
                     dilation_rate = extract_list_value_strict(
@@ -620,32 +471,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             "dilation_rate > 1"));
                 }
 
-                if (strides.empty() && dilation_rate.empty())
-                {
-                    return this_->conv2d_any_pad(
-                        extract_numeric_value(
-                            std::move(args[0]), this_->name_, this_->codename_),
-                        extract_numeric_value(
-                            std::move(args[1]), this_->name_, this_->codename_),
-                        std::move(padding));
-                }
-                if (dilation_rate.empty()) // strides != (1,1)
+                // the result is float for single precision arguments
+                // and double otherwise
+                if (extract_common_type(args[0], args[1]) ==
+                    node_data_type_float)
                 {
-                    return this_->conv2d_any_pad(
-                        extract_numeric_value(
+                    return this_->conv2d_any(
+                        extract_float_value(
                             std::move(args[0]), this_->name_, this_->codename_),
-                        extract_numeric_value(
+                        extract_float_value(
                             std::move(args[1]), this_->name_, this_->codename_),
-                        std::move(padding), stride_height, stride_width);
+                        std::move(padding), stride_height, stride_width,
+                        dilation_height, dilation_width);
                 }
-
-                // strides == (1,1) and dilation_rate != (1,1)
-                return this_->conv2d_any_pad_dilation(
+                return this_->conv2d_any(
                     extract_numeric_value(
                         std::move(args[0]), this_->name_, this_->codename_),
                     extract_numeric_value(
                         std::move(args[1]), this_->name_, this_->codename_),
-                    std::move(padding), dilation_height, dilation_width);
+                    std::move(padding), stride_height, stride_width,
+                    dilation_height, dilation_width);
             }),
             detail::map_operands(operands, functional::value_operand{},
                 args, name_, codename_, std::move(ctx)));
@@ -7,8 +7,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
 #include <phylanx/plugins/keras_support/conv2d_transpose_operation.hpp>
-#include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
 
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/include/lcos.hpp>
@@ -188,75 +188,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Tensor>
-    void conv2d_transpose_operation::flip_kernel(Tensor& t) const
-    {
-        std::size_t columns = t.columns();
-        for (std::size_t c = 0; c != columns; ++c)
-        {
-            auto slice = blaze::columnslice(t, c);
-            slice = blaze::reverse<blaze::rowwise>(slice);
-            slice = blaze::reverse<blaze::columnwise>(slice);
-        }
-    }
-
-    ///////////////////////////////////////////////////////////////////////////
+    // The transposed convolution is a convolution of the input upsampled by
+    // the strides with the flipped kernel
     primitive_argument_type conv2d_transpose_operation::conv2d_transpose_valid(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
         std::size_t res_height, std::size_t res_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        std::size_t out_channels = k.rows();
-
-        std::int64_t pad_top  = filter_height - 1;
-        std::int64_t pad_left = filter_width - 1;
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t l = 0; l != batch; ++l)
-        {
-            auto a_tensor = blaze::quatslice(q, l);
-            auto res_tensor = blaze::quatslice(result, l);
-
-            for (std::size_t o = 0; o != out_channels; ++o)
-            {
-                auto res_slice = blaze::columnslice(res_tensor, o);
-                auto k_tensor =
-                    blaze::quatslice(blaze::trans(k, {2, 0, 1, 3}), o);
-
-                blaze::DynamicTensor<double> flipped_kernel = k_tensor;
-                flip_kernel(flipped_kernel);
-
-                for (std::int64_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes(
-                            in_height, filter_height, i - pad_top);
-                    for (std::int64_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes(
-                            in_width, filter_width, j - pad_left);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::subtensor(flipped_kernel,
-                                sub_height.kernel_beg_, sub_width.kernel_beg_,
-                                0, sub_height.size_, sub_width.size_,
-                                in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+
+        common::conv_dimension height(
+            in_height, filter_height, res_height, filter_height - 1);
+        common::conv_dimension width(
+            in_width, filter_width, res_width, filter_width - 1);
+
+        return primitive_argument_type{common::conv2d_gemm(arg,
+            common::conv2d_transpose_kernel_matrix(kernel), height, width)};
     }
 
     primitive_argument_type conv2d_transpose_operation::conv2d_transpose_valid(
@@ -264,58 +213,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::size_t res_height, std::size_t res_width,
         std::int64_t stride_height, std::int64_t stride_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        std::size_t out_channels = k.rows();
-
-        std::int64_t pad_top  = filter_height - 1;
-        std::int64_t pad_left = filter_width - 1;
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t l = 0; l != batch; ++l)
-        {
-            auto a_tensor = blaze::quatslice(q, l);
-            auto res_tensor = blaze::quatslice(result, l);
-
-            for (std::size_t o = 0; o != out_channels; ++o)
-            {
-                auto res_slice = blaze::columnslice(res_tensor, o);
-                auto k_tensor =
-                    blaze::quatslice(blaze::trans(k, {2, 0, 1, 3}), o);
-
-                blaze::DynamicTensor<double> flipped_kernel = k_tensor;
-                flip_kernel(flipped_kernel);
-
-                for (std::int64_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes_transpose(
-                        in_height, filter_height, i - pad_top, stride_height);
-                    for (std::int64_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes_transpose(
-                            in_width, filter_width, j - pad_left, stride_width);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::dilatedsubtensor(flipped_kernel,
-                                sub_height.kernel_beg_, sub_width.kernel_beg_,
-                                0, sub_height.size_, sub_width.size_,
-                                in_channels, stride_height, stride_width, 1);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+
+        common::conv_dimension height(in_height, filter_height, res_height,
+            filter_height - 1, 1, 1, stride_height);
+        common::conv_dimension width(in_width, filter_width, res_width,
+            filter_width - 1, 1, 1, stride_width);
+
+        return primitive_argument_type{common::conv2d_gemm(arg,
+            common::conv2d_transpose_kernel_matrix(kernel), height, width)};
     }
 
     primitive_argument_type
@@ -324,64 +233,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::size_t res_height, std::size_t res_width,
         std::int64_t dilation_height, std::int64_t dilation_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.rows();
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
 
         std::int64_t pad_top = dilation_height * (filter_height - 1);
         std::int64_t pad_left = dilation_width * (filter_width - 1);
 
-        blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
-            batch, res_height, res_width, out_channels);
+        common::conv_dimension height(in_height, filter_height, res_height,
+            pad_top, 1, dilation_height);
+        common::conv_dimension width(in_width, filter_width, res_width,
+            pad_left, 1, dilation_width);
 
-        for (std::size_t l = 0; l != batch; ++l)
-        {
-            auto a_tensor = blaze::quatslice(q, l);
-            auto res_tensor = blaze::quatslice(result, l);
-
-            for (std::size_t o = 0; o != out_channels; ++o)
-            {
-                auto res_slice = blaze::columnslice(res_tensor, o);
-                auto k_tensor =
-                    blaze::quatslice(blaze::trans(k, {2, 0, 1, 3}), o);
-
-                blaze::DynamicTensor<double> flipped_kernel = k_tensor;
-                flip_kernel(flipped_kernel);
-
-                for (std::int64_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes_dilated(
-                        in_height, filter_height, i - pad_top, dilation_height);
-                    for (std::int64_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width =
-                            conv_indices::get_subsizes_dilated(in_width,
-                                filter_width, j - pad_left, dilation_width);
-                        if (sub_height.size_ == 0 || sub_width.size_ == 0)
-                            continue;
-
-                        auto schur_product =
-                            blaze::dilatedsubtensor(a_tensor,
-                                sub_height.image_beg_, sub_width.image_beg_, 0,
-                                sub_height.size_, sub_width.size_, in_channels,
-                                dilation_height, dilation_width, 1) %
-                            blaze::subtensor(flipped_kernel,
-                                sub_height.kernel_beg_, sub_width.kernel_beg_,
-                                0, sub_height.size_, sub_width.size_,
-                                in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(arg,
+            common::conv2d_transpose_kernel_matrix(kernel), height, width)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -389,61 +255,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
         std::size_t res_height, std::size_t res_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width = static_cast<std::int64_t>(k.pages());
-        std::size_t out_channels = k.rows();
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
 
         std::int64_t pad_top =
             blaze::ceil(static_cast<double>(filter_height - 1) / 2.);
         std::int64_t pad_left =
             blaze::ceil(static_cast<double>(filter_width - 1) / 2.);
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
 
-        for (std::size_t l = 0; l != batch; ++l)
-        {
-            auto a_tensor = blaze::quatslice(q, l);
-            auto res_tensor = blaze::quatslice(result, l);
-
-            for (std::size_t o = 0; o != out_channels; ++o)
-            {
-                auto res_slice = blaze::columnslice(res_tensor, o);
-                auto k_tensor =
-                    blaze::quatslice(blaze::trans(k, {2, 0, 1, 3}), o);
-
-                blaze::DynamicTensor<double> flipped_kernel = k_tensor;
-                flip_kernel(flipped_kernel);
-
-                for (std::int64_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes(
-                            in_height, filter_height, i - pad_top);
-                    for (std::int64_t j = 0; j != res_width; ++j)
-                    {
+        common::conv_dimension height(
+            in_height, filter_height, res_height, pad_top);
+        common::conv_dimension width(
+            in_width, filter_width, res_width, pad_left);
 
-                        auto sub_width = conv_indices::get_subsizes(
-                            in_width, filter_width, j - pad_left);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::subtensor(flipped_kernel,
-                                sub_height.kernel_beg_, sub_width.kernel_beg_,
-                                0, sub_height.size_, sub_width.size_,
-                                in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(arg,
+            common::conv2d_transpose_kernel_matrix(kernel), height, width)};
     }
 
     primitive_argument_type conv2d_transpose_operation::conv2d_transpose_same(
@@ -451,15 +279,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::size_t res_height, std::size_t res_width,
         std::int64_t stride_height, std::int64_t stride_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width = static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t out_channels = k.rows();
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+
         std::int64_t pad_height =
             res_height - (in_height - 1) * stride_height + filter_height - 2;
         std::int64_t pad_width =
@@ -469,46 +293,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::int64_t pad_left =
             blaze::ceil(static_cast<double>(pad_width) / 2.);
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t l = 0; l != batch; ++l)
-        {
-            auto a_tensor = blaze::quatslice(q, l);
-            auto res_tensor = blaze::quatslice(result, l);
-
-            for (std::size_t o = 0; o != out_channels; ++o)
-            {
-                auto res_slice = blaze::columnslice(res_tensor, o);
-                auto k_tensor =
-                    blaze::quatslice(blaze::trans(k, {2, 0, 1, 3}), o);
-
-                blaze::DynamicTensor<double> flipped_kernel = k_tensor;
-                flip_kernel(flipped_kernel);
+        common::conv_dimension height(in_height, filter_height, res_height,
+            pad_top, 1, 1, stride_height);
+        common::conv_dimension width(in_width, filter_width, res_width,
+            pad_left, 1, 1, stride_width);
 
-                for (std::int64_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes_transpose(
-                        in_height, filter_height, i - pad_top, stride_height);
-                    for (std::int64_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes_transpose(
-                            in_width, filter_width, j - pad_left, stride_width);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::dilatedsubtensor(flipped_kernel,
-                                sub_height.kernel_beg_, sub_width.kernel_beg_,
-                                0, sub_height.size_, sub_width.size_,
-                                in_channels, stride_height, stride_width, 1);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(arg,
+            common::conv2d_transpose_kernel_matrix(kernel), height, width)};
     }
 
     primitive_argument_type
@@ -517,66 +308,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::size_t res_height, std::size_t res_width,
         std::int64_t dilation_height, std::int64_t dilation_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width = static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.rows();
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width = static_cast<std::int64_t>(arg.dimension(2));
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
 
         std::int64_t pad_top = blaze::ceil(
             static_cast<double>(dilation_height * (filter_height - 1)) / 2.);
         std::int64_t pad_left = blaze::ceil(
             static_cast<double>(dilation_width * (filter_width - 1)) / 2.);
 
-        blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t l = 0; l != batch; ++l)
-        {
-            auto a_tensor = blaze::quatslice(q, l);
-            auto res_tensor = blaze::quatslice(result, l);
-
-            for (std::size_t o = 0; o != out_channels; ++o)
-            {
-                auto res_slice = blaze::columnslice(res_tensor, o);
-                auto k_tensor =
-                    blaze::quatslice(blaze::trans(k, {2, 0, 1, 3}), o);
-
-                blaze::DynamicTensor<double> flipped_kernel = k_tensor;
-                flip_kernel(flipped_kernel);
+        common::conv_dimension height(in_height, filter_height, res_height,
+            pad_top, 1, dilation_height);
+        common::conv_dimension width(in_width, filter_width, res_width,
+            pad_left, 1, dilation_width);
 
-                for (std::int64_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes_dilated(
-                        in_height, filter_height, i - pad_top, dilation_height);
-                    for (std::int64_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width =
-                            conv_indices::get_subsizes_dilated(in_width,
-                                filter_width, j - pad_left, dilation_width);
-                        if (sub_height.size_ == 0 || sub_width.size_ == 0)
-                            continue;
-
-                        auto schur_product =
-                            blaze::dilatedsubtensor(a_tensor,
-                                sub_height.image_beg_, sub_width.image_beg_, 0,
-                                sub_height.size_, sub_width.size_, in_channels,
-                                dilation_height, dilation_width, 1) %
-                            blaze::subtensor(flipped_kernel,
-                                sub_height.kernel_beg_, sub_width.kernel_beg_,
-                                0, sub_height.size_, sub_width.size_,
-                                in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(arg,
+            common::conv2d_transpose_kernel_matrix(kernel), height, width)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
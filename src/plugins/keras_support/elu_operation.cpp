@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/keras_support/elu_operation.hpp>
 
@@ -55,25 +56,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
         : primitive_component_base{ std::move(operands), name, codename }
     {}
 
-    primitive_argument_type elu_operation::elu0d(mat_type&& arg,
-        double alpha) const
+    template <typename T>
+    primitive_argument_type elu_operation::elu0d(
+        ir::node_data<T>&& arg, T alpha) const
     {
         auto elu_ = [alpha](auto const& x)
         {
-            return (x >= 0.) * ( x )
-                 + (x <  0.) * ( alpha * (std::exp(x) - 1.) );
+            return (x >= T(0)) * ( x )
+                 + (x <  T(0)) * ( alpha * (std::exp(x) - T(1)) );
         };
 
         return primitive_argument_type{ elu_(arg.scalar()) };
     }
 
-    primitive_argument_type elu_operation::elu1d(mat_type&& arg,
-        double alpha) const
+    template <typename T>
+    primitive_argument_type elu_operation::elu1d(
+        ir::node_data<T>&& arg, T alpha) const
     {
         auto elu_ = [alpha](auto const& x)
         {
-            return (x >= 0.) * ( x )
-                 + (x <  0.) * ( alpha * (std::exp(x) - 1.) );
+            return (x >= T(0)) * ( x )
+                 + (x <  T(0)) * ( alpha * (std::exp(x) - T(1)) );
         };
 
         if(!arg.is_ref())
@@ -88,13 +91,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{ std::move(arg) };
     }
 
-    primitive_argument_type elu_operation::elu2d(mat_type&& arg,
-        double alpha) const
+    template <typename T>
+    primitive_argument_type elu_operation::elu2d(
+        ir::node_data<T>&& arg, T alpha) const
     {
         auto elu_ = [alpha](auto const& x)
         {
-            return (x >= 0.) * ( x )
-                 + (x <  0.) * ( alpha * (std::exp(x) - 1.) );
+            return (x >= T(0)) * ( x )
+                 + (x <  T(0)) * ( alpha * (std::exp(x) - T(1)) );
         };
 
         if(!arg.is_ref())
@@ -109,13 +113,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{ std::move(arg) };
     }
 
-    primitive_argument_type elu_operation::elu3d(mat_type&& arg,
-        double alpha) const
+    template <typename T>
+    primitive_argument_type elu_operation::elu3d(
+        ir::node_data<T>&& arg, T alpha) const
     {
         auto elu_ = [alpha](auto const& x)
         {
-            return (x >= 0.) * ( x )
-                 + (x <  0.) * ( alpha * (std::exp(x) - 1.) );
+            return (x >= T(0)) * ( x )
+                 + (x <  T(0)) * ( alpha * (std::exp(x) - T(1)) );
         };
 
         if(!arg.is_ref())
@@ -130,6 +135,34 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{ std::move(arg) };
     }
 
+    template <typename T>
+    primitive_argument_type elu_operation::elu_nd(
+        ir::node_data<T>&& arg, T alpha) const
+    {
+        switch(arg.num_dimensions())
+        {
+        case 0:
+            return elu0d(std::move(arg), alpha);
+
+        case 1:
+            return elu1d(std::move(arg), alpha);
+
+        case 2:
+            return elu2d(std::move(arg), alpha);
+
+        case 3:
+            return elu3d(std::move(arg), alpha);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "elu_operation::eval",
+            generate_error_message(
+                "operand a has an invalid number of dimensions"));
+    }
+
     hpx::future<primitive_argument_type> elu_operation::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args,
@@ -159,11 +192,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             (primitive_argument_type&& arg_mat,
                 primitive_argument_type&& arg_alpha)
             {
-                mat_type mat = extract_numeric_value(
-                    std::move(arg_mat),
-                    this_->name_, this_->codename_);
-
-                alpha_type alpha = extract_numeric_value(
+                auto alpha = extract_numeric_value(
                     std::move(arg_alpha),
                     this_->name_, this_->codename_);
 
@@ -177,26 +206,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             "scalar"));
                 }
 
-                switch(mat.num_dimensions())
+                // the result is float for single precision arguments and
+                // double otherwise
+                if (extract_common_type(arg_mat) == node_data_type_float)
                 {
-                case 0:
-                    return this_->elu0d(std::move(mat), alpha.scalar());
-
-                case 1:
-                    return this_->elu1d(std::move(mat), alpha.scalar());
-
-                case 2:
-                    return this_->elu2d(std::move(mat), alpha.scalar());
-
-                case 3:
-                    return this_->elu3d(std::move(mat), alpha.scalar());
-
-                default:
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "elu_operation::eval",
-                        this_->generate_error_message(
-                            "operand a has an invalid number of dimensions"));
+                    return this_->elu_nd(
+                        extract_float_value_strict(std::move(arg_mat),
+                            this_->name_, this_->codename_),
+                        static_cast<float>(alpha.scalar()));
                 }
+
+                return this_->elu_nd(
+                    extract_numeric_value(std::move(arg_mat),
+                        this_->name_, this_->codename_),
+                    alpha.scalar());
             }),
             value_operand(operands[0], args, name_, codename_, ctx),
             value_operand(operands[1], args, name_, codename_, ctx));
@@ -4,6 +4,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/keras_support/hard_sigmoid_operation.hpp>
 
@@ -106,21 +107,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type hard_sigmoid_operation::hard_sigmoid0d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type hard_sigmoid_operation::hard_sigmoid0d(
+        ir::node_data<T>&& arg) const
     {
         return primitive_argument_type{
-            detail::hard_sigmoid(1.0, 0.0, 0.2, 0.5, arg.scalar())};
+            detail::hard_sigmoid(
+                T(1.0), T(0.0), T(0.2), T(0.5), arg.scalar())};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type hard_sigmoid_operation::hard_sigmoid1d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type hard_sigmoid_operation::hard_sigmoid1d(
+        ir::node_data<T>&& arg) const
     {
         auto v = arg.vector();
 
-        auto ones = detail::make_uniform(1.0, v);
-        auto zeros = detail::make_uniform(0.0, v);
-        auto fifth = detail::make_uniform(0.2, v);
-        auto halfs = detail::make_uniform(0.5, v);
+        auto ones = detail::make_uniform(T(1.0), v);
+        auto zeros = detail::make_uniform(T(0.0), v);
+        auto fifth = detail::make_uniform(T(0.2), v);
+        auto halfs = detail::make_uniform(T(0.5), v);
 
         if (!arg.is_ref())
         {
@@ -135,14 +141,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type hard_sigmoid_operation::hard_sigmoid2d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type hard_sigmoid_operation::hard_sigmoid2d(
+        ir::node_data<T>&& arg) const
     {
         auto m = arg.matrix();
 
-        auto ones = detail::make_uniform(1.0, m);
-        auto zeros = detail::make_uniform(0.0, m);
-        auto fifth = detail::make_uniform(0.2, m);
-        auto halfs = detail::make_uniform(0.5, m);
+        auto ones = detail::make_uniform(T(1.0), m);
+        auto zeros = detail::make_uniform(T(0.0), m);
+        auto fifth = detail::make_uniform(T(0.2), m);
+        auto halfs = detail::make_uniform(T(0.5), m);
 
         if (!arg.is_ref())
         {
@@ -157,14 +165,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type hard_sigmoid_operation::hard_sigmoid3d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type hard_sigmoid_operation::hard_sigmoid3d(
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
 
-        auto ones = detail::make_uniform(1.0, t);
-        auto zeros = detail::make_uniform(0.0, t);
-        auto fifth = detail::make_uniform(0.2, t);
-        auto halfs = detail::make_uniform(0.5, t);
+        auto ones = detail::make_uniform(T(1.0), t);
+        auto zeros = detail::make_uniform(T(0.0), t);
+        auto fifth = detail::make_uniform(T(0.2), t);
+        auto halfs = detail::make_uniform(T(0.5), t);
 
         if (!arg.is_ref())
         {
@@ -178,6 +188,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(arg)};
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type hard_sigmoid_operation::hard_sigmoid_nd(
+        ir::node_data<T>&& a) const
+    {
+        switch (a.num_dimensions())
+        {
+        case 0:
+            return hard_sigmoid0d(std::move(a));
+
+        case 1:
+            return hard_sigmoid1d(std::move(a));
+
+        case 2:
+            return hard_sigmoid2d(std::move(a));
+
+        case 3:
+            return hard_sigmoid3d(std::move(a));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "hard_sigmoid_operation::eval",
+            generate_error_message(
+                "operand a has an invalid number of dimensions"));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> hard_sigmoid_operation::eval(
         primitive_arguments_type const& operands,
@@ -208,32 +247,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 [this_ = std::move(this_)](primitive_argument_type&& arg)
                 -> primitive_argument_type
                 {
-                    // Extract the argument, the result should always be double
-                    arg_type a = extract_numeric_value(
-                        std::move(arg), this_->name_, this_->codename_);
-
-                    std::size_t a_dims = a.num_dimensions();
-                    switch (a_dims)
+                    // the result is float for single precision arguments
+                    // and double otherwise
+                    if (extract_common_type(arg) == node_data_type_float)
                     {
-                    case 0:
-                        return this_->hard_sigmoid0d(std::move(a));
-
-                    case 1:
-                        return this_->hard_sigmoid1d(std::move(a));
-
-                    case 2:
-                        return this_->hard_sigmoid2d(std::move(a));
-
-                    case 3:
-                        return this_->hard_sigmoid3d(std::move(a));
-
-                    default:
-                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                            "hard_sigmoid_operation::eval",
-                            this_->generate_error_message(
-                                "operand a has an invalid number of "
-                                "dimensions"));
+                        return this_->hard_sigmoid_nd(extract_float_value_strict(
+                            std::move(arg), this_->name_, this_->codename_));
                     }
+
+                    return this_->hard_sigmoid_nd(extract_numeric_value(
+                        std::move(arg), this_->name_, this_->codename_));
                 }));
     }
 }}}
@@ -19,8 +19,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -58,6 +60,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // single precision arguments produce single precision results, all
+        // other arguments produce double precision results
+        template <typename T>
+        using relu_result_type = typename std::conditional<
+            std::is_same<T, float>::value, float, double>::type;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     primitive_argument_type relu_operation::relu0d(ir::node_data<T>&& arg,
@@ -68,28 +80,31 @@ namespace phylanx { namespace execution_tree { namespace primitives
             a = alpha * (a - threshold);
         else
             a = (blaze::max)(T(0), (blaze::min)(a, max_value));
-        return primitive_argument_type{double(a)};
+        return primitive_argument_type{detail::relu_result_type<T>(a)};
     }
 
     template <typename T>
     primitive_argument_type relu_operation::relu1d(ir::node_data<T>&& arg,
         double alpha, T max_value, double threshold) const
     {
+        using result_type = detail::relu_result_type<T>;
+
         auto v = arg.vector();
 
-        blaze::DynamicVector<double> result(v.size());
+        blaze::DynamicVector<result_type> result(v.size());
 
         auto v_pos = blaze::map(v, [&](T a) {
             if (a >= threshold)
-                return (double) (blaze::max)(T(0), (blaze::min)(a, max_value));
+                return result_type(
+                    (blaze::max)(T(0), (blaze::min)(a, max_value)));
             else
-                return 0.0;
+                return result_type(0);
         });
         auto v_neg = blaze::map(v, [&](T a) {
             if (a < threshold)
-                return alpha * (a - threshold);
+                return result_type(alpha * (a - threshold));
             else
-                return 0.0;
+                return result_type(0);
         });
 
         result = v_pos + v_neg;
@@ -100,21 +115,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type relu_operation::relu2d(ir::node_data<T>&& arg,
         double alpha, T max_value, double threshold) const
     {
+        using result_type = detail::relu_result_type<T>;
+
         auto m = arg.matrix();
 
-        blaze::DynamicMatrix<double> result(m.rows(), m.columns());
+        blaze::DynamicMatrix<result_type> result(m.rows(), m.columns());
 
         auto m_pos = blaze::map(m, [&](T a) {
             if (a >= threshold)
-                return (double) (blaze::max)(T(0), (blaze::min)(a, max_value));
+                return result_type(
+                    (blaze::max)(T(0), (blaze::min)(a, max_value)));
             else
-                return 0.0;
+                return result_type(0);
         });
         auto m_neg = blaze::map(m, [&](T a) {
             if (a < threshold)
-                return alpha * (a - threshold);
+                return result_type(alpha * (a - threshold));
             else
-                return 0.0;
+                return result_type(0);
         });
 
         result = m_pos + m_neg;
@@ -125,21 +143,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type relu_operation::relu3d(ir::node_data<T>&& arg,
         double alpha, T max_value, double threshold) const
     {
+        using result_type = detail::relu_result_type<T>;
+
         auto t = arg.tensor();
 
-        blaze::DynamicTensor<double> result(t.pages(), t.rows(), t.columns());
+        blaze::DynamicTensor<result_type> result(
+            t.pages(), t.rows(), t.columns());
 
         auto t_pos = blaze::map(t, [&](T a) {
             if (a >= threshold)
-                return (double) (blaze::max)(T(0), (blaze::min)(a, max_value));
+                return result_type(
+                    (blaze::max)(T(0), (blaze::min)(a, max_value)));
             else
-                return 0.0;
+                return result_type(0);
         });
         auto t_neg = blaze::map(t, [&](T a) {
             if (a < threshold)
-                return alpha * (a - threshold);
+                return result_type(alpha * (a - threshold));
             else
-                return 0.0;
+                return result_type(0);
         });
 
         result = t_pos + t_neg;
@@ -249,6 +271,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[0]), this_->name_, this_->codename_),
                         alpha, max_value, threshold);
                 }
+                case node_data_type_float:
+                {
+                    float max_value = 0.0f;
+                    if (args.size() < 3 || !valid(args[2]))
+                    {
+                        max_value = (std::numeric_limits<float>::max)();
+                    }
+                    else
+                    {
+                        max_value = static_cast<float>(
+                            extract_scalar_numeric_value(std::move(args[2]),
+                                this_->name_, this_->codename_));
+                    }
+                    return this_->relu_helper<float>(
+                        extract_float_value_strict(
+                            std::move(args[0]), this_->name_, this_->codename_),
+                        alpha, max_value, threshold);
+                }
                 case node_data_type_unknown:
                     HPX_FALLTHROUGH;
                 case node_data_type_double:
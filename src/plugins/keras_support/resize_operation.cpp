@@ -235,6 +235,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(width_factor),
                                 std::move(interpolation));
 
+                        case node_data_type_float:
+                            HPX_FALLTHROUGH;
                         case node_data_type_unknown:
                             HPX_FALLTHROUGH;
                         case node_data_type_double:
@@ -7,7 +7,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
-#include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
+#include <phylanx/plugins/common/conv_engine.hpp>
 #include <phylanx/plugins/keras_support/separable_conv1d_operation.hpp>
 
 #include <hpx/datastructures/optional.hpp>
@@ -72,39 +72,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {}
 
     ///////////////////////////////////////////////////////////////////////////
+    // The depthwise and pointwise kernels are combined into the kernel of a
+    // single (regular) convolution
     primitive_argument_type separable_conv1d_operation::sep_conv1d_valid(
         ir::node_data<double>&& arg,
         ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
 
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_length = dk.pages();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
-        std::size_t result_length = a.rows() - dk_length + 1;
+        common::conv_dimension length(
+            data_length, dk_length, data_length - dk_length + 1, 0);
 
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     j, batch, dk_length) *
-                        blaze::trans(blaze::rowslice(dk, i)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv1d_gemm(arg,
+            common::separable_conv1d_kernel_matrix(depth_kernel, point_kernel),
+            length)};
     }
 
     primitive_argument_type separable_conv1d_operation::sep_conv1d_valid(
@@ -112,35 +95,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t strides) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_length = dk.pages();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
-        std::size_t result_length = blaze::ceil(
-            static_cast<double>(a.rows() - dk_length + 1) / strides);
-
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     j * strides, batch, dk_length) *
-                        blaze::trans(blaze::rowslice(dk, i)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
+        std::int64_t result_length = blaze::ceil(
+            static_cast<double>(data_length - dk_length + 1) / strides);
+
+        common::conv_dimension length(
+            data_length, dk_length, result_length, 0, strides);
+
+        return primitive_argument_type{common::conv1d_gemm(arg,
+            common::separable_conv1d_kernel_matrix(depth_kernel, point_kernel),
+            length)};
     }
 
     primitive_argument_type
@@ -148,16 +113,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& arg, ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t dilation_rate) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t result_length =
             data_length - dilation_rate * (dk_length - 1);
 
@@ -168,23 +125,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "this dilation_rate causes non-positive "
                     "result_length where padding is valid"));
 
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
+        common::conv_dimension length(
+            data_length, dk_length, result_length, 0, 1, dilation_rate);
 
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                blaze::rowslice(result, j) += blaze::trans(
-                    blaze::dilatedsubmatrix(blaze::columnslice(a, i), 0, j,
-                        batch, dk_length, 1, dilation_rate) *
-                    blaze::trans(blaze::rowslice(dk, i)) *
-                    blaze::submatrix(blaze::pageslice(pk, 0),
-                        dk_out_channels * i, 0, dk_out_channels,
-                        pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv1d_gemm(arg,
+            common::separable_conv1d_kernel_matrix(depth_kernel, point_kernel),
+            length)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -193,54 +139,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t pad_left = (dk_length - 1) / 2;
 
-        blaze::DynamicTensor<double> result(
-            batch, data_length, pk_out_channels, 0.);
+        common::conv_dimension length(
+            data_length, dk_length, data_length, pad_left);
 
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != data_length; ++j)
-            {
-                auto sub = conv_indices::get_subsizes(
-                    data_length, dk_length, j - pad_left);
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     sub.image_beg_, batch, sub.size_) *
-                        blaze::trans(blaze::submatrix(blaze::rowslice(dk, i), 0,
-                            sub.kernel_beg_, dk_out_channels, sub.size_)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv1d_gemm(arg,
+            common::separable_conv1d_kernel_matrix(depth_kernel, point_kernel),
+            length)};
     }
 
     primitive_argument_type separable_conv1d_operation::sep_conv1d_same(
         ir::node_data<double>&& arg, ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t strides) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t pad_width;
 
         if (data_length % strides == 0)
@@ -254,73 +170,32 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 static_cast<std::int64_t>(0));
         }
 
-        std::size_t result_length = blaze::ceil(
+        std::int64_t result_length = blaze::ceil(
             static_cast<double>(data_length + pad_width - dk_length + 1) /
             strides);
 
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
-        std::size_t pad_left = pad_width / 2;
+        common::conv_dimension length(
+            data_length, dk_length, result_length, pad_width / 2, strides);
 
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                auto sub = conv_indices::get_subsizes(
-                    data_length, dk_length, j * strides - pad_left);
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     sub.image_beg_, batch, sub.size_) *
-                        blaze::trans(blaze::submatrix(blaze::rowslice(dk, i), 0,
-                            sub.kernel_beg_, dk_out_channels, sub.size_)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv1d_gemm(arg,
+            common::separable_conv1d_kernel_matrix(depth_kernel, point_kernel),
+            length)};
     }
 
     primitive_argument_type separable_conv1d_operation::sep_conv1d_same_dilation(
         ir::node_data<double>&& arg, ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t dilation_rate) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t pad_left = (dilation_rate * (dk_length - 1) ) / 2;
 
-        blaze::DynamicTensor<double> result(
-            batch, data_length, pk_out_channels, 0.);
+        common::conv_dimension length(data_length, dk_length, data_length,
+            pad_left, 1, dilation_rate);
 
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != data_length; ++j)
-            {
-                auto sub = conv_indices::get_subsizes_dilated(
-                    data_length, dk_length, j - pad_left, dilation_rate);
-
-                if (sub.size_ == 0)
-                    continue;
-
-                blaze::rowslice(result, j) += blaze::trans(
-                    blaze::dilatedsubmatrix(blaze::columnslice(a, i), 0,
-                        sub.image_beg_, batch, sub.size_, 1, dilation_rate) *
-                    blaze::trans(blaze::submatrix(blaze::rowslice(dk, i), 0,
-                        sub.kernel_beg_, dk_out_channels, sub.size_)) *
-                    blaze::submatrix(blaze::pageslice(pk, 0),
-                        dk_out_channels * i, 0, dk_out_channels,
-                        pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv1d_gemm(arg,
+            common::separable_conv1d_kernel_matrix(depth_kernel, point_kernel),
+            length)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -5,6 +5,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/keras_support/sigmoid_operation.hpp>
 #include <phylanx/util/detail/div_simd.hpp>
@@ -102,17 +103,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type sigmoid_operation::sigmoid0d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type sigmoid_operation::sigmoid0d(
+        ir::node_data<T>&& arg) const
     {
-        return primitive_argument_type{detail::sigmoid(1.0, arg.scalar())};
+        return primitive_argument_type{detail::sigmoid(T(1), arg.scalar())};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type sigmoid_operation::sigmoid1d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type sigmoid_operation::sigmoid1d(
+        ir::node_data<T>&& arg) const
     {
         auto v = arg.vector();
 
-        auto ones = detail::make_uniform(1.0, v);
+        auto ones = detail::make_uniform(T(1), v);
 
         if (!arg.is_ref())
         {
@@ -127,11 +132,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type sigmoid_operation::sigmoid2d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type sigmoid_operation::sigmoid2d(
+        ir::node_data<T>&& arg) const
     {
         auto m = arg.matrix();
 
-        auto ones = detail::make_uniform(1.0, m);
+        auto ones = detail::make_uniform(T(1), m);
 
         if (!arg.is_ref())
         {
@@ -146,11 +153,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type sigmoid_operation::sigmoid3d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type sigmoid_operation::sigmoid3d(
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
 
-        auto ones = detail::make_uniform(1.0, t);
+        auto ones = detail::make_uniform(T(1), t);
 
         if (!arg.is_ref())
         {
@@ -164,6 +173,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(arg)};
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type sigmoid_operation::sigmoid_nd(
+        ir::node_data<T>&& a) const
+    {
+        switch (a.num_dimensions())
+        {
+        case 0:
+            return sigmoid0d(std::move(a));
+
+        case 1:
+            return sigmoid1d(std::move(a));
+
+        case 2:
+            return sigmoid2d(std::move(a));
+
+        case 3:
+            return sigmoid3d(std::move(a));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "sigmoid_operation::eval",
+            generate_error_message(
+                "operand a has an invalid number of dimensions"));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> sigmoid_operation::eval(
         primitive_arguments_type const& operands,
@@ -196,36 +234,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 {
                     annotation_wrapper wrap(arg);
 
-                    // Extract the argument, the result should always be double
-                    arg_type a = extract_numeric_value(
-                        std::move(arg), this_->name_, this_->codename_);
-
-                    std::size_t a_dims = a.num_dimensions();
-                    switch (a_dims)
+                    // the result is float for single precision arguments
+                    // and double otherwise
+                    if (extract_common_type(arg) == node_data_type_float)
                     {
-                    case 0:
-                        return wrap.propagate(this_->sigmoid0d(std::move(a)),
-                            this_->name_, this_->codename_);
-
-                    case 1:
-                        return wrap.propagate(this_->sigmoid1d(std::move(a)),
-                            this_->name_, this_->codename_);
-
-                    case 2:
-                        return wrap.propagate(this_->sigmoid2d(std::move(a)),
-                            this_->name_, this_->codename_);
-
-                    case 3:
-                        return wrap.propagate(this_->sigmoid3d(std::move(a)),
+                        return wrap.propagate(
+                            this_->sigmoid_nd(extract_float_value_strict(
+                                std::move(arg), this_->name_,
+                                this_->codename_)),
                             this_->name_, this_->codename_);
-
-                    default:
-                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                            "sigmoid_operation::eval",
-                            this_->generate_error_message(
-                                "operand a has an invalid number of "
-                                "dimensions"));
                     }
+
+                    return wrap.propagate(
+                        this_->sigmoid_nd(extract_numeric_value(
+                            std::move(arg), this_->name_, this_->codename_)),
+                        this_->name_, this_->codename_);
                 }));
     }
 }}}
@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/keras_support/softmax_operation.hpp>
 
@@ -56,13 +57,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
       : primitive_component_base(std::move(operands), name, codename)
     {}
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax0d() const
     {
-        return primitive_argument_type{static_cast<double>(1.)};
+        return primitive_argument_type{T(1)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softmax_operation::softmax1d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softmax_operation::softmax1d(
+        ir::node_data<T>&& arg) const
     {
         if (!arg.is_ref())
         {
@@ -73,8 +77,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     primitive_argument_type softmax_operation::softmax2d_axis0(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         if (!arg.is_ref())
         {
@@ -85,8 +90,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             blaze::softmax<blaze::columnwise>(arg.matrix())};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax2d_axis1(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         if (!arg.is_ref())
         {
@@ -97,8 +103,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             blaze::softmax<blaze::rowwise>(arg.matrix())};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax2d(
-        arg_type&& arg, std::int64_t axis) const
+        ir::node_data<T>&& arg, std::int64_t axis) const
     {
         switch (axis)
         {
@@ -121,8 +128,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     primitive_argument_type softmax_operation::softmax3d_axis0(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
         if (!arg.is_ref())
@@ -135,7 +143,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{std::move(arg)};
         }
 
-        blaze::DynamicTensor<val_type> result(t.pages(), t.rows(), t.columns());
+        blaze::DynamicTensor<T> result(t.pages(), t.rows(), t.columns());
         for (std::size_t i = 0; i != t.rows(); ++i)
         {
             auto slice = blaze::rowslice(t, i);
@@ -144,8 +152,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax3d_axis1(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
         if (!arg.is_ref())
@@ -158,7 +167,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{std::move(arg)};
         }
 
-        blaze::DynamicTensor<val_type> result(t.pages(), t.rows(), t.columns());
+        blaze::DynamicTensor<T> result(t.pages(), t.rows(), t.columns());
         for (std::size_t i = 0; i != t.columns(); ++i)
         {
             auto slice = blaze::columnslice(t, i);
@@ -167,8 +176,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax3d_axis2(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
         if (!arg.is_ref())
@@ -181,7 +191,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{std::move(arg)};
         }
 
-        blaze::DynamicTensor<val_type> result(t.pages(), t.rows(), t.columns());
+        blaze::DynamicTensor<T> result(t.pages(), t.rows(), t.columns());
         for (std::size_t i = 0; i != t.pages(); ++i)
         {
             auto slice = blaze::pageslice(t, i);
@@ -190,8 +200,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax3d(
-        arg_type&& arg, std::int64_t axis) const
+        ir::node_data<T>&& arg, std::int64_t axis) const
     {
         switch (axis)
         {
@@ -218,8 +229,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
     primitive_argument_type softmax_operation::softmax4d_axis0(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto q = arg.quatern();
         std::size_t quats = q.columns();
@@ -234,12 +246,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     blaze::softmax<blaze::rowwise>(blaze::pageslice(t, i));
             }
         }
-        blaze::DynamicArray<4UL, val_type> result = q;
+        blaze::DynamicArray<4UL, T> result = q;
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax4d_axis1(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto q = arg.quatern();
         std::size_t quats = q.quats();
@@ -259,7 +272,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{std::move(arg)};
         }
 
-        blaze::DynamicArray<4UL, val_type> result(
+        blaze::DynamicArray<4UL, T> result(
             quats, q.pages(), q.rows(), columns);
         for (std::size_t l = 0; l != quats; ++l)
         {
@@ -275,8 +288,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax4d_axis2(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto q = arg.quatern();
         std::size_t quats = q.quats();
@@ -295,7 +309,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{std::move(arg)};
         }
 
-        blaze::DynamicArray<4UL, val_type> result(
+        blaze::DynamicArray<4UL, T> result(
             quats, pages, q.rows(), q.columns());
         for (std::size_t l = 0; l != quats; ++l)
         {
@@ -311,8 +325,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax4d_axis3(
-        arg_type&& arg) const
+        ir::node_data<T>&& arg) const
     {
         auto q = arg.quatern();
         std::size_t quats = q.quats();
@@ -331,7 +346,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{std::move(arg)};
         }
 
-        blaze::DynamicArray<4UL, val_type> result(
+        blaze::DynamicArray<4UL, T> result(
             quats, pages, q.rows(), q.columns());
         for (std::size_t l = 0; l != quats; ++l)
         {
@@ -347,8 +362,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(result)};
     }
 
+    template <typename T>
     primitive_argument_type softmax_operation::softmax4d(
-        arg_type&& arg, std::int64_t axis) const
+        ir::node_data<T>&& arg, std::int64_t axis) const
     {
         switch (axis)
         {
@@ -378,6 +394,39 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 "to be between -4 and 3 for 4d arrays."));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type softmax_operation::softmax_nd(
+        ir::node_data<T>&& a, std::int64_t axis) const
+    {
+        switch (a.num_dimensions())
+        {
+        case 0:
+            return softmax0d<T>();
+
+        case 1:
+            return softmax1d(std::move(a));
+
+        case 2:
+            return softmax2d(std::move(a), axis);
+
+        case 3:
+            return softmax3d(std::move(a), axis);
+
+        case 4:
+            return softmax4d(std::move(a), axis);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "softmax_operation::eval",
+            util::generate_error_message(
+                "operand a has an invalid number of dimensions",
+                name_, codename_));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> softmax_operation::eval(
         primitive_arguments_type const& operands,
@@ -425,36 +474,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             args[1], this_->name_, this_->codename_);
                 }
 
-                // Extract the array, the result should always be double
-                arg_type a = extract_numeric_value(
-                    std::move(args[0]), this_->name_, this_->codename_);
-
-                std::size_t a_dims = a.num_dimensions();
-
-                switch (a_dims)
+                // the result is float for single precision arguments and
+                // double otherwise
+                if (extract_common_type(args[0]) == node_data_type_float)
                 {
-                case 0:
-                    return this_->softmax0d();
-
-                case 1:
-                    return this_->softmax1d(std::move(a));
-
-                case 2:
-                    return this_->softmax2d(std::move(a), axis);
-
-                case 3:
-                    return this_->softmax3d(std::move(a), axis);
-
-                case 4:
-                    return this_->softmax4d(std::move(a), axis);
-
-                default:
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "softmax_operation::eval",
-                        util::generate_error_message("operand a has an invalid "
-                                                        "number of dimensions",
-                            this_->name_, this_->codename_));
+                    return this_->softmax_nd(
+                        extract_float_value_strict(std::move(args[0]),
+                            this_->name_, this_->codename_),
+                        axis);
                 }
+
+                return this_->softmax_nd(
+                    extract_numeric_value(std::move(args[0]),
+                        this_->name_, this_->codename_),
+                    axis);
             }),
             detail::map_operands(
                 operands, functional::value_operand{}, args,
@@ -4,6 +4,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/keras_support/softplus_operation.hpp>
 
@@ -96,18 +97,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softplus_operation::softplus0d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softplus_operation::softplus0d(
+        ir::node_data<T>&& arg) const
     {
-        return primitive_argument_type{detail::softplus(1.0, 0.0, arg.scalar())};
+        return primitive_argument_type{
+            detail::softplus(T(1.0), T(0.0), arg.scalar())};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softplus_operation::softplus1d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softplus_operation::softplus1d(
+        ir::node_data<T>&& arg) const
     {
         auto v = arg.vector();
 
-        auto zeros = detail::make_uniform(0.0, v);
-        auto ones = detail::make_uniform(1.0, v);
+        auto zeros = detail::make_uniform(T(0.0), v);
+        auto ones = detail::make_uniform(T(1.0), v);
 
         if (!arg.is_ref())
         {
@@ -122,12 +128,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softplus_operation::softplus2d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softplus_operation::softplus2d(
+        ir::node_data<T>&& arg) const
     {
         auto m = arg.matrix();
 
-        auto zeros = detail::make_uniform(0.0, m);
-        auto ones = detail::make_uniform(1.0, m);
+        auto zeros = detail::make_uniform(T(0.0), m);
+        auto ones = detail::make_uniform(T(1.0), m);
 
         if (!arg.is_ref())
         {
@@ -142,12 +150,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softplus_operation::softplus3d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softplus_operation::softplus3d(
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
 
-        auto zeros = detail::make_uniform(0.0, t);
-        auto ones = detail::make_uniform(1.0, t);
+        auto zeros = detail::make_uniform(T(0.0), t);
+        auto ones = detail::make_uniform(T(1.0), t);
 
         if (!arg.is_ref())
         {
@@ -161,6 +171,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_argument_type{std::move(arg)};
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type softplus_operation::softplus_nd(
+        ir::node_data<T>&& a) const
+    {
+        switch (a.num_dimensions())
+        {
+        case 0:
+            return softplus0d(std::move(a));
+
+        case 1:
+            return softplus1d(std::move(a));
+
+        case 2:
+            return softplus2d(std::move(a));
+
+        case 3:
+            return softplus3d(std::move(a));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "softplus_operation::eval",
+            generate_error_message(
+                "operand a has an invalid number of dimensions"));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> softplus_operation::eval(
         primitive_arguments_type const& operands,
@@ -191,32 +230,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 [this_ = std::move(this_)](primitive_argument_type&& arg)
                 -> primitive_argument_type
                 {
-                    // Extract the argument, the result should always be double
-                    arg_type a = extract_numeric_value(
-                        std::move(arg), this_->name_, this_->codename_);
-
-                    std::size_t a_dims = a.num_dimensions();
-                    switch (a_dims)
+                    // the result is float for single precision arguments
+                    // and double otherwise
+                    if (extract_common_type(arg) == node_data_type_float)
                     {
-                    case 0:
-                        return this_->softplus0d(std::move(a));
-
-                    case 1:
-                        return this_->softplus1d(std::move(a));
-
-                    case 2:
-                        return this_->softplus2d(std::move(a));
-
-                    case 3:
-                        return this_->softplus3d(std::move(a));
-
-                    default:
-                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                            "softplus_operation::eval",
-                            this_->generate_error_message(
-                                "operand a has an invalid number of "
-                                "dimensions"));
+                        return this_->softplus_nd(extract_float_value_strict(
+                            std::move(arg), this_->name_, this_->codename_));
                     }
+
+                    return this_->softplus_nd(extract_numeric_value(
+                        std::move(arg), this_->name_, this_->codename_));
                 }));
     }
 }}}
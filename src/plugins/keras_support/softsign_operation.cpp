@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/keras_support/softsign_operation.hpp>
 
@@ -53,66 +54,103 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softsign_operation::softsign0d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softsign_operation::softsign0d(
+        ir::node_data<T>&& arg) const
     {
         auto a = arg.scalar();
         return primitive_argument_type{a / (1 + blaze::abs(a))};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softsign_operation::softsign1d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softsign_operation::softsign1d(
+        ir::node_data<T>&& arg) const
     {
         auto v = arg.vector();
 
         if (!arg.is_ref())
         {
             arg =
-                blaze::map(v, [](double a) { return a / (1 + blaze::abs(a)); });
+                blaze::map(v, [](T a) { return a / (1 + blaze::abs(a)); });
         }
         else
         {
             arg.vector() =
-                blaze::map(v, [](double a) { return a / (1 + blaze::abs(a)); });
+                blaze::map(v, [](T a) { return a / (1 + blaze::abs(a)); });
         }
         return primitive_argument_type{std::move(arg)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softsign_operation::softsign2d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softsign_operation::softsign2d(
+        ir::node_data<T>&& arg) const
     {
         auto m = arg.matrix();
 
         if (!arg.is_ref())
         {
             arg =
-                blaze::map(m, [](double a) { return a / (1 + blaze::abs(a)); });
+                blaze::map(m, [](T a) { return a / (1 + blaze::abs(a)); });
         }
         else
         {
             m =
-                blaze::map(m, [](double a) { return a / (1 + blaze::abs(a)); });
+                blaze::map(m, [](T a) { return a / (1 + blaze::abs(a)); });
         }
         return primitive_argument_type{std::move(arg)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    primitive_argument_type softsign_operation::softsign3d(arg_type&& arg) const
+    template <typename T>
+    primitive_argument_type softsign_operation::softsign3d(
+        ir::node_data<T>&& arg) const
     {
         auto t = arg.tensor();
 
         if (!arg.is_ref())
         {
             arg =
-                blaze::map(t, [](double a) { return a / (1 + blaze::abs(a)); });
+                blaze::map(t, [](T a) { return a / (1 + blaze::abs(a)); });
         }
         else
         {
             t =
-                blaze::map(t, [](double a) { return a / (1 + blaze::abs(a)); });
+                blaze::map(t, [](T a) { return a / (1 + blaze::abs(a)); });
         }
         return primitive_argument_type{std::move(arg)};
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type softsign_operation::softsign_nd(
+        ir::node_data<T>&& a) const
+    {
+        switch (a.num_dimensions())
+        {
+        case 0:
+            return softsign0d(std::move(a));
+
+        case 1:
+            return softsign1d(std::move(a));
+
+        case 2:
+            return softsign2d(std::move(a));
+
+        case 3:
+            return softsign3d(std::move(a));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "softsign_operation::eval",
+            generate_error_message(
+                "operand a has an invalid number of dimensions"));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> softsign_operation::eval(
         primitive_arguments_type const& operands,
@@ -144,33 +182,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 hpx::util::unwrapping(
                     [this_ = std::move(this_)](primitive_argument_type&& arg)
                         -> primitive_argument_type {
-                        // Extract the argument, the result should always be double
-                        arg_type a = extract_numeric_value(
-                            std::move(arg), this_->name_, this_->codename_);
-
-                        std::size_t a_dims = a.num_dimensions();
-
-                        switch (a_dims)
+                        // the result is float for single precision arguments
+                        // and double otherwise
+                        if (extract_common_type(arg) == node_data_type_float)
                         {
-                        case 0:
-                            return this_->softsign0d(std::move(a));
-
-                        case 1:
-                            return this_->softsign1d(std::move(a));
-
-                        case 2:
-                            return this_->softsign2d(std::move(a));
-
-                        case 3:
-                            return this_->softsign3d(std::move(a));
-
-                        default:
-                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                                "softsign_operation::eval",
-                                this_->generate_error_message(
-                                    "operand a has an invalid number of "
-                                    "dimensions"));
+                            return this_->softsign_nd(extract_float_value_strict(
+                                std::move(arg), this_->name_, this_->codename_));
                         }
+
+                        return this_->softsign_nd(extract_numeric_value(
+                            std::move(arg), this_->name_, this_->codename_));
                     }));
     }
 }}}
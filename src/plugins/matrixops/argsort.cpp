@@ -6,8 +6,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/sort_kernels.hpp>
 #include <phylanx/plugins/matrixops/argsort.hpp>
-#include <phylanx/util/matrix_iterators.hpp>
 
 #include <hpx/iostream.hpp>
 #include <hpx/include/lcos.hpp>
@@ -19,7 +19,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -50,7 +49,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
               kind (optional, {'quicksort', 'merrgesort', 'heapsort', 'stable'}):
                 Sorting algorithm.
-                *** ignored ***
+                *** ignored, the sort is always stable ***
 
               order (optional, {str, list of str}):
                 When a is an array with fields defined, this argument specifies which
@@ -83,11 +82,8 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
         auto mat = in_array.matrix();
-        auto flatten = blaze::ravel(mat);
         blaze::DynamicVector<std::int64_t> idx(mat.rows() * mat.columns());
-        std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(),
-            [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
+        common::argsort_values<T>(blaze::ravel(mat), idx);
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -96,12 +92,9 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
         auto tensor = in_array.tensor();
-        auto flatten = blaze::ravel(tensor);
         blaze::DynamicVector<std::int64_t> idx(
             tensor.pages() * tensor.rows() * tensor.columns());
-        std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(),
-            [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
+        common::argsort_values<T>(blaze::ravel(tensor), idx);
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -155,6 +148,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                 extract_numeric_value_strict(
                     std::move(in_array), name_, codename_),
                 axis, kind, order);
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return argsort_flatten_helper(
                 extract_numeric_value(std::move(in_array), name_, codename_),
@@ -177,9 +171,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         {
             auto vec = in_array.vector();
             blaze::DynamicVector<std::int64_t> idx(vec.size());
-            std::iota(idx.begin(), idx.end(), 0);
-            std::sort(idx.begin(), idx.end(),
-                [&vec](size_t a, size_t b) { return vec[a] < vec[b]; });
+            common::argsort_values<T>(vec, idx);
             return primitive_argument_type{std::move(idx)};
         }
         HPX_THROW_EXCEPTION(hpx::bad_parameter, "argsort::argsort1d",
@@ -192,24 +184,12 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort2d_axis0(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_column_iterator;
         auto mat = in_array.matrix();
         blaze::DynamicMatrix<std::int64_t> idx(mat.rows(), mat.columns());
 
-        matrix_column_iterator<decltype(mat)> mat_cols_begin(mat);
-        matrix_column_iterator<decltype(mat)> mat_cols_end(mat, mat.columns());
-
-        matrix_column_iterator<decltype(idx)> idx_cols_it(idx);
-
-        for (auto mat_col = mat_cols_begin; mat_col != mat_cols_end;
-             ++mat_col, ++idx_cols_it)
-        {
-            std::iota(idx_cols_it->begin(), idx_cols_it->end(), 0);
-            std::sort(idx_cols_it->begin(), idx_cols_it->end(),
-                [mat_col](size_t a, size_t b) {
-                    return *(mat_col->begin() + a) < *(mat_col->begin() + b);
-                });
-        }
+        common::argsort_lanes<T>(mat.columns(), mat.rows(),
+            [&](std::size_t i) { return blaze::column(mat, i); },
+            [&](std::size_t i) { return blaze::column(idx, i); });
 
         return primitive_argument_type{std::move(idx)};
     }
@@ -218,24 +198,12 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort2d_axis1(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_row_iterator;
         auto mat = in_array.matrix();
         blaze::DynamicMatrix<std::int64_t> idx(mat.rows(), mat.columns());
 
-        matrix_row_iterator<decltype(mat)> mat_rows_begin(mat);
-        matrix_row_iterator<decltype(mat)> mat_rows_end(mat, mat.rows());
-
-        matrix_row_iterator<decltype(idx)> idx_rows_it(idx);
-
-        for (auto mat_row = mat_rows_begin; mat_row != mat_rows_end;
-             ++mat_row, ++idx_rows_it)
-        {
-            std::iota(idx_rows_it->begin(), idx_rows_it->end(), 0);
-            std::sort(idx_rows_it->begin(), idx_rows_it->end(),
-                [mat_row](size_t a, size_t b) {
-                    return *(mat_row->begin() + a) < *(mat_row->begin() + b);
-                });
-        }
+        common::argsort_lanes<T>(mat.rows(), mat.columns(),
+            [&](std::size_t i) { return blaze::row(mat, i); },
+            [&](std::size_t i) { return blaze::row(idx, i); });
 
         return primitive_argument_type{std::move(idx)};
     }
@@ -266,35 +234,22 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort3d_axis0(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_row_iterator;
         auto tensor = in_array.tensor();
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
 
-        for (size_t row = 0; row < tensor.rows(); ++row)
-        {
-            auto tensor_row_slice = blaze::rowslice(tensor, row);
-            matrix_row_iterator<decltype(tensor_row_slice)> const
-                mat_slice_rows_begin(tensor_row_slice);
-            matrix_row_iterator<decltype(tensor_row_slice)> const
-                mat_slice_rows_end(tensor_row_slice, tensor_row_slice.rows());
-
-            auto idx_row_slice = blaze::rowslice(idx, row);
-            matrix_row_iterator<decltype(idx_row_slice)> const
-                idx_slice_rows_begin(idx_row_slice);
-
-            auto idx_row = idx_slice_rows_begin;
-            for (auto mat_row = mat_slice_rows_begin;
-                 mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
-            {
-                std::iota(idx_row->begin(), idx_row->end(), 0);
-                std::sort(idx_row->begin(), idx_row->end(),
-                    [mat_row](size_t a, size_t b) {
-                        return *(mat_row->begin() + a) <
-                            *(mat_row->begin() + b);
-                    });
-            }
-        }
+        // the lanes are the rows of the row slices
+        std::size_t const columns = tensor.columns();
+        common::argsort_lanes<T>(tensor.rows() * columns, tensor.pages(),
+            [&](std::size_t i) {
+                return blaze::row(
+                    blaze::rowslice(tensor, i / columns), i % columns);
+            },
+            [&](std::size_t i) {
+                return blaze::row(
+                    blaze::rowslice(idx, i / columns), i % columns);
+            });
+
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -302,36 +257,22 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort3d_axis1(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_row_iterator;
         auto tensor = in_array.tensor();
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
 
-        for (size_t page = 0; page < tensor.columns(); ++page)
-        {
-            auto tensor_col_slice = blaze::columnslice(tensor, page);
-            matrix_row_iterator<decltype(tensor_col_slice)> const
-                mat_slice_rows_begin(tensor_col_slice);
-            matrix_row_iterator<decltype(tensor_col_slice)> const
-                mat_slice_rows_end(
-                    tensor_col_slice, tensor_col_slice.columns());
-
-            auto idx_col_slice = blaze::columnslice(idx, page);
-            matrix_row_iterator<decltype(idx_col_slice)> const
-                idx_slice_rows_begin(idx_col_slice);
-
-            auto idx_row = idx_slice_rows_begin;
-            for (auto mat_row = mat_slice_rows_begin;
-                 mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
-            {
-                std::iota(idx_row->begin(), idx_row->end(), 0);
-                std::sort(idx_row->begin(), idx_row->end(),
-                    [mat_row](size_t a, size_t b) {
-                        return *(mat_row->begin() + a) <
-                            *(mat_row->begin() + b);
-                    });
-            }
-        }
+        // the lanes are the rows of the column slices
+        std::size_t const pages = tensor.pages();
+        common::argsort_lanes<T>(tensor.columns() * pages, tensor.rows(),
+            [&](std::size_t i) {
+                return blaze::row(
+                    blaze::columnslice(tensor, i / pages), i % pages);
+            },
+            [&](std::size_t i) {
+                return blaze::row(
+                    blaze::columnslice(idx, i / pages), i % pages);
+            });
+
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -339,37 +280,21 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort3d_axis2(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_row_iterator;
         auto tensor = in_array.tensor();
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
 
-        for (size_t page = 0; page < tensor.pages(); ++page)
-        {
-            auto tensor_page_slice = blaze::pageslice(tensor, page);
-
-            matrix_row_iterator<decltype(tensor_page_slice)> const
-                mat_slice_pages_begin(tensor_page_slice);
-            matrix_row_iterator<decltype(tensor_page_slice)> const
-                mat_slice_pages_end(
-                    tensor_page_slice, tensor_page_slice.rows());
-
-            auto idx_page_slice = blaze::pageslice(idx, page);
-            matrix_row_iterator<decltype(idx_page_slice)> const
-                idx_slice_pages_begin(idx_page_slice);
-
-            auto idx_page = idx_slice_pages_begin;
-            for (auto mat_page = mat_slice_pages_begin;
-                 mat_page != mat_slice_pages_end; ++mat_page, ++idx_page)
-            {
-                std::iota(idx_page->begin(), idx_page->end(), 0);
-                std::sort(idx_page->begin(), idx_page->end(),
-                    [mat_page](size_t a, size_t b) {
-                        return *(mat_page->begin() + a) <
-                            *(mat_page->begin() + b);
-                    });
-            }
-        }
+        // the lanes are the rows of the page slices
+        std::size_t const rows = tensor.rows();
+        common::argsort_lanes<T>(tensor.pages() * rows, tensor.columns(),
+            [&](std::size_t i) {
+                return blaze::row(
+                    blaze::pageslice(tensor, i / rows), i % rows);
+            },
+            [&](std::size_t i) {
+                return blaze::row(blaze::pageslice(idx, i / rows), i % rows);
+            });
+
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -484,6 +409,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                                     this_->name_, this_->codename_),
                                 axis, kind, order);
 
+                        case node_data_type_float: HPX_FALLTHROUGH;
                         case node_data_type_unknown:
                             return this_->argsort_helper(
                                 extract_numeric_value(std::move(args[0]),
@@ -179,6 +179,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     return this_->clip_helper<std::int64_t>(std::move(args));
                 case node_data_type_bool:
                     return this_->clip_helper<std::uint8_t>(std::move(args));
+                case node_data_type_float:
+                    HPX_FALLTHROUGH;
                 case node_data_type_unknown:
                     HPX_FALLTHROUGH;
                 case node_data_type_double:
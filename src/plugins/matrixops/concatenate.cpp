@@ -136,6 +136,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return concatenate1d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate1d_helper<double>(std::move(args));
@@ -333,6 +334,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return concatenate2d_helper<std::int64_t>(std::move(args), axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate2d_helper<double>(std::move(args), axis);
@@ -417,6 +419,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return concatenate_flatten_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate_flatten_helper<double>(std::move(args));
@@ -714,6 +717,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return concatenate3d_helper<std::int64_t>(std::move(args), axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate3d_helper<double>(std::move(args), axis);
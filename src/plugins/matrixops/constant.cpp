@@ -193,6 +193,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return constant0d_helper<std::uint8_t>(std::move(op));
         case node_data_type_int64:
             return constant0d_helper<std::int64_t>(std::move(op));
+        case node_data_type_float:
+            return constant0d_helper<float>(std::move(op));
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -240,6 +242,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return constant1d_helper<std::int64_t>(std::move(op), dim);
 
+        case node_data_type_float:
+            return constant1d_helper<float>(std::move(op), dim);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -290,6 +295,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return constant2d_helper<std::int64_t>(std::move(op), dim);
 
+        case node_data_type_float:
+            return constant2d_helper<float>(std::move(op), dim);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -342,6 +350,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return constant3d_helper<std::int64_t>(std::move(op), dim);
 
+        case node_data_type_float:
+            return constant3d_helper<float>(std::move(op), dim);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -400,6 +411,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return constant4d_helper<std::int64_t>(std::move(op), dim);
 
+        case node_data_type_float:
+            return constant4d_helper<float>(std::move(op), dim);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
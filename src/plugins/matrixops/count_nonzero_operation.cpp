@@ -72,6 +72,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{detail::count_nonzero0d(
                 extract_node_data<std::int64_t>(std::move(arg)))};
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return primitive_argument_type{detail::count_nonzero0d(
                 extract_node_data<double>(std::move(arg)))};
@@ -108,6 +109,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{detail::count_nonzero1d(
                 extract_node_data<std::int64_t>(std::move(arg)))};
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return primitive_argument_type{detail::count_nonzero1d(
                 extract_node_data<double>(std::move(arg)))};
@@ -144,6 +146,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{detail::count_nonzero2d(
                 extract_node_data<std::int64_t>(std::move(arg)))};
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return primitive_argument_type{detail::count_nonzero2d(
                 extract_node_data<double>(std::move(arg)))};
@@ -392,6 +392,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return cross1d(
@@ -424,6 +425,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return cross2d(
@@ -73,6 +73,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return determinant0d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return determinant0d(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -108,6 +109,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_int64:  HPX_FALLTHROUGH;
         case node_data_type_bool:   HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return determinant2d(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -95,6 +95,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return diag1d(
                 extract_numeric_value(std::move(arg), name_, codename_), k);
@@ -130,6 +131,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return diag2d(
                 extract_numeric_value(std::move(arg), name_, codename_), k);
@@ -9,6 +9,7 @@
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/dot_operation_nd.hpp>
+#include <phylanx/plugins/common/sparse_operations.hpp>
 #include <phylanx/plugins/matrixops/dot_operation.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -141,6 +142,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return outer1d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -174,6 +180,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return outer2d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -207,6 +218,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return outer3d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -240,6 +256,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return contraction2d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -273,6 +294,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return contraction3d(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -309,6 +335,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(rhs), name_, codename_), axis_a,
                 axis_b);
 
+        case node_data_type_float:
+            return tensordot_range_of_scalars(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_), axis_a,
+                axis_b);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -343,6 +375,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_float:
+            return outer_nd_helper(
+                extract_float_value(std::move(lhs), name_, codename_),
+                extract_float_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -535,6 +572,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     primitive_argument_type&& op2)
                 ->primitive_argument_type
             {
+                if (is_sparse_operand(op1) || is_sparse_operand(op2))
+                {
+                    if (this_->mode_ == dot_product)
+                    {
+                        return common::sparse_dot(std::move(op1),
+                            std::move(op2), this_->name_, this_->codename_);
+                    }
+
+                    // all other products operate on dense data
+                    op1 = common::to_dense(
+                        std::move(op1), this_->name_, this_->codename_);
+                    op2 = common::to_dense(
+                        std::move(op2), this_->name_, this_->codename_);
+                }
+
                 if (this_->mode_ == outer_product)
 
                     return this_->outer_nd_helper(
@@ -103,6 +103,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return expand_dims_0d(extract_numeric_value(
                 std::move(args[0]), name_, codename_));
@@ -221,6 +222,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                           std::move(args[0]), name_, codename_),
                     axis, std::move(arr_localities));
 
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return expand_dims_1d(
                     extract_numeric_value(std::move(args[0]), name_, codename_),
@@ -252,6 +254,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return expand_dims_1d(extract_numeric_value(
                 std::move(args[0]), name_, codename_), axis);
@@ -326,6 +329,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return expand_dims_2d(extract_numeric_value(
                 std::move(args[0]), name_, codename_), axis);
@@ -425,6 +429,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_3d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return expand_dims_3d(extract_numeric_value(
                 std::move(args[0]), name_, codename_), axis);
@@ -99,9 +99,9 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t size = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            size = localities.size(name_, codename_);
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            size = localities->size(name_, codename_);
         }
         else
         {
@@ -123,9 +123,9 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t size = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            size = localities.size(name_, codename_);
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            size = localities->size(name_, codename_);
         }
         else
         {
@@ -143,10 +143,10 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t columns = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            rows = localities.rows(name_, codename_);
-            columns = localities.columns(name_, codename_);
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            rows = localities->rows(name_, codename_);
+            columns = localities->columns(name_, codename_);
         }
         else
         {
@@ -175,10 +175,10 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t size = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            size = (index == 0) ? localities.rows(name_, codename_) :
-                                  localities.columns(name_, codename_);
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            size = (index == 0) ? localities->rows(name_, codename_) :
+                                  localities->columns(name_, codename_);
         }
         else
         {
@@ -198,11 +198,11 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t columns = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            pages = localities.pages(name_, codename_);
-            rows = localities.rows(name_, codename_);
-            columns = localities.columns(name_, codename_);
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            pages = localities->pages(name_, codename_);
+            rows = localities->rows(name_, codename_);
+            columns = localities->columns(name_, codename_);
         }
         else
         {
@@ -232,9 +232,9 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t size = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            size = localities.dimensions(name_, codename_)[index];
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            size = localities->dimensions(name_, codename_)[index];
         }
         else
         {
@@ -255,12 +255,12 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t columns = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            quats = localities.quats(name_, codename_);
-            pages = localities.pages(name_, codename_);
-            rows = localities.rows(name_, codename_);
-            columns = localities.columns(name_, codename_);
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            quats = localities->quats(name_, codename_);
+            pages = localities->pages(name_, codename_);
+            rows = localities->rows(name_, codename_);
+            columns = localities->columns(name_, codename_);
         }
         else
         {
@@ -292,9 +292,9 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         std::int64_t size = 0;
         if (mode_ == dist_mode && arg.has_annotation())
         {
-            localities_information localities =
-                extract_localities_information(arg, name_, codename_);
-            size = localities.dimensions(name_, codename_)[index];
+            auto localities =
+                get_localities_information(arg, name_, codename_);
+            size = localities->dimensions(name_, codename_)[index];
         }
         else
         {
@@ -789,6 +789,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return flipnd(
                 extract_integer_value(std::move(arg), name_, codename_));
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return flipnd(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -841,6 +842,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return flipud(
                 extract_integer_value(std::move(arg), name_, codename_));
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return flipud(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -895,6 +897,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return fliplr(
                 extract_integer_value(std::move(arg), name_, codename_));
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return fliplr(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -959,6 +962,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         extract_integer_value(
                             std::move(arg), this_->name_, this_->codename_),
                         std::move(axis));
+                case node_data_type_float: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->flipnd(
                         extract_numeric_value(
@@ -199,6 +199,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 extract_numeric_value_strict(std::move(op), name_, codename_));
         case node_data_type_bool:
         case node_data_type_int64:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return gaussInverse2d(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -170,6 +170,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return gradient1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return gradient1d(
                 extract_numeric_value(std::move(args[0]), name_, codename_));
@@ -210,6 +211,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return gradient2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return gradient2d(
                 extract_numeric_value(std::move(args[0]), name_, codename_),
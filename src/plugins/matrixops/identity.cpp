@@ -78,6 +78,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return identity_helper<std::int64_t>(std::move(op));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -784,6 +784,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             this_->name_, this_->codename_),
                         axis);
 
+                case node_data_type_float: HPX_FALLTHROUGH;
                 case node_data_type_unknown: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->insert_nd(
@@ -132,6 +132,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return inverse0d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return inverse0d(
                 extract_numeric_value(std::move(op), name_, codename_));
@@ -158,6 +159,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_bool:
         case node_data_type_int64:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return inverse2d(extract_numeric_value(
                 std::move(op), name_, codename_));
@@ -184,6 +186,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_bool:
         case node_data_type_int64:
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return inverse3d(extract_numeric_value(
                 std::move(op), name_, codename_));
@@ -113,6 +113,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_bool:   HPX_FALLTHROUGH;
         case node_data_type_double: HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return linmatrix(nx, ny,
                 extract_scalar_numeric_value(std::move(x0), name_, codename_),
@@ -102,6 +102,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_bool:   HPX_FALLTHROUGH;
         case node_data_type_double: HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return linspace1d(
                 extract_scalar_numeric_value(std::move(start), name_, codename_),
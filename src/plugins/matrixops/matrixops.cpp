@@ -120,6 +120,10 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(slicing_operation_plugin,
     phylanx::execution_tree::primitives::slicing_operation::match_data[0]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(sort_plugin,
     phylanx::execution_tree::primitives::sort::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(sparse_operation_plugin,
+    phylanx::execution_tree::primitives::sparse_operation::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(todense_operation_plugin,
+    phylanx::execution_tree::primitives::sparse_operation::match_data[1]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(squeeze_operation_plugin,
     phylanx::execution_tree::primitives::squeeze_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(stack_operation_plugin,
@@ -292,6 +292,12 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 type, std::move(ord), std::move(axis), keepdims,
                 std::move(ctx));
 
+        case node_data_type_float:
+            return norm_helper(
+                extract_numeric_value(std::move(data), name_, codename_),
+                type, std::move(ord), std::move(axis), keepdims,
+                std::move(ctx));
+
         default:
             break;
         }
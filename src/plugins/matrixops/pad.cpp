@@ -461,14 +461,16 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                             extract_boolean_value_strict(std::move(args[3]),
                                 this_->name_,
                                 this_->codename_));
+                    case node_data_type_float:
+                        HPX_FALLTHROUGH;
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->pad_helper(
-                            extract_numeric_value_strict(std::move(args[0]),
+                            extract_numeric_value(std::move(args[0]),
                                 this_->name_, this_->codename_),
                             std::move(width),
-                            extract_numeric_value_strict(
+                            extract_numeric_value(
                                 std::move(args[3]), this_->codename_));
 
                     default:
@@ -491,11 +493,13 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                                 this_->name_, this_->codename_),
                             std::move(width),
                             ir::node_data<std::uint8_t>{0});
+                    case node_data_type_float:
+                        HPX_FALLTHROUGH;
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->pad_helper(
-                            extract_numeric_value_strict(std::move(args[0]),
+                            extract_numeric_value(std::move(args[0]),
                                 this_->name_, this_->codename_),
                             std::move(width),
                             ir::node_data<double>{0.0});
@@ -127,6 +127,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power0d(extract_numeric_value(std::move(lhs)),
@@ -158,6 +159,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power1d(extract_numeric_value(std::move(lhs)),
@@ -189,6 +191,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power2d(extract_numeric_value(std::move(lhs)),
@@ -220,6 +223,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power3d(extract_numeric_value(std::move(lhs)),
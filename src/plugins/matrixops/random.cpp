@@ -159,6 +159,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return detail::adjust_dimensions(
                 util::get<4>(val), name, codename);
 
+        case primitive_argument_type::float32_index:
+            return detail::adjust_dimensions(
+                util::get<9>(val), name, codename);
+
         case primitive_argument_type::list_index:
             {
                 std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> result{};
@@ -380,10 +384,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
     namespace detail
     {
         ///////////////////////////////////////////////////////////////////////
+        // The value of each element is a pure function of the key of the
+        // array and the (row-major) index of the element, this allows to
+        // fill the arrays in parallel.
         template <typename Dist, typename T>
         ir::node_data<T> randomize(Dist& dist, T& d)
         {
-            d = dist(util::rng_);
+            d = util::random_element(dist, util::next_random_key(), 0);
             return ir::node_data<T>{d};
         }
 
@@ -391,12 +398,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<T> randomize(
             Dist& dist, blaze::DynamicVector<T>& v)
         {
-            std::size_t const size = v.size();
+            std::uint64_t key = util::next_random_key();
 
-            for (std::size_t i = 0; i != size; ++i)
-            {
-                v[i] = dist(util::rng_);
-            }
+            util::random_for_loop(dist, key, v.size(),
+                [&](util::random_element_generator<Dist>& gen, std::size_t i)
+                {
+                    v[i] = gen(i);
+                });
 
             return ir::node_data<T>{std::move(v)};
         }
@@ -405,16 +413,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<T> randomize(
             Dist& dist, blaze::DynamicMatrix<T>& m)
         {
-            std::size_t const rows = m.rows();
+            std::uint64_t key = util::next_random_key();
             std::size_t const columns = m.columns();
 
-            for (std::size_t i = 0; i != rows; ++i)
-            {
-                for (std::size_t j = 0; j != columns; ++j)
+            util::random_for_loop(dist, key, m.rows(),
+                [&](util::random_element_generator<Dist>& gen, std::size_t i)
                 {
-                    m(i, j) = dist(util::rng_);
-                }
-            }
+                    for (std::size_t j = 0; j != columns; ++j)
+                    {
+                        m(i, j) = gen(i * columns + j);
+                    }
+                });
 
             return ir::node_data<T>{std::move(m)};
         }
@@ -423,20 +432,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<T> randomize(
             Dist& dist, blaze::DynamicTensor<T>& t)
         {
-            std::size_t const pages = t.pages();
+            std::uint64_t key = util::next_random_key();
             std::size_t const rows = t.rows();
             std::size_t const columns = t.columns();
 
-            for (std::size_t k = 0; k != pages; ++k)
-            {
-                for (std::size_t i = 0; i != rows; ++i)
+            util::random_for_loop(dist, key, t.pages() * rows,
+                [&](util::random_element_generator<Dist>& gen, std::size_t n)
                 {
+                    std::size_t k = n / rows;
+                    std::size_t i = n % rows;
                     for (std::size_t j = 0; j != columns; ++j)
                     {
-                        t(k, i, j) = dist(util::rng_);
+                        t(k, i, j) = gen(n * columns + j);
                     }
-                }
-            }
+                });
 
             return ir::node_data<T>{std::move(t)};
         }
@@ -445,24 +454,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<T> randomize(
             Dist& dist, blaze::DynamicArray<4UL, T>& q)
         {
-            std::size_t const quats = q.quats();
+            std::uint64_t key = util::next_random_key();
             std::size_t const pages = q.pages();
             std::size_t const rows  = q.rows();
             std::size_t const columns = q.columns();
 
-            for (std::size_t l = 0; l != quats; ++l)
-            {
-                for (std::size_t k = 0; k != pages; ++k)
+            util::random_for_loop(dist, key, q.quats() * pages * rows,
+                [&](util::random_element_generator<Dist>& gen, std::size_t n)
                 {
-                    for (std::size_t i = 0; i != rows; ++i)
+                    std::size_t l = n / (pages * rows);
+                    std::size_t k = (n / rows) % pages;
+                    std::size_t i = n % rows;
+                    for (std::size_t j = 0; j != columns; ++j)
                     {
-                        for (std::size_t j = 0; j != columns; ++j)
-                        {
-                            q(l, k, i, j) = dist(util::rng_);
-                        }
+                        q(l, k, i, j) = gen(n * columns + j);
                     }
-                }
-            }
+                });
 
             return ir::node_data<T>{std::move(q)};
         }
@@ -519,6 +526,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             case node_data_type_int64:
                 return convert_to<std::int64_t>(std::move(result));
 
+            case node_data_type_float: HPX_FALLTHROUGH;
             case node_data_type_unknown: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return convert_to<double>(std::move(result));
@@ -923,6 +923,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         extract_integer_value(
                             std::move(args[0]), this_->name_, this_->codename_),
                         extract_integer_value_strict(std::move(args[1])), axis);
+                case node_data_type_float: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->repeatnd(
                         extract_numeric_value(
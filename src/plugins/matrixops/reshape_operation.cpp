@@ -208,6 +208,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return reshape0d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -329,6 +330,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return reshape1d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -472,6 +474,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return reshape2d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -609,6 +612,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return reshape3d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -794,6 +798,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         return this_->flatten_nd(extract_numeric_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
 
+                    case node_data_type_float: HPX_FALLTHROUGH;
                     case node_data_type_unknown:
                         return this_->flatten_nd(extract_numeric_value(
                             std::move(arr), this_->name_, this_->codename_));
@@ -906,6 +911,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(arr), this_->name_, this_->codename_),
                             std::move(order));
 
+                    case node_data_type_float: HPX_FALLTHROUGH;
                     case node_data_type_unknown:
                         return this_->flatten_nd(
                             extract_numeric_value(
@@ -7,9 +7,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/sort_kernels.hpp>
 #include <phylanx/plugins/matrixops/sort.hpp>
-#include <phylanx/util/matrix_iterators.hpp>
-#include <phylanx/util/tensor_iterators.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -25,6 +24,7 @@
 #include <vector>
 
 #include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives
@@ -65,7 +65,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         blaze::DynamicVector<T> result(m.rows() * m.columns());
 
         std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        common::sort_values(result.data(), result.data() + result.size());
         return primitive_argument_type{std::move(result)};
     }
 
@@ -78,7 +78,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         blaze::DynamicVector<T> result(t.pages() * t.rows() * t.columns());
 
         std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        common::sort_values(result.data(), result.data() + result.size());
         return primitive_argument_type{std::move(result)};
     }
 
@@ -131,6 +131,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
                 kind);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return sort_flatten_helper(
                 extract_numeric_value(std::move(arg), name_, codename_), kind);
@@ -150,9 +151,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (axis == 0 || axis == -1)
         {
-            auto v = arg.vector();
+            // the argument may refer to the value of a variable
+            if (arg.is_ref())
+            {
+                arg = arg.vector_copy();
+            }
 
-            std::sort(v.begin(), v.begin() + v.size());
+            auto v = arg.vector();
+            common::sort_values(v.data(), v.data() + v.size());
             return primitive_argument_type{std::move(arg)};
         }
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -165,17 +171,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort2d_axis0(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        using phylanx::util::matrix_column_iterator;
-        auto m = arg.matrix();
-
-        matrix_column_iterator<decltype(m)> m_begin(m);
-        const matrix_column_iterator<decltype(m)> m_end(m, m.columns());
-
-        for (auto it = m_begin; it != m_end; ++it)
+        if (arg.is_ref())
         {
-            std::sort(it->begin(), it->end());
+            arg = arg.matrix_copy();
         }
 
+        auto m = arg.matrix();
+        common::sort_lanes<T>(m.columns(), m.rows(),
+            [&](std::size_t i) { return blaze::column(m, i); });
+
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -183,17 +187,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort2d_axis1(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        auto m = arg.matrix();
-        using phylanx::util::matrix_row_iterator;
-
-        matrix_row_iterator<decltype(m)> m_begin(m);
-        const matrix_row_iterator<decltype(m)> m_end(m, m.rows());
-
-        for (auto it = m_begin; it != m_end; ++it)
+        if (arg.is_ref())
         {
-            std::sort(it->begin(), it->end());
+            arg = arg.matrix_copy();
         }
 
+        auto m = arg.matrix();
+        common::sort_lanes<T>(m.rows(), m.columns(),
+            [&](std::size_t i) { return blaze::row(m, i); });
+
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -225,19 +227,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort3d_axis0(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        using phylanx::util::matrix_row_iterator;
-        auto t = arg.tensor();
-
-        for (std::size_t i = 0; i != t.rows(); ++i)
+        if (arg.is_ref())
         {
-            auto slice = blaze::rowslice(t, i);
-            matrix_row_iterator<decltype(slice)> const a_begin(slice);
-            matrix_row_iterator<decltype(slice)> const a_end(
-                slice, slice.rows());
-
-            for (auto it = a_begin; it != a_end; ++it)
-                std::sort(it->begin(), it->end());
+            arg = arg.tensor_copy();
         }
+
+        // the lanes are the rows of the row slices
+        auto t = arg.tensor();
+        std::size_t const columns = t.columns();
+        common::sort_lanes<T>(t.rows() * columns, t.pages(),
+            [&](std::size_t i) {
+                return blaze::row(blaze::rowslice(t, i / columns),
+                    i % columns);
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -245,19 +247,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort3d_axis1(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        using phylanx::util::matrix_row_iterator;
-        auto t = arg.tensor();
-
-        for (std::size_t i = 0; i != t.columns(); ++i)
+        if (arg.is_ref())
         {
-            auto slice = blaze::columnslice(t, i);
-            matrix_row_iterator<decltype(slice)> const a_begin(slice);
-            matrix_row_iterator<decltype(slice)> const a_end(
-                slice, slice.rows());
-
-            for (auto it = a_begin; it != a_end; ++it)
-                std::sort(it->begin(), it->end());
+            arg = arg.tensor_copy();
         }
+
+        // the lanes are the rows of the column slices
+        auto t = arg.tensor();
+        std::size_t const pages = t.pages();
+        common::sort_lanes<T>(t.columns() * pages, t.rows(),
+            [&](std::size_t i) {
+                return blaze::row(blaze::columnslice(t, i / pages),
+                    i % pages);
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -265,19 +267,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort3d_axis2(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        using phylanx::util::matrix_column_iterator;
-        auto t = arg.tensor();
-
-        for (std::size_t i = 0; i != t.rows(); ++i)
+        if (arg.is_ref())
         {
-            auto slice = blaze::rowslice(t, i);
-            matrix_column_iterator<decltype(slice)> const a_begin(slice);
-            matrix_column_iterator<decltype(slice)> const a_end(
-                slice, slice.columns());
-
-            for (auto it = a_begin; it != a_end; ++it)
-                std::sort(it->begin(), it->end());
+            arg = arg.tensor_copy();
         }
+
+        // the lanes are the rows of the page slices
+        auto t = arg.tensor();
+        std::size_t const rows = t.rows();
+        common::sort_lanes<T>(t.pages() * rows, t.columns(),
+            [&](std::size_t i) {
+                return blaze::row(blaze::pageslice(t, i / rows), i % rows);
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -395,6 +396,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[0]), this_->name_, this_->codename_),
                         axis, kind);
 
+                case node_data_type_float: HPX_FALLTHROUGH;
                 case node_data_type_unknown:
                     return this_->sort_helper(
                         extract_numeric_value(
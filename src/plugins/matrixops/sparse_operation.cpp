@@ -0,0 +1,100 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/sparse_operations.hpp>
+#include <phylanx/plugins/matrixops/sparse_operation.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const sparse_operation::match_data =
+    {
+        match_pattern_type{"sparse",
+        std::vector<std::string>{"sparse(_1)"},
+        &create_sparse_operation, &create_primitive<sparse_operation>,
+        R"(a
+        Args:
+
+            a (array) : a vector or a matrix
+
+        Returns:
+
+        The sparse (compressed) representation of the given vector or
+        matrix, only the non-zero elements are stored.)"},
+
+        match_pattern_type{"todense",
+        std::vector<std::string>{"todense(_1)"},
+        &create_todense_operation, &create_primitive<sparse_operation>,
+        R"(a
+        Args:
+
+            a (array) : a (sparse) vector or matrix
+
+        Returns:
+
+        The dense representation of the given vector or matrix.)"}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    sparse_operation::sparse_operation(primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , to_sparse_(name_.find("todense") == std::string::npos)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> sparse_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_operation::eval",
+                generate_error_message(
+                    "the sparse/todense primitives require exactly one "
+                    "operand"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_operation::eval",
+                generate_error_message(
+                    "the sparse/todense primitives require that the "
+                    "arguments given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return value_operand(
+                operands[0], args, name_, codename_, std::move(ctx))
+            .then(hpx::launch::sync,
+                [this_ = std::move(this_)](
+                        hpx::future<primitive_argument_type> && arg)
+                -> primitive_argument_type
+                {
+                    if (this_->to_sparse_)
+                    {
+                        return common::to_sparse(
+                            arg.get(), this_->name_, this_->codename_);
+                    }
+                    return common::to_dense(
+                        arg.get(), this_->name_, this_->codename_);
+                });
+    }
+}}}
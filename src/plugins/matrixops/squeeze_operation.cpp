@@ -104,6 +104,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return squeeze1d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return squeeze1d(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -215,6 +216,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return squeeze2d(
                 extract_numeric_value(std::move(arg), name_, codename_), axis);
@@ -379,6 +381,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return squeeze3d(
                 extract_numeric_value(std::move(arg), name_, codename_), axis);
@@ -637,6 +640,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return squeeze4d(
                 extract_numeric_value(std::move(arg), name_, codename_), axis);
@@ -327,6 +327,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return hstack0d1d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack0d1d_helper<double>(std::move(args));
@@ -431,6 +432,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return hstack2d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack2d_helper<double>(std::move(args));
@@ -549,6 +551,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return hstack3d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack3d_helper<double>(std::move(args));
@@ -624,6 +627,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return vstack0d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack0d_helper<double>(std::move(args));
@@ -762,6 +766,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return vstack1d2d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack1d2d_helper<double>(std::move(args));
@@ -880,6 +885,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return vstack3d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack3d_helper<double>(std::move(args));
@@ -955,6 +961,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return dstack0d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack0d_helper<double>(std::move(args));
@@ -1060,6 +1067,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return dstack1d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack1d_helper<double>(std::move(args));
@@ -1197,6 +1205,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return dstack2d3d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack2d3d_helper<double>(std::move(args));
@@ -1339,6 +1348,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return stack1d_axis1_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -1494,6 +1505,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return stack2d_axis0_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -1619,6 +1632,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return stack2d_axis1_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -1753,6 +1768,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return stack3d_axis1_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -1840,6 +1857,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return stack3d_axis2_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float:
+            HPX_FALLTHROUGH;
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -166,6 +166,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return tile0d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -294,6 +295,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return tile1d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -422,6 +424,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return tile2d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -548,6 +551,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return tile3d(
                 extract_numeric_value(std::move(arr), name_, codename_),
@@ -8,8 +8,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/sort_kernels.hpp>
 #include <phylanx/plugins/matrixops/unique.hpp>
-#include <phylanx/util/matrix_iterators.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -25,23 +25,41 @@
 #include <vector>
 
 #include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives
 {
     ///////////////////////////////////////////////////////////////////////////
-    match_pattern_type const unique::match_data = {hpx::make_tuple(
-        "unique", std::vector<std::string>{"unique(_1)", "unique(_1, _2)"},
+    match_pattern_type const unique::match_data = {hpx::make_tuple("unique",
+        std::vector<std::string>{R"(
+            unique(
+                _1,
+                __arg(_2_axis, nil),
+                __arg(_3_return_index, false),
+                __arg(_4_return_inverse, false),
+                __arg(_5_return_counts, false)
+            )
+        )"},
         &create_unique, &create_primitive<unique>, R"(
-            a, axis
+            a, axis, return_index, return_inverse, return_counts
             Args:
 
                 a (array_like) : input array
-                axis (optional, int): which axis of a to use
+                axis (optional, int): which axis of a to use, the flattened
+                    array is used if not given
+                return_index (optional, bool): also return the indices of
+                    the first occurrences of the unique elements
+                return_inverse (optional, bool): also return the indices of
+                    the unique elements that reconstruct a
+                return_counts (optional, bool): also return the number of
+                    occurrences of each of the unique elements
 
             Returns:
 
-            The sorted unique elements of an array."
+            The sorted unique elements of an array. If any of the optional
+            results was requested, a list of the unique elements followed by
+            the requested results (in the order of the arguments).
             )")};
 
     ///////////////////////////////////////////////////////////////////////////
@@ -52,290 +70,226 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename T>
-    primitive_argument_type unique::unique0d(ir::node_data<T> && arg) const
+    namespace detail
     {
-        blaze::DynamicVector<T> result(1UL, arg.scalar());
-        return primitive_argument_type{std::move(result)};
-    }
-
-    primitive_argument_type unique::unique0d(primitive_arguments_type && args)
-        const
-    {
-        std::size_t numargs = args.size();
-        if (numargs == 2)
-        {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::unique::unique0d",
-                generate_error_message("invalid axis specified for unique"));
-        }
-
-        switch (extract_common_type(args[0]))
+        primitive_argument_type unique_result(primitive_argument_type&& values,
+            common::unique_groups&& groups, bool return_index,
+            bool return_inverse, bool return_counts)
         {
-        case node_data_type_bool:
-            return unique0d(extract_boolean_value_strict(
-                std::move(args[0]), name_, codename_));
-
-        case node_data_type_int64:
-            return unique0d(extract_integer_value_strict(
-                std::move(args[0]), name_, codename_));
-
-        case node_data_type_double:
-            return unique0d(extract_numeric_value_strict(
-                std::move(args[0]), name_, codename_));
+            if (!return_index && !return_inverse && !return_counts)
+            {
+                return std::move(values);
+            }
 
-        case node_data_type_unknown:
-            return unique0d(
-                extract_numeric_value(std::move(args[0]), name_, codename_));
+            primitive_arguments_type result;
+            result.reserve(4);
 
-        default:
-            break;
+            result.push_back(std::move(values));
+            if (return_index)
+            {
+                result.push_back(
+                    primitive_argument_type{std::move(groups.indices_)});
+            }
+            if (return_inverse)
+            {
+                result.push_back(
+                    primitive_argument_type{std::move(groups.inverse_)});
+            }
+            if (return_counts)
+            {
+                result.push_back(
+                    primitive_argument_type{std::move(groups.counts_)});
+            }
+            return primitive_argument_type{std::move(result)};
         }
-
-        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::primitives::unique::unique0d",
-            generate_error_message(
-                "the unique primitive requires for all arguments to "
-                "be numeric data types"));
     }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
-    primitive_argument_type unique::unique1d(ir::node_data<T> && arg) const
+    primitive_argument_type unique::unique_flatten(
+        ir::node_data<T>&& arg, unique_options const& options) const
     {
-        blaze::DynamicVector<T> a = arg.vector();
-        // Sorting the vector
-        std::sort(a.begin(), a.end());
-
-        // Use std::unique to remove duplicacy
-        auto ip = std::unique(a.begin(), a.end());
+        common::unique_groups groups;
+        common::unique_groups* pgroups = options.any() ? &groups : nullptr;
 
-        // Resizing the vector to remove undifined elements
-        a.resize(std::distance(a.begin(), ip));
+        blaze::DynamicVector<T> result;
+        switch (arg.num_dimensions())
+        {
+        case 0:
+            result = blaze::DynamicVector<T>(1UL, arg.scalar());
+            groups.indices_ = blaze::DynamicVector<std::int64_t>(1UL, 0);
+            groups.inverse_ = blaze::DynamicVector<std::int64_t>(1UL, 0);
+            groups.counts_ = blaze::DynamicVector<std::int64_t>(1UL, 1);
+            break;
 
-        return primitive_argument_type{std::move(a)};
-    }
+        case 1:
+            result = common::unique_values<T>(arg.vector(), pgroups);
+            break;
 
-    primitive_argument_type unique::unique1d(primitive_arguments_type && args)
-        const
-    {
-        std::int64_t axis = 0;
-        std::size_t numargs = args.size();
-        if (numargs == 2)
-        {
-            axis = extract_scalar_integer_value(args[1], name_, codename_);
-            if (axis < -1 || axis > 0)
+        case 2:
             {
-                HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                    "phylanx::execution_tree::primitives::argmax::argmax1d",
-                    generate_error_message(
-                        "operand axis can only between -1 and 0 for "
-                        "an a operand that is 1d"));
+                auto m = arg.matrix();
+                result = common::unique_values<T>(blaze::ravel(m), pgroups);
             }
-        }
-
-        switch (extract_common_type(args[0]))
-        {
-        case node_data_type_bool:
-            return unique1d(extract_boolean_value_strict(
-                std::move(args[0]), name_, codename_));
-
-        case node_data_type_int64:
-            return unique1d(extract_integer_value_strict(
-                std::move(args[0]), name_, codename_));
-
-        case node_data_type_double:
-            return unique1d(extract_numeric_value_strict(
-                std::move(args[0]), name_, codename_));
+            break;
 
-        case node_data_type_unknown:
-            return unique1d(
-                extract_numeric_value(std::move(args[0]), name_, codename_));
+        case 3:
+            {
+                auto t = arg.tensor();
+                result = common::unique_values<T>(blaze::ravel(t), pgroups);
+            }
+            break;
 
         default:
-            break;
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unique::unique_flatten",
+                generate_error_message(
+                    "operand a has an invalid number of dimensions"));
         }
 
-        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::primitives::unique::unique1d",
-            generate_error_message(
-                "the arange primitive requires for all arguments to "
-                "be numeric data types"));
+        return detail::unique_result(primitive_argument_type{std::move(result)},
+            std::move(groups), options.return_index_, options.return_inverse_,
+            options.return_counts_);
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename T>
-    primitive_argument_type unique::unique2d_flatten(
-        ir::node_data<T>&& arg) const
-    {
-        using phylanx::util::matrix_row_iterator;
-        auto a = arg.matrix();
-
-        const matrix_row_iterator<decltype(a)> a_begin(a);
-        const matrix_row_iterator<decltype(a)> a_end(a, a.rows());
-
-        blaze::DynamicVector<double> result(a.rows() * a.columns());
-        auto d = result.data();
-
-        for (auto it = a_begin; it != a_end; ++it)
-        {
-            d = std::copy(it->begin(), it->end(), d);
-        }
-
-        // Sorting the vector
-        std::sort(result.begin(), result.end());
-
-        // Use std::unique to remove duplicacy
-        auto ip = std::unique(result.begin(), result.end());
-
-        // Resizing the vector to remove undifined elements
-        result.resize(std::distance(result.begin(), ip));
-
-        return primitive_argument_type{std::move(result)};
-    }
-
     template <typename T>
     primitive_argument_type unique::unique2d_x_axis(
-        ir::node_data<T>&& arg) const
+        ir::node_data<T>&& arg, unique_options const& options) const
     {
         auto a = arg.matrix();
 
-        using phylanx::util::matrix_row_iterator;
-        matrix_row_iterator<decltype(a)> a_begin(a);
-
-        blaze::DynamicMatrix<T> result(a.rows(), a.columns());
+        common::unique_groups groups;
+        std::vector<std::int64_t> rows = common::unique_lanes(a.rows(),
+            a.columns(), [&](std::size_t i) { return blaze::row(a, i); },
+            options.any() ? &groups : nullptr);
 
-        std::vector<matrix_row_iterator<decltype(a)>> indices(
-            a.rows(), a_begin);
-        std::iota(indices.begin(), indices.end(), a_begin);
-
-        std::sort(indices.begin(), indices.end(),
-            [&](const auto& lhs, const auto& rhs) {
-                return std::lexicographical_compare(
-                    lhs->begin(), lhs->end(), rhs->begin(), rhs->end());
-            });
-
-        for (size_t i = 0; i < a.rows(); i++)
+        blaze::DynamicMatrix<T> result(rows.size(), a.columns());
+        for (std::size_t i = 0; i != rows.size(); ++i)
         {
-            blaze::row(result, i) = *(indices[i]);
+            blaze::row(result, i) = blaze::row(a, rows[i]);
         }
 
-        return primitive_argument_type{std::move(result)};
+        return detail::unique_result(primitive_argument_type{std::move(result)},
+            std::move(groups), options.return_index_, options.return_inverse_,
+            options.return_counts_);
     }
 
     template <typename T>
     primitive_argument_type unique::unique2d_y_axis(
-        ir::node_data<T>&& arg) const
+        ir::node_data<T>&& arg, unique_options const& options) const
     {
         auto a = arg.matrix();
 
-        using phylanx::util::matrix_column_iterator;
-        matrix_column_iterator<decltype(a)> a_begin(a);
-
-        blaze::DynamicMatrix<T> result(a.rows(), a.columns());
-
-        std::vector<matrix_column_iterator<decltype(a)>> indices(
-            a.columns(), a_begin);
-        std::iota(indices.begin(), indices.end(), a_begin);
+        common::unique_groups groups;
+        std::vector<std::int64_t> columns = common::unique_lanes(a.columns(),
+            a.rows(), [&](std::size_t i) { return blaze::column(a, i); },
+            options.any() ? &groups : nullptr);
 
-        std::sort(indices.begin(), indices.end(),
-            [&](const auto& lhs, const auto& rhs) {
-                return std::lexicographical_compare(
-                    lhs->begin(), lhs->end(), rhs->begin(), rhs->end());
-            });
-
-        for (size_t i = 0; i < a.columns(); i++)
+        blaze::DynamicMatrix<T> result(a.rows(), columns.size());
+        for (std::size_t i = 0; i != columns.size(); ++i)
         {
-            blaze::column(result, i) = *(indices[i]);
+            blaze::column(result, i) = blaze::column(a, columns[i]);
         }
 
-        return primitive_argument_type{std::move(result)};
+        return detail::unique_result(primitive_argument_type{std::move(result)},
+            std::move(groups), options.return_index_, options.return_inverse_,
+            options.return_counts_);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
     template <typename T>
-    primitive_argument_type unique::unique2d(
-        std::size_t numargs, ir::node_data<T>&& arg, std::int64_t axis) const
+    primitive_argument_type unique::unique_helper(ir::node_data<T>&& arg,
+        std::int64_t axis, bool has_axis, unique_options const& options) const
     {
-        // m should not be empty
-        auto m = arg.matrix();
-
-        // `axis` is optional
-        if (numargs == 1)
+        std::size_t dims = arg.num_dimensions();
+        if (!has_axis)
         {
-            // Option 1: Flatten and find max
-            return unique2d_flatten(std::move(arg));
+            return unique_flatten(std::move(arg), options);
         }
 
-        // `axis` can only be -2, -1, 0, or 1
-        if (axis < -2 || axis > 1)
+        switch (dims)
         {
+        case 0:
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "unique::unique2d",
-                generate_error_message(
-                    "operand axis can only between -2 and 1 for an an "
-                    "operand that is 2d"));
-        }
+                "unique::unique_helper",
+                generate_error_message("invalid axis specified for unique"));
 
-        switch (axis)
-        {
-        case -2:
-            HPX_FALLTHROUGH;
-        case 0:
-            return unique2d_x_axis(std::move(arg));
-        case -1:
-            HPX_FALLTHROUGH;
         case 1:
-            return unique2d_y_axis(std::move(arg));
+            if (axis < -1 || axis > 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "unique::unique_helper",
+                    generate_error_message(
+                        "operand axis can only between -1 and 0 for "
+                        "an a operand that is 1d"));
+            }
+            return unique_flatten(std::move(arg), options);
 
-        default:
+        case 2:
+            switch (axis)
+            {
+            case -2:
+                HPX_FALLTHROUGH;
+            case 0:
+                return unique2d_x_axis(std::move(arg), options);
+            case -1:
+                HPX_FALLTHROUGH;
+            case 1:
+                return unique2d_y_axis(std::move(arg), options);
+
+            default:
+                break;
+            }
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "unique::unique2d",
+                "unique::unique_helper",
                 generate_error_message(
-                    "operand has an invalid value for the axis parameter"));
+                    "operand axis can only between -2 and 1 for an an "
+                    "operand that is 2d"));
+
+        default:
+            break;
         }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "unique::unique_helper",
+            generate_error_message(
+                "the unique primitive supports the axis argument only for "
+                "operands with up to two dimensions"));
     }
 
-    primitive_argument_type unique::unique2d(
-        primitive_arguments_type&& args) const
+    primitive_argument_type unique::unique_helper(primitive_argument_type&& arg,
+        std::int64_t axis, bool has_axis, unique_options const& options) const
     {
-        std::int64_t axis = -1;
-        std::size_t numargs = args.size();
-        if (numargs == 2)
-        {
-            axis = extract_scalar_integer_value(args[1], name_, codename_);
-        }
-
-        switch (extract_common_type(args[0]))
+        switch (extract_common_type(arg))
         {
         case node_data_type_bool:
-            return unique2d(numargs,
-                extract_boolean_value_strict(
-                    std::move(args[0]), name_, codename_),
-                axis);
+            return unique_helper(
+                extract_boolean_value_strict(std::move(arg), name_, codename_),
+                axis, has_axis, options);
 
         case node_data_type_int64:
-            return unique2d(numargs,
-                extract_integer_value_strict(
-                    std::move(args[0]), name_, codename_),
-                axis);
+            return unique_helper(
+                extract_integer_value_strict(std::move(arg), name_, codename_),
+                axis, has_axis, options);
 
         case node_data_type_double:
-            return unique2d(numargs,
-                extract_numeric_value_strict(
-                    std::move(args[0]), name_, codename_),
-                axis);
+            return unique_helper(
+                extract_numeric_value_strict(std::move(arg), name_, codename_),
+                axis, has_axis, options);
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_unknown:
-            return unique2d(numargs,
-                extract_numeric_value(std::move(args[0]), name_, codename_),
-                axis);
+            return unique_helper(
+                extract_numeric_value(std::move(arg), name_, codename_), axis,
+                has_axis, options);
 
         default:
             break;
         }
 
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::primitives::unique::unique2d",
+            "phylanx::execution_tree::primitives::unique::unique_helper",
             generate_error_message(
                 "the unique primitive requires for all arguments to "
                 "be numeric data types"));
@@ -346,24 +300,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
     {
-        if (operands.empty() || operands.size() > 2)
+        if (operands.empty() || operands.size() > 5)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "unique::eval",
-                generate_error_message("the unique primitive requires exactly "
-                                       "one or two operands"));
+                generate_error_message("the unique primitive requires "
+                                       "between one and five operands"));
         }
 
-        for (auto const& i : operands)
+        if (!valid(operands[0]))
         {
-            if (!valid(i))
-            {
-                HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                    "unique::eval",
-                    generate_error_message(
-                        "the unique primitive requires that the "
-                        "arguments given by the operands array are valid"));
-            }
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "unique::eval",
+                generate_error_message(
+                    "the unique primitive requires that the "
+                    "arguments given by the operands array are valid"));
         }
 
         auto this_ = this->shared_from_this();
@@ -371,25 +322,34 @@ namespace phylanx { namespace execution_tree { namespace primitives
             hpx::util::unwrapping([this_ = std::move(this_)](
                                       primitive_arguments_type&& args)
                                       -> primitive_argument_type {
-                std::size_t a_dims = extract_numeric_value_dimension(
-                    args[0], this_->name_, this_->codename_);
-                switch (a_dims)
+                std::int64_t axis = 0;
+                bool has_axis = false;
+                if (args.size() > 1 && valid(args[1]))
                 {
-                case 0:
-                    return this_->unique0d(std::move(args));
-
-                case 1:
-                    return this_->unique1d(std::move(args));
-
-                case 2:
-                    return this_->unique2d(std::move(args));
+                    axis = extract_scalar_integer_value(
+                        args[1], this_->name_, this_->codename_);
+                    has_axis = true;
+                }
 
-                default:
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "unique::eval",
-                        this_->generate_error_message(
-                            "operand a has an invalid number of dimensions"));
+                unique_options options;
+                if (args.size() > 2 && valid(args[2]))
+                {
+                    options.return_index_ = extract_scalar_boolean_value(
+                        args[2], this_->name_, this_->codename_);
+                }
+                if (args.size() > 3 && valid(args[3]))
+                {
+                    options.return_inverse_ = extract_scalar_boolean_value(
+                        args[3], this_->name_, this_->codename_);
+                }
+                if (args.size() > 4 && valid(args[4]))
+                {
+                    options.return_counts_ = extract_scalar_boolean_value(
+                        args[4], this_->name_, this_->codename_);
                 }
+
+                return this_->unique_helper(
+                    std::move(args[0]), axis, has_axis, options);
             }),
             detail::map_operands(operands, functional::value_operand{}, args,
                 name_, codename_, std::move(ctx)));
@@ -193,6 +193,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_int64:
             return vsplit2d_helper<std::int64_t>(std::move(args));
 
+        case node_data_type_float: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vsplit2d_helper<double>(std::move(args));
 
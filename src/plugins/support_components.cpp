@@ -20,14 +20,17 @@ using std_int64_t = std::int64_t;
 using std_uint8_t = std::uint8_t;
 
 REGISTER_DISTRIBUTED_VECTOR(double);
+REGISTER_DISTRIBUTED_VECTOR(float);
 REGISTER_DISTRIBUTED_VECTOR(std_int64_t);
 REGISTER_DISTRIBUTED_VECTOR(std_uint8_t);
 
 REGISTER_DISTRIBUTED_MATRIX(double);
+REGISTER_DISTRIBUTED_MATRIX(float);
 REGISTER_DISTRIBUTED_MATRIX(std_int64_t);
 REGISTER_DISTRIBUTED_MATRIX(std_uint8_t);
 
 REGISTER_DISTRIBUTED_TENSOR(double);
+REGISTER_DISTRIBUTED_TENSOR(float);
 REGISTER_DISTRIBUTED_TENSOR(std_int64_t);
 REGISTER_DISTRIBUTED_TENSOR(std_uint8_t);
 
@@ -274,8 +274,9 @@ namespace phylanx { namespace util {
         std::vector<std::string> const& primitive_instances,
         hpx::naming::id_type const& locality_id)
     {
-        std::vector<std::string> const counter_names{
-            "count/eval", "time/eval", "eval_direct", "transferred_bytes"};
+        std::vector<std::string> const counter_names{"count/eval",
+            "time/eval", "eval_direct", "transferred_bytes", "copied_bytes",
+            "moved_bytes", "reused_bytes"};
 
         return retrieve_counter_data(
             primitive_instances, counter_names, locality_id);
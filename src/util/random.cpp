@@ -6,6 +6,7 @@
 
 #include <phylanx/util/random.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <random>
 
@@ -22,10 +23,26 @@ namespace phylanx { namespace util
 
     std::mt19937 rng_{default_seed()};    // The Mersenne twister generator.
 
+    namespace detail
+    {
+        // seed and number of keys handed out for the counter based generator
+        static std::atomic<std::uint32_t> key_seed(default_seed());
+        static std::atomic<std::uint32_t> key_count(0);
+    }
+
     void set_seed(std::uint32_t seed)
     {
         seed_ = seed;
         rng_.seed(seed_);
+
+        detail::key_seed = seed;
+        detail::key_count = 0;
+    }
+
+    std::uint64_t next_random_key()
+    {
+        return (std::uint64_t(detail::key_seed.load()) << 32) |
+            std::uint64_t(detail::key_count++);
     }
 
     std::uint32_t get_seed()
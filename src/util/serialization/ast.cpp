@@ -51,6 +51,11 @@ namespace phylanx { namespace util
         return detail::serialize(ast);
     }
 
+    std::vector<char> serialize(ir::node_data<float> const& ast)
+    {
+        return detail::serialize(ast);
+    }
+
     std::vector<char> serialize(ast::nil ast)
     {
         return std::vector<char>{};
@@ -122,6 +127,12 @@ namespace phylanx { namespace util
             detail::unserialize_helper(input, ast);
         }
 
+        void unserialize(
+            std::vector<char> const& input, ir::node_data<float>& ast)
+        {
+            detail::unserialize_helper(input, ast);
+        }
+
         void unserialize(
             std::vector<char> const& input, ir::node_data<std::int64_t>& ast)
         {
@@ -0,0 +1,560 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Benchmarks for the primitives of all plugin families, run for a range of
+// shapes and data types. The results (timings, throughput, number of tasks
+// and of node_data copies/moves) are printed and can be written to a JSON
+// file. A previously written JSON file can be given as a baseline, the
+// benchmark fails if any of the results regresses beyond the given threshold.
+//
+// The distributed benchmarks use all localities the application was started
+// on, for instance:
+//
+//      phylanxrun.py primitive_benchmarks_test -l 2 -- --filter=dist_
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Generate the (random) inputs for the benchmarks, cols == 0 creates vectors
+std::string const make_input_code = R"(
+    define(make_input, rows, cols, dtype,
+        if(cols == 0,
+            astype(random(rows, "uniform") * 100.0, dtype),
+            astype(random(list(rows, cols), "uniform") * 100.0, dtype)
+        )
+    )
+    make_input
+)";
+
+std::string const make_input_d_code = R"(
+    define(make_input_d, rows, cols, name,
+        if(cols == 0,
+            random_d(list(rows), find_here(), num_localities(), name),
+            random_d(list(rows, cols), find_here(), num_localities(), name)
+        )
+    )
+    make_input_d
+)";
+
+///////////////////////////////////////////////////////////////////////////////
+// Each benchmark defines a function 'run(a, b)' operating on two inputs of the
+// same shape. The shape is either (n) or (n, n), elements(n) is the number of
+// elements read or written and flops(n) the number of arithmetic operations
+// performed by a single invocation.
+struct benchmark_case
+{
+    char const* family;
+    char const* name;
+    char const* code;
+    bool matrix;
+    bool distributed;
+    std::vector<char const*> dtypes;
+    double (*elements)(double n);
+    double (*flops)(double n);
+};
+
+std::vector<char const*> const all_dtypes = {"float64", "int64"};
+
+// clang-format off
+std::vector<benchmark_case> const benchmark_cases = {
+    // arithmetics
+    {"arithmetics", "add",
+        "define(run, a, b, a + b) run", false, false, all_dtypes,
+        [](double n) { return 3 * n; }, [](double n) { return n; }},
+    {"arithmetics", "daxpy",
+        "define(run, a, b, b + a * 3) run", false, false, all_dtypes,
+        [](double n) { return 3 * n; }, [](double n) { return 2 * n; }},
+    {"arithmetics", "add_2d",
+        "define(run, a, b, a + b) run", true, false, all_dtypes,
+        [](double n) { return 3 * n * n; }, [](double n) { return n * n; }},
+
+    // matrixops
+    {"matrixops", "dot_1d",
+        "define(run, a, b, dot(a, b)) run", false, false, all_dtypes,
+        [](double n) { return 2 * n; }, [](double n) { return 2 * n; }},
+    {"matrixops", "dot_2d",
+        "define(run, a, b, dot(a, b)) run", true, false, all_dtypes,
+        [](double n) { return 3 * n * n; },
+        [](double n) { return 2 * n * n * n; }},
+    {"matrixops", "transpose",
+        "define(run, a, b, transpose(a)) run", true, false, all_dtypes,
+        [](double n) { return 2 * n * n; }, [](double n) { return 0.0; }},
+    {"matrixops", "sort",
+        "define(run, a, b, sort(a)) run", false, false, all_dtypes,
+        [](double n) { return 2 * n; }, [](double n) { return 0.0; }},
+
+    // statistics
+    {"statistics", "sum",
+        "define(run, a, b, sum(a)) run", false, false, all_dtypes,
+        [](double n) { return n; }, [](double n) { return n; }},
+    {"statistics", "mean_axis0",
+        "define(run, a, b, mean(a, 0)) run", true, false, all_dtypes,
+        [](double n) { return n * n + n; }, [](double n) { return n * n; }},
+    {"statistics", "var",
+        "define(run, a, b, var(a)) run", false, false, all_dtypes,
+        [](double n) { return n; }, [](double n) { return 4 * n; }},
+
+    // keras_support
+    {"keras_support", "relu",
+        "define(run, a, b, relu(a)) run", false, false, {"float64"},
+        [](double n) { return 2 * n; }, [](double n) { return n; }},
+    {"keras_support", "sigmoid",
+        "define(run, a, b, sigmoid(a)) run", false, false, {"float64"},
+        [](double n) { return 2 * n; }, [](double n) { return 3 * n; }},
+    {"keras_support", "softmax",
+        "define(run, a, b, softmax(a)) run", true, false, {"float64"},
+        [](double n) { return 2 * n * n; },
+        [](double n) { return 3 * n * n; }},
+
+    // controls: overheads of evaluating a function for each element
+    {"controls", "for_each", R"(
+        define(run, a, b, block(
+            define(s, 0.0),
+            for_each(lambda(i, store(s, s + slice(a, i))), range(shape(a, 0))),
+            s
+        ))
+        run
+    )", false, false, {"float64"},
+        [](double n) { return n; }, [](double n) { return n; }},
+    {"controls", "fold_left",
+        "define(run, a, b, fold_left(lambda(x, y, x + y), 0.0, a)) run",
+        false, false, {"float64"},
+        [](double n) { return n; }, [](double n) { return n; }},
+
+    // fileio: round trip through a CSV file
+    {"fileio", "csv_write_read", R"(
+        define(run, a, b, block(
+            file_write_csv("{file}", a),
+            file_read_csv("{file}")
+        ))
+        run
+    )", true, false, {"float64"},
+        [](double n) { return 2 * n * n; }, [](double n) { return 0.0; }},
+
+    // dist_matrixops and dist_statistics, the inputs are tiled over all
+    // localities
+    {"dist_matrixops", "dot_d_1d",
+        "define(run, a, b, dot_d(a, b)) run", false, true, {"float64"},
+        [](double n) { return 2 * n; }, [](double n) { return 2 * n; }},
+    {"dist_matrixops", "transpose_d",
+        "define(run, a, b, transpose_d(a)) run", true, true, {"float64"},
+        [](double n) { return 2 * n * n; }, [](double n) { return 0.0; }},
+    {"dist_matrixops", "sort_d",
+        "define(run, a, b, sort_d(a)) run", false, true, {"float64"},
+        [](double n) { return 2 * n; }, [](double n) { return 0.0; }},
+    {"dist_statistics", "sum_d",
+        "define(run, a, b, sum_d(a)) run", false, true, {"float64"},
+        [](double n) { return n; }, [](double n) { return n; }},
+};
+// clang-format on
+
+///////////////////////////////////////////////////////////////////////////////
+struct benchmark_result
+{
+    std::string family;
+    std::string name;
+    std::vector<std::int64_t> shape;
+    std::string dtype;
+
+    double time_median = 0.0;       // [s]
+    double time_min = 0.0;          // [s]
+    double gbytes_per_second = 0.0;
+    double gflops_per_second = 0.0;
+    std::int64_t tasks = 0;         // per invocation
+    std::int64_t copies = 0;        // node_data copies per invocation
+    std::int64_t moves = 0;         // node_data moves per invocation
+
+    std::string key() const
+    {
+        std::string result = family + "/" + name + "/";
+        for (std::size_t i = 0; i != shape.size(); ++i)
+        {
+            if (i != 0)
+            {
+                result += "x";
+            }
+            result += std::to_string(shape[i]);
+        }
+        return result + "/" + dtype;
+    }
+
+    // name usable for the compiled code and for distributed arrays
+    std::string id() const
+    {
+        std::string result = key();
+        std::replace(result.begin(), result.end(), '/', '_');
+        return result;
+    }
+};
+
+std::size_t dtype_size(std::string const& dtype)
+{
+    return dtype == "bool" ? 1 : 8;
+}
+
+std::string replace_all(
+    std::string code, std::string const& what, std::string const& with)
+{
+    std::size_t pos = 0;
+    while ((pos = code.find(what, pos)) != std::string::npos)
+    {
+        code.replace(pos, what.size(), with);
+        pos += with.size();
+    }
+    return code;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of HPX threads executed on this locality so far
+class task_counter
+{
+public:
+    task_counter()
+      : counter_("/threads{locality#" + std::to_string(hpx::get_locality_id()) +
+            "/total}/count/cumulative")
+    {
+    }
+
+    std::int64_t reset()
+    {
+        return counter_.get_value<std::int64_t>(hpx::launch::sync, true);
+    }
+
+private:
+    hpx::performance_counters::performance_counter counter_;
+};
+
+std::int64_t node_data_copies(bool reset)
+{
+    return phylanx::ir::node_data<double>::copy_construction_count(reset) +
+        phylanx::ir::node_data<double>::copy_assignment_count(reset);
+}
+
+std::int64_t node_data_moves(bool reset)
+{
+    return phylanx::ir::node_data<double>::move_construction_count(reset) +
+        phylanx::ir::node_data<double>::move_assignment_count(reset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+benchmark_result run_benchmark(benchmark_case const& bc, std::int64_t n,
+    std::string const& dtype, hpx::program_options::variables_map& vm,
+    phylanx::execution_tree::compiler::function_list& snippets,
+    task_counter& tasks)
+{
+    using namespace phylanx::execution_tree;
+
+    std::int64_t const repetitions = vm["repetitions"].as<std::int64_t>();
+    std::int64_t const cols = bc.matrix ? n : 0;
+
+    benchmark_result result;
+    result.family = bc.family;
+    result.name = bc.name;
+    result.shape = bc.matrix ? std::vector<std::int64_t>{n, n} :
+                               std::vector<std::int64_t>{n};
+    result.dtype = dtype;
+
+    // create the inputs, the distributed arrays are given unique names
+    primitive_argument_type a, b;
+    if (bc.distributed)
+    {
+        a = make_input(n, cols, "benchmark_" + result.id() + "_a");
+        b = make_input(n, cols, "benchmark_" + result.id() + "_b");
+    }
+    else
+    {
+        a = make_input(n, cols, dtype);
+        b = make_input(n, cols, dtype);
+    }
+
+    std::string codestr = replace_all(
+        bc.code, "{file}", vm["csv-file"].as<std::string>());
+    auto const& code = compile(result.id(), codestr, snippets);
+    auto run = code.run();
+
+    // warm up, this also creates all the primitives involved
+    run(a, b);
+
+    std::vector<double> times;
+    times.reserve(repetitions);
+
+    tasks.reset();
+    node_data_copies(true);
+    node_data_moves(true);
+
+    for (std::int64_t i = 0; i != repetitions; ++i)
+    {
+        hpx::chrono::high_resolution_timer t;
+        run(a, b);
+        times.push_back(t.elapsed());
+    }
+
+    result.tasks = tasks.reset() / repetitions;
+    result.copies = node_data_copies(true) / repetitions;
+    result.moves = node_data_moves(true) / repetitions;
+
+    std::sort(times.begin(), times.end());
+    result.time_min = times.front();
+    result.time_median = times[times.size() / 2];
+
+    if (result.time_median > 0)
+    {
+        double const dn = static_cast<double>(n);
+        result.gbytes_per_second = bc.elements(dn) * dtype_size(dtype) /
+            result.time_median / 1e9;
+        result.gflops_per_second = bc.flops(dn) / result.time_median / 1e9;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(benchmark_result const& r)
+{
+    std::cout << r.key() << ": " << r.time_median * 1e6 << " us (min "
+              << r.time_min * 1e6 << " us), " << r.gbytes_per_second
+              << " GB/s, " << r.gflops_per_second << " GFLOP/s, " << r.tasks
+              << " tasks, " << r.copies << " copies, " << r.moves
+              << " moves\n";
+}
+
+void write_json(std::string const& filename,
+    std::vector<benchmark_result> const& results)
+{
+    std::ofstream os(filename);
+    if (!os.good())
+    {
+        HPX_THROW_EXCEPTION(hpx::filesystem_error, "write_json",
+            "Failed to open the specified file: " + filename);
+    }
+
+    os << "{\n"
+       << "  \"localities\": " << hpx::get_num_localities(hpx::launch::sync)
+       << ",\n"
+       << "  \"threads\": " << hpx::get_os_thread_count() << ",\n"
+       << "  \"results\": [";
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        benchmark_result const& r = results[i];
+
+        os << (i == 0 ? "\n" : ",\n") << "    {\n"
+           << "      \"key\": \"" << r.key() << "\",\n"
+           << "      \"family\": \"" << r.family << "\",\n"
+           << "      \"name\": \"" << r.name << "\",\n"
+           << "      \"shape\": [";
+        for (std::size_t j = 0; j != r.shape.size(); ++j)
+        {
+            os << (j == 0 ? "" : ", ") << r.shape[j];
+        }
+        os << "],\n"
+           << "      \"dtype\": \"" << r.dtype << "\",\n"
+           << "      \"time_median\": " << r.time_median << ",\n"
+           << "      \"time_min\": " << r.time_min << ",\n"
+           << "      \"gbytes_per_second\": " << r.gbytes_per_second << ",\n"
+           << "      \"gflops_per_second\": " << r.gflops_per_second << ",\n"
+           << "      \"tasks\": " << r.tasks << ",\n"
+           << "      \"copies\": " << r.copies << ",\n"
+           << "      \"moves\": " << r.moves << "\n"
+           << "    }";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+// Compare the results with the given baseline, return the number of
+// regressions. Timings may regress by the given (relative) threshold, the
+// number of copies is deterministic and may not increase at all.
+std::size_t compare_with_baseline(std::string const& filename,
+    std::vector<benchmark_result> const& results, double threshold)
+{
+    boost::property_tree::ptree baseline;
+    boost::property_tree::read_json(filename, baseline);
+
+    std::map<std::string, boost::property_tree::ptree> entries;
+    for (auto const& entry : baseline.get_child("results"))
+    {
+        entries[entry.second.get<std::string>("key")] = entry.second;
+    }
+
+    std::size_t regressions = 0;
+    for (benchmark_result const& r : results)
+    {
+        auto it = entries.find(r.key());
+        if (it == entries.end())
+        {
+            std::cout << r.key() << ": no baseline\n";
+            continue;
+        }
+
+        double const time = it->second.get<double>("time_median");
+        if (time > 0 && r.time_median > time * (1.0 + threshold))
+        {
+            std::cout << r.key() << ": time regressed from " << time * 1e6
+                      << " us to " << r.time_median * 1e6 << " us\n";
+            ++regressions;
+        }
+
+        std::int64_t const copies = it->second.get<std::int64_t>("copies");
+        if (r.copies > copies)
+        {
+            std::cout << r.key() << ": node_data copies increased from "
+                      << copies << " to " << r.copies << "\n";
+            ++regressions;
+        }
+    }
+    return regressions;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    bool const is_root = hpx::get_locality_id() == 0;
+    std::string const filter =
+        vm.count("filter") != 0 ? vm["filter"].as<std::string>() : "";
+
+    phylanx::execution_tree::compiler::function_list snippets;
+
+    auto const& input_code = phylanx::execution_tree::compile(
+        "make_input", make_input_code, snippets);
+    auto make_input = input_code.run();
+
+    auto const& input_d_code = phylanx::execution_tree::compile(
+        "make_input_d", make_input_d_code, snippets);
+    auto make_input_d = input_d_code.run();
+
+    phylanx::ir::reset_enable_counts_on_exit counts(true);
+    task_counter tasks;
+
+    std::vector<benchmark_result> results;
+    std::size_t failures = 0;
+
+    for (benchmark_case const& bc : benchmark_cases)
+    {
+        std::string const name = std::string(bc.family) + "/" + bc.name;
+        if (name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        // the distributed benchmarks are run on all localities, all others
+        // on the root locality only
+        if (!bc.distributed && !is_root)
+        {
+            continue;
+        }
+
+        auto const& sizes = bc.matrix ?
+            vm["matrix-sizes"].as<std::vector<std::int64_t>>() :
+            vm["vector-sizes"].as<std::vector<std::int64_t>>();
+
+        for (std::int64_t n : sizes)
+        {
+            for (char const* dtype : bc.dtypes)
+            {
+                try
+                {
+                    results.push_back(run_benchmark(bc, n, dtype, vm,
+                        snippets, bc.distributed ? make_input_d : make_input,
+                        tasks));
+                    if (is_root)
+                    {
+                        print_result(results.back());
+                    }
+                }
+                catch (std::exception const& e)
+                {
+                    std::cerr << name << "/" << n << "/" << dtype
+                              << ": exception caught:\n"
+                              << e.what() << "\n";
+                    ++failures;
+                }
+            }
+        }
+    }
+
+    std::size_t regressions = 0;
+    if (is_root)
+    {
+        if (vm.count("output") != 0)
+        {
+            write_json(vm["output"].as<std::string>(), results);
+        }
+
+        if (vm.count("baseline") != 0)
+        {
+            regressions = compare_with_baseline(
+                vm["baseline"].as<std::string>(), results,
+                vm["threshold"].as<double>());
+
+            std::cout << regressions << " regression(s) detected\n";
+        }
+    }
+
+    hpx::finalize();
+    return (failures != 0 || regressions != 0) ? 1 : 0;
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::value;
+
+    // command line handling
+    hpx::program_options::options_description desc(
+        "usage: primitive_benchmarks [options]");
+    // clang-format off
+    desc.add_options()
+        ("filter", value<std::string>(),
+            "run only the benchmarks whose name (family/name) contains the "
+            "given string")
+        ("vector-sizes",
+            value<std::vector<std::int64_t>>()->multitoken()->default_value(
+                std::vector<std::int64_t>{10000, 1000000}, "10000 1000000"),
+            "the sizes of the vectors to run the benchmarks for")
+        ("matrix-sizes",
+            value<std::vector<std::int64_t>>()->multitoken()->default_value(
+                std::vector<std::int64_t>{100, 1000}, "100 1000"),
+            "the sizes of the (square) matrices to run the benchmarks for")
+        ("repetitions", value<std::int64_t>()->default_value(10),
+            "the number of times each benchmark is run (default: 10)")
+        ("output", value<std::string>(),
+            "write the results as JSON to the given file")
+        ("baseline", value<std::string>(),
+            "compare the results with the given JSON file written by an "
+            "earlier run")
+        ("threshold", value<double>()->default_value(0.1),
+            "relative increase of the timings regarded as a regression "
+            "(default: 0.1)")
+        ("csv-file",
+            value<std::string>()->default_value("primitive_benchmarks.csv"),
+            "the file used by the fileio benchmarks "
+            "(default: primitive_benchmarks.csv)");
+    // clang-format on
+
+    hpx::init_params params;
+    params.desc_cmdline = desc;
+    params.cfg = {"hpx.run_hpx_main!=1"};
+    return hpx::init(argc, argv, params);
+}
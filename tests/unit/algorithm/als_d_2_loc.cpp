@@ -0,0 +1,133 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// the users (rows of the ratings) are tiled unevenly, the items are evenly
+// distributed over the localities by als_d
+std::string const ratings = R"(
+    define(ratings, [[0.0, 4.0, 0.0, 0.0, 0.0],
+                     [1.0, 0.0, 4.0, 0.0, 5.0],
+                     [0.0, 0.0, 0.0, 2.0, 0.0],
+                     [0.0, 8.0, 0.0, 0.0, 0.0],
+                     [0.0, 0.0, 4.0, 0.0, 0.0],
+                     [0.0, 0.0, 0.0, 0.0, 0.0],
+                     [0.0, 0.0, 0.0, 0.0, 2.0],
+                     [1.0, 0.0, 0.0, 0.0, 0.0],
+                     [0.0, 0.0, 0.0, 5.0, 0.0],
+                     [1.0, 0.0, 0.0, 2.0, 0.0]])
+)";
+
+std::size_t const user_tiles[] = {0, 4, 10};
+std::size_t const item_tiles[] = {0, 3, 5};
+
+std::string als_d_tile(std::string const& name, bool sparse)
+{
+    std::uint32_t locality_id = hpx::get_locality_id();
+    std::string start = std::to_string(user_tiles[locality_id]);
+    std::string stop = std::to_string(user_tiles[locality_id + 1]);
+
+    std::string tile = "slice(ratings, list(" + start + ", " + stop + "))";
+    if (sparse)
+    {
+        tile = "sparse(" + tile + ")";
+    }
+
+    return "als_d(annotate_d(" + tile + ", \"" + name +
+        "\", list(\"args\", list(\"locality\", " +
+        std::to_string(locality_id) +
+        ", 2), list(\"tile\", list(\"columns\", 0, 5), list(\"rows\", " +
+        start + ", " + stop + ")))), 0.1, 3, 10, 40)";
+}
+
+phylanx::ir::range compile_and_run(std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(codestr, snippets, env);
+    return phylanx::execution_tree::extract_list_value(code.run().arg_);
+}
+
+blaze::DynamicMatrix<double> extract_matrix(
+    phylanx::execution_tree::primitive_argument_type const& arg)
+{
+    return phylanx::execution_tree::extract_numeric_value(arg).matrix();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the local tiles of the factors are the same as the corresponding rows of
+// the factors calculated by als
+void test_als_d(bool sparse)
+{
+    std::string name = sparse ? "als_ratings_sparse" : "als_ratings_dense";
+    auto result = compile_and_run(ratings + "list(als(ratings, 0.1, 3, 10, " +
+        "40, false), " + als_d_tile(name, sparse) + ")");
+
+    auto it = result.begin();
+    auto expected = phylanx::execution_tree::extract_list_value(*it++);
+    auto actual = phylanx::execution_tree::extract_list_value(*it);
+
+    std::uint32_t locality_id = hpx::get_locality_id();
+    std::size_t user_start = user_tiles[locality_id];
+    std::size_t user_size = user_tiles[locality_id + 1] - user_start;
+    std::size_t item_start = item_tiles[locality_id];
+    std::size_t item_size = item_tiles[locality_id + 1] - item_start;
+
+    auto expected_it = expected.begin();
+    auto actual_it = actual.begin();
+
+    // X
+    blaze::DynamicMatrix<double> expected_x = extract_matrix(*expected_it++);
+    blaze::DynamicMatrix<double> x = extract_matrix(*actual_it++);
+    HPX_TEST_EQ(x.rows(), user_size);
+    HPX_TEST(blaze::max(blaze::abs(x -
+                 blaze::submatrix(expected_x, user_start, 0, user_size,
+                     expected_x.columns()))) < 1e-8);
+
+    // Y
+    blaze::DynamicMatrix<double> expected_y = extract_matrix(*expected_it);
+    blaze::DynamicMatrix<double> y = extract_matrix(*actual_it);
+    HPX_TEST_EQ(y.rows(), item_size);
+    HPX_TEST(blaze::max(blaze::abs(y -
+                 blaze::submatrix(expected_y, item_start, 0, item_size,
+                     expected_y.columns()))) < 1e-8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_als_d(false);
+    test_als_d(true);
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -0,0 +1,115 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// documents 0 and 1 use words 0 and 1 only, documents 2 and 3 use words 2
+// and 3 only, i.e. the corpus consists of two separable topics
+std::string const corpus = R"(
+    define(corpus, [[5.0, 5.0, 0.0, 0.0],
+                    [4.0, 6.0, 0.0, 0.0],
+                    [0.0, 0.0, 5.0, 5.0],
+                    [0.0, 0.0, 6.0, 4.0]])
+)";
+
+phylanx::ir::range compile_and_run(std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(codestr, snippets, env);
+    return phylanx::execution_tree::extract_list_value(code.run().arg_);
+}
+
+blaze::DynamicMatrix<double> extract_matrix(
+    phylanx::execution_tree::primitive_argument_type const& arg)
+{
+    return phylanx::execution_tree::extract_numeric_value(arg).matrix();
+}
+
+// the topic with the largest count in the given row
+std::size_t main_topic(blaze::DynamicMatrix<double> const& m, std::size_t row)
+{
+    return m(row, 0) < m(row, 1) ? 1 : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lda_trainer(std::string const& word_doc_matrix)
+{
+    std::string const code = corpus + R"(
+        block(
+            set_seed(42),
+            lda_trainer(2, 0.1, 0.01, 50, )" + word_doc_matrix + R"()
+        )
+    )";
+
+    auto result = compile_and_run(code);
+    auto it = result.begin();
+    blaze::DynamicMatrix<double> wp = extract_matrix(*it++);
+    blaze::DynamicMatrix<double> dp = extract_matrix(*it);
+
+    blaze::DynamicMatrix<double> const words{{5.0, 5.0, 0.0, 0.0},
+        {4.0, 6.0, 0.0, 0.0}, {0.0, 0.0, 5.0, 5.0}, {0.0, 0.0, 6.0, 4.0}};
+    double const num_tokens = blaze::sum(words);
+
+    HPX_TEST_EQ(wp.rows(), words.columns());
+    HPX_TEST_EQ(wp.columns(), std::size_t(2));
+    HPX_TEST_EQ(dp.rows(), words.rows());
+    HPX_TEST_EQ(dp.columns(), std::size_t(2));
+
+    // every token is assigned exactly one topic
+    HPX_TEST_EQ(blaze::sum(wp), num_tokens);
+    HPX_TEST_EQ(blaze::sum(dp), num_tokens);
+
+    // the topic counts of each document add up to its length, the topic
+    // counts of each word add up to its number of occurrences
+    for (std::size_t d = 0; d != words.rows(); ++d)
+    {
+        HPX_TEST_EQ(blaze::sum(blaze::row(dp, d)),
+            blaze::sum(blaze::row(words, d)));
+    }
+    for (std::size_t w = 0; w != words.columns(); ++w)
+    {
+        HPX_TEST_EQ(blaze::sum(blaze::row(wp, w)),
+            blaze::sum(blaze::column(words, w)));
+    }
+
+    // the two topics are recovered
+    std::size_t topic = main_topic(dp, 0);
+    HPX_TEST_EQ(main_topic(dp, 1), topic);
+    HPX_TEST_EQ(main_topic(dp, 2), 1 - topic);
+    HPX_TEST_EQ(main_topic(dp, 3), 1 - topic);
+
+    HPX_TEST_EQ(main_topic(wp, 0), topic);
+    HPX_TEST_EQ(main_topic(wp, 1), topic);
+    HPX_TEST_EQ(main_topic(wp, 2), 1 - topic);
+    HPX_TEST_EQ(main_topic(wp, 3), 1 - topic);
+
+    // the results are reproducible after setting the seed
+    auto repeated = compile_and_run(code);
+    auto repeated_it = repeated.begin();
+    HPX_TEST(extract_matrix(*repeated_it++) == wp);
+    HPX_TEST(extract_matrix(*repeated_it) == dp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_lda_trainer("corpus");
+    test_lda_trainer("sparse(corpus)");
+
+    return hpx::util::report_errors();
+}
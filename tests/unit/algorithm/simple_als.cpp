@@ -166,8 +166,58 @@ void test_als_physl()
         phylanx::ir::node_data<uint8_t>{1});
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// als_d on a single locality has to give the same result as als, for dense
+// as well as for sparse ratings
+char const* const als_d_test = R"(
+    define(ratings,[[0.0,4.0,0.0,0.0,0.0],
+                    [1.0,0.0,4.0,0.0,5.0],
+                    [0.0,0.0,0.0,2.0,0.0],
+                    [0.0,8.0,0.0,0.0,0.0],
+                    [0.0,0.0,4.0,0.0,0.0],
+                    [0.0,0.0,0.0,0.0,0.0],
+                    [0.0,0.0,0.0,0.0,2.0],
+                    [1.0,0.0,0.0,0.0,0.0],
+                    [0.0,0.0,0.0,5.0,0.0],
+                    [1.0,0.0,0.0,2.0,0.0]])
+    list(
+        als(ratings, 0.1, 3, 10, 40, 0),
+        als_d(ratings, 0.1, 3, 10, 40),
+        als_d(sparse(ratings), 0.1, 3, 10, 40)
+    )
+)";
+
+bool allclose(phylanx::execution_tree::primitive_argument_type const& lhs,
+    phylanx::execution_tree::primitive_argument_type const& rhs)
+{
+    auto l = phylanx::execution_tree::extract_numeric_value(lhs).matrix();
+    auto r = phylanx::execution_tree::extract_numeric_value(rhs).matrix();
+    return blaze::max(blaze::abs(l - r)) < 1e-8;
+}
+
+void test_als_d()
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(als_d_test, snippets);
+    auto result =
+        phylanx::execution_tree::extract_list_value(code.run()());
+
+    auto it = result.begin();
+    auto expected = phylanx::execution_tree::extract_list_value(*it++);
+    for (/**/; it != result.end(); ++it)
+    {
+        auto actual = phylanx::execution_tree::extract_list_value(*it);
+
+        auto expected_it = expected.begin();
+        auto actual_it = actual.begin();
+        HPX_TEST(allclose(*expected_it++, *actual_it++));    // X
+        HPX_TEST(allclose(*expected_it, *actual_it));        // Y
+    }
+}
+
 int main(int argc, char* argv[])
 {
     test_als_physl();
+    test_als_d();
     return hpx::util::report_errors();
 }
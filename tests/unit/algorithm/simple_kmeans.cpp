@@ -152,10 +152,38 @@ void test_kmeans_cpp_physl()
         phylanx::ir::node_data<uint8_t>{1});
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_kmeans_nd()
+{
+    char const* const code_str = R"(block(
+        define(points, [[ 0.,  0.,  0.], [ 0.,  0.,  1.], [ 0.,  1.,  0.],
+                        [10., 10., 10.], [10., 10., 11.], [10., 11., 10.]]),
+        define(initial_centroids, [[0., 0., 0.], [10., 10., 10.]]),
+        list(
+            kmeans(points, 2, 3, false, nil, initial_centroids),
+            kmeans_d(points, 2, 3, false, nil, initial_centroids)
+        )
+    ))";
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(code_str, snippets);
+    auto result = phylanx::execution_tree::extract_list_value(code.run()());
+
+    blaze::DynamicMatrix<double> expected{
+        {0., 1. / 3., 1. / 3.}, {10., 31. / 3., 31. / 3.}};
+
+    auto it = result.begin();
+    HPX_TEST(allclose(phylanx::ir::node_data<double>(expected),
+        phylanx::execution_tree::extract_numeric_value(*it++)));
+    HPX_TEST(allclose(phylanx::ir::node_data<double>(expected),
+        phylanx::execution_tree::extract_numeric_value(*it)));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
     test_kmeans_as_primitive();
     test_kmeans_cpp_physl();
+    test_kmeans_nd();
     return hpx::util::report_errors();
 }
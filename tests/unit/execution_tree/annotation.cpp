@@ -5,10 +5,12 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <string>
 
 phylanx::execution_tree::primitive_argument_type compile_and_run(
@@ -103,6 +105,47 @@ void test_annotation_non_equality_4()
         compile_and_run("annotation_1", annotation_1));
 }
 
+void test_localities_information_cache()
+{
+    using namespace phylanx::execution_tree;
+
+    std::string annotation_0 = R"(
+            annotate_d([[91, 91]], "cached_tiles",
+                list("tile", list("columns", 0, 2), list("rows", 0, 1)))
+        )";
+
+    primitive_argument_type arg =
+        compile_and_run("annotation_0", annotation_0);
+
+    auto info = get_localities_information(arg, "annotation_0", "<unknown>");
+    HPX_TEST_EQ(info->rows("annotation_0", "<unknown>"), std::size_t(1));
+    HPX_TEST_EQ(info->columns("annotation_0", "<unknown>"), std::size_t(2));
+
+    // the annotation is parsed only once, even if it is shared between
+    // several arrays
+    primitive_argument_type copy = arg;
+    HPX_TEST(info ==
+        get_localities_information(arg, "annotation_0", "<unknown>"));
+    HPX_TEST(info ==
+        get_localities_information(copy, "annotation_0", "<unknown>"));
+
+    localities_information localities =
+        extract_localities_information(copy, "annotation_0", "<unknown>");
+    HPX_TEST_EQ(localities.annotation_.name_, info->annotation_.name_);
+    HPX_TEST_EQ(localities.tiles_.size(), info->tiles_.size());
+
+    // modifying the annotation invalidates the parsed information
+    annotation ann = *arg.annotation();
+    ann.increment_generation("annotation_0", "<unknown>");
+    arg.set_annotation(std::move(ann), "annotation_0", "<unknown>");
+
+    auto updated =
+        get_localities_information(arg, "annotation_0", "<unknown>");
+    HPX_TEST(info != updated);
+    HPX_TEST_EQ(updated->annotation_.generation_,
+        info->annotation_.generation_ + 1);
+}
+
 int main(int argc, char* argv[])
 {
     test_annotation_equality_0();
@@ -111,5 +154,7 @@ int main(int argc, char* argv[])
     test_annotation_non_equality_3();
     test_annotation_non_equality_4();
 
+    test_localities_information_cache();
+
     return hpx::util::report_errors();
 }
@@ -10,7 +10,9 @@
 #include <hpx/modules/testing.hpp>
 
 #include <cstdint>
+#include <cstdio>
 #include <list>
+#include <string>
 #include <utility>
 
 #include <blaze/Math.h>
@@ -855,6 +857,55 @@ void test_define_call_block_function_noarg()
         ));
 }
 
+void test_compilation_cache()
+{
+    std::string const code = R"(
+        define(fact, n, if(n <= 1, 1, n * fact(n - 1)))
+        define(add, a, __arg(b, 1), a + b)
+        add(fact(5), -fact(3))
+    )";
+    std::string const cache_file = "compiler_test.cache";
+
+    std::remove(cache_file.c_str());
+
+    // the first compilation populates the cache, the second one reuses it
+    for (int i = 0; i != 2; ++i)
+    {
+        phylanx::execution_tree::eval_context ctx;
+
+        phylanx::execution_tree::compiler::function_list snippets;
+        phylanx::execution_tree::compiler::environment env =
+            phylanx::execution_tree::compiler::default_environment();
+
+        auto const& code_x = phylanx::execution_tree::compile_cached(
+            "<test>", "test_compilation_cache", code, cache_file, snippets,
+            env);
+
+        HPX_TEST_EQ(std::int64_t(114),
+            phylanx::execution_tree::extract_scalar_integer_value_strict(
+                code_x.run(ctx).arg_));
+    }
+
+    // the cache entry is not used for different code
+    {
+        phylanx::execution_tree::eval_context ctx;
+
+        phylanx::execution_tree::compiler::function_list snippets;
+        phylanx::execution_tree::compiler::environment env =
+            phylanx::execution_tree::compiler::default_environment();
+
+        auto const& code_x = phylanx::execution_tree::compile_cached(
+            "<test>", "test_compilation_cache", "42 - 1", cache_file,
+            snippets, env);
+
+        HPX_TEST_EQ(std::int64_t(41),
+            phylanx::execution_tree::extract_scalar_integer_value_strict(
+                code_x.run(ctx).arg_));
+    }
+
+    std::remove(cache_file.c_str());
+}
+
 int main(int argc, char* argv[])
 {
     test_builtin_environment();
@@ -898,6 +949,8 @@ int main(int argc, char* argv[])
     test_define_call_block_function_noarg();
     test_define_function_default_arguments();
 
+    test_compilation_cache();
+
     return hpx::util::report_errors();
 }
 
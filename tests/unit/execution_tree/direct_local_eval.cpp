@@ -0,0 +1,136 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test is run with and without --hpx:ini=phylanx.direct_local_eval=0,
+// evaluating local primitives must give the same results either way.
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::compiler::function compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+std::int64_t extract_int(phylanx::execution_tree::primitive_argument_type&& val)
+{
+    return phylanx::execution_tree::extract_scalar_integer_value(
+        std::move(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_configuration()
+{
+    bool expected =
+        hpx::get_config_entry("phylanx.direct_local_eval", "1") == "1";
+    HPX_TEST_EQ(expected,
+        phylanx::execution_tree::primitives::primitive_component::
+            enable_local_eval());
+}
+
+void test_eval()
+{
+    using phylanx::execution_tree::primitive_argument_type;
+    using phylanx::execution_tree::primitive_arguments_type;
+
+    auto f = compile_and_run(R"(
+            define(f, a, b, block(
+                define(x, a * b),
+                x + a
+            ))
+            f
+        )");
+    auto const& p = phylanx::execution_tree::primitive_operand(f.arg_);
+
+    // arguments passed as lvalue
+    primitive_arguments_type args{primitive_argument_type{std::int64_t(6)},
+        primitive_argument_type{std::int64_t(7)}};
+    HPX_TEST_EQ(extract_int(p.eval(args).get()), std::int64_t(48));
+    HPX_TEST_EQ(extract_int(p.eval(hpx::launch::sync, args)), std::int64_t(48));
+
+    // arguments passed as rvalue
+    HPX_TEST_EQ(extract_int(p.eval(primitive_arguments_type{args}).get()),
+        std::int64_t(48));
+    HPX_TEST_EQ(extract_int(p.eval(hpx::launch::sync, std::move(args))),
+        std::int64_t(48));
+
+    // recursive invocations evaluate the same primitives concurrently
+    auto fib = compile_and_run(R"(
+            define(fib, n, if(n < 2, n, fib(n - 1) + fib(n - 2)))
+            fib
+        )");
+    auto const& pfib = phylanx::execution_tree::primitive_operand(fib.arg_);
+    primitive_arguments_type fib_args{
+        primitive_argument_type{std::int64_t(15)}};
+    HPX_TEST_EQ(extract_int(pfib.eval(std::move(fib_args)).get()),
+        std::int64_t(610));
+}
+
+// exceptions thrown while evaluating are delivered through the future
+void test_exception()
+{
+    using phylanx::execution_tree::primitive_argument_type;
+    using phylanx::execution_tree::primitive_arguments_type;
+
+    auto f = compile_and_run(R"(
+            define(f, a, slice(a, 10))
+            f
+        )");
+    auto const& p = phylanx::execution_tree::primitive_operand(f.arg_);
+
+    primitive_arguments_type args{
+        primitive_argument_type{phylanx::ir::node_data<double>{
+            blaze::DynamicVector<double>{1.0, 2.0}}}};
+
+    bool caught_exception = false;
+    auto result = p.eval(args);
+    try
+    {
+        result.get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    result = p.eval(std::move(args));
+    try
+    {
+        result.get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_configuration();
+    test_eval();
+    test_exception();
+
+    return hpx::util::report_errors();
+}
@@ -89,6 +89,12 @@ void test1_function_call()
     }
     HPX_TEST_EQ(it->second.defaults_.size(), std::size_t(0));
 
+    HPX_TEST(it->second.is_function_call_);
+    HPX_TEST(!it->second.is_variadic_);
+    HPX_TEST(it->second.accepts_arguments(2));
+    HPX_TEST(!it->second.accepts_arguments(1));
+    HPX_TEST(!it->second.accepts_arguments(3));
+
     test_function(patterns, "__test1(42, 43)", 42);
 }
 
@@ -201,9 +207,28 @@ void test3_function_call()
         HPX_TEST_EQ(it->second.defaults_.size(), std::size_t(2));
         HPX_TEST_EQ(it->second.defaults_[0], std::string("1"));
         HPX_TEST_EQ(it->second.defaults_[1], std::string("2"));
+
+        // default values are parsed only once
+        HPX_TEST_EQ(it->second.default_values_.size(), std::size_t(2));
+        HPX_TEST_EQ(
+            phylanx::ast::to_string(it->second.default_values_[0], true),
+            it->second.defaults_[0]);
+        HPX_TEST_EQ(
+            phylanx::ast::to_string(it->second.default_values_[1], true),
+            it->second.defaults_[1]);
+
+        // patterns are generated for an increasing number of arguments
+        HPX_TEST_EQ(it->second.num_args_, i);
+        HPX_TEST(it->second.accepts_arguments(i));
     }
     HPX_TEST_EQ(i, std::size_t(4));
 
+    compiler::pattern_index index(patterns);
+    HPX_TEST(index.indexes(patterns));
+    HPX_TEST_EQ(index.functions("__test3").size(), std::size_t(3));
+    HPX_TEST(index.functions("__test4").empty());
+    HPX_TEST(index.operators().empty());
+
     test_function(
         patterns, "__test3(42, __arg(name2, 43), __arg(name1, 44))", 44);
     test_function(
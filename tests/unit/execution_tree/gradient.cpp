@@ -0,0 +1,305 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+phylanx::execution_tree::compiler::function compile_function(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+phylanx::execution_tree::primitive_argument_type evaluate(
+    phylanx::execution_tree::compiler::function const& f,
+    phylanx::execution_tree::primitive_arguments_type args)
+{
+    return phylanx::execution_tree::primitive_operand(f.arg_).eval(
+        hpx::launch::sync, std::move(args));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_gradient(std::string const& code, std::string const& expected_str)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
+}
+
+// the gradient of f with respect to its argument 'wrt' is compared against
+// central differences of f
+void test_finite_differences(std::string const& f,
+    std::vector<std::string> const& args, std::size_t wrt,
+    std::string const& wrt_name)
+{
+    using phylanx::execution_tree::primitive_argument_type;
+    using phylanx::execution_tree::primitive_arguments_type;
+
+    auto func = compile_function(f + "\nf");
+    auto df = compile_function(
+        f + "\ndefine(df, grad(f, " + wrt_name + "))\ndf");
+
+    primitive_arguments_type values;
+    for (auto const& arg : args)
+    {
+        values.push_back(compile_and_run(arg));
+    }
+
+    phylanx::ir::node_data<double> gradient =
+        phylanx::execution_tree::extract_numeric_value(evaluate(df, values));
+    phylanx::ir::node_data<double> x =
+        phylanx::execution_tree::extract_numeric_value(values[wrt]).copy();
+
+    HPX_TEST(gradient.dimensions() == x.dimensions());
+
+    auto f_at = [&](phylanx::ir::node_data<double>::dimensions_type const& i,
+                    double delta) {
+        phylanx::ir::node_data<double> xd = x.copy();
+        xd[i] += delta;
+        values[wrt] = primitive_argument_type{std::move(xd)};
+        return phylanx::execution_tree::extract_scalar_numeric_value(
+            evaluate(func, values));
+    };
+
+    double const h = 1e-6;
+    auto const dims = x.dimensions();
+    std::size_t const num_dims = x.num_dimensions();
+    for (std::size_t n = 0; n != x.size(); ++n)
+    {
+        phylanx::ir::node_data<double>::dimensions_type i{};
+        for (std::size_t d = num_dims, flat = n; d != 0; --d)
+        {
+            i[d - 1] = flat % dims[d - 1];
+            flat /= dims[d - 1];
+        }
+
+        double expected = (f_at(i, h) - f_at(i, -h)) / (2 * h);
+        HPX_TEST(std::abs(gradient[i] - expected) <
+            1e-5 * (std::max)(1.0, std::abs(expected)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_elementwise()
+{
+    test_gradient(R"(
+            define(f, x, sum(x * x))
+            define(df, grad(f, x))
+            df([1., 2., 3.])
+        )", "[2., 4., 6.]");
+
+    test_gradient(R"(
+            define(f, x, sum(x / 2. - x))
+            define(df, grad(f, x))
+            df([1., 2.])
+        )", "[-0.5, -0.5]");
+
+    test_gradient(R"(
+            define(f, x, sum(relu(x)))
+            define(df, grad(f, x))
+            df([-1., 2.])
+        )", "[0., 1.]");
+
+    // intermediate results are reused by the backward pass
+    test_gradient(R"(
+            define(f, x, block(define(y, x * x), sum(y * x)))
+            define(df, grad(f, x))
+            df([1., 2.])
+        )", "[3., 12.]");
+}
+
+void test_broadcasting()
+{
+    test_gradient(R"(
+            define(f, w, x, sum(w * x))
+            define(df, grad(f, w))
+            df(2., [1., 2., 3.])
+        )", "6.");
+
+    test_gradient(R"(
+            define(f, w, b, sum(w + b))
+            define(df, grad(f, b))
+            df([[1., 2.], [3., 4.]], [1., 1.])
+        )", "[2., 2.]");
+}
+
+void test_reductions()
+{
+    test_gradient(R"(
+            define(f, x, mean(x))
+            define(df, grad(f, x))
+            df([1., 2., 3., 4.])
+        )", "[0.25, 0.25, 0.25, 0.25]");
+
+    test_gradient(R"(
+            define(f, x, amax(x))
+            define(df, grad(f, x))
+            df([1., 3., 2.])
+        )", "[0., 1., 0.]");
+
+    test_gradient(R"(
+            define(f, x, sum(sum(x, 0)))
+            define(df, grad(f, x))
+            df([[1., 2.], [3., 4.]])
+        )", "[[1., 1.], [1., 1.]]");
+}
+
+void test_dot()
+{
+    test_gradient(R"(
+            define(f, w, x, sum(dot(w, x)))
+            define(df, grad(f, w))
+            df([[1., 2.], [3., 4.]], [1., 2.])
+        )", "[[1., 2.], [1., 2.]]");
+
+    test_gradient(R"(
+            define(f, w, x, sum(dot(w, x)))
+            define(df, grad(f, x))
+            df([[1., 2.], [3., 4.]], [1., 2.])
+        )", "[4., 6.]");
+}
+
+void test_multiple_arguments()
+{
+    test_gradient(R"(
+            define(f, a, b, sum(a * b + a))
+            define(df, grad(f, list(a, b)))
+            df([1., 2.], [3., 4.])
+        )", "list([4., 5.], [1., 2.])");
+
+    // the gradient with respect to an unused argument is zero
+    test_gradient(R"(
+            define(f, x, y, sum(x))
+            define(df, grad(f, y))
+            df([1., 2.], [3., 4.])
+        )", "[0., 0.]");
+}
+
+void test_conv()
+{
+    std::string const x1d = "[[[0.1, -0.2], [0.3, 0.4], [-0.5, 0.6], "
+                            "[0.7, -0.8], [0.9, 1.0]]]";
+    std::string const k1d = "[[[0.5], [-1.0]], [[0.25], [0.75]]]";
+
+    for (std::string const padding : {"\"valid\"", "\"same\""})
+    {
+        std::string const f = "define(f, x, k, sum(square(conv1d(x, k, " +
+            padding + "))))";
+        test_finite_differences(f, {x1d, k1d}, 0, "x");
+        test_finite_differences(f, {x1d, k1d}, 1, "k");
+    }
+
+    test_finite_differences(
+        "define(f, x, k, sum(square(conv1d(x, k, \"valid\", 2))))",
+        {x1d, k1d}, 0, "x");
+
+    std::string const x2d = R"(
+            [[[[0.1, -0.2], [0.3, 0.4], [-0.5, 0.6]],
+              [[0.7, -0.8], [0.9, 1.0], [-1.1, 0.2]],
+              [[0.4, 0.3], [-0.6, 0.8], [0.5, -0.7]]]]
+        )";
+    std::string const k2d = R"(
+            [[[[0.5], [-1.0]], [[0.25], [0.75]]],
+             [[[-0.5], [1.5]], [[1.0], [-0.25]]]]
+        )";
+
+    for (std::string const padding : {"\"valid\"", "\"same\""})
+    {
+        std::string const f = "define(f, x, k, sum(square(conv2d(x, k, " +
+            padding + "))))";
+        test_finite_differences(f, {x2d, k2d}, 0, "x");
+        test_finite_differences(f, {x2d, k2d}, 1, "k");
+    }
+}
+
+void test_pooling()
+{
+    // all values are distinct, the maxima don't change under perturbation
+    std::string const x = R"(
+            [[[[0.1, -0.2], [0.3, 0.4], [-0.5, 0.6]],
+              [[0.7, -0.8], [0.9, 1.0], [-1.1, 0.2]],
+              [[0.45, 0.35], [-0.6, 0.8], [0.5, -0.7]]]]
+        )";
+
+    for (std::string const pool : {"max_pool2d", "avg_pool2d"})
+    {
+        test_finite_differences("define(f, x, sum(square(" + pool +
+                "(x, list(2, 2)))))", {x}, 0, "x");
+        test_finite_differences("define(f, x, sum(square(" + pool +
+                "(x, list(2, 2), \"valid\", list(1, 2)))))", {x}, 0, "x");
+    }
+}
+
+void test_activations()
+{
+    std::string const x = "[[-2.0, -0.5, 0.3], [0.5, 2.0, -1.2]]";
+
+    // the sum of the softmax is constant, square it to get a non-zero gradient
+    test_finite_differences(
+        "define(f, x, sum(square(softmax(x))))", {x}, 0, "x");
+    test_finite_differences(
+        "define(f, x, sum(square(softmax(x, 0))))", {x}, 0, "x");
+
+    for (std::string const activation : {"sigmoid", "tanh"})
+    {
+        test_finite_differences("define(f, x, sum(square(" + activation +
+                "(x))))", {x}, 0, "x");
+    }
+}
+
+void test_moments()
+{
+    std::string const x = "[[1.0, -0.5, 0.3], [0.5, 2.0, -1.2]]";
+
+    for (std::string const moment : {"var", "std"})
+    {
+        test_finite_differences(
+            "define(f, x, " + moment + "(x))", {x}, 0, "x");
+        test_finite_differences("define(f, x, sum(square(" + moment +
+                "(x, 0))))", {x}, 0, "x");
+        test_finite_differences("define(f, x, sum(square(" + moment +
+                "(x, 1, true))))", {x}, 0, "x");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_elementwise();
+    test_broadcasting();
+    test_reductions();
+    test_dot();
+    test_multiple_arguments();
+    test_conv();
+    test_pooling();
+    test_activations();
+    test_moments();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t run_int(std::string const& code)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& f = phylanx::execution_tree::compile(code, snippets, env);
+    return phylanx::execution_tree::extract_scalar_integer_value(f.run().arg_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the compiler resolves the variables of a function to the slots of its frame
+void test_slot_access()
+{
+    HPX_TEST_EQ(run_int(R"(
+            define(f, a, block(
+                define(x, a),
+                define(y, a + 1),
+                store(x, x + y),
+                x * y
+            ))
+            f(2)
+        )"), std::int64_t(15));
+
+    // every invocation gets its own frame
+    HPX_TEST_EQ(run_int(R"(
+            define(f, a, block(
+                define(x, a),
+                if(a > 0, store(x, x + f(a - 1))),
+                x
+            ))
+            f(3)
+        )"), std::int64_t(6));
+
+    // functions are accessed through slots as well
+    HPX_TEST_EQ(run_int(R"(
+            define(f, a, block(
+                define(g, b, a * b),
+                g(a) + g(1)
+            ))
+            f(3)
+        )"), std::int64_t(12));
+}
+
+// variables of enclosing frames are looked up by name
+void test_fallback_access()
+{
+    HPX_TEST_EQ(run_int(R"(
+            define(x, 40)
+            define(f, a, x + a)
+            f(2)
+        )"), std::int64_t(42));
+
+    HPX_TEST_EQ(run_int(R"(
+            define(x, 40)
+            define(f, a, block(store(x, x + a), x))
+            block(f(1), f(1))
+        )"), std::int64_t(42));
+}
+
+// frames are chained following the callers, a variable defined by a caller
+// shadows the global variable of the same name
+void test_shadowing()
+{
+    HPX_TEST_EQ(run_int(R"(
+            define(x, 1)
+            define(g, a, x + a)
+            define(f, a, block(
+                define(x, 10),
+                g(a)
+            ))
+            f(2) + g(2)
+        )"), std::int64_t(15));
+
+    HPX_TEST_EQ(run_int(R"(
+            define(x, 1)
+            define(h, a, x * a)
+            define(g, a, h(a))
+            define(f, a, block(
+                define(x, 10),
+                g(a)
+            ))
+            f(3)
+        )"), std::int64_t(30));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eval_context_slots()
+{
+    using phylanx::execution_tree::eval_context;
+    using phylanx::execution_tree::primitive_argument_type;
+    using phylanx::execution_tree::variable_slot;
+    using phylanx::util::hashed_string;
+
+    hashed_string x("x");
+    hashed_string y("y");
+
+    eval_context outer;
+    outer.set_var(x, primitive_argument_type{std::int64_t(1)});
+
+    eval_context middle = outer;
+    middle.add_frame("middle", "<unknown>", 1);
+    middle.set_var(x, variable_slot(variable_slot::current_frame, 0),
+        primitive_argument_type{std::int64_t(2)});
+
+    eval_context inner = middle;
+    inner.add_frame("inner", "<unknown>", 1);
+
+    // slot of the current frame
+    inner.set_var(y, variable_slot(variable_slot::current_frame, 0),
+        primitive_argument_type{std::int64_t(3)});
+    auto const* var =
+        inner.get_var(y, variable_slot(variable_slot::current_frame, 0));
+    HPX_TEST(var != nullptr && *var == primitive_argument_type{std::int64_t(3)});
+
+    // the slot is taken by a different variable, look up by name
+    var = inner.get_var(x, variable_slot(variable_slot::current_frame, 0));
+    HPX_TEST(var != nullptr && *var == primitive_argument_type{std::int64_t(2)});
+
+    // the caller's variable shadows the variable of the outermost frame
+    var = inner.get_var(x, variable_slot(variable_slot::outermost_frame, 0));
+    HPX_TEST(var != nullptr && *var == primitive_argument_type{std::int64_t(2)});
+
+    // variables stored in slots are visible to name based lookups
+    var = inner.get_var(y);
+    HPX_TEST(var != nullptr && *var == primitive_argument_type{std::int64_t(3)});
+
+    var = outer.get_var(x);
+    HPX_TEST(var != nullptr && *var == primitive_argument_type{std::int64_t(1)});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_slot_access();
+    test_fallback_access();
+    test_shadowing();
+
+    test_eval_context_slots();
+
+    return hpx::util::report_errors();
+}
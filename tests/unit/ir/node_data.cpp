@@ -241,5 +241,26 @@ int main(int argc, char* argv[])
         test_serialization(array_value);
     }
 
+    {
+        blaze::CompressedMatrix<double> m(42UL, 101UL);
+        m(3, 7) = 1.0;
+        m(41, 100) = 2.0;
+
+        phylanx::ir::node_data<double> array_value(m);
+
+        // references to sparse data don't copy the data
+        phylanx::ir::node_data<double> ref_value = array_value.ref();
+        HPX_TEST(ref_value.is_ref());
+        HPX_TEST(ref_value.is_sparse());
+        HPX_TEST_EQ(&ref_value.sparse_matrix(), &array_value.sparse_matrix());
+        HPX_TEST(ref_value.dimensions() == array_value.dimensions());
+
+        phylanx::ir::node_data<double> copied_value = ref_value.copy();
+        HPX_TEST(!copied_value.is_ref());
+        HPX_TEST(copied_value == array_value);
+
+        test_serialization(ref_value);
+    }
+
     return hpx::util::report_errors();
 }
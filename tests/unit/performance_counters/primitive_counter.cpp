@@ -5,16 +5,19 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/performance_data.hpp>
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/agas.hpp>
 #include <hpx/include/performance_counters.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <blaze/Math.h>
 
@@ -61,22 +64,68 @@ std::map<std::string, std::size_t> expected_counts =
     { "function", 1 },
     { "lambda", 1 },
     { "variable", 6 },
-    { "__add", 2 },
+    { "__add", 1 },
     { "block", 3 },
     { "constant", 4 },
-    { "__div", 1 },
     { "dot", 2 },
     { "shape", 4 },
-    { "exp", 1 },
     { "__lt", 1 },
-    { "__mul", 1 },
     { "parallel_block", 1 },
-    { "__sub", 2 },
+    { "__sub", 1 },
     { "transpose", 1 },
-    { "__minus", 1 },
     { "while", 1 },
+    // 1.0 / (1.0 + exp(-dot(x, weights))), weights - (alpha * __gradient)
+    { "__fused_elementwise", 2 },
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// sort deep-copies its argument, which refers to the value passed to the
+// function, __add reuses the memory of the temporary returned by sort
+char const* const node_data_bytes_code = R"(block(
+    define(__node_data_bytes, x, __add(sort(x), x)),
+    __node_data_bytes
+))";
+
+std::vector<std::int64_t> counter_values(
+    std::string const& name, std::string const& counter)
+{
+    hpx::performance_counters::performance_counter pc(
+        "/phylanx{locality#0/total}/primitives/" + name + "/" + counter);
+    return pc.get_counter_values_array(hpx::launch::sync, false).values_;
+}
+
+bool any_positive(std::vector<std::int64_t> const& values)
+{
+    return std::any_of(values.begin(), values.end(),
+        [](std::int64_t value) { return value > 0; });
+}
+
+void test_node_data_bytes()
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code =
+        phylanx::execution_tree::compile(node_data_bytes_code, snippets);
+    auto f = code.run();
+
+    phylanx::ir::reset_enable_counts_on_exit counts(true);
+    phylanx::util::enable_measurements();
+
+    // the second evaluation is executed synchronously, i.e. the bytes are
+    // attributed to the evaluating primitives
+    blaze::DynamicVector<double> const v{3.0, 1.0, 2.0, 4.0};
+    for (int i = 0; i != 2; ++i)
+    {
+        auto result = phylanx::execution_tree::extract_numeric_value(
+            f(phylanx::ir::node_data<double>{v}));
+        HPX_TEST(result.vector() ==
+            blaze::DynamicVector<double>({4.0, 3.0, 5.0, 8.0}));
+    }
+
+    HPX_TEST(any_positive(counter_values("sort", "copied_bytes")));
+    HPX_TEST(any_positive(counter_values("__add", "reused_bytes")));
+}
+
+///////////////////////////////////////////////////////////////////////////////
 int main()
 {
     blaze::DynamicMatrix<double> const v1{{15.04, 16.74}, {13.82, 24.49},
@@ -135,6 +184,10 @@ int main()
             "/phylanx{locality#0/total}/primitives/" + name + "/eval_direct");
         hpx::performance_counters::performance_counter eval_pc(eval_pc_name);
 
+        std::string const copied_pc_name("/phylanx{locality#0/total}/"
+            "primitives/" + name + "/copied_bytes");
+        hpx::performance_counters::performance_counter copied_pc(
+            copied_pc_name);
 
         // Count performance counters
         auto const info = count_pc.get_info(hpx::launch::sync);
@@ -189,7 +242,29 @@ int main()
                     values.values_[i] == 1);
             }
         }
+
+        // Copied-bytes performance counters
+        {
+            auto const info = copied_pc.get_info(hpx::launch::sync);
+            HPX_TEST_EQ(info.fullname_, copied_pc_name);
+            HPX_TEST_EQ(
+                info.type_, hpx::performance_counters::counter_raw_values);
+
+            auto const values =
+                copied_pc.get_counter_values_array(hpx::launch::sync, false);
+
+            HPX_TEST_EQ(values.count_, 1ll);
+            HPX_TEST_EQ(values.values_.size(), entries.size());
+
+            // no primitive can have copied a negative amount of data
+            for (std::size_t i = 0; i != values.values_.size(); ++i)
+            {
+                HPX_TEST(values.values_[i] >= 0);
+            }
+        }
     }
 
+    test_node_data_bytes();
+
     return hpx::util::report_errors();
 }
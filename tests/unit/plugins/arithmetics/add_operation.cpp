@@ -495,6 +495,40 @@ void test_add_operation_2d1d_lit()
         phylanx::execution_tree::extract_numeric_value(f.get()));
 }
 
+void test_add_operation_2d_column_row()
+{
+    blaze::Rand<blaze::DynamicMatrix<double>> mat_gen{};
+    blaze::DynamicMatrix<double> c = mat_gen.generate(101UL, 1UL);
+    blaze::DynamicMatrix<double> r = mat_gen.generate(1UL, 104UL);
+
+    phylanx::execution_tree::primitive lhs =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), phylanx::ir::node_data<double>(c));
+
+    phylanx::execution_tree::primitive rhs =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), phylanx::ir::node_data<double>(r));
+
+    phylanx::execution_tree::primitive add =
+        phylanx::execution_tree::primitives::create_add_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                std::move(lhs), std::move(rhs)});
+
+    hpx::future<phylanx::execution_tree::primitive_argument_type> f = add.eval();
+    blaze::DynamicMatrix<double> expected(c.rows(), r.columns());
+    for (size_t i = 0UL; i < c.rows(); ++i)
+    {
+        for (size_t j = 0UL; j < r.columns(); ++j)
+        {
+            expected(i, j) = c(i, 0) + r(0, j);
+        }
+    }
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>(std::move(expected)),
+        phylanx::execution_tree::extract_numeric_value(f.get()));
+}
+
 int main(int argc, char* argv[])
 {
     test_add_operation_0d();
@@ -524,5 +558,7 @@ int main(int argc, char* argv[])
     test_add_operation_2d1d();
     test_add_operation_2d1d_lit();
 
+    test_add_operation_2d_column_row();
+
     return hpx::util::report_errors();
 }
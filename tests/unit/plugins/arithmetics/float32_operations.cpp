@@ -0,0 +1,184 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+// the result of the given expression is expected to be single precision
+void test_float32(std::string const& code, std::string const& expected)
+{
+    auto result = compile_and_run(code);
+
+    HPX_TEST(phylanx::execution_tree::is_float_operand_strict(result));
+    HPX_TEST(phylanx::ir::allclose(
+        phylanx::execution_tree::extract_float_value_strict(std::move(result)),
+        phylanx::execution_tree::extract_float_value(
+            compile_and_run(expected)),
+        1e-5, 1e-6));
+}
+
+// the result of the given expression is expected to be double precision
+void test_float64(std::string const& code, std::string const& expected)
+{
+    auto result = compile_and_run(code);
+
+    HPX_TEST(phylanx::execution_tree::is_numeric_operand_strict(result));
+    HPX_TEST(phylanx::ir::allclose(
+        phylanx::execution_tree::extract_numeric_value_strict(
+            std::move(result)),
+        phylanx::execution_tree::extract_numeric_value(
+            compile_and_run(expected))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_astype()
+{
+    test_float32(R"(astype(1.5, "float32"))", "1.5");
+    test_float32(R"(astype([1, 2, 3], "float32"))", "[1.0, 2.0, 3.0]");
+    test_float64(R"(astype(astype([1.5, 2.5], "float32"), "float64"))",
+        "[1.5, 2.5]");
+}
+
+void test_arithmetics()
+{
+    test_float32(R"(
+            block(
+                define(a, astype([1.0, 2.0, 3.0], "float32")),
+                a * a + a - 1
+            )
+        )", "[1.0, 5.0, 11.0]");
+
+    test_float32(R"(
+            block(
+                define(a, astype([[1.0, 2.0], [3.0, 4.0]], "float32")),
+                __add(__mul(a, 2), a)
+            )
+        )", "[[3.0, 6.0], [9.0, 12.0]]");
+
+    // mixing single and double precision promotes to double precision
+    test_float64(R"(
+            block(
+                define(a, astype([1.0, 2.0, 3.0], "float32")),
+                a + [1.0, 1.0, 1.0]
+            )
+        )", "[2.0, 3.0, 4.0]");
+}
+
+void test_generic()
+{
+    test_float32(R"(exp(astype([0.0, 1.0], "float32")))", "exp([0.0, 1.0])");
+    test_float32(R"(sqrt(astype([[4.0, 9.0]], "float32")))", "[[2.0, 3.0]]");
+    test_float32(R"(exp(astype([1, 2], "float32"), __arg(dtype, "float32")))",
+        "exp([1.0, 2.0])");
+}
+
+void test_constant()
+{
+    test_float32(R"(constant(2.0, list(2, 3), "float32"))",
+        "constant(2.0, list(2, 3))");
+}
+
+void test_dot()
+{
+    test_float32(R"(
+            block(
+                define(a, astype([1.0, 2.0, 3.0], "float32")),
+                dot(a, a)
+            )
+        )", "14.0");
+
+    test_float32(R"(
+            block(
+                define(a, astype([[1.0, 2.0], [3.0, 4.0]], "float32")),
+                dot(a, astype([1.0, 1.0], "float32"))
+            )
+        )", "[3.0, 7.0]");
+
+    test_float32(R"(
+            block(
+                define(a, astype([[1.0, 2.0], [3.0, 4.0]], "float32")),
+                dot(a, a)
+            )
+        )", "[[7.0, 10.0], [15.0, 22.0]]");
+
+    // mixing single and double precision promotes to double precision
+    test_float64(R"(
+            block(
+                define(a, astype([[1.0, 2.0], [3.0, 4.0]], "float32")),
+                dot(a, [1.0, 1.0])
+            )
+        )", "[3.0, 7.0]");
+}
+
+void test_keras_activations()
+{
+    std::string const value = "[[-2.0, -0.5], [0.5, 2.0]]";
+    std::string const value32 = "astype(" + value + ", \"float32\")";
+
+    for (std::string f : {"sigmoid", "hard_sigmoid", "softplus", "softsign",
+             "softmax", "relu"})
+    {
+        test_float32(f + "(" + value32 + ")", f + "(" + value + ")");
+    }
+
+    test_float32("elu(" + value32 + ", 0.5)", "elu(" + value + ", 0.5)");
+    test_float32("softmax(" + value32 + ", 0)", "softmax(" + value + ", 0)");
+    test_float32("relu(" + value32 + ", 0.1, 1.5)",
+        "relu(" + value + ", 0.1, 1.5)");
+}
+
+void test_conv()
+{
+    test_float32(R"(
+            conv1d(
+                astype([[[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]]], "float32"),
+                astype([[[1.0], [0.0]], [[0.0], [1.0]]], "float32"),
+                "same")
+        )", R"(
+            conv1d([[[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]]],
+                [[[1.0], [0.0]], [[0.0], [1.0]]], "same")
+        )");
+
+    test_float32(R"(
+            conv2d(constant(1.0, list(1, 3, 3, 2), "float32"),
+                constant(0.5, list(2, 2, 2, 1), "float32"))
+        )", R"(
+            conv2d(constant(1.0, list(1, 3, 3, 2)),
+                constant(0.5, list(2, 2, 2, 1)))
+        )");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_astype();
+    test_arithmetics();
+    test_generic();
+    test_constant();
+    test_dot();
+    test_keras_activations();
+    test_conv();
+
+    return hpx::util::report_errors();
+}
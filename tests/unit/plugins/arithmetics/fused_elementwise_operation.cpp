@@ -0,0 +1,247 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::compiler::function compile(std::string const& codestr,
+    phylanx::execution_tree::compiler::function_list& snippets)
+{
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    return phylanx::execution_tree::compile(codestr, snippets, env);
+}
+
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    return compile(codestr, snippets).run().arg_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the function call form of nested elementwise operations is fused, the
+// operator form is not
+void test_fused(std::string const& fused, std::string const& unfused)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = compile(fused, snippets);
+
+    HPX_TEST_EQ(
+        snippets.sequence_numbers_["__fused_elementwise"], std::size_t(1));
+
+    auto result = code.run().arg_;
+    auto expected = compile_and_run(unfused);
+
+    HPX_TEST_EQ(phylanx::execution_tree::extract_common_type(result),
+        phylanx::execution_tree::extract_common_type(expected));
+    HPX_TEST(phylanx::ir::allclose(
+        phylanx::execution_tree::extract_numeric_value(std::move(result)),
+        phylanx::execution_tree::extract_numeric_value(std::move(expected))));
+}
+
+void test_fused_concatenation(
+    std::string const& fused, std::string const& expected)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = compile(fused, snippets);
+
+    HPX_TEST_EQ(
+        snippets.sequence_numbers_["__fused_elementwise"], std::size_t(1));
+
+    HPX_TEST_EQ(code.run().arg_, compile_and_run(expected));
+}
+
+void test_not_fused(std::string const& code)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    compile(code, snippets);
+
+    HPX_TEST_EQ(
+        snippets.sequence_numbers_["__fused_elementwise"], std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fused_elementwise_0d()
+{
+    test_fused("__add(__mul(2, 3), 4)", "2 * 3 + 4");
+    test_fused("__sub(__mul(2.0, 3), __div(4, 2.0))", "2.0 * 3 - 4 / 2.0");
+    test_fused("__add(-3.0, __minus(4), __mul(2, 3, 4))",
+        "-3.0 + -4 + 2 * 3 * 4");
+    test_fused("sigmoid(__add(1.0, 2.0))", "sigmoid(1.0 + 2.0)");
+    test_fused("exp(__div(7, 2))", "exp(7 / 2)");
+}
+
+void test_fused_elementwise_1d()
+{
+    test_fused(R"(
+            block(
+                define(a, [1.0, 2.0, 3.0, 4.0]),
+                define(b, [4.0, 3.0, 2.0, 1.0]),
+                __add(__mul(a, b), sigmoid(a))
+            )
+        )", R"(
+            block(
+                define(a, [1.0, 2.0, 3.0, 4.0]),
+                define(b, [4.0, 3.0, 2.0, 1.0]),
+                a * b + sigmoid(a)
+            )
+        )");
+
+    // broadcast scalars and mixed types
+    test_fused(R"(
+            block(
+                define(a, [1, 2, 3, 4]),
+                __div(__sub(a, 1), exp(__mul(a, 0.5)))
+            )
+        )", R"(
+            block(
+                define(a, [1, 2, 3, 4]),
+                (a - 1) / exp(a * 0.5)
+            )
+        )");
+
+    // large enough to be evaluated in parallel
+    test_fused(R"(
+            block(
+                define(a, linspace(0.0, 1.0, 100000)),
+                define(b, linspace(1.0, 2.0, 100000)),
+                __add(__mul(a, b), tanh(a), __minus(b))
+            )
+        )", R"(
+            block(
+                define(a, linspace(0.0, 1.0, 100000)),
+                define(b, linspace(1.0, 2.0, 100000)),
+                a * b + tanh(a) + -b
+            )
+        )");
+}
+
+void test_fused_elementwise_2d()
+{
+    test_fused(R"(
+            block(
+                define(a, [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]]),
+                define(b, [10.0, 20.0, 30.0]),
+                __mul(__add(a, b), square(a))
+            )
+        )", R"(
+            block(
+                define(a, [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]]),
+                define(b, [10.0, 20.0, 30.0]),
+                (a + b) * square(a)
+            )
+        )");
+
+    test_fused(R"(
+            block(
+                define(a, [[1, 2, 3], [4, 5, 6]]),
+                __sub(__mul(a, a), sqrt(a))
+            )
+        )", R"(
+            block(
+                define(a, [[1, 2, 3], [4, 5, 6]]),
+                a * a - sqrt(a)
+            )
+        )");
+}
+
+void test_fused_elementwise_3d()
+{
+    test_fused(R"(
+            block(
+                define(a, [[[1.0, 2.0], [3.0, 4.0]], [[5.0, 6.0], [7.0, 8.0]]]),
+                __add(__mul(a, 2.0), log(a))
+            )
+        )", R"(
+            block(
+                define(a, [[[1.0, 2.0], [3.0, 4.0]], [[5.0, 6.0], [7.0, 8.0]]]),
+                a * 2.0 + log(a)
+            )
+        )");
+}
+
+// single precision arguments produce single precision results, the same
+// as for the unfused primitives
+void test_fused_elementwise_float32()
+{
+    for (std::string const op : {"sigmoid", "exp", "tanh", "square"})
+    {
+        test_fused(R"(
+                block(
+                    define(a, astype([[1.0, 2.0], [3.0, 4.0]], "float32")),
+                    define(b, astype([[0.5, -1.0], [-2.5, 1.0]], "float32")),
+                    )" + op + R"((__add(a, b))
+                )
+            )", R"(
+                block(
+                    define(a, astype([[1.0, 2.0], [3.0, 4.0]], "float32")),
+                    define(b, astype([[0.5, -1.0], [-2.5, 1.0]], "float32")),
+                    )" + op + R"((a + b)
+                )
+            )");
+    }
+}
+
+// __add concatenates lists (of strings or numbers), the leaves of the fused primitive
+// are evaluated by the unfused primitives in this case
+void test_fused_concatenation()
+{
+    test_fused_concatenation(R"(
+            block(
+                define(l1, list(1, 2)),
+                define(l2, list(3)),
+                define(l3, list(4, 5)),
+                __add(__add(l1, l2), l3)
+            )
+        )", "list(1, 2, 3, 4, 5)");
+
+    test_fused_concatenation(R"(
+            block(
+                define(l, list(1, 2)),
+                __add(__add(l, l), l)
+            )
+        )", "list(1, 2, 1, 2, 1, 2)");
+
+    test_fused_concatenation(
+        R"(__add(__add(list("ab"), list("cd", "ef")), list("gh")))",
+        R"(list("ab", "cd", "ef", "gh"))");
+}
+
+void test_not_fused()
+{
+    test_not_fused("__add(1, 2)");
+    test_not_fused("1 + 2 * 3");
+    test_not_fused(R"(__add(__mul__int(2, 3), 4))");
+    test_not_fused(R"(__add(exp(2, __arg(dtype, "float")), 4))");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_fused_elementwise_0d();
+    test_fused_elementwise_1d();
+    test_fused_elementwise_2d();
+    test_fused_elementwise_3d();
+    test_fused_elementwise_float32();
+
+    test_fused_concatenation();
+
+    test_not_fused();
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <string>
 
+#include <blaze/Math.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 phylanx::execution_tree::primitive_argument_type compile_and_run(
     std::string const& codestr)
@@ -281,6 +283,41 @@ void test_fmap_operation_func_lambda2()
         phylanx::execution_tree::extract_numeric_value(*it)[0], 6.0);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_fmap_operation_chunking()
+{
+    std::string const code = R"(
+            fmap(lambda(x, x + 1), "static:2", list(1, 2, 3, 4, 5))
+        )";
+
+    auto result =
+        phylanx::execution_tree::extract_list_value(compile_and_run(code));
+
+    HPX_TEST_EQ(result.size(), 5ul);
+
+    double expected = 2.0;
+    for (auto const& elem : result)
+    {
+        HPX_TEST_EQ(
+            phylanx::execution_tree::extract_numeric_value(elem)[0],
+            expected);
+        expected += 1.0;
+    }
+}
+
+void test_fmap_operation_chunking_vector()
+{
+    std::string const code = R"(
+            fmap(lambda(x, x * 2), "dynamic", [1.0, 2.0, 3.0, 4.0])
+        )";
+
+    auto result =
+        phylanx::execution_tree::extract_numeric_value(compile_and_run(code));
+
+    blaze::DynamicVector<double> expected{2.0, 4.0, 6.0, 8.0};
+    HPX_TEST_EQ(result, phylanx::ir::node_data<double>(expected));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -297,5 +334,8 @@ int main(int argc, char* argv[])
     test_fmap_operation_func2();
     test_fmap_operation_func_lambda2();
 
+    test_fmap_operation_chunking();
+    test_fmap_operation_chunking_vector();
+
     return hpx::util::report_errors();
 }
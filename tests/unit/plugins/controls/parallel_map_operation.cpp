@@ -279,6 +279,33 @@ void test_map_operation_func_lambda2()
         phylanx::execution_tree::extract_numeric_value(*it)[0], 6.0);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_map_operation_chunking()
+{
+    for (std::string policy : {"sequential", "auto", "static", "static:2",
+             "dynamic", "dynamic:3"})
+    {
+        std::string const code = R"(
+                parallel_map(lambda(x, y, x + y), ")" + policy + R"(",
+                    list(1, 2, 3, 4, 5), list(1, 2, 3, 4, 5))
+            )";
+
+        auto result =
+            phylanx::execution_tree::extract_list_value(compile_and_run(code));
+
+        HPX_TEST_EQ(result.size(), 5ul);
+
+        double expected = 2.0;
+        for (auto const& elem : result)
+        {
+            HPX_TEST_EQ(
+                phylanx::execution_tree::extract_numeric_value(elem)[0],
+                expected);
+            expected += 2.0;
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -295,5 +322,7 @@ int main(int argc, char* argv[])
     test_map_operation_func2();
     test_map_operation_func_lambda2();
 
+    test_map_operation_chunking();
+
     return hpx::util::report_errors();
 }
@@ -12,10 +12,13 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 phylanx::execution_tree::primitive_argument_type compile_and_run(
     std::string const& name, std::string const& codestr)
@@ -303,6 +306,35 @@ void test_random_3d_1()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// the tiles generated by random_d are identical to the corresponding parts
+// of the array generated by random
+void test_random_2d_values()
+{
+    std::uint32_t loc = hpx::get_locality_id();
+
+    auto result = phylanx::execution_tree::extract_list_value(
+        compile_and_run("test_random_2loc2d_values", R"(
+            block(
+                set_seed(42),
+                define(full, random(list(4, 6))),
+                set_seed(42),
+                define(tile, random_d(list(4, 6), find_here(), 2,
+                    "random_values", "row")),
+                list(full, tile)
+            )
+        )"));
+
+    auto it = result.begin();
+    auto full = phylanx::execution_tree::extract_numeric_value(*it);
+    auto tile = phylanx::execution_tree::extract_numeric_value(*++it);
+
+    blaze::DynamicMatrix<double> expected =
+        blaze::submatrix(full.matrix(), 2 * loc, 0, 2, 6);
+
+    HPX_TEST_EQ(tile, phylanx::ir::node_data<double>(std::move(expected)));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -319,6 +351,8 @@ int hpx_main(int argc, char* argv[])
     test_random_3d_0();
     test_random_3d_1();
 
+    test_random_2d_values();
+
     hpx::finalize();
     return hpx::util::report_errors();
 }
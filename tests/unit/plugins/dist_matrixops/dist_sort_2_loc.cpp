@@ -0,0 +1,110 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_sort_d_operation(std::string const& name, std::string const& code,
+    blaze::DynamicVector<double> const& expected)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+
+    HPX_TEST_EQ(hpx::cout,
+        phylanx::execution_tree::extract_numeric_value(result),
+        phylanx::ir::node_data<double>(expected));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The splitter selected from the regular samples of both tiles is 5.0, all
+// values up to it end up on locality 0
+void test_sort_d_1d_0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_0", R"(
+            sort_d(annotate_d([5.0, 1.0, 9.0, 3.0], "array_0",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 4)))))
+        )", blaze::DynamicVector<double>{0.0, 1.0, 2.0, 3.0, 4.0, 5.0});
+    }
+    else
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_0", R"(
+            sort_d(annotate_d([2.0, 8.0, 0.0, 7.0, 4.0, 6.0], "array_0",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 4, 10)))))
+        )", blaze::DynamicVector<double>{6.0, 7.0, 8.0, 9.0});
+    }
+}
+
+// Values equal to the splitter (2.0) are sent to the same locality
+void test_sort_d_1d_1()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_1", R"(
+            sort_d(annotate_d([3.0, -1.0, 2.0, 2.0], "array_1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 4)))))
+        )", blaze::DynamicVector<double>{-1.0, 2.0, 2.0, 2.0});
+    }
+    else
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_1", R"(
+            sort_d(annotate_d([2.0], "array_1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 4, 5)))))
+        )", blaze::DynamicVector<double>{3.0});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sort_d_1d_0();
+    test_sort_d_1d_1();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
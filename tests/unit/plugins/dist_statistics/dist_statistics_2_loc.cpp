@@ -0,0 +1,208 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_statistics_d_operation(std::string const& name,
+    std::string const& code, phylanx::ir::node_data<double> const& expected)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+
+    HPX_TEST_EQ(hpx::cout,
+        phylanx::execution_tree::extract_numeric_value(result), expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reducing all elements of a tiled vector gives the same (replicated) result
+// on all localities
+void test_sum_d_1d()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_sum_d_2loc1d", R"(
+            sum_d(annotate_d([1.0, 2.0], "array_sum_1d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 2)))))
+        )", phylanx::ir::node_data<double>(15.0));
+    }
+    else
+    {
+        test_statistics_d_operation("test_sum_d_2loc1d", R"(
+            sum_d(annotate_d([3.0, 4.0, 5.0], "array_sum_1d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 2, 5)))))
+        )", phylanx::ir::node_data<double>(15.0));
+    }
+}
+
+// The moments of the tiles are combined, the tiles have different sizes
+void test_mean_var_d_1d()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_mean_d_2loc1d", R"(
+            mean_d(annotate_d([1.0, 2.0], "array_mean_1d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 2)))))
+        )", phylanx::ir::node_data<double>(3.0));
+
+        test_statistics_d_operation("test_var_d_2loc1d", R"(
+            var_d(annotate_d([1.0, 2.0], "array_var_1d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 2)))))
+        )", phylanx::ir::node_data<double>(2.0));
+    }
+    else
+    {
+        test_statistics_d_operation("test_mean_d_2loc1d", R"(
+            mean_d(annotate_d([3.0, 4.0, 5.0], "array_mean_1d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 2, 5)))))
+        )", phylanx::ir::node_data<double>(3.0));
+
+        test_statistics_d_operation("test_var_d_2loc1d", R"(
+            var_d(annotate_d([3.0, 4.0, 5.0], "array_var_1d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 2, 5)))))
+        )", phylanx::ir::node_data<double>(2.0));
+    }
+}
+
+void test_logsumexp_d_1d()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_logsumexp_d_2loc1d", R"(
+            logsumexp_d(annotate_d([0.0, 0.0], "array_logsumexp_1d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("rows", 0, 2)))))
+        )", phylanx::ir::node_data<double>(std::log(5.0)));
+    }
+    else
+    {
+        test_statistics_d_operation("test_logsumexp_d_2loc1d", R"(
+            logsumexp_d(annotate_d([0.0, 0.0, 0.0], "array_logsumexp_1d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("rows", 2, 5)))))
+        )", phylanx::ir::node_data<double>(std::log(5.0)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reducing along the columns of a matrix tiled by rows is done locally, the
+// result is tiled like the rows of the argument
+void test_sum_d_2d_axis1()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_sum_d_2loc2d_axis1", R"(
+            sum_d(annotate_d([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]],
+                "array_sum_2d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("rows", 0, 2), list("columns", 0, 3)))),
+                1)
+        )", phylanx::ir::node_data<double>(
+                blaze::DynamicVector<double>{6.0, 15.0}));
+    }
+    else
+    {
+        test_statistics_d_operation("test_sum_d_2loc2d_axis1", R"(
+            sum_d(annotate_d([[7.0, 8.0, 9.0]], "array_sum_2d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("rows", 2, 3), list("columns", 0, 3)))),
+                1)
+        )", phylanx::ir::node_data<double>(
+                blaze::DynamicVector<double>{24.0}));
+    }
+}
+
+// Reducing along the tiled rows combines the partial results of all tiles
+void test_amin_d_2d_axis0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_amin_d_2loc2d_axis0", R"(
+            amin_d(annotate_d([[1.0, 8.0, 3.0], [4.0, 5.0, 6.0]],
+                "array_amin_2d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("rows", 0, 2), list("columns", 0, 3)))),
+                0)
+        )", phylanx::ir::node_data<double>(
+                blaze::DynamicVector<double>{1.0, 2.0, 3.0}));
+    }
+    else
+    {
+        test_statistics_d_operation("test_amin_d_2loc2d_axis0", R"(
+            amin_d(annotate_d([[7.0, 2.0, 9.0]], "array_amin_2d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("rows", 2, 3), list("columns", 0, 3)))),
+                0)
+        )", phylanx::ir::node_data<double>(
+                blaze::DynamicVector<double>{1.0, 2.0, 3.0}));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sum_d_1d();
+    test_mean_var_d_1d();
+    test_logsumexp_d_1d();
+
+    test_sum_d_2d_axis1();
+    test_amin_d_2d_axis0();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
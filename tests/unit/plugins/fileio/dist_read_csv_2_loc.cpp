@@ -12,6 +12,8 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstdio>
+#include <fstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -194,6 +196,46 @@ void test_read_csv_3d_1()
     }
 }
 
+// each locality loads the byte range holding the rows of its tile only, the
+// lines have different lengths and the first tile spans both byte ranges
+void test_read_csv_2d_1()
+{
+    std::string filename =
+        "test_20201016_2loc_" + std::to_string(hpx::get_locality_id());
+    {
+        std::ofstream outfile(filename.c_str(), std::ios::binary);
+        outfile << "123456789.125,-987654321.5\r\n3,4\r\n5,6\r\n"
+                   "7.5,8.25\r\n9,10";
+    }
+
+    std::string const code = R"(
+            file_read_csv_d(")" + filename + R"(", false, 1, "row", 0, "test_2")
+        )";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_csv_d_operation("test_read_csv_2loc2d_1", code, R"(
+            annotate_d([[123456789.125, -987654321.5], [3, 4], [5, 6]],
+                "test_2",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 2), list("rows", 0, 3))))
+        )");
+    }
+    else
+    {
+        test_read_csv_d_operation("test_read_csv_2loc2d_1", code, R"(
+            annotate_d([[7.5, 8.25], [9, 10]],
+                "test_2",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 0, 2), list("rows", 3, 5))))
+        )");
+    }
+
+    std::remove(filename.c_str());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -218,6 +260,7 @@ int hpx_main(int argc, char* argv[])
     f.get();
 
     test_read_csv_2d_0();
+    test_read_csv_2d_1();
 
     test_read_csv_3d_0();
     test_read_csv_3d_1();
@@ -0,0 +1,209 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_read_hdf5_d_operation(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+    phylanx::execution_tree::primitive_argument_type comparison =
+        compile_and_run(name, expected_str);
+
+    HPX_TEST_EQ(hpx::cout, result, comparison);
+}
+
+// every locality writes its own copy of the file
+std::string write_dataset(std::string const& filename,
+    phylanx::ir::node_data<double>&& in)
+{
+    phylanx::execution_tree::primitive outfile =
+        phylanx::execution_tree::primitives::create_file_write_hdf5(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                {filename}, {std::string("dataset")}, std::move(in)});
+
+    outfile.eval().get();
+    return filename;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_read_hdf5_1d(std::string const& filename)
+{
+    std::string const code = R"(
+            file_read_hdf5_d(")" + filename + R"(", "dataset", "sym", nil,
+                "hdf5_1d")
+        )";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc1d", code, R"(
+            annotate_d([1.0, 2.0, 3.0], "hdf5_1d",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc1d", code, R"(
+            annotate_d([4.0, 5.0], "hdf5_1d",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 3, 5))))
+        )");
+    }
+}
+
+void test_read_hdf5_2d_row(std::string const& filename)
+{
+    std::string const code = R"(
+            file_read_hdf5_d(")" + filename + R"(", "dataset", "row", nil,
+                "hdf5_2d_row")
+        )";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_row", code, R"(
+            annotate_d([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], "hdf5_2d_row",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3), list("rows", 0, 2))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_row", code, R"(
+            annotate_d([[7.0, 8.0, 9.0], [10.0, 11.0, 12.0]], "hdf5_2d_row",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 0, 3), list("rows", 2, 4))))
+        )");
+    }
+}
+
+void test_read_hdf5_2d_column(std::string const& filename)
+{
+    std::string const code = R"(
+            file_read_hdf5_d(")" + filename + R"(", "dataset", "column", nil,
+                "hdf5_2d_column")
+        )";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_column", code, R"(
+            annotate_d([[1.0, 2.0], [4.0, 5.0], [7.0, 8.0], [10.0, 11.0]],
+                "hdf5_2d_column",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 2), list("rows", 0, 4))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_column", code, R"(
+            annotate_d([[3.0], [6.0], [9.0], [12.0]], "hdf5_2d_column",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 2, 3), list("rows", 0, 4))))
+        )");
+    }
+}
+
+// the tiles overlap by one row
+void test_read_hdf5_2d_intersection(std::string const& filename)
+{
+    std::string const code = R"(
+            file_read_hdf5_d(")" + filename + R"(", "dataset", "row", 1,
+                "hdf5_2d_intersection")
+        )";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_intersection", code,
+            R"(
+            annotate_d([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0], [7.0, 8.0, 9.0]],
+                "hdf5_2d_intersection",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3), list("rows", 0, 3))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_intersection", code,
+            R"(
+            annotate_d([[4.0, 5.0, 6.0], [7.0, 8.0, 9.0], [10.0, 11.0, 12.0]],
+                "hdf5_2d_intersection",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 0, 3), list("rows", 1, 4))))
+        )");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    std::string const suffix = std::to_string(hpx::get_locality_id());
+
+    std::string filename1d = write_dataset("test_20201016_2loc1d_" + suffix,
+        phylanx::ir::node_data<double>{
+            blaze::DynamicVector<double>{1.0, 2.0, 3.0, 4.0, 5.0}});
+
+    std::string filename2d = write_dataset("test_20201016_2loc2d_" + suffix,
+        phylanx::ir::node_data<double>{blaze::DynamicMatrix<double>{
+            {1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0},
+            {10.0, 11.0, 12.0}}});
+
+    test_read_hdf5_1d(filename1d);
+
+    test_read_hdf5_2d_row(filename2d);
+    test_read_hdf5_2d_column(filename2d);
+    test_read_hdf5_2d_intersection(filename2d);
+
+    std::remove(filename1d.c_str());
+    std::remove(filename2d.c_str());
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -91,6 +92,40 @@ void test_file_io(phylanx::ir::node_data<double> const& in)
     test_file_io_primitive(in);
 }
 
+void test_file_read_text(std::string const& text,
+    phylanx::ir::node_data<double> const& expected)
+{
+    std::string filename = std::tmpnam(nullptr);
+
+    {
+        std::ofstream outfile(filename.c_str(), std::ios::binary);
+        outfile << text;
+    }
+
+    phylanx::execution_tree::primitive infile =
+        phylanx::execution_tree::primitives::create_file_read_csv(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{{filename}});
+
+    HPX_TEST(expected ==
+        phylanx::execution_tree::extract_numeric_value(infile.eval().get()));
+
+    std::remove(filename.c_str());
+}
+
+void test_file_read_text()
+{
+    // windows line endings, no trailing newline
+    test_file_read_text("1,2\r\n3,4\r\n5,6",
+        phylanx::ir::node_data<double>(
+            blaze::DynamicMatrix<double>{{1, 2}, {3, 4}, {5, 6}}));
+
+    // a partially numeric header line is skipped
+    test_file_read_text("1a,2b\n1.5,2.5,3.5\n",
+        phylanx::ir::node_data<double>(
+            blaze::DynamicVector<double>{1.5, 2.5, 3.5}));
+}
+
 int main(int argc, char* argv[])
 {
     blaze::Rand<blaze::DynamicVector<double>> gen{};
@@ -109,5 +144,7 @@ int main(int argc, char* argv[])
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 101UL);
     test_file_io(phylanx::ir::node_data<double>(std::move(m)));
 
+    test_file_read_text();
+
     return hpx::util::report_errors();
 }
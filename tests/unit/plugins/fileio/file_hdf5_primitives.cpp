@@ -10,11 +10,25 @@
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSpace.hpp>
+#include <highfive/H5File.hpp>
+
+#include <H5Dpublic.h>
+#include <H5Ppublic.h>
+#include <H5Spublic.h>
+#include <H5Tpublic.h>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
 void test_file_io_lit(phylanx::ir::node_data<double> const& in)
 {
     std::string filename = std::tmpnam(nullptr);
@@ -93,6 +107,216 @@ void test_file_io(phylanx::ir::node_data<double> const& in)
     test_file_io_primitive(in);
 }
 
+phylanx::execution_tree::primitive_argument_type make_list(
+    std::int64_t first, std::int64_t second)
+{
+    return phylanx::execution_tree::primitive_argument_type{
+        phylanx::ir::range(phylanx::execution_tree::primitive_arguments_type{
+            phylanx::ir::node_data<std::int64_t>{first},
+            phylanx::ir::node_data<std::int64_t>{second}})};
+}
+
+void test_file_io_hyperslab(blaze::DynamicMatrix<double> const& in)
+{
+    std::string filename = std::tmpnam(nullptr);
+    std::string dataset_name("dataset");
+
+    // write to file
+    {
+        phylanx::execution_tree::primitive outfile =
+            phylanx::execution_tree::primitives::create_file_write_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    dataset_name, phylanx::ir::node_data<double>{in}});
+
+        auto f = outfile.eval();
+        f.get();
+    }
+
+    // read back every second row starting at row 3, and 7 columns starting
+    // at column 5
+    hpx::future<phylanx::execution_tree::primitive_argument_type> f;
+    {
+        phylanx::execution_tree::primitive infile =
+            phylanx::execution_tree::primitives::create_file_read_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    dataset_name, make_list(3, 5), make_list(10, 7),
+                    make_list(2, 1)});
+
+        f = infile.eval();
+    }
+
+    blaze::DynamicMatrix<double> expected(10, 7);
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        for (std::size_t j = 0; j != 7; ++j)
+        {
+            expected(i, j) = in(3 + 2 * i, 5 + j);
+        }
+    }
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>{std::move(expected)},
+        phylanx::execution_tree::extract_numeric_value(f.get()));
+
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type make_list(
+    std::vector<std::int64_t> const& values)
+{
+    phylanx::execution_tree::primitive_arguments_type list;
+    for (std::int64_t value : values)
+    {
+        list.emplace_back(phylanx::ir::node_data<std::int64_t>{value});
+    }
+    return phylanx::execution_tree::primitive_argument_type{
+        phylanx::ir::range(std::move(list))};
+}
+
+// the writer supports up to two dimensions, write the (dense, row-major)
+// values of higher dimensional datasets directly
+void write_dataset(std::string const& filename,
+    std::string const& dataset_name, std::vector<std::size_t> const& dims,
+    std::vector<double> const& values)
+{
+    HighFive::File outfile(filename,
+        HighFive::File::ReadWrite | HighFive::File::Create |
+            HighFive::File::Truncate);
+
+    HighFive::DataSet dataset =
+        outfile.createDataSet<double>(dataset_name, HighFive::DataSpace(dims));
+    H5Dwrite(dataset.getId(), H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL,
+        H5P_DEFAULT, values.data());
+}
+
+phylanx::execution_tree::primitive_argument_type read_hyperslab(
+    std::string const& filename, std::string const& dataset_name,
+    std::vector<std::int64_t> const& start,
+    std::vector<std::int64_t> const& count,
+    std::vector<std::int64_t> const& stride)
+{
+    phylanx::execution_tree::primitive infile =
+        phylanx::execution_tree::primitives::create_file_read_hdf5(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{filename,
+                dataset_name, make_list(start), make_list(count),
+                make_list(stride)});
+
+    return infile.eval().get();
+}
+
+void test_file_io_hyperslab_3d()
+{
+    std::string filename = std::tmpnam(nullptr);
+    std::string dataset_name("dataset");
+
+    // value(i, j, k) = 100 * i + 10 * j + k
+    std::vector<double> values;
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        for (std::size_t j = 0; j != 6; ++j)
+        {
+            for (std::size_t k = 0; k != 7; ++k)
+            {
+                values.push_back(double(100 * i + 10 * j + k));
+            }
+        }
+    }
+    write_dataset(filename, dataset_name, {5, 6, 7}, values);
+
+    // read every second page starting at page 1, 3 rows starting at row 2,
+    // and every third column starting at column 0
+    auto result = read_hyperslab(
+        filename, dataset_name, {1, 2, 0}, {2, 3, 3}, {2, 1, 3});
+
+    blaze::DynamicTensor<double> expected(2, 3, 3);
+    for (std::size_t k = 0; k != 2; ++k)
+    {
+        for (std::size_t i = 0; i != 3; ++i)
+        {
+            for (std::size_t j = 0; j != 3; ++j)
+            {
+                expected(k, i, j) =
+                    double(100 * (1 + 2 * k) + 10 * (2 + i) + 3 * j);
+            }
+        }
+    }
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>{std::move(expected)},
+        phylanx::execution_tree::extract_numeric_value(std::move(result)));
+
+    // a count of zero selects all remaining elements of that dimension
+    result = read_hyperslab(
+        filename, dataset_name, {4, 0, 5}, {0, 0, 0}, {1, 5, 1});
+
+    blaze::DynamicTensor<double> expected_all(1, 2, 2);
+    for (std::size_t i = 0; i != 2; ++i)
+    {
+        for (std::size_t j = 0; j != 2; ++j)
+        {
+            expected_all(0, i, j) = double(400 + 10 * (5 * i) + 5 + j);
+        }
+    }
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>{std::move(expected_all)},
+        phylanx::execution_tree::extract_numeric_value(std::move(result)));
+
+    std::remove(filename.c_str());
+}
+
+void test_file_io_hyperslab_4d()
+{
+    std::string filename = std::tmpnam(nullptr);
+    std::string dataset_name("dataset");
+
+    // value(l, i, j, k) = 1000 * l + 100 * i + 10 * j + k
+    std::vector<double> values;
+    for (std::size_t l = 0; l != 3; ++l)
+    {
+        for (std::size_t i = 0; i != 4; ++i)
+        {
+            for (std::size_t j = 0; j != 5; ++j)
+            {
+                for (std::size_t k = 0; k != 6; ++k)
+                {
+                    values.push_back(
+                        double(1000 * l + 100 * i + 10 * j + k));
+                }
+            }
+        }
+    }
+    write_dataset(filename, dataset_name, {3, 4, 5, 6}, values);
+
+    // read 2 quats starting at quat 1, every second page, 2 rows starting
+    // at row 3, and every second column starting at column 1
+    auto result = read_hyperslab(
+        filename, dataset_name, {1, 0, 3, 1}, {2, 2, 2, 3}, {1, 2, 1, 2});
+
+    blaze::DynamicArray<4, double> expected(2, 2, 2, 3);
+    for (std::size_t l = 0; l != 2; ++l)
+    {
+        for (std::size_t k = 0; k != 2; ++k)
+        {
+            for (std::size_t i = 0; i != 2; ++i)
+            {
+                for (std::size_t j = 0; j != 3; ++j)
+                {
+                    expected(l, k, i, j) = double(1000 * (1 + l) +
+                        100 * (2 * k) + 10 * (3 + i) + (1 + 2 * j));
+                }
+            }
+        }
+    }
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>{std::move(expected)},
+        phylanx::execution_tree::extract_numeric_value(std::move(result)));
+
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
     test_file_io(phylanx::ir::node_data<double>(42.0));
@@ -108,7 +332,11 @@ int main(int argc, char* argv[])
     blaze::Rand<blaze::DynamicMatrix<double>> gen2{};
 
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 102UL);
-    test_file_io(phylanx::ir::node_data<double>(std::move(m)));
+    test_file_io(phylanx::ir::node_data<double>(m));
+
+    test_file_io_hyperslab(m);
+    test_file_io_hyperslab_3d();
+    test_file_io_hyperslab_4d();
 
     return hpx::util::report_errors();
 }
@@ -104,5 +104,15 @@ int main(int argc, char* argv[])
         "[[   0.,    0.,    0.,    0.],[  27.,  -31.,  -85., -294.]],"
         "[[   0.,    0.,    0.,    0.],[  35.,   16.,    0.,   17.]]]]");
 
+    // pointwise convolution
+    test_conv2d_operation(R"(conv2d([[[[ 1,  2],[ 3,  4]],[[ 5,  6],[ 7,  8]],
+                          [[ 9, 10],[11, 12]]],[[[13, 14],[15, 16]],
+                          [[17, 18],[19, 20]],[[21, 22],[23, 24]]]],
+                          [[[[ 1, 0, 2],[-1, 1, 0]]]]))",
+        "[[[[-1.,  2.,  2.],[-1.,  4.,  6.]],[[-1.,  6., 10.],[-1.,  8., 14.]],"
+        "[[-1., 10., 18.],[-1., 12., 22.]]],"
+        "[[[-1., 14., 26.],[-1., 16., 30.]],[[-1., 18., 34.],[-1., 20., 38.]],"
+        "[[-1., 22., 42.],[-1., 24., 46.]]]]");
+
     return hpx::util::report_errors();
 }
@@ -4,6 +4,7 @@
 //   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/random.hpp>
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/modules/testing.hpp>
@@ -54,6 +55,40 @@ void set_seed(std::uint32_t seed)
 
     call(static_cast<std::int64_t>(seed));
 }
+///////////////////////////////////////////////////////////////////////////////
+// Mirrors the counter based generation of the random primitive: each array
+// uses the next key, the value of each element is determined by its
+// (row-major) index
+class reference_generator
+{
+public:
+    explicit reference_generator(std::uint32_t seed)
+      : seed_(seed)
+      , count_(0)
+      , key_(0)
+      , index_(0)
+    {
+    }
+
+    void next_array()
+    {
+        key_ = (std::uint64_t(seed_) << 32) | count_++;
+        index_ = 0;
+    }
+
+    template <typename Dist>
+    typename Dist::result_type operator()(Dist& dist)
+    {
+        return phylanx::util::random_element(dist, key_, index_++);
+    }
+
+private:
+    std::uint32_t seed_;
+    std::uint32_t count_;
+    std::uint64_t key_;
+    std::uint64_t index_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // generate single random double value
 template <typename T, typename Gen, typename Dist>
@@ -65,9 +100,10 @@ void generate_0d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    gen.next_array();
 
     HPX_TEST_EQ(
-        static_cast<T>(dist(gen)),
+        static_cast<T>(gen(dist)),
         static_cast<T>(
             phylanx::execution_tree::extract_node_data<T>(result)[0]));
 }
@@ -83,11 +119,12 @@ void generate_1d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    gen.next_array();
 
     blaze::DynamicVector<T> v(32);
     for (auto& val : v)
     {
-        val = dist(gen);
+        val = gen(dist);
     }
 
     HPX_TEST_EQ(phylanx::ir::node_data<T>(std::move(v)),
@@ -105,13 +142,14 @@ void generate_2d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    gen.next_array();
 
     blaze::DynamicMatrix<T> m(32, 16);
     for (std::size_t row = 0; row != blaze::rows(m); ++row)
     {
         for (auto& val : blaze::row(m, row))
         {
-            val = dist(gen);
+            val = gen(dist);
         }
     }
 
@@ -131,6 +169,7 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    gen.next_array();
 
     blaze::DynamicTensor<T> t(3, 32, 16);
     for (std::size_t page = 0; page != blaze::pages(t); ++page)
@@ -139,7 +178,7 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
         {
             for (auto& val : blaze::row(blaze::pageslice(t, page), row))
             {
-                val = dist(gen);
+                val = gen(dist);
             }
         }
     }
@@ -161,6 +200,7 @@ void generate_4d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    gen.next_array();
 
     blaze::DynamicArray<4UL, T> q(3UL, 32UL, 16UL, 13UL);
     for (std::size_t quat = 0; quat != blaze::quats(q); ++quat)
@@ -173,7 +213,7 @@ void generate_4d(phylanx::execution_tree::compiler::function const& call,
                     blaze::row(
                         blaze::pageslice(blaze::quatslice(q, quat), page), row))
                 {
-                    val = dist(gen);
+                    val = gen(dist);
                 }
             }
         }
@@ -184,7 +224,7 @@ void generate_4d(phylanx::execution_tree::compiler::function const& call,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_normal_distribution_implicit(std::mt19937& gen)
+void test_normal_distribution_implicit(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size)),
@@ -215,7 +255,7 @@ void test_normal_distribution_implicit(std::mt19937& gen)
     }
 }
 
-void test_uniform_distribution_explicit(std::mt19937& gen)
+void test_uniform_distribution_explicit(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "uniform")),
@@ -246,7 +286,7 @@ void test_uniform_distribution_explicit(std::mt19937& gen)
     }
 }
 
-void test_uniform_distribution_explicit_params(std::mt19937& gen)
+void test_uniform_distribution_explicit_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("uniform", 2.0, 4.0))),
@@ -278,7 +318,7 @@ void test_uniform_distribution_explicit_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_uniform_int_distribution_explicit(std::mt19937& gen)
+void test_uniform_int_distribution_explicit(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "uniform_int", __arg(dtype, "int"))),
@@ -309,7 +349,7 @@ void test_uniform_int_distribution_explicit(std::mt19937& gen)
     }
 }
 
-void test_uniform_int_distribution_explicit_params(std::mt19937& gen)
+void test_uniform_int_distribution_explicit_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size,
@@ -343,7 +383,7 @@ void test_uniform_int_distribution_explicit_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_bernoulli_distribution(std::mt19937& gen)
+void test_bernoulli_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "bernoulli", __arg(dtype, "bool"))),
@@ -374,7 +414,7 @@ void test_bernoulli_distribution(std::mt19937& gen)
     }
 }
 
-void test_bernoulli_distribution_params(std::mt19937& gen)
+void test_bernoulli_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size,
@@ -408,7 +448,7 @@ void test_bernoulli_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_binomial_distribution(std::mt19937& gen)
+void test_binomial_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("binomial", 1.0, 0.5))),
@@ -439,7 +479,7 @@ void test_binomial_distribution(std::mt19937& gen)
     }
 }
 
-void test_binomial_distribution_params(std::mt19937& gen)
+void test_binomial_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("binomial", 10, 0.8))),
@@ -471,7 +511,7 @@ void test_binomial_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_negative_binomial_distribution(std::mt19937& gen)
+void test_negative_binomial_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("negative_binomial", 1.0, 0.5))),
@@ -502,7 +542,7 @@ void test_negative_binomial_distribution(std::mt19937& gen)
     }
 }
 
-void test_negative_binomial_distribution_params(std::mt19937& gen)
+void test_negative_binomial_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("negative_binomial", 10, 0.8))),
@@ -534,7 +574,7 @@ void test_negative_binomial_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_geometric_distribution(std::mt19937& gen)
+void test_geometric_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("geometric", 0.5))),
@@ -565,7 +605,7 @@ void test_geometric_distribution(std::mt19937& gen)
     }
 }
 
-void test_geometric_distribution_params(std::mt19937& gen)
+void test_geometric_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("geometric", 0.8))),
@@ -597,7 +637,7 @@ void test_geometric_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_poisson_distribution(std::mt19937& gen)
+void test_poisson_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("poisson", 1.0))),
@@ -628,7 +668,7 @@ void test_poisson_distribution(std::mt19937& gen)
     }
 }
 
-void test_poisson_distribution_params(std::mt19937& gen)
+void test_poisson_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("poisson", 4))),
@@ -660,7 +700,7 @@ void test_poisson_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_exponential_distribution(std::mt19937& gen)
+void test_exponential_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("exponential", 1.0))),
@@ -691,7 +731,7 @@ void test_exponential_distribution(std::mt19937& gen)
     }
 }
 
-void test_exponential_distribution_params(std::mt19937& gen)
+void test_exponential_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("exponential", 2.0))),
@@ -723,7 +763,7 @@ void test_exponential_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_gamma_distribution(std::mt19937& gen)
+void test_gamma_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("gamma", 1.0))),
@@ -754,7 +794,7 @@ void test_gamma_distribution(std::mt19937& gen)
     }
 }
 
-void test_gamma_distribution_params(std::mt19937& gen)
+void test_gamma_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("gamma", 0.8, 1.2))),
@@ -786,7 +826,7 @@ void test_gamma_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_weibull_distribution(std::mt19937& gen)
+void test_weibull_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("weibull", 1.0))),
@@ -817,7 +857,7 @@ void test_weibull_distribution(std::mt19937& gen)
     }
 }
 
-void test_weibull_distribution_params(std::mt19937& gen)
+void test_weibull_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("weibull", 0.8, 1.2))),
@@ -849,7 +889,7 @@ void test_weibull_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_extreme_value_distribution(std::mt19937& gen)
+void test_extreme_value_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "extreme_value")),
@@ -880,7 +920,7 @@ void test_extreme_value_distribution(std::mt19937& gen)
     }
 }
 
-void test_extreme_value_distribution_params(std::mt19937& gen)
+void test_extreme_value_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("extreme_value", 0.8, 1.2))),
@@ -912,7 +952,7 @@ void test_extreme_value_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_normal_distribution(std::mt19937& gen)
+void test_normal_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "normal")),
@@ -943,7 +983,7 @@ void test_normal_distribution(std::mt19937& gen)
     }
 }
 
-void test_normal_distribution_params(std::mt19937& gen)
+void test_normal_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("normal", 0.8, 1.2))),
@@ -975,7 +1015,7 @@ void test_normal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_truncated_normal_distribution(std::mt19937& gen)
+void test_truncated_normal_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "truncated_normal")),
@@ -1006,7 +1046,7 @@ void test_truncated_normal_distribution(std::mt19937& gen)
     }
 }
 
-void test_truncated_normal_distribution_params(std::mt19937& gen)
+void test_truncated_normal_distribution_params(reference_generator& gen)
 {
     using namespace phylanx::execution_tree::primitives;
 
@@ -1042,7 +1082,7 @@ void test_truncated_normal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_lognormal_distribution(std::mt19937& gen)
+void test_lognormal_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "lognormal")),
@@ -1073,7 +1113,7 @@ void test_lognormal_distribution(std::mt19937& gen)
     }
 }
 
-void test_lognormal_distribution_params(std::mt19937& gen)
+void test_lognormal_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("lognormal", 0.8, 1.2))),
@@ -1105,7 +1145,7 @@ void test_lognormal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_chi_squared_distribution(std::mt19937& gen)
+void test_chi_squared_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("chi_squared", 1.0))),
@@ -1136,7 +1176,7 @@ void test_chi_squared_distribution(std::mt19937& gen)
     }
 }
 
-void test_chi_squared_distribution_params(std::mt19937& gen)
+void test_chi_squared_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("chi_squared", 0.8))),
@@ -1168,7 +1208,7 @@ void test_chi_squared_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_cauchy_distribution(std::mt19937& gen)
+void test_cauchy_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "cauchy")),
@@ -1199,7 +1239,7 @@ void test_cauchy_distribution(std::mt19937& gen)
     }
 }
 
-void test_cauchy_distribution_params(std::mt19937& gen)
+void test_cauchy_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("cauchy", 0.6, 0.8))),
@@ -1231,7 +1271,7 @@ void test_cauchy_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_fisher_f_distribution(std::mt19937& gen)
+void test_fisher_f_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("fisher_f", 1.0))),
@@ -1262,7 +1302,7 @@ void test_fisher_f_distribution(std::mt19937& gen)
     }
 }
 
-void test_fisher_f_distribution_params(std::mt19937& gen)
+void test_fisher_f_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("fisher_f", 0.6, 0.8))),
@@ -1294,7 +1334,7 @@ void test_fisher_f_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_student_t_distribution(std::mt19937& gen)
+void test_student_t_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("student_t", 1.0))),
@@ -1325,7 +1365,7 @@ void test_student_t_distribution(std::mt19937& gen)
     }
 }
 
-void test_student_t_distribution_params(std::mt19937& gen)
+void test_student_t_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("student_t", 0.8))),
@@ -1364,7 +1404,7 @@ int main(int argc, char* argv[])
     set_seed(seed);
     HPX_TEST_EQ(get_seed(), seed);
 
-    std::mt19937 gen(seed);
+    reference_generator gen(seed);
 
     test_normal_distribution_implicit(gen);
 
@@ -0,0 +1,106 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sparse_operation(std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
+}
+
+void test_is_sparse(std::string const& code, bool expected)
+{
+    HPX_TEST_EQ(
+        phylanx::execution_tree::is_sparse_operand(compile_and_run(code)),
+        expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // conversions
+    test_is_sparse("sparse([0., 1., 0., 2.])", true);
+    test_is_sparse("sparse([[0., 1.], [0., 0.]])", true);
+    test_is_sparse("todense(sparse([[0., 1.], [0., 0.]]))", false);
+
+    test_sparse_operation(
+        "todense(sparse([0., 1., 0., 2.]))", "[0., 1., 0., 2.]");
+    test_sparse_operation(
+        "todense(sparse([[0., 1.], [3., 0.]]))", "[[0., 1.], [3., 0.]]");
+    test_sparse_operation("sparse([[0, 1], [3, 0]])", "[[0., 1.], [3., 0.]]");
+
+    // products
+    test_sparse_operation(
+        "dot(sparse([[0., 1.], [3., 0.]]), [2., 5.])", "[5., 6.]");
+    test_sparse_operation(
+        "dot(sparse([0., 1., 0.]), sparse([4., 5., 6.]))", "5.");
+    test_is_sparse(
+        "dot(sparse([[0., 1.], [3., 0.]]), sparse([[1., 0.], [0., 2.]]))",
+        true);
+    test_sparse_operation(
+        "dot(sparse([[0., 1.], [3., 0.]]), sparse([[1., 0.], [0., 2.]]))",
+        "[[0., 2.], [3., 0.]]");
+
+    test_is_sparse("sparse([[0., 1.], [3., 0.]]) * 2.", true);
+    test_sparse_operation(
+        "sparse([[0., 1.], [3., 0.]]) * 2.", "[[0., 2.], [6., 0.]]");
+    test_sparse_operation("sparse([[0., 1.], [3., 0.]]) * [[4., 5.], [6., 7.]]",
+        "[[0., 5.], [18., 0.]]");
+
+    // transpose
+    test_is_sparse("transpose(sparse([[0., 1.], [3., 0.]]))", true);
+    test_sparse_operation("transpose(sparse([[0., 1., 0.], [3., 0., 4.]]))",
+        "[[0., 3.], [1., 0.], [0., 4.]]");
+
+    // reductions
+    test_sparse_operation("sum(sparse([[0., 1.], [3., 0.]]))", "4.");
+    test_sparse_operation("sum(sparse([[0., 1.], [3., 2.]]), 0)", "[3., 3.]");
+    test_sparse_operation("sum(sparse([[0., 1.], [3., 2.]]), 1)", "[1., 5.]");
+    test_sparse_operation(
+        "sum(sparse([[0., 1.], [3., 2.]]), 1, true)", "[[1.], [5.]]");
+    test_sparse_operation("mean(sparse([[0., 1.], [3., 0.]]))", "1.");
+
+    // slicing
+    test_sparse_operation("slice(sparse([0., 1., 0., 2.]), 3)", "2.");
+    test_is_sparse("slice(sparse([0., 1., 0., 2.]), list(1, 4))", true);
+    test_sparse_operation(
+        "slice(sparse([0., 1., 0., 2.]), list(1, 4))", "[1., 0., 2.]");
+    test_sparse_operation(
+        "slice(sparse([0., 1., 0., 2.]), list(0, 4, 2))", "[0., 0.]");
+    test_sparse_operation(
+        "slice(sparse([[0., 1., 0.], [3., 0., 4.]]), 1, nil)", "[3., 0., 4.]");
+    test_sparse_operation(
+        "slice(sparse([[0., 1., 0.], [3., 0., 4.]]), nil, 1)", "[1., 0.]");
+    test_sparse_operation(
+        "slice(sparse([[0., 1., 0.], [3., 0., 4.]]), list(0, 2), list(1, 3))",
+        "[[1., 0.], [0., 4.]]");
+    test_sparse_operation(
+        "slice(sparse([[0., 1., 0.], [3., 0., 4.]]), nil, list(0, 3, 2))",
+        "[[0., 0.], [3., 4.]]");
+    test_sparse_operation(
+        "slice(sparse([0., 1., 0., 2.]), [3, 1])", "[2., 1.]");
+
+    return hpx::util::report_errors();
+}
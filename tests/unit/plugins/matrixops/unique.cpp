@@ -56,6 +56,45 @@ void test_unique_1d()
         phylanx::execution_tree::extract_numeric_value(f.get()));
 }
 
+void test_unique_1d_groups()
+{
+    using arg_type = phylanx::execution_tree::primitive_argument_type;
+
+    blaze::DynamicVector<double> v1{2.0, 1.0, 4.0, 1.0, 3.0, 1.0, 3.0};
+
+    blaze::DynamicVector<double> expected{1.0, 2.0, 3.0, 4.0};
+    blaze::DynamicVector<std::int64_t> expected_index{1, 0, 4, 2};
+    blaze::DynamicVector<std::int64_t> expected_inverse{
+        1, 0, 3, 0, 2, 0, 2};
+    blaze::DynamicVector<std::int64_t> expected_counts{3, 1, 2, 1};
+
+    phylanx::execution_tree::primitive lhs =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), phylanx::ir::node_data<double>(v1));
+
+    phylanx::execution_tree::primitive p =
+        phylanx::execution_tree::primitives::create_unique(hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{std::move(lhs),
+                arg_type{}, arg_type{phylanx::ir::node_data<std::uint8_t>(1)},
+                arg_type{phylanx::ir::node_data<std::uint8_t>(1)},
+                arg_type{phylanx::ir::node_data<std::uint8_t>(1)}});
+
+    hpx::future<arg_type> f = p.eval();
+
+    auto result = phylanx::execution_tree::extract_list_value(f.get());
+    HPX_TEST_EQ(result.size(), std::ptrdiff_t(4));
+
+    auto it = result.begin();
+    HPX_TEST_EQ(phylanx::ir::node_data<double>(expected),
+        phylanx::execution_tree::extract_numeric_value(*it++));
+    HPX_TEST_EQ(phylanx::ir::node_data<std::int64_t>(expected_index),
+        phylanx::execution_tree::extract_integer_value(*it++));
+    HPX_TEST_EQ(phylanx::ir::node_data<std::int64_t>(expected_inverse),
+        phylanx::execution_tree::extract_integer_value(*it++));
+    HPX_TEST_EQ(phylanx::ir::node_data<std::int64_t>(expected_counts),
+        phylanx::execution_tree::extract_integer_value(*it));
+}
+
 void test_unique_2d()
 {
     blaze::DynamicMatrix<double> m1{
@@ -141,6 +180,7 @@ int main(int argc, char* argv[])
 {
     test_unique_0d();
     test_unique_1d();
+    test_unique_1d_groups();
     test_unique_2d();
     test_unique_2d_x_axis();
     test_unique_2d_y_axis();
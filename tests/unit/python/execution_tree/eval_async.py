@@ -0,0 +1,48 @@
+# Copyright (c) 2020 Hartmut Kaiser
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+import asyncio
+import numpy as np
+from phylanx import Phylanx
+
+
+@Phylanx
+def add(a, b):
+    return a + b
+
+
+a = np.array([[1.0, 2.0], [3.0, 4.0]])
+b = np.array([[5.0, 6.0], [7.0, 8.0]])
+expected = a + b
+
+# decorated functions
+f1 = add.submit(a, b)
+f2 = add.submit(b, a)
+assert (f1.result() == expected).all()
+assert (f2.result(timeout=60) == expected).all()
+assert f1.done()
+
+# the arguments may be modified while the evaluation is in flight
+c = a.copy()
+f3 = add.submit(c, b)
+c[0, 0] = 42.0
+assert (f3.result() == expected).all()
+
+# lazily bound functions
+f4 = add.lazy(a, b).submit()
+assert (f4.result() == expected).all()
+
+# concurrent.futures
+assert (add.submit(a, b).as_concurrent_future().result() == expected).all()
+
+
+# asyncio
+async def run():
+    return await add.submit(a, b)
+
+
+loop = asyncio.new_event_loop()
+assert (loop.run_until_complete(run()) == expected).all()
+loop.close()
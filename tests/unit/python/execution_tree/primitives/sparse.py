@@ -0,0 +1,30 @@
+#  Copyright (c) 2020 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+import phylanx
+from phylanx import PhylanxSession
+import numpy as np
+
+PhylanxSession.init(1)
+
+et = phylanx.execution_tree
+cs = et.compiler_state('global', __name__)
+
+# sparse results are returned to Python as dense numpy arrays
+v = et.eval(cs, "sparse([0.0, 1.0, 0.0, 2.0])")
+assert isinstance(v, np.ndarray)
+assert (v == np.array([0.0, 1.0, 0.0, 2.0])).all()
+
+m = et.eval(cs, "sparse([[1.0, 0.0], [0.0, 2.0], [0.0, 0.0]])")
+assert isinstance(m, np.ndarray)
+assert m.shape == (3, 2)
+assert (m == np.array([[1.0, 0.0], [0.0, 2.0], [0.0, 0.0]])).all()
+
+# results of operations preserving the sparse storage
+t = et.eval(cs, "transpose(sparse([[1.0, 0.0], [0.0, 2.0], [0.0, 0.0]]))")
+assert (t == np.array([[1.0, 0.0, 0.0], [0.0, 2.0, 0.0]])).all()
+
+s = et.eval(cs, "sparse([[1.0, 0.0], [0.0, 2.0]]) * 3.0")
+assert (s == np.array([[3.0, 0.0], [0.0, 6.0]])).all()
@@ -0,0 +1,134 @@
+//  Copyright (c) 2021 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/distributed_matrix.hpp>
+
+#include <hpx/barrier.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
+
+///////////////////////////////////////////////////////////////////////////////
+blaze::DynamicMatrix<double> local_part(std::size_t locality_id)
+{
+    blaze::DynamicMatrix<double> m(4, 7);
+    for (std::size_t i = 0; i != m.rows(); ++i)
+    {
+        for (std::size_t j = 0; j != m.columns(); ++j)
+        {
+            m(i, j) = double(100 * locality_id + 10 * i + j);
+        }
+    }
+    return m;
+}
+
+// the parts of the other locality are sent without their padding
+void test_fetch()
+{
+    std::size_t const locality_id = hpx::get_locality_id();
+    std::size_t const other = 1 - locality_id;
+
+    phylanx::ir::node_data<double> data{local_part(locality_id)};
+
+    std::int64_t transferred_bytes = 0;
+    phylanx::util::distributed_matrix<double> m("test_fetch", data.matrix(),
+        2, locality_id, &transferred_bytes);
+
+    blaze::DynamicMatrix<double> const expected = local_part(other);
+
+    // the whole part
+    HPX_TEST(m.fetch(other).get() == expected);
+    HPX_TEST_EQ(transferred_bytes, std::int64_t(4 * 7 * sizeof(double)));
+
+    // a strided part of the rows
+    HPX_TEST(m.fetch(other, 1, 2, 3, 6).get() ==
+        blaze::submatrix(expected, 1, 2, 2, 4));
+    HPX_TEST_EQ(transferred_bytes, std::int64_t((28 + 8) * sizeof(double)));
+
+    // complete rows, sent as a single block if the rows are not padded
+    HPX_TEST(m.fetch(other, 2, 0, 4, 7).get() ==
+        blaze::submatrix(expected, 2, 0, 2, 7));
+    HPX_TEST_EQ(transferred_bytes, std::int64_t((36 + 14) * sizeof(double)));
+
+    // a single row
+    HPX_TEST(m.fetch(other, 3, 0, 4, 7).get() ==
+        blaze::submatrix(expected, 3, 0, 1, 7));
+
+    // parts of the local matrix are copied, nothing is transferred
+    HPX_TEST(m.fetch(locality_id).get() == local_part(locality_id));
+    HPX_TEST(m.fetch(locality_id, 1, 2, 3, 6).get() ==
+        blaze::submatrix(local_part(locality_id), 1, 2, 2, 4));
+    HPX_TEST_EQ(transferred_bytes, std::int64_t((50 + 7) * sizeof(double)));
+
+    // keep the local part alive until the other locality is done
+    hpx::lcos::barrier b("barrier_test_distributed_matrix_fetch", 2,
+        locality_id);
+    b.wait();
+}
+
+// the results of the fetch actions are serialized after the actions have
+// returned, they must not refer to the elements of the part, which may be
+// overwritten or destroyed by then
+void test_fetch_result_ownership()
+{
+    using server_type = phylanx::util::server::distributed_matrix_part<double>;
+    using transfer_type = server_type::transfer_type;
+
+    phylanx::ir::node_data<double> data{local_part(0)};
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oar(buffer);
+    {
+        server_type part(data.matrix());
+
+        transfer_type whole = part.fetch();
+        transfer_type sub = part.fetch_part(1, 2, 3, 6);
+
+        auto elements = data.matrix();
+        elements = -1.0;
+
+        oar << whole << sub;
+    }
+
+    hpx::serialization::input_archive iar(buffer, oar.bytes_written());
+    transfer_type whole, sub;
+    iar >> whole >> sub;
+
+    blaze::DynamicMatrix<double> const expected = local_part(0);
+    HPX_TEST(std::move(whole).get() == expected);
+    HPX_TEST(std::move(sub).get() == blaze::submatrix(expected, 1, 2, 2, 4));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_fetch();
+    test_fetch_result_ownership();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2021 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/serialization/submatrix.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+using transfer_type = phylanx::util::submatrix_transfer<double>;
+using unpadded_matrix =
+    blaze::CustomMatrix<double, blaze::unaligned, blaze::unpadded>;
+
+///////////////////////////////////////////////////////////////////////////////
+// every element (including the padding) gets a distinct value
+void fill(double* data, std::size_t size)
+{
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = double(i);
+    }
+}
+
+// serialize the source and deserialize it into the destination
+void transfer(transfer_type const& source, transfer_type& destination)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oar(buffer);
+    oar << source;
+
+    hpx::serialization::input_archive iar(buffer, oar.bytes_written());
+    iar >> destination;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the rows of a strided source are sent one by one
+void test_strided_source()
+{
+    std::vector<double> data(5 * 8);
+    fill(data.data(), data.size());
+    unpadded_matrix m(data.data(), 5, 7, 8);
+
+    transfer_type received;
+    transfer(transfer_type{m, 1, 2, 3, 4}, received);
+
+    HPX_TEST_EQ(received.rows(), std::size_t(3));
+    HPX_TEST_EQ(received.columns(), std::size_t(4));
+    HPX_TEST_EQ(received.size_in_bytes(), 3 * 4 * sizeof(double));
+
+    blaze::DynamicMatrix<double> expected = blaze::submatrix(m, 1, 2, 3, 4);
+    HPX_TEST(std::move(received).get() == expected);
+}
+
+// a contiguous block is received into a padded destination through a
+// bounce buffer, the padding is not touched
+void test_contiguous_source_padded_destination()
+{
+    std::vector<double> data(3 * 5);
+    fill(data.data(), data.size());
+    unpadded_matrix m(data.data(), 3, 5);
+
+    std::vector<double> dest_data(3 * 8, -1.0);
+    unpadded_matrix dest(dest_data.data(), 3, 5, 8);
+
+    transfer_type received = transfer_type::destination(dest);
+    transfer(transfer_type{m}, received);
+
+    HPX_TEST(dest == m);
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        for (std::size_t j = 5; j != 8; ++j)
+        {
+            HPX_TEST_EQ(dest_data[i * 8 + j], -1.0);
+        }
+    }
+}
+
+// the destination has to have the dimensions of the received matrix
+void test_dimension_mismatch()
+{
+    blaze::DynamicMatrix<double> m(3, 5, 1.0);
+    blaze::DynamicMatrix<double> dest(2, 5, 0.0);
+
+    transfer_type received = transfer_type::destination(dest);
+
+    bool caught_exception = false;
+    try
+    {
+        transfer(transfer_type{m}, received);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Matrix>
+void test_round_trip(Matrix const& m)
+{
+    // received into newly allocated storage
+    transfer_type received;
+    transfer(transfer_type{m}, received);
+    HPX_TEST(std::move(received).get() == m);
+
+    // received into a padded matrix
+    blaze::DynamicMatrix<double> padded(m.rows(), m.columns(), 0.0);
+    transfer_type padded_received = transfer_type::destination(padded);
+    transfer(transfer_type{m}, padded_received);
+    HPX_TEST(padded == m);
+
+    // received into an unpadded matrix
+    std::vector<double> data(m.rows() * m.columns(), 0.0);
+    unpadded_matrix unpadded(data.data(), m.rows(), m.columns());
+    transfer_type unpadded_received = transfer_type::destination(unpadded);
+    transfer(transfer_type{m}, unpadded_received);
+    HPX_TEST(unpadded == m);
+}
+
+void test_round_trips()
+{
+    blaze::DynamicMatrix<double> padded(4, 7);
+    for (std::size_t i = 0; i != padded.rows(); ++i)
+    {
+        for (std::size_t j = 0; j != padded.columns(); ++j)
+        {
+            padded(i, j) = double(10 * i + j);
+        }
+    }
+    test_round_trip(padded);
+
+    std::vector<double> data(4 * 7);
+    fill(data.data(), data.size());
+    test_round_trip(unpadded_matrix(data.data(), 4, 7));
+
+    // single rows are sent as a single block
+    test_round_trip(blaze::DynamicMatrix<double>(1, 7, 2.0));
+    test_round_trip(unpadded_matrix(data.data(), 1, 7));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_strided_source();
+    test_contiguous_source_padded_destination();
+    test_dimension_mismatch();
+    test_round_trips();
+
+    return hpx::util::report_errors();
+}